@@ -0,0 +1,91 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "include/diagnostic_client_config.h"
+#include "parser/json_parser.h"
+#include "src/dcm/config_parser/config_parser_type.h"
+#include "src/dcm/config_parser/json_config_reader.h"
+
+namespace diag {
+namespace client {
+namespace {
+
+/**
+ * @brief    Temporary file the configuration is written to, as needed to use the property tree
+ */
+constexpr char const *kTemporaryConfigPath{"config_reader_benchmark.json"};
+
+/**
+ * @brief    Function to generate a configuration with the given number of conversations
+ */
+auto GenerateConfig(std::size_t conversation_count) -> std::string {
+  std::string config{R"({"UdpIpAddress": "172.16.25.127", "UdpBroadcastAddress": "172.16.255.255", "Conversation": )"
+                     R"({"NumberOfConversation": 255, "ConversationProperty": [)"};
+  for (std::size_t index{0U}; index < conversation_count; ++index) {
+    if (index != 0U) { config.append(","); }
+    config.append("\n  {\"P2ClientMax\": 1000, \"P2StarClientMax\": 5000, \"RxBufferSize\": 4095, \"SourceAddress\": ")
+        .append(std::to_string(index + 1U))
+        .append(", \"TargetAddressType\": \"Physical\", \"Network\": {\"ProtocolKind\": \"DoIP\", \"TcpIpAddress\": "
+                "\"172.16.25.127\", \"TLS\": false}, \"ConversationName\": \"DiagTester")
+        .append(std::to_string(index))
+        .append("\"}");
+  }
+  config.append("]}}");
+  return config;
+}
+
+/**
+ * @brief    Generated configuration is written to a temporary file and read with the property tree
+ */
+void BM_ReadConfigPropertyTree(benchmark::State &state) {
+  std::string const content{GenerateConfig(static_cast<std::size_t>(state.range(0)))};
+  for (auto _: state) {
+    std::ofstream{kTemporaryConfigPath} << content;
+    boost_support::parser::boost_tree config_tree{};
+    if (!boost_support::parser::Read(kTemporaryConfigPath, config_tree).HasValue()) {
+      state.SkipWithError("Reading temporary file failed");
+      break;
+    }
+    config_parser::DcmClientConfig config{config_parser::ReadDcmClientConfig(config_tree)};
+    benchmark::DoNotOptimize(config);
+  }
+  std::remove(kTemporaryConfigPath);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_ReadConfigPropertyTree)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief    Generated configuration is read in memory in a single pass
+ */
+void BM_ReadConfigStreaming(benchmark::State &state) {
+  std::string const content{GenerateConfig(static_cast<std::size_t>(state.range(0)))};
+  for (auto _: state) {
+    auto config{config_parser::ReadDcmClientConfig(config::JsonConfig{content})};
+    if (!config.HasValue()) {
+      state.SkipWithError("Reading configuration failed");
+      break;
+    }
+    benchmark::DoNotOptimize(config);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_ReadConfigStreaming)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace client
+}  // namespace diag
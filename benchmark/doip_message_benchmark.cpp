@@ -0,0 +1,83 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/doip_message.h"
+#include "core/include/endian_codec.h"
+
+namespace doip_client {
+namespace {
+
+/**
+ * @brief    Ip address and port of the sender as passed by the sockets
+ */
+constexpr DoipMessage::IpAddressType kHostIpAddress{"172.16.25.128"};
+constexpr std::uint16_t kHostPortNumber{13400U};
+
+/**
+ * @brief    Create a received diagnostic message with the uds response 62 F1 90 and VIN
+ */
+auto CreateDiagnosticMessage() -> std::vector<std::uint8_t> {
+  std::vector<std::uint8_t> message{0x02U, 0xFDU};
+  core_type::AppendBigEndian(message, std::uint16_t{0x8001U});
+  core_type::AppendBigEndian(message, std::uint32_t{4U + 3U + 17U});
+  core_type::AppendBigEndian(message, std::uint16_t{0x1001U});
+  core_type::AppendBigEndian(message, std::uint16_t{0x0E80U});
+  message.insert(message.end(), {0x62U, 0xF1U, 0x90U});
+  message.insert(message.end(), 17U, 0x41U);
+  return message;
+}
+
+/**
+ * @brief    Create a received vehicle announcement
+ */
+auto CreateVehicleAnnouncement() -> std::vector<std::uint8_t> {
+  std::vector<std::uint8_t> message{0x02U, 0xFDU};
+  core_type::AppendBigEndian(message, std::uint16_t{0x0004U});
+  core_type::AppendBigEndian(message, std::uint32_t{33U});
+  message.insert(message.end(), 33U, 0x41U);
+  return message;
+}
+
+/**
+ * @brief    Generic header, source and target address of a tcp message are decoded
+ */
+void BM_DoipMessageTcpDecode(benchmark::State &state) {
+  std::vector<std::uint8_t> buffer{CreateDiagnosticMessage()};
+  for (auto _: state) {
+    DoipMessage const message{DoipMessage::MessageType::kTcp, kHostIpAddress, kHostPortNumber,
+                              core_type::Span<std::uint8_t>{buffer.data(), buffer.size()}};
+    benchmark::DoNotOptimize(message.GetPayloadType());
+    benchmark::DoNotOptimize(message.GetServerAddress());
+    benchmark::DoNotOptimize(message.GetPayload().size());
+  }
+}
+
+BENCHMARK(BM_DoipMessageTcpDecode);
+
+/**
+ * @brief    Generic header of a udp message is decoded
+ */
+void BM_DoipMessageUdpDecode(benchmark::State &state) {
+  std::vector<std::uint8_t> buffer{CreateVehicleAnnouncement()};
+  for (auto _: state) {
+    DoipMessage const message{DoipMessage::MessageType::kUdp, kHostIpAddress, kHostPortNumber,
+                              core_type::Span<std::uint8_t>{buffer.data(), buffer.size()}};
+    benchmark::DoNotOptimize(message.GetPayloadLength());
+    benchmark::DoNotOptimize(message.GetPayload().size());
+  }
+}
+
+BENCHMARK(BM_DoipMessageUdpDecode);
+
+}  // namespace
+}  // namespace doip_client
@@ -0,0 +1,101 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/include/endian_codec.h"
+
+namespace core_type {
+namespace {
+
+/**
+ * @brief    Size of a DoIP generic header
+ */
+constexpr std::size_t kHeaderSize{8U};
+
+/**
+ * @brief    Number of headers decoded per iteration
+ */
+constexpr std::size_t kHeaderCount{1024U};
+
+/**
+ * @brief    Create a buffer of consecutive DoIP generic headers with varying payload length
+ */
+auto CreateHeaders() -> std::vector<std::uint8_t> {
+  std::vector<std::uint8_t> headers{};
+  headers.reserve(kHeaderSize * kHeaderCount);
+  for (std::uint32_t index{0U}; index < kHeaderCount; ++index) {
+    headers.emplace_back(0x02U);
+    headers.emplace_back(0xFDU);
+    AppendBigEndian(headers, std::uint16_t{0x8001U});
+    AppendBigEndian(headers, index);
+  }
+  return headers;
+}
+
+/**
+ * @brief    Decode the payload length as done by hand before the codec existed
+ */
+void BM_DecodeLengthShiftAndMask(benchmark::State &state) {
+  std::vector<std::uint8_t> const headers{CreateHeaders()};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    for (std::size_t offset{0U}; offset < headers.size(); offset += kHeaderSize) {
+      sum += ((static_cast<std::uint32_t>(headers[offset + 4U] << 24U) & 0xFF000000) |
+              (static_cast<std::uint32_t>(headers[offset + 5U] << 16U) & 0x00FF0000) |
+              (static_cast<std::uint32_t>(headers[offset + 6U] << 8U) & 0x0000FF00) |
+              (static_cast<std::uint32_t>(headers[offset + 7U] & 0x000000FF)));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kHeaderCount));
+}
+BENCHMARK(BM_DecodeLengthShiftAndMask);
+
+/**
+ * @brief    Decode the payload length with the bounds-checked reader of the codec
+ */
+void BM_DecodeLengthCodec(benchmark::State &state) {
+  std::vector<std::uint8_t> const headers{CreateHeaders()};
+  Span<std::uint8_t const> const buffer{headers};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    for (std::size_t offset{0U}; offset < headers.size(); offset += kHeaderSize) {
+      sum += ReadBigEndian<std::uint32_t>(buffer, offset + 4U).value_or(0U);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kHeaderCount));
+}
+BENCHMARK(BM_DecodeLengthCodec);
+
+/**
+ * @brief    Encode DoIP generic headers with the codec into a reused buffer
+ */
+void BM_EncodeHeaderCodec(benchmark::State &state) {
+  std::vector<std::uint8_t> headers(kHeaderSize * kHeaderCount);
+  Span<std::uint8_t> const buffer{headers};
+  for (auto _: state) {
+    for (std::size_t index{0U}; index < kHeaderCount; ++index) {
+      std::size_t const offset{index * kHeaderSize};
+      (void) WriteBigEndian(buffer, offset + 2U, std::uint16_t{0x8001U});
+      (void) WriteBigEndian(buffer, offset + 4U, static_cast<std::uint32_t>(index));
+    }
+    benchmark::DoNotOptimize(headers.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kHeaderCount));
+}
+BENCHMARK(BM_EncodeHeaderCodec);
+
+}  // namespace
+}  // namespace core_type
@@ -0,0 +1,99 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "utility/inline_function.h"
+
+namespace utility {
+namespace function {
+namespace {
+
+/**
+ * @brief    Inline function with the signature of benchmarked handlers
+ */
+using Handler = InlineFunction<std::uint64_t(std::uint64_t), kDefaultInlineCapacity>;
+
+/**
+ * @brief    Capture of four pointers, as a socket read handler capturing its owner and a few references
+ */
+using Capture = std::array<std::uint64_t const *, 4U>;
+
+/**
+ * @brief    std::function holding a small lambda is called
+ */
+void BM_StdFunctionCall(benchmark::State &state) {
+  std::uint64_t offset{1U};
+  std::function<std::uint64_t(std::uint64_t)> function{[&offset](std::uint64_t value) { return value + offset; }};
+  std::uint64_t value{0U};
+  for (auto _: state) {
+    value = function(value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BM_StdFunctionCall);
+
+/**
+ * @brief    Inline function holding a small lambda is called
+ */
+void BM_InlineFunctionCall(benchmark::State &state) {
+  std::uint64_t offset{1U};
+  Handler function{[&offset](std::uint64_t value) { return value + offset; }};
+  std::uint64_t value{0U};
+  for (auto _: state) {
+    value = function(value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BM_InlineFunctionCall);
+
+/**
+ * @brief    std::function is constructed with a capture beyond its small buffer, moved and called
+ */
+void BM_StdFunctionConstructMoveCall(benchmark::State &state) {
+  std::uint64_t offset{1U};
+  Capture const capture{&offset, &offset, &offset, &offset};
+  std::uint64_t value{0U};
+  for (auto _: state) {
+    std::function<std::uint64_t(std::uint64_t)> function{
+        [capture](std::uint64_t input) { return input + *capture[0U] + *capture[3U]; }};
+    std::function<std::uint64_t(std::uint64_t)> moved{std::move(function)};
+    value = moved(value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BM_StdFunctionConstructMoveCall);
+
+/**
+ * @brief    Inline function is constructed with the same capture, moved and called
+ */
+void BM_InlineFunctionConstructMoveCall(benchmark::State &state) {
+  std::uint64_t offset{1U};
+  Capture const capture{&offset, &offset, &offset, &offset};
+  std::uint64_t value{0U};
+  for (auto _: state) {
+    Handler function{[capture](std::uint64_t input) { return input + *capture[0U] + *capture[3U]; }};
+    Handler moved{std::move(function)};
+    value = moved(value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BM_InlineFunctionConstructMoveCall);
+
+}  // namespace
+}  // namespace function
+}  // namespace utility
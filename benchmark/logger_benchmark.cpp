@@ -0,0 +1,152 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "utility/logger.h"
+#ifdef ENABLE_ASYNC_LOGGER
+#include "utility/async_log_backend.h"
+#endif
+
+namespace utility {
+namespace logger {
+namespace {
+
+#ifdef ENABLE_ASYNC_LOGGER
+/**
+ * @brief    Log sink discarding every line, so that only the cost of the log site is measured
+ */
+class NullLogSink final : public LogSink {
+ public:
+  void Write(std::string_view line) noexcept override { benchmark::DoNotOptimize(line.data()); }
+
+  void Flush() noexcept override {}
+};
+#endif
+
+/**
+ * @brief    Get the logger used by all benchmarks
+ */
+auto GetBenchmarkLogger() noexcept -> Logger & {
+  static Logger logger{"bnch"};
+#ifdef ENABLE_ASYNC_LOGGER
+  static bool const sink_installed{[]() {
+    AsyncLogBackend::GetInstance().SetSink(std::make_unique<NullLogSink>());
+    return true;
+  }()};
+  benchmark::DoNotOptimize(sink_installed);
+#endif
+  return logger;
+}
+
+/**
+ * @brief    Drain the rings of the asynchronous backend outside of the measured time, so that records are not dropped
+ */
+void DrainPeriodically(benchmark::State &state, std::size_t &iteration) {
+#ifdef ENABLE_ASYNC_LOGGER
+  if ((++iteration % (AsyncLogBackend::kRingCapacity / 2U)) == 0U) {
+    state.PauseTiming();
+    AsyncLogBackend::GetInstance().Flush();
+    state.ResumeTiming();
+  }
+#else
+  UNUSED_PARAM(state);
+  UNUSED_PARAM(iteration);
+#endif
+}
+
+/**
+ * @brief    Set the label telling whether the measured level is compiled in
+ */
+void SetCompiledLabel(benchmark::State &state) {
+  state.SetLabel(IsLogLevelCompiled(LogLevel::kDebug) ? "debug compiled in" : "debug compiled out");
+}
+
+// Log site with stringstream functor, level disabled at runtime
+void BM_LogFunctorDisabled(benchmark::State &state) {
+  Logger &logger{GetBenchmarkLogger()};
+  logger.SetLogLevel(LogLevel::kInfo);
+  std::string const ip_address{"172.16.25.128"};
+  std::uint16_t port{13400U};
+  for (auto _: state) {
+    logger.LogDebug(__FILE__, __LINE__, __func__, [&ip_address, port](std::stringstream &msg) {
+      msg << "Tcp message sent to <" << ip_address << "," << port << ">";
+    });
+    benchmark::DoNotOptimize(port);
+  }
+  SetCompiledLabel(state);
+}
+BENCHMARK(BM_LogFunctorDisabled);
+
+// Log site with format string, level disabled at runtime
+void BM_LogFormatDisabled(benchmark::State &state) {
+  Logger &logger{GetBenchmarkLogger()};
+  logger.SetLogLevel(LogLevel::kInfo);
+  std::string const ip_address{"172.16.25.128"};
+  std::uint16_t port{13400U};
+  for (auto _: state) {
+    logger.LogDebug(__FILE__, __LINE__, __func__, "Tcp message sent to <{},{}>", ip_address, port);
+    benchmark::DoNotOptimize(port);
+  }
+  SetCompiledLabel(state);
+}
+BENCHMARK(BM_LogFormatDisabled);
+
+// Log site with stringstream functor, level enabled
+void BM_LogFunctorEnabled(benchmark::State &state) {
+  Logger &logger{GetBenchmarkLogger()};
+  logger.SetLogLevel(LogLevel::kVerbose);
+  std::string const ip_address{"172.16.25.128"};
+  std::uint16_t port{13400U};
+  std::size_t iteration{0U};
+  for (auto _: state) {
+    logger.LogDebug(__FILE__, __LINE__, __func__, [&ip_address, port](std::stringstream &msg) {
+      msg << "Tcp message sent to <" << ip_address << "," << port << ">";
+    });
+    benchmark::DoNotOptimize(port);
+    DrainPeriodically(state, iteration);
+  }
+  SetCompiledLabel(state);
+}
+BENCHMARK(BM_LogFunctorEnabled);
+
+// Log site with format string, level enabled
+void BM_LogFormatEnabled(benchmark::State &state) {
+  Logger &logger{GetBenchmarkLogger()};
+  logger.SetLogLevel(LogLevel::kVerbose);
+  std::string const ip_address{"172.16.25.128"};
+  std::uint16_t port{13400U};
+  std::size_t iteration{0U};
+  for (auto _: state) {
+    logger.LogDebug(__FILE__, __LINE__, __func__, "Tcp message sent to <{},{}>", ip_address, port);
+    benchmark::DoNotOptimize(port);
+    DrainPeriodically(state, iteration);
+  }
+  SetCompiledLabel(state);
+}
+BENCHMARK(BM_LogFormatEnabled);
+
+// Cost of the format string rendering used by the Dlt backend, without any backend involved
+void BM_FormatTo(benchmark::State &state) {
+  std::string const ip_address{"172.16.25.128"};
+  std::uint16_t port{13400U};
+  std::string line{};
+  for (auto _: state) {
+    line.clear();
+    format::FormatTo(line, "Tcp message sent to <{},{}>", ip_address, port);
+    benchmark::DoNotOptimize(line.data());
+  }
+}
+BENCHMARK(BM_FormatTo);
+
+}  // namespace
+}  // namespace logger
+}  // namespace utility
@@ -0,0 +1,107 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "socket/tcp/tcp_message.h"
+#include "utility/object_pool.h"
+
+namespace {
+
+/**
+ * @brief    Number of calls to global operator new, to report the allocation rate
+ */
+std::atomic<std::uint64_t> global_allocation_count{0U};
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  global_allocation_count.fetch_add(1U, std::memory_order_relaxed);
+  void *const memory{std::malloc(size == 0U ? 1U : size)};
+  if (memory == nullptr) { throw std::bad_alloc{}; }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+
+namespace utility {
+namespace memory {
+namespace {
+
+using boost_support::socket::tcp::TcpMessage;
+
+/**
+ * @brief    Tcp message allocated from the heap, as before the object pool
+ */
+struct HeapTcpMessage {
+  TcpMessage message;
+};
+
+/**
+ * @brief    Set the counter of global allocations per iteration
+ */
+void SetAllocationRate(benchmark::State &state, std::uint64_t allocation_count_before) {
+  state.counters["allocs_per_iter"] = benchmark::Counter(
+      static_cast<double>(global_allocation_count.load(std::memory_order_relaxed) - allocation_count_before),
+      benchmark::Counter::kAvgIterations);
+}
+
+// Tcp message created and destroyed with the heap
+void BM_TcpMessageHeap(benchmark::State &state) {
+  std::uint64_t const allocation_count_before{global_allocation_count.load(std::memory_order_relaxed)};
+  for (auto _: state) {
+    std::unique_ptr<HeapTcpMessage> message{std::make_unique<HeapTcpMessage>()};
+    benchmark::DoNotOptimize(message.get());
+  }
+  SetAllocationRate(state, allocation_count_before);
+}
+BENCHMARK(BM_TcpMessageHeap);
+
+// Tcp message created and destroyed with the pool behind TcpMessagePtr
+void BM_TcpMessagePool(benchmark::State &state) {
+  std::uint64_t const allocation_count_before{global_allocation_count.load(std::memory_order_relaxed)};
+  for (auto _: state) {
+    boost_support::socket::tcp::TcpMessagePtr message{std::make_unique<TcpMessage>()};
+    benchmark::DoNotOptimize(message.get());
+  }
+  SetAllocationRate(state, allocation_count_before);
+}
+BENCHMARK(BM_TcpMessagePool);
+
+// Tcp message created and destroyed concurrently with the pool behind TcpMessagePtr
+void BM_TcpMessagePoolContended(benchmark::State &state) {
+  for (auto _: state) {
+    boost_support::socket::tcp::TcpMessagePtr message{std::make_unique<TcpMessage>()};
+    benchmark::DoNotOptimize(message.get());
+  }
+}
+BENCHMARK(BM_TcpMessagePoolContended)->Threads(4);
+
+// Object created and destroyed with the custom deleter of a pool
+void BM_ObjectPoolMake(benchmark::State &state) {
+  static ObjectPool<std::uint64_t, 16U> pool{};
+  std::uint64_t const allocation_count_before{global_allocation_count.load(std::memory_order_relaxed)};
+  for (auto _: state) {
+    ObjectPool<std::uint64_t, 16U>::UniquePtr value{pool.Make(std::uint64_t{42U})};
+    benchmark::DoNotOptimize(value.get());
+  }
+  SetAllocationRate(state, allocation_count_before);
+}
+BENCHMARK(BM_ObjectPoolMake);
+
+}  // namespace
+}  // namespace memory
+}  // namespace utility
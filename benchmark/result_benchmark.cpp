@@ -0,0 +1,196 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/include/error_code.h"
+#include "core/include/result.h"
+
+namespace core_type {
+namespace {
+
+/**
+ * @brief    Number of inputs passed through the chain per iteration
+ */
+constexpr std::size_t kInputCount{1024U};
+
+/**
+ * @brief    Every n-th input fails in one of the steps
+ */
+constexpr std::uint32_t kFailureInterval{16U};
+
+/**
+ * @brief    Plain error code as returned by the socket layer
+ */
+enum class SocketErrc : std::uint8_t { kOk, kOpenFailed, kConnectFailed, kSendFailed };
+
+/**
+ * @brief    Error domain to benchmark ErrorCode, mirrors the domains of the library
+ */
+class BenchmarkErrorDomain final : public ErrorDomain {
+ public:
+  constexpr BenchmarkErrorDomain() noexcept : ErrorDomain{0x5000000000000FFEU} {}
+
+  const char *Name() const noexcept override { return "BenchmarkErrorDomain"; }
+
+  const char *Message(CodeType) noexcept override { return "benchmark error"; }
+};
+
+BenchmarkErrorDomain benchmark_error_domain{};
+
+auto CreateInputs() -> std::vector<std::uint32_t> {
+  std::vector<std::uint32_t> inputs(kInputCount);
+  for (std::size_t index{0U}; index < kInputCount; ++index) { inputs[index] = static_cast<std::uint32_t>(index); }
+  return inputs;
+}
+
+/**
+ * @brief    Steps of an open/connect/transmit sequence with plain error codes and an output parameter
+ */
+inline auto OpenPlain(std::uint32_t input, std::uint32_t &handle) noexcept -> SocketErrc {
+  handle = input + 1U;
+  return (input % kFailureInterval) == 1U ? SocketErrc::kOpenFailed : SocketErrc::kOk;
+}
+
+inline auto ConnectPlain(std::uint32_t handle, std::uint32_t &connection) noexcept -> SocketErrc {
+  connection = handle * 3U;
+  return (handle % kFailureInterval) == 3U ? SocketErrc::kConnectFailed : SocketErrc::kOk;
+}
+
+inline auto TransmitPlain(std::uint32_t connection, std::uint32_t &sent) noexcept -> SocketErrc {
+  sent = connection ^ 0x5AU;
+  return (connection % kFailureInterval) == 5U ? SocketErrc::kSendFailed : SocketErrc::kOk;
+}
+
+/**
+ * @brief    The same steps returning Result
+ */
+inline auto Open(std::uint32_t input) noexcept -> Result<std::uint32_t, SocketErrc> {
+  return (input % kFailureInterval) == 1U ? Result<std::uint32_t, SocketErrc>::FromError(SocketErrc::kOpenFailed)
+                                          : Result<std::uint32_t, SocketErrc>::FromValue(input + 1U);
+}
+
+inline auto Connect(std::uint32_t handle) noexcept -> Result<std::uint32_t, SocketErrc> {
+  return (handle % kFailureInterval) == 3U ? Result<std::uint32_t, SocketErrc>::FromError(SocketErrc::kConnectFailed)
+                                           : Result<std::uint32_t, SocketErrc>::FromValue(handle * 3U);
+}
+
+inline auto Transmit(std::uint32_t connection) noexcept -> Result<std::uint32_t, SocketErrc> {
+  return (connection % kFailureInterval) == 5U ? Result<std::uint32_t, SocketErrc>::FromError(SocketErrc::kSendFailed)
+                                               : Result<std::uint32_t, SocketErrc>::FromValue(connection ^ 0x5AU);
+}
+
+/**
+ * @brief    Sequence with plain error codes, checked after every step
+ */
+void BM_PlainErrorCode(benchmark::State &state) {
+  std::vector<std::uint32_t> const inputs{CreateInputs()};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    std::uint32_t failures{0U};
+    for (std::uint32_t const input: inputs) {
+      std::uint32_t handle{};
+      std::uint32_t connection{};
+      std::uint32_t sent{};
+      if ((OpenPlain(input, handle) == SocketErrc::kOk) && (ConnectPlain(handle, connection) == SocketErrc::kOk) &&
+          (TransmitPlain(connection, sent) == SocketErrc::kOk)) {
+        sum += sent;
+      } else {
+        ++failures;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(failures);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kInputCount));
+}
+BENCHMARK(BM_PlainErrorCode);
+
+/**
+ * @brief    Sequence with Result, checked after every step
+ */
+void BM_ResultHasValue(benchmark::State &state) {
+  std::vector<std::uint32_t> const inputs{CreateInputs()};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    std::uint32_t failures{0U};
+    for (std::uint32_t const input: inputs) {
+      Result<std::uint32_t, SocketErrc> result{Open(input)};
+      if (result.HasValue()) { result = Connect(result.Value()); }
+      if (result.HasValue()) { result = Transmit(result.Value()); }
+      if (result.HasValue()) {
+        sum += result.Value();
+      } else {
+        ++failures;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(failures);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kInputCount));
+}
+BENCHMARK(BM_ResultHasValue);
+
+/**
+ * @brief    Sequence with Result, chained with the monadic operations
+ */
+void BM_ResultAndThenChain(benchmark::State &state) {
+  std::vector<std::uint32_t> const inputs{CreateInputs()};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    std::uint32_t failures{0U};
+    for (std::uint32_t const input: inputs) {
+      Result<std::uint32_t, SocketErrc> const result{
+          Open(input)
+              .AndThen([](std::uint32_t handle) { return Connect(handle); })
+              .AndThen([](std::uint32_t connection) { return Transmit(connection); })};
+      if (result.HasValue()) {
+        sum += result.Value();
+      } else {
+        ++failures;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(failures);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kInputCount));
+}
+BENCHMARK(BM_ResultAndThenChain);
+
+/**
+ * @brief    Sequence with Result<void> carrying ErrorCode, as used by the socket handler
+ */
+void BM_ResultVoidErrorCode(benchmark::State &state) {
+  std::vector<std::uint32_t> const inputs{CreateInputs()};
+  for (auto _: state) {
+    std::uint64_t sum{0U};
+    std::uint32_t failures{0U};
+    for (std::uint32_t const input: inputs) {
+      Result<void> const result{
+          Open(input)
+              .AndThen([](std::uint32_t handle) { return Connect(handle); })
+              .AndThen([](std::uint32_t connection) { return Transmit(connection); })
+              .AndThen([&sum](std::uint32_t sent) { sum += sent; })
+              .MapError([](SocketErrc error) {
+                return ErrorCode{static_cast<ErrorDomain::CodeType>(error), benchmark_error_domain};
+              })};
+      if (!result.HasValue()) { ++failures; }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(failures);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kInputCount));
+}
+BENCHMARK(BM_ResultVoidErrorCode);
+
+}  // namespace
+}  // namespace core_type
@@ -0,0 +1,88 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "socket/io_context.h"
+#include "socket/tcp/tcp_client.h"
+
+namespace boost_support {
+namespace socket {
+namespace {
+
+/**
+ * @brief    Loopback address used by client and server
+ */
+constexpr std::string_view kLoopbackAddress{"127.0.0.1"};
+
+/**
+ * @brief    Function to get the number of threads of this process
+ */
+auto GetThreadCount() -> std::size_t {
+  return static_cast<std::size_t>(std::distance(std::filesystem::directory_iterator{"/proc/self/task"},
+                                                std::filesystem::directory_iterator{}));
+}
+
+/**
+ * @brief    Tcp client sockets are opened and connected to a loopback server, all of them share one event loop
+ */
+void BM_ConnectTcpSockets(benchmark::State &state) {
+  std::size_t const socket_count{static_cast<std::size_t>(state.range(0))};
+  // server side accepting the connections
+  boost::asio::io_context server_context{};
+  boost::asio::ip::tcp::acceptor acceptor{
+      server_context,
+      boost::asio::ip::tcp::endpoint{boost::asio::ip::make_address(std::string{kLoopbackAddress}), 0U}};
+  acceptor.listen(static_cast<int>(socket_count));
+  std::uint16_t const server_port{acceptor.local_endpoint().port()};
+
+  IoContext io_context{};
+  std::thread io_thread{[&io_context]() { io_context.Run(); }};
+
+  std::size_t const threads_before{GetThreadCount()};
+  std::size_t threads_after{threads_before};
+  for (auto _: state) {
+    std::vector<std::unique_ptr<tcp::TcpClientSocket>> tcp_sockets{};
+    tcp_sockets.reserve(socket_count);
+    for (std::size_t index{0U}; index < socket_count; ++index) {
+      tcp::TcpClientSocket &tcp_socket{*tcp_sockets.emplace_back(std::make_unique<tcp::TcpClientSocket>(
+          kLoopbackAddress, 0U, [](tcp::TcpMessagePtr) {}, io_context))};
+      if (!tcp_socket.Open().HasValue() || !tcp_socket.ConnectToHost(kLoopbackAddress, server_port).HasValue()) {
+        state.SkipWithError("Connect failed");
+        break;
+      }
+    }
+
+    state.PauseTiming();
+    threads_after = GetThreadCount();
+    std::vector<boost::asio::ip::tcp::socket> server_sockets{};
+    for (std::size_t index{0U}; index < tcp_sockets.size(); ++index) { server_sockets.push_back(acceptor.accept()); }
+    // the server closes first, it keeps the TIME_WAIT state instead of the local ports of client
+    server_sockets.clear();
+    tcp_sockets.clear();
+    state.ResumeTiming();
+  }
+  state.counters["socket_threads"] = static_cast<double>(threads_after - threads_before);
+
+  io_context.Stop();
+  io_thread.join();
+}
+
+BENCHMARK(BM_ConnectTcpSockets)->Arg(2)->Arg(50)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace socket
+}  // namespace boost_support
@@ -0,0 +1,84 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "include/diagnostic_client_config.h"
+
+namespace diag {
+namespace client {
+namespace {
+
+/**
+ * @brief    Function to get the number of threads of this process
+ */
+auto GetThreadCount() -> std::size_t {
+  return static_cast<std::size_t>(std::distance(std::filesystem::directory_iterator{"/proc/self/task"},
+                                                std::filesystem::directory_iterator{}));
+}
+
+/**
+ * @brief    Diag client is initialized and all configured conversations are started up, none of them is connected
+ */
+void BM_StartupConversations(benchmark::State &state) {
+  std::size_t const conversation_count{static_cast<std::size_t>(state.range(0))};
+  std::vector<std::string> names{};
+  std::vector<config::ConversationConfig> conversations{};
+  names.reserve(conversation_count);
+  for (std::size_t index{0U}; index < conversation_count; ++index) {
+    names.emplace_back("DiagTester" + std::to_string(index));
+  }
+  for (std::size_t index{0U}; index < conversation_count; ++index) {
+    conversations.push_back(config::ConversationConfig{names[index], 1000U, 5000U, 4095U,
+                                                       static_cast<std::uint16_t>(index + 1U), "172.16.25.127"});
+  }
+  config::DiagClientConfig const config{"172.16.25.127", "172.16.255.255",
+                                        core_type::Span<config::ConversationConfig const>{conversations}};
+
+  std::size_t const threads_before{GetThreadCount()};
+  std::size_t threads_after{threads_before};
+  for (auto _: state) {
+    std::unique_ptr<DiagClient> diag_client{CreateDiagnosticClient(config)};
+    if (!diag_client->Initialize().HasValue()) {
+      state.SkipWithError("Initialize failed");
+      break;
+    }
+    // conversations are neither copyable nor movable
+    std::vector<std::unique_ptr<conversation::DiagClientConversation>> diag_client_conversations{};
+    diag_client_conversations.reserve(conversation_count);
+    for (std::string const &name: names) {
+      diag_client_conversations
+          .emplace_back(new conversation::DiagClientConversation{diag_client->GetDiagnosticClientConversation(name)})
+          ->Startup();
+    }
+
+    state.PauseTiming();
+    threads_after = GetThreadCount();
+    for (auto const &diag_client_conversation: diag_client_conversations) { diag_client_conversation->Shutdown(); }
+    diag_client_conversations.clear();
+    static_cast<void>(diag_client->DeInitialize());
+    diag_client.reset();
+    state.ResumeTiming();
+  }
+  state.counters["idle_threads"] = static_cast<double>(threads_after - threads_before);
+}
+
+BENCHMARK(BM_StartupConversations)->Arg(2)->Arg(50)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace client
+}  // namespace diag
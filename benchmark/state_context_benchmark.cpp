@@ -0,0 +1,74 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "utility/state.h"
+
+namespace utility {
+namespace state {
+namespace {
+
+/**
+ * @brief    States of a channel, as the routing activation and diagnostic message states
+ */
+enum class ChannelState : std::uint8_t { kIdle, kWaitForResponse };
+
+/**
+ * @brief    State doing no work on start and stop, so that only the cost of the context is measured
+ */
+class EmptyState final : public State<ChannelState> {
+ public:
+  explicit EmptyState(ChannelState state) : State<ChannelState>{state} {}
+
+  void Start() override {}
+
+  void Stop() override {}
+};
+
+/**
+ * @brief    Create a context with both states, idle is active
+ */
+auto CreateStateContext() -> std::unique_ptr<StateContext<ChannelState>> {
+  auto context{std::make_unique<StateContext<ChannelState>>()};
+  context->AddState(ChannelState::kIdle, std::make_unique<EmptyState>(ChannelState::kIdle));
+  context->AddState(ChannelState::kWaitForResponse, std::make_unique<EmptyState>(ChannelState::kWaitForResponse));
+  context->TransitionTo(ChannelState::kIdle);
+  return context;
+}
+
+/**
+ * @brief    Context transitions to waiting for response and back to idle, as done for every request
+ */
+void BM_StateContextTransition(benchmark::State &state) {
+  auto context{CreateStateContext()};
+  for (auto _: state) {
+    context->TransitionTo(ChannelState::kWaitForResponse);
+    context->TransitionTo(ChannelState::kIdle);
+  }
+  benchmark::DoNotOptimize(context->GetActiveState().GetState());
+}
+
+BENCHMARK(BM_StateContextTransition);
+
+/**
+ * @brief    Active state is queried, as done for every received message
+ */
+void BM_StateContextGetActiveState(benchmark::State &state) {
+  auto context{CreateStateContext()};
+  for (auto _: state) { benchmark::DoNotOptimize(context->GetActiveState().GetState()); }
+}
+
+BENCHMARK(BM_StateContextGetActiveState);
+
+}  // namespace
+}  // namespace state
+}  // namespace utility
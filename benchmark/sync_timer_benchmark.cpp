@@ -0,0 +1,58 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "utility/sync_timer.h"
+
+namespace utility {
+namespace sync_timer {
+namespace {
+
+/**
+ * @brief    Timeout of the wait, never reached since the wait is cancelled before
+ */
+constexpr std::chrono::milliseconds kTimeout{1000};
+
+/**
+ * @brief    Timer is armed, cancelled by the response and the wait returns at once, as for a request answered before
+ *           the timer thread starts waiting
+ */
+void BM_SyncTimerArmCancelWait(benchmark::State &state) {
+  SyncTimer timer{};
+  std::uint64_t cancel_count{0U};
+  for (auto _: state) {
+    timer.Arm();
+    timer.CancelWait();
+    timer.WaitForTimeout([]() {}, [&cancel_count]() { ++cancel_count; }, kTimeout);
+  }
+  benchmark::DoNotOptimize(cancel_count);
+}
+
+BENCHMARK(BM_SyncTimerArmCancelWait);
+
+/**
+ * @brief    Timer is armed and cancelled without a waiting thread
+ */
+void BM_SyncTimerArmCancel(benchmark::State &state) {
+  SyncTimer timer{};
+  for (auto _: state) {
+    timer.Arm();
+    timer.CancelWait();
+  }
+  benchmark::DoNotOptimize(timer.IsTimerActive());
+}
+
+BENCHMARK(BM_SyncTimerArmCancel);
+
+}  // namespace
+}  // namespace sync_timer
+}  // namespace utility
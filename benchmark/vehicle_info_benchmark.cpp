@@ -0,0 +1,57 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "src/dcm/conversation/vd_conversation.h"
+#include "src/dcm/service/vd_message.h"
+#include "uds_transport/protocol_types.h"
+#include "uds_transport/uds_message.h"
+
+namespace diag {
+namespace client {
+namespace conversation {
+namespace {
+
+/**
+ * @brief    Payload of a vehicle announcement with VIN, logical address, EID, GID and further action
+ */
+auto CreateVehicleAnnouncementPayload() -> uds_transport::ByteVector {
+  uds_transport::ByteVector payload{'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I',
+                                    'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q'};
+  payload.insert(payload.end(), {0x0FU, 0xA3U});
+  payload.insert(payload.end(), {0x00U, 0x02U, 0x36U, 0x31U, 0x00U, 0x1CU});
+  payload.insert(payload.end(), {0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU});
+  payload.insert(payload.end(), {0x00U, 0x00U});
+  return payload;
+}
+
+/**
+ * @brief    Received vehicle announcement is stored in a vehicle discovery message and decoded into the vehicle
+ *           address information
+ */
+void BM_DeserializeVehicleInfoResponse(benchmark::State &state) {
+  uds_transport::ByteVector const payload{CreateVehicleAnnouncementPayload()};
+  for (auto _: state) {
+    uds_transport::UdsMessagePtr message{std::make_unique<vd_message::VdMessage>()};
+    message->GetPayload() = payload;
+    auto const vehicle_info{VdConversation::DeserializeVehicleInfoResponse(std::move(message))};
+    benchmark::DoNotOptimize(vehicle_info.second.eid.data());
+  }
+}
+
+BENCHMARK(BM_DeserializeVehicleInfoResponse);
+
+}  // namespace
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
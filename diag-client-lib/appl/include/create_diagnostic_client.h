@@ -9,8 +9,12 @@
 #define DIAG_CLIENT_LIB_APPL_INCLUDE_CREATE_DIAGNOSTIC_CLIENT_H_
 
 #include <memory>
+#include <memory_resource>
 #include <string_view>
 
+#include "core/include/clock.h"
+#include "include/diagnostic_client_config.h"
+
 namespace diag {
 namespace client {
 
@@ -28,6 +32,98 @@ class DiagClient;
  */
 std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path);
 
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using the given memory resource.
+ *              This instance to be further used for all the functionalities.
+ * @param[in]   diag_client_config_path
+ *              path to diag client config file
+ * @param[in]   memory_resource
+ *              The memory resource backing the per-conversation arenas and the response messages, must outlive
+ *              the diag client object and all response messages
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path,
+                                                                 std::pmr::memory_resource *memory_resource);
+
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using the given memory resource and clock.
+ *              This instance to be further used for all the functionalities.
+ * @param[in]   diag_client_config_path
+ *              path to diag client config file
+ * @param[in]   memory_resource
+ *              The memory resource backing the per-conversation arenas and the response messages, must outlive
+ *              the diag client object and all response messages
+ * @param[in]   clock
+ *              The clock used for timeout monitoring, must outlive the diag client object
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path,
+                                                                 std::pmr::memory_resource *memory_resource,
+                                                                 core_type::Clock &clock);
+
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using a configuration built in code.
+ *              No config file is read and parsed.
+ * @param[in]   config
+ *              The configuration, copied during construction
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(config::DiagClientConfig const &config);
+
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using a configuration built in code, the
+ *              given memory resource and clock. No config file is read and parsed.
+ * @param[in]   config
+ *              The configuration, copied during construction
+ * @param[in]   memory_resource
+ *              The memory resource backing the per-conversation arenas and the response messages, must outlive
+ *              the diag client object and all response messages
+ * @param[in]   clock
+ *              The clock used for timeout monitoring, must outlive the diag client object
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(config::DiagClientConfig const &config,
+                                                                 std::pmr::memory_resource *memory_resource,
+                                                                 core_type::Clock &clock);
+
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using a json configuration held in memory.
+ *              No config file is read, the json text is parsed in a single pass on Initialize().
+ * @param[in]   config
+ *              The json configuration, copied during construction
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(config::JsonConfig const &config);
+
+/**
+ * @brief       Function to get the instance of Diagnostic Client Object using a json configuration held in memory,
+ *              the given memory resource and clock. No config file is read, the json text is parsed in a single pass
+ *              on Initialize().
+ * @param[in]   config
+ *              The json configuration, copied during construction
+ * @param[in]   memory_resource
+ *              The memory resource backing the per-conversation arenas and the response messages, must outlive
+ *              the diag client object and all response messages
+ * @param[in]   clock
+ *              The clock used for timeout monitoring, must outlive the diag client object
+ * @return      std::unique_ptr<diag::client::DiagClient>
+ *              Unique pointer to diag client object
+ * @implements  DiagClientLib-Library-Support, DiagClientLib-ComParam-Settings
+ */
+std::unique_ptr<diag::client::DiagClient> CreateDiagnosticClient(config::JsonConfig const &config,
+                                                                 std::pmr::memory_resource *memory_resource,
+                                                                 core_type::Clock &clock);
+
 }  // namespace client
 }  // namespace diag
 
@@ -10,9 +10,14 @@
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <string>
 #include <string_view>
 
+#include "core/include/clock.h"
+#include "include/diagnostic_client_config.h"
 #include "include/diagnostic_client_conversation.h"
+#include "include/diagnostic_client_metrics.h"
 #include "include/diagnostic_client_result.h"
 #include "include/diagnostic_client_vehicle_info_message_type.h"
 
@@ -42,6 +47,85 @@ class DiagClient final {
    */
   explicit DiagClient(std::string_view diag_client_config_path) noexcept;
 
+  /**
+   * @brief         Constructs an instance of DiagClient using the given memory resource
+   * @details       Every conversation serves the messages of one request/response cycle from its own arena, which is
+   *                reset at the start of every request. The arenas, the response messages and all requests not
+   *                fitting into the arenas are allocated from the given memory resource.
+   * @param[in]     diag_client_config_path
+   *                path to diag client config file
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations, must outlive the diag client object and all response
+   *                messages
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClient(std::string_view diag_client_config_path, std::pmr::memory_resource *memory_resource) noexcept;
+
+  /**
+   * @brief         Constructs an instance of DiagClient using the given memory resource and clock
+   * @details       All timeouts (routing activation, diagnostic acknowledgement, P2/P2* and vehicle identification)
+   *                are measured on the given clock. A core_type::ManualClock makes them advance only on request.
+   * @param[in]     diag_client_config_path
+   *                path to diag client config file
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations, must outlive the diag client object and all response
+   *                messages
+   * @param[in]     clock
+   *                The clock used for timeout monitoring, must outlive the diag client object
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClient(std::string_view diag_client_config_path, std::pmr::memory_resource *memory_resource,
+             core_type::Clock &clock) noexcept;
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a configuration built in code
+   * @details       No file is read and no json is parsed on Initialize()
+   * @param[in]     config
+   *                The configuration, copied during construction
+   * @implements    DiagClientLib-Construction
+   */
+  explicit DiagClient(config::DiagClientConfig const &config) noexcept;
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a configuration built in code using the given memory
+   *                resource and clock
+   * @param[in]     config
+   *                The configuration, copied during construction
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations, must outlive the diag client object and all response
+   *                messages
+   * @param[in]     clock
+   *                The clock used for timeout monitoring, must outlive the diag client object
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClient(config::DiagClientConfig const &config, std::pmr::memory_resource *memory_resource,
+             core_type::Clock &clock) noexcept;
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a json configuration held in memory
+   * @details       No file is read, the json text is parsed in a single pass on Initialize(). Initialize() fails for an
+   *                invalid configuration, use config::ValidateJsonConfig() to get the error position.
+   * @param[in]     config
+   *                The json configuration, copied during construction
+   * @implements    DiagClientLib-Construction
+   */
+  explicit DiagClient(config::JsonConfig const &config) noexcept;
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a json configuration held in memory using the given
+   *                memory resource and clock
+   * @param[in]     config
+   *                The json configuration, copied during construction
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations, must outlive the diag client object and all response
+   *                messages
+   * @param[in]     clock
+   *                The clock used for timeout monitoring, must outlive the diag client object
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClient(config::JsonConfig const &config, std::pmr::memory_resource *memory_resource,
+             core_type::Clock &clock) noexcept;
+
   /**
    * @brief  Deleted copy assignment and copy constructor
    */
@@ -96,6 +180,68 @@ class DiagClient final {
    */
   conversation::DiagClientConversation GetDiagnosticClientConversation(std::string_view conversation_name) noexcept;
 
+  /**
+   * @brief       Function to get required diag client conversation object using the given memory resource
+   * @param[in]   conversation_name
+   *              Name of conversation configured as json parameter "ConversationName"
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation, must outlive the conversation object
+   * @return      Diag client conversation object as per passed conversation name
+   * @implements  DiagClientLib-MultipleTester-Connection, DiagClientLib-Conversation-Construction
+   */
+  conversation::DiagClientConversation GetDiagnosticClientConversation(
+      std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept;
+
+  /**
+   * @brief       Function to get a snapshot of the latency metrics of all conversations
+   * @details     Recording of metrics is lock-free and not disturbed by taking a snapshot. The metrics contain the
+   *              routing activation time, acknowledgement latency, time to first response, total response time and
+   *              number of pending responses, in total and per service identifier.
+   * @return      The metrics of all conversations sorted by conversation name
+   */
+  metrics::MetricsSnapshot GetMetricsSnapshot() const noexcept;
+
+  /**
+   * @brief       Function to apply a changed json config file without restarting the diag client
+   * @details     The new configuration is compared to the running one: conversations no longer configured are removed,
+   *              changed P2ClientMax/P2StarClientMax are applied in place with the next request, new conversations are
+   *              added. A conversation with changed RxBufferSize, SourceAddress or TcpIpAddress is connected as
+   *              configured when got next by GetDiagnosticClientConversation(). Conversation objects already handed
+   *              out for removed or changed conversations keep working until shut down by the application, all other
+   *              conversations and their connections are not touched. UdpIpAddress and UdpBroadcastAddress can only be
+   *              changed by DeInitialize() and Initialize(). A later Initialize() reads the reloaded configuration.
+   * @param[in]   diag_client_config_path
+   *              The path to diag client config file
+   * @return      Result with void in case of success, otherwise error is returned and nothing is applied
+   */
+  Result<void> Reload(std::string_view diag_client_config_path) noexcept;
+
+  /**
+   * @brief       Function to apply a changed configuration built in code without restarting the diag client
+   * @details     Same as reload of a json config file
+   * @param[in]   config
+   *              The configuration
+   * @return      Result with void in case of success, otherwise error is returned and nothing is applied
+   */
+  Result<void> Reload(config::DiagClientConfig const &config) noexcept;
+
+  /**
+   * @brief       Function to apply a changed json configuration held in memory without restarting the diag client
+   * @details     Same as reload of a json config file
+   * @param[in]   config
+   *              The json configuration
+   * @return      Result with void in case of success, otherwise error is returned and nothing is applied
+   */
+  Result<void> Reload(config::JsonConfig const &config) noexcept;
+
+  /**
+   * @brief       Function to dump the recorded request lifecycle trace
+   * @details     Trace points are compiled in with CMake option BUILD_WITH_TRACE, otherwise the trace is empty.
+   *              The latest events of all diag client instances are kept in a lock-free in-memory buffer.
+   * @return      The trace in Chrome trace event JSON format, to be opened in Perfetto or chrome://tracing
+   */
+  std::string DumpTrace() const;
+
  private:
   /**
    * @brief    Forward declaration of diag client implementation
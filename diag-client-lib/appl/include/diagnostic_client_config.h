@@ -0,0 +1,138 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_CONFIG_H_
+#define DIAG_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_CONFIG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "core/include/span.h"
+#include "include/diagnostic_client_result.h"
+
+namespace diag {
+namespace client {
+namespace config {
+
+/**
+ * @brief    Properties of a single conversation, equivalent to one entry of "ConversationProperty" in the json file
+ */
+struct ConversationConfig {
+  /**
+   * @brief  Name of conversation, "ConversationName"
+   */
+  std::string_view conversation_name;
+
+  /**
+   * @brief  Maximum P2 client time in milliseconds, "P2ClientMax"
+   */
+  std::uint16_t p2_client_max;
+
+  /**
+   * @brief  Maximum P2* client time in milliseconds, "P2StarClientMax"
+   */
+  std::uint16_t p2_star_client_max;
+
+  /**
+   * @brief  Size of reception buffer in bytes, "RxBufferSize"
+   */
+  std::uint16_t rx_buffer_size;
+
+  /**
+   * @brief  Logical address of the client, "SourceAddress"
+   */
+  std::uint16_t source_address;
+
+  /**
+   * @brief  Local Tcp Ip address of conversation, "Network.TcpIpAddress"
+   */
+  std::string_view tcp_ip_address;
+};
+
+/**
+ * @brief    Configuration of diag client built in code instead of read from a json file
+ * @details  It is an aggregate of views, so that it can be constexpr. The viewed strings and conversations only need
+ *           to live during construction of the diag client, they are copied. Example:
+ * @code
+ *           constexpr std::array<diag::client::config::ConversationConfig, 1U> kConversations{
+ *               {{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0001U, "172.16.25.127"}}};
+ *           constexpr diag::client::config::DiagClientConfig kDiagClientConfig{
+ *               "172.16.25.127", "172.16.255.255",
+ *               core_type::Span<diag::client::config::ConversationConfig const>{kConversations}};
+ * @endcode
+ *           The CMake function generate_diag_client_config() creates such a definition out of a json file at build
+ *           time.
+ */
+struct DiagClientConfig {
+  /**
+   * @brief  Local Udp Ip address used for vehicle discovery, "UdpIpAddress"
+   */
+  std::string_view udp_ip_address;
+
+  /**
+   * @brief  Broadcast address used for vehicle discovery, "UdpBroadcastAddress"
+   */
+  std::string_view udp_broadcast_address;
+
+  /**
+   * @brief  All conversations, "Conversation.ConversationProperty"
+   */
+  core_type::Span<ConversationConfig const> conversations;
+};
+
+/**
+ * @brief    Configuration in json format held in memory, with the same content as the json config file
+ * @details  The content is parsed in a single pass straight into the configuration, without writing a file or building
+ *           a property tree. Unlike the json config file, values must have their json type, i.e. numbers are not
+ *           accepted as strings. The viewed content only needs to live during construction of the diag client, it is
+ *           copied.
+ */
+struct JsonConfig {
+  /**
+   * @brief  The json text
+   */
+  std::string_view content;
+};
+
+/**
+ * @brief    Error found in a json configuration
+ */
+struct ConfigError {
+  /**
+   * @brief  Line of the error, starting with 1
+   */
+  std::size_t line;
+
+  /**
+   * @brief  Column of the error in bytes, starting with 1
+   */
+  std::size_t column;
+
+  /**
+   * @brief  Description of the error prefixed by the path of the affected value,
+   *         e.g. "Conversation.ConversationProperty[3].P2ClientMax: value 70000 exceeds 65535"
+   */
+  std::string message;
+};
+
+/**
+ * @brief       Function to validate a json configuration without creating a diag client
+ * @details     A diag client created with an invalid configuration only fails Initialize() and logs the error, this
+ *              function gives access to the error position and description.
+ * @param[in]   config
+ *              The json configuration
+ * @return      Result with void in case the configuration is valid, otherwise the first error found
+ */
+Result<void, ConfigError> ValidateJsonConfig(JsonConfig const &config) noexcept;
+
+}  // namespace config
+}  // namespace client
+}  // namespace diag
+
+#endif  // DIAG_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_CONFIG_H_
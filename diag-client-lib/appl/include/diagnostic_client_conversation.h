@@ -9,13 +9,21 @@
 #define DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_CONVERSATION_H
 
 #include <cstdint>
+#include <memory>
 
 #include "diagnostic_client_uds_message_type.h"
 #include "include/diagnostic_client_result.h"
 
 namespace diag {
 namespace client {
+// forward declaration
+namespace dcm {
+class DCMClient;
+}
+
 namespace conversation {
+// forward declaration
+class Conversation;
 
 /**
  * @brief       Conversation class to establish connection with a Diagnostic Server
@@ -60,14 +68,6 @@ class DiagClientConversation final {
     kDiagBusyProcessing = 7U     /**< Conversation is already busy processing previous request */
   };
 
-  /**
-   * @brief         Constructor an instance of DiagClientConversation
-   * @param[in]     conversation_name
-   *                The name of conversation configured as json parameter under "ConversationName"
-   * @implements    DiagClientLib-Conversation-Construction, DiagClientLib-DoIP-Support
-   */
-  explicit DiagClientConversation(std::string_view conversation_name) noexcept;
-
   /**
    * @brief         Destructor an instance of DiagClientConversation
    * @implements    DiagClientLib-Conversation-Destruction
@@ -127,6 +127,21 @@ class DiagClientConversation final {
       uds_message::UdsRequestMessageConstPtr message) noexcept;
 
  private:
+  /**
+   * @brief         Constructor an instance of DiagClientConversation
+   * @details       Conversations are only handed out by the diag client owning them, see
+   *                DiagClient::GetDiagnosticClientConversation()
+   * @param[in]     conversation
+   *                The conversation of the diag client
+   * @implements    DiagClientLib-Conversation-Construction, DiagClientLib-DoIP-Support
+   */
+  explicit DiagClientConversation(Conversation &conversation) noexcept;
+
+  /**
+   * @brief    The dcm client of diag client creates the conversations
+   */
+  friend class dcm::DCMClient;
+
   /**
    * @brief    Forward declaration of diag client conversation implementation
    */
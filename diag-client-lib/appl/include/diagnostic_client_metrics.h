@@ -0,0 +1,144 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_METRICS_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_METRICS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace diag {
+namespace client {
+namespace metrics {
+
+/**
+ * @brief       Structure containing the summary of one histogram
+ * @details     Latencies are given in microseconds, pending response counts are given as number of 0x78 responses
+ *              per request. Percentiles are accurate to about 3 %.
+ */
+struct HistogramSnapshot {
+  /**
+   * @brief       Number of recorded values
+   */
+  std::uint64_t count{};
+
+  /**
+   * @brief       Smallest recorded value
+   */
+  std::uint64_t min{};
+
+  /**
+   * @brief       Largest recorded value
+   */
+  std::uint64_t max{};
+
+  /**
+   * @brief       Arithmetic mean of all recorded values
+   */
+  double mean{};
+
+  /**
+   * @brief       Median of all recorded values
+   */
+  std::uint64_t p50{};
+
+  /**
+   * @brief       90th percentile of all recorded values
+   */
+  std::uint64_t p90{};
+
+  /**
+   * @brief       99th percentile of all recorded values
+   */
+  std::uint64_t p99{};
+
+  /**
+   * @brief       99.9th percentile of all recorded values
+   */
+  std::uint64_t p999{};
+};
+
+/**
+ * @brief       Structure containing the metrics of all requests with the same service identifier
+ */
+struct ServiceMetricsSnapshot {
+  /**
+   * @brief       Service identifier of the requests
+   */
+  std::uint8_t service_id{};
+
+  /**
+   * @brief       Time from sending the request until the positive acknowledgement is received
+   */
+  HistogramSnapshot ack_latency{};
+
+  /**
+   * @brief       Time from sending the request until the first response (pending or final) is received
+   */
+  HistogramSnapshot time_to_first_byte{};
+
+  /**
+   * @brief       Time from sending the request until the final response is received
+   */
+  HistogramSnapshot total_response_time{};
+
+  /**
+   * @brief       Number of pending responses (NRC 0x78) received per request that got its final response
+   */
+  HistogramSnapshot pending_response_count{};
+};
+
+/**
+ * @brief       Structure containing the metrics of one conversation
+ */
+struct ConversationMetricsSnapshot {
+  /**
+   * @brief       Name of the conversation as configured in json parameter "ConversationName"
+   */
+  std::string conversation_name{};
+
+  /**
+   * @brief       Time needed to connect and perform the routing activation
+   */
+  HistogramSnapshot routing_activation{};
+
+  /**
+   * @brief       Time from sending the request until the positive acknowledgement is received, all services
+   */
+  HistogramSnapshot ack_latency{};
+
+  /**
+   * @brief       Time from sending the request until the first response is received, all services
+   */
+  HistogramSnapshot time_to_first_byte{};
+
+  /**
+   * @brief       Time from sending the request until the final response is received, all services
+   */
+  HistogramSnapshot total_response_time{};
+
+  /**
+   * @brief       Number of pending responses (NRC 0x78) received per request that got its final response, all services
+   */
+  HistogramSnapshot pending_response_count{};
+
+  /**
+   * @brief       Metrics of every service identifier requested at least once, sorted by service identifier
+   */
+  std::vector<ServiceMetricsSnapshot> services{};
+};
+
+/**
+ * @brief       Type alias of the metrics of all conversations, sorted by conversation name
+ */
+using MetricsSnapshot = std::vector<ConversationMetricsSnapshot>;
+
+}  // namespace metrics
+}  // namespace client
+}  // namespace diag
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_METRICS_H
@@ -14,6 +14,8 @@
 #include <string_view>
 #include <vector>
 
+#include "core/include/small_byte_vector.h"
+
 namespace diag {
 namespace client {
 namespace uds_message {
@@ -32,8 +34,10 @@ class UdsMessage {
 
   /**
    * @brief         Type alias of byte vector type
+   * @details       Follows the interface of std::vector<std::uint8_t> and converts from and to it, payloads of up to
+   *                48 bytes are stored without heap allocation
    */
-  using ByteVector = std::vector<std::uint8_t>;
+  using ByteVector = core_type::SmallByteVector<48U>;
 
  public:
   /**
@@ -11,38 +11,24 @@ namespace diag {
 namespace client {
 namespace common {
 
-DiagnosticManager::DiagnosticManager() noexcept : exit_requested_{false}, cond_var_{}, mutex_{} {}
+DiagnosticManager::DiagnosticManager() noexcept : io_context_{} {}
 
-DiagnosticManager::~DiagnosticManager() noexcept {
-  {
-    std::lock_guard<std::mutex> const lock{mutex_};
-    exit_requested_ = true;
-  }
-  cond_var_.notify_all();
-}
+DiagnosticManager::~DiagnosticManager() noexcept { io_context_.Stop(); }
 
 void DiagnosticManager::Main() noexcept {
   // Initialize the module
   Initialize();
   // Run the module
   Run();
-  // Entering infinite loop
-  while (!exit_requested_) {
-    std::unique_lock<std::mutex> lck(mutex_);
-    cond_var_.wait(lck, [this]() { return exit_requested_; });
-    // Thread exited
-  }
+  // Run the event loop until shutdown is requested
+  io_context_.Run();
   // Shutdown module
   Shutdown();
 }
 
 Result<void> DiagnosticManager::SignalShutdown() noexcept {
   Result<void> result{};
-  {
-    std::lock_guard<std::mutex> lock{mutex_};
-    exit_requested_ = true;
-  }
-  cond_var_.notify_all();
+  io_context_.Stop();
   return result;
 }
 }  // namespace common
@@ -8,13 +8,15 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_COMMON_DIAGNOSTIC_MANAGER_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_COMMON_DIAGNOSTIC_MANAGER_H
 /* includes */
-#include <condition_variable>
-#include <mutex>
+#include <memory_resource>
 
 #include "core/include/result.h"
 #include "include/diagnostic_client.h"
+#include "include/diagnostic_client_metrics.h"
 #include "include/diagnostic_client_uds_message_type.h"
 #include "include/diagnostic_client_vehicle_info_message_type.h"
+#include "socket/io_context.h"
+#include "src/dcm/config_parser/config_parser_type.h"
 
 namespace diag {
 namespace client {
@@ -54,6 +56,7 @@ class DiagnosticManager {
 
   /**
    * @brief         Function to manage the whole lifecycle of DiagnosticManager
+   * @details       The calling thread runs the event loop of all sockets between Run() and Shutdown()
    */
   virtual void Main() noexcept;
 
@@ -81,11 +84,13 @@ class DiagnosticManager {
    * @brief       Function to get required diag client conversation object based on conversation name
    * @param[in]   conversation_name
    *              Name of conversation configured as json parameter "ConversationName"
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation, nullptr for the one of diag client
    * @return      Diag client conversation object as per passed conversation name
    * @implements  DiagClientLib-MultipleTester-Connection, DiagClientLib-Conversation-Construction
    */
   virtual conversation::DiagClientConversation GetDiagnosticClientConversation(
-      std::string_view conversation_name) noexcept = 0;
+      std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept = 0;
 
   /**
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
@@ -99,21 +104,33 @@ class DiagnosticManager {
   SendVehicleIdentificationRequest(
       diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept = 0;
 
- private:
   /**
-   * @brief         Flag to terminate the main thread
+   * @brief       Function to get the latency metrics of all conversations
+   * @return      The metrics of all conversations sorted by conversation name
    */
-  bool exit_requested_;
+  virtual metrics::MetricsSnapshot GetMetricsSnapshot() const noexcept = 0;
 
   /**
-   * @brief         Conditional variable to block the thread
+   * @brief       Function to apply a new configuration without restarting
+   * @details     Only the differences to the running configuration are applied
+   * @param[in]   config
+   *              The new configuration
+   * @return      Result with void in case of success, otherwise error is returned
    */
-  std::condition_variable cond_var_;
+  virtual Result<void> Reload(config_parser::DcmClientConfig config) noexcept = 0;
 
+ protected:
+  /**
+   * @brief         Function to get the event loop run by Main()
+   * @return        The reference to event loop
+   */
+  auto GetIoContext() noexcept -> boost_support::socket::IoContext & { return io_context_; }
+
+ private:
   /**
-   * @brief         For locking critical section of code
+   * @brief         The event loop running the socket io and the reception handling of all conversations
    */
-  std::mutex mutex_;
+  boost_support::socket::IoContext io_context_;
 };
 }  // namespace common
 }  // namespace client
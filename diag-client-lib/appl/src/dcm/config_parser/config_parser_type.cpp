@@ -8,6 +8,8 @@
 /* includes */
 #include "src/dcm/config_parser/config_parser_type.h"
 
+#include <utility>
+
 namespace diag {
 namespace client {
 namespace config_parser {
@@ -34,6 +36,25 @@ diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(boost_support::
   return config;
 }
 
+diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(diag::client::config::DiagClientConfig const &config) {
+  diag::client::config_parser::DcmClientConfig dcm_client_config{};
+  dcm_client_config.udp_ip_address = config.udp_ip_address;
+  dcm_client_config.udp_broadcast_address = config.udp_broadcast_address;
+  dcm_client_config.num_of_conversation = static_cast<std::uint8_t>(config.conversations.size());
+  dcm_client_config.conversations.reserve(config.conversations.size());
+  for (diag::client::config::ConversationConfig const &conversation_config: config.conversations) {
+    diag::client::config_parser::ConversationType conversation{};
+    conversation.conversation_name = conversation_config.conversation_name;
+    conversation.p2_client_max = conversation_config.p2_client_max;
+    conversation.p2_star_client_max = conversation_config.p2_star_client_max;
+    conversation.rx_buffer_size = conversation_config.rx_buffer_size;
+    conversation.source_address = conversation_config.source_address;
+    conversation.network.tcp_ip_address = conversation_config.tcp_ip_address;
+    dcm_client_config.conversations.emplace_back(std::move(conversation));
+  }
+  return dcm_client_config;
+}
+
 }  // namespace config_parser
 }  // namespace client
 }  // namespace diag
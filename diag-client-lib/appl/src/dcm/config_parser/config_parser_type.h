@@ -9,7 +9,9 @@
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONFIG_PARSER_CONFIG_PARSER_TYPE_H
 /* includes */
 #include <string>
+#include <vector>
 
+#include "include/diagnostic_client_config.h"
 #include "parser/json_parser.h"
 
 namespace diag {
@@ -58,6 +60,15 @@ struct DcmClientConfig {
  */
 diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(boost_support::parser::boost_tree &config_tree);
 
+/**
+ * @brief         Function to get the DcmClient configuration out of a configuration built in code
+ * @details       The configuration must not contain more than 255 conversations, like NumberOfConversation in json
+ * @param[in]     config
+ *                The configuration built in code
+ * @return        The Dcm client configuration
+ */
+diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(diag::client::config::DiagClientConfig const &config);
+
 }  // namespace config_parser
 }  // namespace client
 }  // namespace diag
@@ -0,0 +1,617 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+/* includes */
+#include "src/dcm/config_parser/json_config_reader.h"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace diag {
+namespace client {
+namespace config_parser {
+namespace {
+
+/**
+ * @brief  Members read out of the top level object, all mandatory
+ */
+constexpr std::array<std::string_view, 3U> kConfigMembers{"UdpIpAddress", "UdpBroadcastAddress", "Conversation"};
+
+/**
+ * @brief  Members read out of "Conversation", all mandatory
+ */
+constexpr std::array<std::string_view, 2U> kConversationMembers{"NumberOfConversation", "ConversationProperty"};
+
+/**
+ * @brief  Members read out of each entry of "ConversationProperty", all mandatory
+ */
+constexpr std::array<std::string_view, 6U> kConversationPropertyMembers{
+    "ConversationName", "P2ClientMax", "P2StarClientMax", "RxBufferSize", "SourceAddress", "Network"};
+
+/**
+ * @brief  Members read out of "Network", all mandatory
+ */
+constexpr std::array<std::string_view, 1U> kNetworkMembers{"TcpIpAddress"};
+
+/**
+ * @brief  Maximum nesting of skipped values, deeper values are rejected instead of exhausting the stack
+ */
+constexpr std::size_t kMaxSkipDepth{32U};
+
+/**
+ * @brief  Maximum nesting of the path to the value currently read
+ */
+constexpr std::size_t kMaxPathDepth{4U};
+
+/**
+ * @brief    Single pass reader of the diag client json configuration
+ * @details  The reader walks the text once and stores the values directly into the configuration. Member names without
+ *           escapes are compared in place, the path of the current value is kept as views to format errors only when
+ *           they occur.
+ */
+class JsonConfigReader final {
+ public:
+  /**
+   * @brief         Constructs an instance of JsonConfigReader
+   * @param[in]     content
+   *                The json text, must outlive the reader
+   */
+  explicit JsonConfigReader(std::string_view content) noexcept : content_{content} {}
+
+  /**
+   * @brief         Function to read the whole configuration
+   * @return        The Dcm client configuration on success, otherwise the first error found
+   */
+  auto Read() noexcept -> core_type::Result<DcmClientConfig, config::ConfigError> {
+    DcmClientConfig config{};
+    SkipByteOrderMark();
+    SkipWhitespace();
+    bool is_valid{ReadConfig(config)};
+    if (is_valid) {
+      SkipWhitespace();
+      if (offset_ != content_.size()) { is_valid = FailHere("unexpected content after configuration"); }
+    }
+    if (!is_valid) { return core_type::Result<DcmClientConfig, config::ConfigError>::FromError(std::move(error_)); }
+    return core_type::Result<DcmClientConfig, config::ConfigError>::FromValue(std::move(config));
+  }
+
+ private:
+  /**
+   * @brief  Position in the json text
+   */
+  struct Position {
+    std::size_t offset;
+    std::size_t line;
+    std::size_t column;
+  };
+
+  /**
+   * @brief  Element of the path to the value currently read
+   */
+  struct PathElement {
+    std::string_view name;
+    std::optional<std::size_t> index;
+  };
+
+  auto ReadConfig(DcmClientConfig &config) noexcept -> bool {
+    return ReadMembers(kConfigMembers, [this, &config](std::size_t member) noexcept -> bool {
+      switch (member) {
+        case 0U:
+          return ReadString(config.udp_ip_address);
+        case 1U:
+          return ReadString(config.udp_broadcast_address);
+        default:
+          return ReadConversation(config);
+      }
+    });
+  }
+
+  auto ReadConversation(DcmClientConfig &config) noexcept -> bool {
+    return ReadMembers(kConversationMembers, [this, &config](std::size_t member) noexcept -> bool {
+      if (member == 0U) { return ReadUnsigned(config.num_of_conversation); }
+      return ReadConversationProperties(config.conversations);
+    });
+  }
+
+  auto ReadConversationProperties(std::vector<ConversationType> &conversations) noexcept -> bool {
+    if (!Consume('[')) { return FailHere("expected array"); }
+    std::vector<Position> name_positions{};
+    SkipWhitespace();
+    if (!Consume(']')) {
+      do {
+        SkipWhitespace();
+        path_[path_depth_ - 1U].index = conversations.size();
+        ConversationType &conversation{conversations.emplace_back()};
+        name_positions.emplace_back();
+        if (!ReadConversationProperty(conversation, name_positions.back())) { return false; }
+        SkipWhitespace();
+      } while (Consume(','));
+      if (!Consume(']')) { return FailHere("expected ',' or ']'"); }
+    }
+    return CheckUniqueNames(conversations, name_positions);
+  }
+
+  auto ReadConversationProperty(ConversationType &conversation, Position &name_position) noexcept -> bool {
+    return ReadMembers(kConversationPropertyMembers,
+                       [this, &conversation, &name_position](std::size_t member) noexcept -> bool {
+                         switch (member) {
+                           case 0U:
+                             name_position = Here();
+                             return ReadString(conversation.conversation_name);
+                           case 1U:
+                             return ReadUnsigned(conversation.p2_client_max);
+                           case 2U:
+                             return ReadUnsigned(conversation.p2_star_client_max);
+                           case 3U:
+                             return ReadUnsigned(conversation.rx_buffer_size);
+                           case 4U:
+                             return ReadUnsigned(conversation.source_address);
+                           default:
+                             return ReadMembers(kNetworkMembers, [this, &conversation](std::size_t) noexcept -> bool {
+                               return ReadString(conversation.network.tcp_ip_address);
+                             });
+                         }
+                       });
+  }
+
+  auto CheckUniqueNames(std::vector<ConversationType> const &conversations,
+                        std::vector<Position> const &name_positions) noexcept -> bool {
+    std::vector<std::size_t> order(conversations.size());
+    std::iota(order.begin(), order.end(), std::size_t{0U});
+    std::stable_sort(order.begin(), order.end(), [&conversations](std::size_t lhs, std::size_t rhs) noexcept {
+      return conversations[lhs].conversation_name < conversations[rhs].conversation_name;
+    });
+    auto const duplicate{std::adjacent_find(order.begin(), order.end(),
+                                            [&conversations](std::size_t lhs, std::size_t rhs) noexcept {
+                                              return conversations[lhs].conversation_name ==
+                                                     conversations[rhs].conversation_name;
+                                            })};
+    if (duplicate == order.end()) { return true; }
+    // report the later of both conversations, equal names keep their order
+    std::size_t const index{*std::next(duplicate)};
+    path_[path_depth_ - 1U].index = index;
+    PushPath(kConversationPropertyMembers[0U]);
+    return Fail(name_positions[index], "duplicate name '" + conversations[index].conversation_name + "'");
+  }
+
+  /**
+   * @brief         Function to read an object whose members are all mandatory
+   * @details       Unknown members are skipped, duplicated and missing members are errors
+   * @param[in]     names
+   *                The names of the members to be read
+   * @param[in]     read_member
+   *                Callable reading the value of the member with the given index into names
+   * @return        True on success, false when an error was recorded
+   */
+  template<std::size_t N, typename MemberReader>
+  auto ReadMembers(std::array<std::string_view, N> const &names, MemberReader &&read_member) noexcept -> bool {
+    Position const object_position{Here()};
+    if (!Consume('{')) { return FailHere("expected object"); }
+    std::bitset<N> found{};
+    SkipWhitespace();
+    if (!Consume('}')) {
+      do {
+        SkipWhitespace();
+        Position const name_position{Here()};
+        std::string_view name{};
+        if (!ReadName(name)) { return false; }
+        SkipWhitespace();
+        if (!Consume(':')) { return FailHere("expected ':' after member name"); }
+        SkipWhitespace();
+        auto const member{std::find(names.begin(), names.end(), name)};
+        if (member == names.end()) {
+          if (!SkipValue(0U)) { return false; }
+        } else {
+          std::size_t const index{static_cast<std::size_t>(std::distance(names.begin(), member))};
+          if (found.test(index)) { return Fail(name_position, "duplicate member '" + std::string{*member} + "'"); }
+          found.set(index);
+          PushPath(*member);
+          if (!read_member(index)) { return false; }
+          PopPath();
+        }
+        SkipWhitespace();
+      } while (Consume(','));
+      if (!Consume('}')) { return FailHere("expected ',' or '}'"); }
+    }
+    for (std::size_t index{0U}; index < N; ++index) {
+      if (!found.test(index)) { return Fail(object_position, "missing member '" + std::string{names[index]} + "'"); }
+    }
+    return true;
+  }
+
+  /**
+   * @brief         Function to read a member name, viewing the json text unless the name contains escapes
+   */
+  auto ReadName(std::string_view &name) noexcept -> bool {
+    if (Peek() != '"') { return FailHere("expected member name"); }
+    std::size_t const begin{offset_ + 1U};
+    std::size_t const end{FindStringEnd(begin)};
+    if (end != content_.size() && content_[end] == '"') {
+      name = content_.substr(begin, end - begin);
+      Advance(end + 1U - offset_);
+      return true;
+    }
+    if (!ReadQuoted(name_)) { return false; }
+    name = name_;
+    return true;
+  }
+
+  /**
+   * @brief         Function to read a string value
+   */
+  auto ReadString(std::string &value) noexcept -> bool {
+    if (Peek() != '"') { return FailHere("expected string"); }
+    return ReadQuoted(value);
+  }
+
+  /**
+   * @brief         Function to read an unsigned integer value and check its range
+   */
+  template<typename T>
+  auto ReadUnsigned(T &value) noexcept -> bool {
+    Position const value_position{Here()};
+    char const first{Peek()};
+    if (first < '0' || first > '9') { return FailHere("expected unsigned integer"); }
+    std::uint64_t number{0U};
+    std::size_t digit_count{0U};
+    while (offset_ < content_.size() && content_[offset_] >= '0' && content_[offset_] <= '9') {
+      // saturate, the range check below reports the value anyway
+      number = std::min<std::uint64_t>(number * 10U + static_cast<std::uint64_t>(content_[offset_] - '0'),
+                                       std::numeric_limits<std::uint32_t>::max());
+      ++digit_count;
+      Advance(1U);
+    }
+    if (first == '0' && digit_count > 1U) { return Fail(value_position, "leading zeros are not allowed"); }
+    char const next{Peek()};
+    if (next == '.' || next == 'e' || next == 'E') { return Fail(value_position, "expected unsigned integer"); }
+    if (number > std::numeric_limits<T>::max()) {
+      return Fail(value_position,
+                  "value " + std::string{content_.substr(value_position.offset, offset_ - value_position.offset)} +
+                      " exceeds " + std::to_string(std::numeric_limits<T>::max()));
+    }
+    value = static_cast<T>(number);
+    return true;
+  }
+
+  /**
+   * @brief         Function to read a quoted string starting at the current position, decoding escapes
+   */
+  auto ReadQuoted(std::string &value) noexcept -> bool {
+    Position const string_position{Here()};
+    Advance(1U);
+    value.clear();
+    while (offset_ < content_.size()) {
+      // copy the run of plain characters at once
+      std::size_t const end{FindStringEnd(offset_)};
+      value.append(content_.substr(offset_, end - offset_));
+      Advance(end - offset_);
+      if (offset_ == content_.size()) { break; }
+      if (content_[offset_] == '"') {
+        Advance(1U);
+        return true;
+      }
+      if (content_[offset_] != '\\') { return FailHere("control character in string"); }
+      if (!ReadEscape(value)) { return false; }
+    }
+    return Fail(string_position, "unterminated string");
+  }
+
+  /**
+   * @brief         Function to decode the escape sequence at the current position
+   */
+  auto ReadEscape(std::string &value) noexcept -> bool {
+    Position const escape_position{Here()};
+    Advance(1U);
+    switch (Peek()) {
+      case '"':
+      case '\\':
+      case '/':
+        value.push_back(Peek());
+        break;
+      case 'b':
+        value.push_back('\b');
+        break;
+      case 'f':
+        value.push_back('\f');
+        break;
+      case 'n':
+        value.push_back('\n');
+        break;
+      case 'r':
+        value.push_back('\r');
+        break;
+      case 't':
+        value.push_back('\t');
+        break;
+      case 'u': {
+        Advance(1U);
+        std::uint32_t code_point{0U};
+        if (!ReadHex(code_point)) { return Fail(escape_position, "invalid unicode escape"); }
+        // combine a surrogate pair into one code point
+        if (code_point >= 0xD800U && code_point <= 0xDBFFU && content_.substr(offset_, 2U) == "\\u") {
+          Advance(2U);
+          std::uint32_t low_surrogate{0U};
+          if (!ReadHex(low_surrogate) || low_surrogate < 0xDC00U || low_surrogate > 0xDFFFU) {
+            return Fail(escape_position, "invalid unicode escape");
+          }
+          code_point = 0x10000U + ((code_point - 0xD800U) << 10U) + (low_surrogate - 0xDC00U);
+        }
+        AppendUtf8(code_point, value);
+        return true;
+      }
+      default:
+        return Fail(escape_position, "invalid escape sequence");
+    }
+    Advance(1U);
+    return true;
+  }
+
+  /**
+   * @brief         Function to read the four hex digits of an unicode escape
+   */
+  auto ReadHex(std::uint32_t &code_point) noexcept -> bool {
+    if (content_.size() - offset_ < 4U) { return false; }
+    for (std::size_t count{0U}; count < 4U; ++count) {
+      char const digit{content_[offset_]};
+      std::uint32_t nibble{};
+      if (digit >= '0' && digit <= '9') {
+        nibble = static_cast<std::uint32_t>(digit - '0');
+      } else if (digit >= 'a' && digit <= 'f') {
+        nibble = static_cast<std::uint32_t>(digit - 'a') + 10U;
+      } else if (digit >= 'A' && digit <= 'F') {
+        nibble = static_cast<std::uint32_t>(digit - 'A') + 10U;
+      } else {
+        return false;
+      }
+      code_point = (code_point << 4U) | nibble;
+      Advance(1U);
+    }
+    return true;
+  }
+
+  /**
+   * @brief         Function to skip any json value not used by the diag client, validating its syntax
+   */
+  auto SkipValue(std::size_t depth) noexcept -> bool {
+    if (depth == kMaxSkipDepth) { return FailHere("nesting too deep"); }
+    switch (Peek()) {
+      case '{':
+      case '[': {
+        char const close{Peek() == '{' ? '}' : ']'};
+        bool const is_object{close == '}'};
+        Advance(1U);
+        SkipWhitespace();
+        if (Consume(close)) { return true; }
+        do {
+          SkipWhitespace();
+          if (is_object) {
+            std::string_view name{};
+            if (!ReadName(name)) { return false; }
+            SkipWhitespace();
+            if (!Consume(':')) { return FailHere("expected ':' after member name"); }
+            SkipWhitespace();
+          }
+          if (!SkipValue(depth + 1U)) { return false; }
+          SkipWhitespace();
+        } while (Consume(','));
+        if (!Consume(close)) { return FailHere(is_object ? "expected ',' or '}'" : "expected ',' or ']'"); }
+        return true;
+      }
+      case '"':
+        return ReadQuoted(skipped_);
+      case 't':
+        return SkipLiteral("true");
+      case 'f':
+        return SkipLiteral("false");
+      case 'n':
+        return SkipLiteral("null");
+      default:
+        return SkipNumber();
+    }
+  }
+
+  auto SkipLiteral(std::string_view literal) noexcept -> bool {
+    if (content_.substr(offset_, literal.size()) != literal) { return FailHere("invalid value"); }
+    Advance(literal.size());
+    return true;
+  }
+
+  auto SkipNumber() noexcept -> bool {
+    Position const number_position{Here()};
+    Consume('-');
+    if (Consume('0')) {
+      // no further integer digits after a leading zero
+    } else if (SkipDigits() == 0U) {
+      return FailHere("invalid value");
+    }
+    if (Consume('.') && SkipDigits() == 0U) { return Fail(number_position, "invalid number"); }
+    if (Consume('e') || Consume('E')) {
+      if (!Consume('+')) { Consume('-'); }
+      if (SkipDigits() == 0U) { return Fail(number_position, "invalid number"); }
+    }
+    return true;
+  }
+
+  auto SkipDigits() noexcept -> std::size_t {
+    std::size_t const begin{offset_};
+    while (offset_ < content_.size() && content_[offset_] >= '0' && content_[offset_] <= '9') { Advance(1U); }
+    return offset_ - begin;
+  }
+
+  auto SkipByteOrderMark() noexcept -> void {
+    if (content_.substr(0U, 3U) == "\xEF\xBB\xBF") { Advance(3U); }
+  }
+
+  auto SkipWhitespace() noexcept -> void {
+    while (offset_ < content_.size()) {
+      char const character{content_[offset_]};
+      if (character == '\n') {
+        ++offset_;
+        ++line_;
+        line_begin_ = offset_;
+      } else if (character == ' ' || character == '\t' || character == '\r') {
+        ++offset_;
+      } else {
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief         Function to find the first quote, backslash or control character from the given offset on
+   * @return        The offset found, the size of the json text if none
+   */
+  auto FindStringEnd(std::size_t begin) const noexcept -> std::size_t {
+    std::size_t end{begin};
+    while (end < content_.size()) {
+      char const character{content_[end]};
+      if (character == '"' || character == '\\' || static_cast<unsigned char>(character) < 0x20U) { break; }
+      ++end;
+    }
+    return end;
+  }
+
+  static auto AppendUtf8(std::uint32_t code_point, std::string &value) noexcept -> void {
+    if (code_point < 0x80U) {
+      value.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800U) {
+      value.push_back(static_cast<char>(0xC0U | (code_point >> 6U)));
+      value.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    } else if (code_point < 0x10000U) {
+      value.push_back(static_cast<char>(0xE0U | (code_point >> 12U)));
+      value.push_back(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3FU)));
+      value.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    } else {
+      value.push_back(static_cast<char>(0xF0U | (code_point >> 18U)));
+      value.push_back(static_cast<char>(0x80U | ((code_point >> 12U) & 0x3FU)));
+      value.push_back(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3FU)));
+      value.push_back(static_cast<char>(0x80U | (code_point & 0x3FU)));
+    }
+  }
+
+  auto Peek() const noexcept -> char { return offset_ < content_.size() ? content_[offset_] : '\0'; }
+
+  auto Consume(char expected) noexcept -> bool {
+    if (offset_ < content_.size() && content_[offset_] == expected) {
+      ++offset_;
+      return true;
+    }
+    return false;
+  }
+
+  // Only used within a line, new lines are consumed by SkipWhitespace() only
+  auto Advance(std::size_t count) noexcept -> void { offset_ += count; }
+
+  auto Here() const noexcept -> Position { return Position{offset_, line_, offset_ - line_begin_ + 1U}; }
+
+  auto PushPath(std::string_view name) noexcept -> void {
+    if (path_depth_ < kMaxPathDepth) { path_[path_depth_] = PathElement{name, std::nullopt}; }
+    ++path_depth_;
+  }
+
+  auto PopPath() noexcept -> void { --path_depth_; }
+
+  /**
+   * @brief         Function to record the error at the current position, which is the end of input when reached
+   * @return        Always false, to be returned by the caller
+   */
+  auto FailHere(std::string_view message) noexcept -> bool {
+    return Fail(Here(), offset_ == content_.size() ? "unexpected end of input" : message);
+  }
+
+  /**
+   * @brief         Function to record the error, prefixed by the path of the value currently read
+   * @return        Always false, to be returned by the caller
+   */
+  auto Fail(Position const &position, std::string_view message) noexcept -> bool {
+    std::string description{};
+    for (std::size_t depth{0U}; depth < std::min(path_depth_, kMaxPathDepth); ++depth) {
+      if (depth != 0U) { description.push_back('.'); }
+      description.append(path_[depth].name);
+      if (path_[depth].index) {
+        description.append("[").append(std::to_string(*path_[depth].index)).append("]");
+      }
+    }
+    if (!description.empty()) { description.append(": "); }
+    description.append(message);
+    error_ = config::ConfigError{position.line, position.column, std::move(description)};
+    return false;
+  }
+
+  /**
+   * @brief  The json text
+   */
+  std::string_view content_;
+
+  /**
+   * @brief  Offset of the next character to be read
+   */
+  std::size_t offset_{0U};
+
+  /**
+   * @brief  Current line, starting with 1
+   */
+  std::size_t line_{1U};
+
+  /**
+   * @brief  Offset of the first character of the current line
+   */
+  std::size_t line_begin_{0U};
+
+  /**
+   * @brief  Path to the value currently read
+   */
+  std::array<PathElement, kMaxPathDepth> path_{};
+
+  /**
+   * @brief  Number of valid elements of the path
+   */
+  std::size_t path_depth_{0U};
+
+  /**
+   * @brief  Storage of member names containing escapes
+   */
+  std::string name_{};
+
+  /**
+   * @brief  Storage of skipped string values
+   */
+  std::string skipped_{};
+
+  /**
+   * @brief  The first error found
+   */
+  config::ConfigError error_{};
+};
+
+}  // namespace
+
+core_type::Result<DcmClientConfig, config::ConfigError> ReadDcmClientConfig(config::JsonConfig const &config) noexcept {
+  return JsonConfigReader{config.content}.Read();
+}
+
+}  // namespace config_parser
+
+namespace config {
+
+Result<void, ConfigError> ValidateJsonConfig(JsonConfig const &config) noexcept {
+  return config_parser::ReadDcmClientConfig(config).AndThen([](config_parser::DcmClientConfig const &) {});
+}
+
+}  // namespace config
+}  // namespace client
+}  // namespace diag
@@ -0,0 +1,33 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONFIG_PARSER_JSON_CONFIG_READER_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONFIG_PARSER_JSON_CONFIG_READER_H
+/* includes */
+#include "core/include/result.h"
+#include "include/diagnostic_client_config.h"
+#include "src/dcm/config_parser/config_parser_type.h"
+
+namespace diag {
+namespace client {
+namespace config_parser {
+
+/**
+ * @brief         Function to parse a json configuration held in memory and get the DcmClient configuration
+ * @details       The json text is read in a single pass directly into the configuration, no document tree is built.
+ *                Members not used by the diag client are skipped, all used members are mandatory and checked for
+ *                their json type and value range. Conversation names must be unique.
+ * @param[in]     config
+ *                The json configuration
+ * @return        The Dcm client configuration on success, otherwise the first error found with its position
+ */
+core_type::Result<DcmClientConfig, config::ConfigError> ReadDcmClientConfig(config::JsonConfig const &config) noexcept;
+
+}  // namespace config_parser
+}  // namespace client
+}  // namespace diag
+#endif  //  DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONFIG_PARSER_JSON_CONFIG_READER_H
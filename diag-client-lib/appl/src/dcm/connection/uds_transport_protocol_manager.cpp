@@ -14,9 +14,10 @@ namespace diag {
 namespace client {
 namespace uds_transport {
 //ctor
-UdsTransportProtocolManager::UdsTransportProtocolManager(/* pass the protocol kind */)
+UdsTransportProtocolManager::UdsTransportProtocolManager(core_type::Clock &clock,
+                                                         boost_support::socket::IoContext &io_context)
     : doip_transport_handler{std::make_unique<doip_client::transport_protocol_handler::DoipTransportProtocolHandler>(
-          handler_id_count, *this)} {}
+          handler_id_count, *this, clock, io_context)} {}
 
 // initialize all the transport protocol handler
 void UdsTransportProtocolManager::Startup() {
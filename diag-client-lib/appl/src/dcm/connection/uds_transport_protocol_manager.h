@@ -8,6 +8,8 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONNECTION_UDS_TRANSPORT_PROTOCOL_MANAGER_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONNECTION_UDS_TRANSPORT_PROTOCOL_MANAGER_H
 
+#include "core/include/clock.h"
+#include "socket/io_context.h"
 #include "uds_transport/protocol_handler.h"
 
 namespace diag {
@@ -20,8 +22,8 @@ namespace uds_transport {
  */
 class UdsTransportProtocolManager final : public ::uds_transport::UdsTransportProtocolMgr {
  public:
-  //ctor
-  UdsTransportProtocolManager();
+  //ctor, the clock is used for timeout monitoring, the event loop receives messages of all transport protocol handlers
+  UdsTransportProtocolManager(core_type::Clock &clock, boost_support::socket::IoContext &io_context);
 
   //dtor
   ~UdsTransportProtocolManager() override = default;
@@ -8,6 +8,10 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_H
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
 #include "core/include/result.h"
 #include "include/diagnostic_client.h"
 #include "include/diagnostic_client_conversation.h"
@@ -75,6 +79,15 @@ class Conversation {
    */
   virtual void Shutdown() noexcept = 0;
 
+  /**
+   * @brief         Function to abort the Conversation on shutdown of diag client
+   * @details       The running and every further request end immediately without waiting for their response
+   * @param[in]     deadline
+   *                The time until the running request is waited for to return
+   * @return        True when no request is running anymore, False when still running at the deadline
+   */
+  virtual bool Abort(std::chrono::steady_clock::time_point deadline) noexcept = 0;
+
   /**
    * @brief       Function to register the conversation to underlying transport protocol handler
    * @param[in]   connection
@@ -89,6 +102,15 @@ class Conversation {
    */
   virtual ::uds_transport::ConversionHandler &GetConversationHandler() noexcept = 0;
 
+  /**
+   * @brief       Function to update the timing parameters, taking effect with the next request
+   * @param[in]   p2_client_max
+   *              The maximum p2 client time in milliseconds
+   * @param[in]   p2_star_client_max
+   *              The maximum p2 star client time in milliseconds
+   */
+  virtual void UpdateTimingParameters(std::uint16_t, std::uint16_t) noexcept {}
+
   /**
    * @brief       Function to connect to Diagnostic Server
    * @param[in]   target_address
@@ -173,6 +195,25 @@ class Conversation {
         diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
         DiagClient::VehicleInfoResponseError>::FromError(DiagClient::VehicleInfoResponseError::kTransmitFailed);
   }
+
+  /**
+   * @brief       Function to get the token held by every application handle of the conversation
+   * @details     The token outlives the conversation, so that a handle may be destroyed after the conversation
+   * @return      The token shared with the conversation
+   */
+  auto GetHandleToken() const noexcept -> std::shared_ptr<void const> { return handle_token_; }
+
+  /**
+   * @brief       Function to check whether an application handle of the conversation still exists
+   * @return      True when a handle exists, otherwise false
+   */
+  auto HasHandles() const noexcept -> bool { return handle_token_.use_count() > 1; }
+
+ private:
+  /**
+   * @brief       Store the token shared with every application handle
+   */
+  std::shared_ptr<void const> handle_token_{std::make_shared<std::uint8_t const>(0U)};
 };
 
 }  // namespace conversation
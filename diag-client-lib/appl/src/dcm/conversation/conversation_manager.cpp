@@ -8,89 +8,369 @@
 /* includes */
 #include "src/dcm/conversation/conversation_manager.h"
 
+#include <algorithm>
+
 #include "core/include/variant_helper.h"
 #include "src/common/logger.h"
 #include "src/dcm/conversation/dm_conversation.h"
+#include "src/dcm/error_domain/dm_error_domain.h"
+#include "src/dcm/service/dm_uds_message.h"
+#include "utility/allocation_counter.h"
+#include "utility/memory_resource.h"
 
 namespace diag {
 namespace client {
 namespace conversation_manager {
+namespace {
+
+/**
+ * @brief  Number of response messages served from the pool, more responses alive at a time are allocated upstream
+ */
+constexpr std::size_t kResponsePoolBlockCount{utility::capacity::kResponsePoolSize};
+
+/**
+ * @brief  Name of vehicle discovery conversation
+ */
+constexpr std::string_view kVehicleDiscoveryConversationName{"VehicleDiscovery"};
+
+/**
+ * @brief  Function to check whether both configurations use the same connection, only timing may differ
+ */
+auto IsSameConnection(conversation::DMConversationType const &lhs, conversation::DMConversationType const &rhs) noexcept
+    -> bool {
+  return lhs.rx_buffer_size == rhs.rx_buffer_size && lhs.source_address == rhs.source_address &&
+         lhs.tcp_address == rhs.tcp_address && lhs.port_num == rhs.port_num;
+}
+
+/**
+ * @brief  Function to get the resource of the response messages handed to the application
+ * @details The application owns the responses and may keep them after the diag client is destroyed. An injected
+ *          resource is used as is, its lifetime is controlled by the application. Otherwise the responses are served
+ *          from a pool shared by all diag clients, which is never destroyed.
+ */
+auto GetResponseResource(std::pmr::memory_resource *memory_resource) noexcept -> std::pmr::memory_resource * {
+  if (memory_resource != std::pmr::get_default_resource()) { return memory_resource; }
+  static utility::memory::FixedBlockPoolResource *const response_pool{new utility::memory::FixedBlockPoolResource{
+      utility::memory::ResourceAllocated::GetAllocationSize(sizeof(uds_message::DmUdsResponse)),
+      kResponsePoolBlockCount, std::pmr::new_delete_resource()}};
+  return response_pool;
+}
+
+}  // namespace
 
 ConversationManager::ConversationManager(
     diag::client::config_parser::DcmClientConfig config,
-    diag::client::uds_transport::UdsTransportProtocolManager &uds_transport_mgr) noexcept
-    : uds_transport_mgr_{uds_transport_mgr} {
+    diag::client::uds_transport::UdsTransportProtocolManager &uds_transport_mgr,
+    std::pmr::memory_resource *memory_resource, core_type::Clock &clock) noexcept
+    : uds_transport_mgr_{uds_transport_mgr},
+      memory_resource_{memory_resource},
+      clock_{clock} {
   // store the conversation config (vd & dm) out of passed config
   StoreConversationConfig(config);
+  if constexpr (utility::capacity::kStaticCapacity) {
+    // create all conversations upfront, so that no conversation is allocated after initialization
+    for (ConversationEntry &entry: conversations_) {
+      entry.storage.conversation = CreateConversation(entry, memory_resource_);
+    }
+  }
 }
 
 void ConversationManager::Startup() noexcept {}
 
-void ConversationManager::Shutdown() noexcept {}
+void ConversationManager::Shutdown() noexcept {
+  std::lock_guard<std::mutex> const lock{conversations_mutex_};
+  // close the sockets left open by the application, vehicle discovery is shut down by the dcm client
+  for (ConversationEntry &entry: conversations_) {
+    if (entry.storage.conversation &&
+        std::holds_alternative<conversation::DMConversationType>(entry.storage.conversation_type)) {
+      entry.storage.conversation->Shutdown();
+    }
+  }
+  for (RetiredConversation &retired: retired_conversations_) { retired.conversation->Shutdown(); }
+  ReleaseRetiredConversations();
+}
+
+bool ConversationManager::Abort(std::chrono::steady_clock::time_point deadline) noexcept {
+  bool all_aborted{true};
+  std::lock_guard<std::mutex> const lock{conversations_mutex_};
+  // an aborted request ends without waiting for its timeout, all of them share the deadline
+  for (ConversationEntry &entry: conversations_) {
+    if (entry.storage.conversation && !entry.storage.conversation->Abort(deadline)) {
+      all_aborted = false;
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          __FILE__, __LINE__, __func__, [&entry](std::stringstream &msg) {
+            msg << "'" << entry.name << "'"
+                << "-> "
+                << "Request still running after abort on shutdown";
+          });
+    }
+  }
+  for (RetiredConversation &retired: retired_conversations_) {
+    if (!retired.conversation->Abort(deadline)) {
+      all_aborted = false;
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          __FILE__, __LINE__, __func__, [](std::stringstream &msg) {
+            msg << "Request of drained conversation still running after abort on shutdown";
+          });
+    }
+  }
+  return all_aborted;
+}
 
 diag::client::conversation::Conversation &ConversationManager::GetDiagnosticClientConversation(
-    std::string_view conversation_name) noexcept {
+    std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
+  std::lock_guard<std::mutex> const lock{conversations_mutex_};
   // find the conversation from config stored
-  auto it = conversation_map_.find(std::string{conversation_name});
-  if (it != conversation_map_.end()) {
-    std::string const conversation_name_in_map{it->first};
-    it->second.conversation = std::visit(
-        core_type::visit::overloaded{
-            [this, &conversation_name_in_map](conversation::DMConversationType conversation_type) noexcept {
-              // Create the conversation
-              std::unique_ptr<diag::client::conversation::Conversation> conversation{
-                  std::make_unique<diag::client::conversation::DmConversation>(conversation_name_in_map,
-                                                                               conversation_type)};
-              // Register the connection
-              conversation->RegisterConnection(uds_transport_mgr_.GetTransportProtocolHandler().CreateTcpConnection(
-                  conversation->GetConversationHandler(), conversation_type.tcp_address, conversation_type.port_num));
-              return conversation;
-            },
-            [this, &conversation_name_in_map](conversation::VDConversationType conversation_type) noexcept {
-              // Create the conversation
-              std::unique_ptr<diag::client::conversation::Conversation> conversation{
-                  std::make_unique<diag::client::conversation::VdConversation>(conversation_name_in_map,
-                                                                               conversation_type)};
-              // Register the connection
-              conversation->RegisterConnection(uds_transport_mgr_.GetTransportProtocolHandler().CreateUdpConnection(
-                  conversation->GetConversationHandler(), conversation_type.udp_address, conversation_type.port_num));
-              return conversation;
-            }},
-        it->second.conversation_type);
+  auto it = std::find_if(conversations_.begin(), conversations_.end(),
+                         [conversation_name](ConversationEntry const &entry) {
+                           return entry.name == conversation_name;
+                         });
+  if (it != conversations_.end()) {
+    if constexpr (!utility::capacity::kStaticCapacity) {
+      it->storage.conversation =
+          CreateConversation(*it, memory_resource != nullptr ? memory_resource : memory_resource_);
+    }
   } else {
     logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatal(
         __FILE__, __LINE__, __func__, [conversation_name](std::stringstream &msg) {
           msg << "Invalid conversation name: '" << conversation_name << "', provide correct name as per config file";
         });
   }
-  return *(it->second.conversation);
+  return *(it->storage.conversation);
+}
+
+auto ConversationManager::GetMetricsSnapshot() const noexcept -> metrics::MetricsSnapshot {
+  metrics::MetricsSnapshot snapshot{};
+  {
+    std::lock_guard<std::mutex> const lock{conversations_mutex_};
+    for (ConversationEntry const &entry: conversations_) {
+      if (entry.storage.metrics) { snapshot.emplace_back(entry.storage.metrics->GetSnapshot(entry.name)); }
+    }
+  }
+  std::sort(snapshot.begin(), snapshot.end(),
+            [](metrics::ConversationMetricsSnapshot const &lhs, metrics::ConversationMetricsSnapshot const &rhs) {
+              return lhs.conversation_name < rhs.conversation_name;
+            });
+  return snapshot;
+}
+
+auto ConversationManager::Reload(diag::client::config_parser::DcmClientConfig config) noexcept -> Result<void> {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
+  std::lock_guard<std::mutex> const lock{conversations_mutex_};
+  {  // Vehicle discovery is shared by all conversations and kept as it is
+    auto const it = std::find_if(conversations_.begin(), conversations_.end(), [](ConversationEntry const &entry) {
+      return entry.name == kVehicleDiscoveryConversationName;
+    });
+    conversation::VDConversationType const &vd_conversation_type{
+        std::get<conversation::VDConversationType>(it->storage.conversation_type)};
+    if (vd_conversation_type.udp_address != config.udp_ip_address ||
+        vd_conversation_type.udp_broadcast_address != config.udp_broadcast_address) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          __FILE__, __LINE__, __func__, [](std::stringstream &msg) {
+            msg << "Reload rejected, vehicle discovery addresses are changed by DeInitialize() and Initialize() only";
+          });
+      return Result<void>::FromError(error_domain::MakeErrorCode(error_domain::DmErrorErrc::kReloadFailed));
+    }
+  }
+
+  // release the objects drained by former reloads, before draining further ones
+  ReleaseRetiredConversations();
+
+  auto const configured_begin = config.conversations.cbegin();
+  auto const configured_end = std::next(configured_begin, static_cast<std::ptrdiff_t>(GetConversationCount(config)));
+  std::size_t updated_count{0U};
+  std::size_t replaced_count{0U};
+  std::size_t removed_count{0U};
+  std::size_t added_count{0U};
+
+  {  // Update or remove the running conversations
+    auto it = conversations_.begin();
+    while (it != conversations_.end()) {
+      conversation::DMConversationType *const running_type{
+          std::get_if<conversation::DMConversationType>(&it->storage.conversation_type)};
+      if (running_type == nullptr) {
+        ++it;
+        continue;
+      }
+      auto const configured =
+          std::find_if(configured_begin, configured_end, [&it](config_parser::ConversationType const &conversation) {
+            return conversation.conversation_name == it->name;
+          });
+      if (configured == configured_end) {
+        // drain the removed conversation, its object stays usable by the application holding it
+        if (it->storage.conversation) {
+          retired_conversations_.emplace_back(
+              RetiredConversation{std::move(it->storage.metrics), std::move(it->storage.conversation)});
+        }
+        it = conversations_.erase(it);
+        ++removed_count;
+        continue;
+      }
+      conversation::DMConversationType configured_type{ToConversationType(*configured)};
+      if (!IsSameConnection(*running_type, configured_type)) {
+        // drain the running object, the next lookup gets an object connected as configured
+        if (it->storage.conversation) {
+          // the metrics are shared with the next object, they must outlive the drained one also when removed later
+          retired_conversations_.emplace_back(
+              RetiredConversation{it->storage.metrics, std::move(it->storage.conversation)});
+        }
+        *running_type = std::move(configured_type);
+        if constexpr (utility::capacity::kStaticCapacity) {
+          it->storage.conversation = CreateConversation(*it, memory_resource_);
+        }
+        ++replaced_count;
+      } else if (running_type->p2_client_max != configured_type.p2_client_max ||
+                 running_type->p2_star_client_max != configured_type.p2_star_client_max) {
+        running_type->p2_client_max = configured_type.p2_client_max;
+        running_type->p2_star_client_max = configured_type.p2_star_client_max;
+        if (it->storage.conversation) {
+          it->storage.conversation->UpdateTimingParameters(configured_type.p2_client_max,
+                                                           configured_type.p2_star_client_max);
+        }
+        ++updated_count;
+      }
+      ++it;
+    }
+  }
+
+  {  // Add the new conversations
+    for (auto configured = configured_begin; configured != configured_end; ++configured) {
+      auto const is_same_name = [configured](auto const &other) {
+        return other.conversation_name == configured->conversation_name;
+      };
+      // the first conversation of a name is kept
+      if (std::find_if(configured_begin, configured, is_same_name) != configured) { continue; }
+      if (std::find_if(conversations_.begin(), conversations_.end(), [configured](ConversationEntry const &entry) {
+            return entry.name == configured->conversation_name;
+          }) != conversations_.end()) {
+        continue;
+      }
+      ConversationEntry &entry{conversations_.emplace_back(ConversationEntry{
+          configured->conversation_name, ConversationStorage{ToConversationType(*configured), nullptr,
+                                                             std::make_shared<conversation::ConversationMetrics>()}})};
+      if constexpr (utility::capacity::kStaticCapacity) {
+        entry.storage.conversation = CreateConversation(entry, memory_resource_);
+      }
+      ++added_count;
+    }
+  }
+
+  logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+      __FILE__, __LINE__, __func__,
+      [added_count, updated_count, replaced_count, removed_count](std::stringstream &msg) {
+        msg << "Configuration reloaded, conversations added: " << added_count << ", updated: " << updated_count
+            << ", replaced: " << replaced_count << ", removed: " << removed_count;
+      });
+  return Result<void>::FromValue();
 }
 
 void ConversationManager::StoreConversationConfig(diag::client::config_parser::DcmClientConfig &config) noexcept {
+  std::size_t const conversation_count{GetConversationCount(config)};
+  conversations_.reserve(conversation_count + 1U);
+
   {  // Create Vehicle discovery config
     conversation::VDConversationType conversion_identifier{};
     conversion_identifier.udp_address = config.udp_ip_address;
     conversion_identifier.udp_broadcast_address = config.udp_broadcast_address;
     conversion_identifier.port_num = 0U;  // random selection of port number
-    (void) conversation_map_.emplace("VehicleDiscovery", ConversationStorage{conversion_identifier, nullptr});
+    (void) conversations_.emplace_back(
+        ConversationEntry{std::string{kVehicleDiscoveryConversationName},
+                          ConversationStorage{conversion_identifier, nullptr, nullptr}});
   }
 
   {  // Create Conversation config
-    for (std::uint8_t conv_count{0U}; conv_count < config.num_of_conversation; conv_count++) {
-      conversation::DMConversationType conversion_identifier{};
-      conversion_identifier.rx_buffer_size = config.conversations[conv_count].rx_buffer_size;
-      conversion_identifier.p2_client_max = config.conversations[conv_count].p2_client_max;
-      conversion_identifier.p2_star_client_max = config.conversations[conv_count].p2_star_client_max;
-      conversion_identifier.source_address = config.conversations[conv_count].source_address;
-      conversion_identifier.tcp_address = config.conversations[conv_count].network.tcp_ip_address;
-      conversion_identifier.port_num = 0U;  // random selection of port number
-      // push to config map
-      (void) conversation_map_.emplace(config.conversations[conv_count].conversation_name,
-                                       ConversationStorage{conversion_identifier, nullptr});
+    for (std::size_t conv_count{0U}; conv_count < conversation_count; conv_count++) {
+      config_parser::ConversationType const &conversation{config.conversations[conv_count]};
+      auto const it = std::find_if(
+          conversations_.begin(), conversations_.end(),
+          [&conversation](ConversationEntry const &entry) { return entry.name == conversation.conversation_name; });
+      // the first conversation of a name is kept
+      if (it != conversations_.end()) { continue; }
+      // push to config container
+      (void) conversations_.emplace_back(ConversationEntry{
+          conversation.conversation_name, ConversationStorage{ToConversationType(conversation), nullptr,
+                                                              std::make_shared<conversation::ConversationMetrics>()}});
     }
   }
 }
 
+std::size_t ConversationManager::GetConversationCount(
+    diag::client::config_parser::DcmClientConfig const &config) noexcept {
+  std::size_t const conversation_count{std::min<std::size_t>(config.num_of_conversation, config.conversations.size())};
+  if (conversation_count > utility::capacity::kMaxConversationCount) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        __FILE__, __LINE__, __func__, [conversation_count](std::stringstream &msg) {
+          msg << "Configured " << conversation_count << " conversations, only the first "
+              << utility::capacity::kMaxConversationCount << " are used";
+        });
+    return utility::capacity::kMaxConversationCount;
+  }
+  return conversation_count;
+}
+
+void ConversationManager::ReleaseRetiredConversations() noexcept {
+  auto it = retired_conversations_.begin();
+  while (it != retired_conversations_.end()) {
+    if (it->conversation->HasHandles()) {
+      ++it;
+      continue;
+    }
+    // the application may have dropped its handle without shutting down
+    it->conversation->Shutdown();
+    it = retired_conversations_.erase(it);
+  }
+}
+
+conversation::DMConversationType ConversationManager::ToConversationType(
+    diag::client::config_parser::ConversationType const &conversation) noexcept {
+  conversation::DMConversationType conversion_identifier{};
+  conversion_identifier.rx_buffer_size = conversation.rx_buffer_size;
+  if (conversion_identifier.rx_buffer_size > utility::capacity::kMaxRxBufferSize) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        __FILE__, __LINE__, __func__, [&conversation](std::stringstream &msg) {
+          msg << "'" << conversation.conversation_name << "'"
+              << "-> "
+              << "Rx buffer size " << conversation.rx_buffer_size << " is clamped to "
+              << utility::capacity::kMaxRxBufferSize;
+        });
+    conversion_identifier.rx_buffer_size = utility::capacity::kMaxRxBufferSize;
+  }
+  conversion_identifier.p2_client_max = conversation.p2_client_max;
+  conversion_identifier.p2_star_client_max = conversation.p2_star_client_max;
+  conversion_identifier.source_address = conversation.source_address;
+  conversion_identifier.tcp_address = conversation.network.tcp_ip_address;
+  conversion_identifier.port_num = 0U;  // random selection of port number
+  return conversion_identifier;
+}
+
+std::unique_ptr<diag::client::conversation::Conversation> ConversationManager::CreateConversation(
+    ConversationEntry &entry, std::pmr::memory_resource *memory_resource) noexcept {
+  return std::visit(
+      core_type::visit::overloaded{
+          [this, &entry, memory_resource](conversation::DMConversationType conversation_type) noexcept {
+            // Create the conversation
+            std::unique_ptr<diag::client::conversation::Conversation> conversation{
+                std::make_unique<diag::client::conversation::DmConversation>(
+                    entry.name, conversation_type, *entry.storage.metrics, memory_resource,
+                    GetResponseResource(memory_resource), clock_)};
+            // Register the connection
+            conversation->RegisterConnection(uds_transport_mgr_.GetTransportProtocolHandler().CreateTcpConnection(
+                conversation->GetConversationHandler(), conversation_type.tcp_address, conversation_type.port_num));
+            return conversation;
+          },
+          [this, &entry](conversation::VDConversationType conversation_type) noexcept {
+            // Create the conversation
+            std::unique_ptr<diag::client::conversation::Conversation> conversation{
+                std::make_unique<diag::client::conversation::VdConversation>(entry.name, conversation_type)};
+            // Register the connection
+            conversation->RegisterConnection(uds_transport_mgr_.GetTransportProtocolHandler().CreateUdpConnection(
+                conversation->GetConversationHandler(), conversation_type.udp_address, conversation_type.port_num));
+            return conversation;
+          }},
+      entry.storage.conversation_type);
+}
+
 }  // namespace conversation_manager
 }  // namespace client
 }  // namespace diag
\ No newline at end of file
@@ -8,16 +8,29 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_MANAGER_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_MANAGER_H
 /* includes */
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
+#include "core/include/static_vector.h"
+
+#include "include/diagnostic_client_metrics.h"
+#include "include/diagnostic_client_result.h"
 #include "src/dcm/config_parser/config_parser_type.h"
 #include "src/dcm/connection/uds_transport_protocol_manager.h"
 #include "src/dcm/conversation/conversation.h"
+#include "src/dcm/conversation/conversation_metrics.h"
 #include "src/dcm/conversation/dm_conversation_type.h"
 #include "src/dcm/conversation/vd_conversation.h"
 #include "src/dcm/conversation/vd_conversation_type.h"
+#include "utility/static_capacity.h"
 
 namespace diag {
 namespace client {
@@ -34,9 +47,14 @@ class ConversationManager {
    *                The configuration of dcm client
    * @param[in]     uds_transport_mgr
    *                The reference to Uds transport manger
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations
+   * @param[in]     clock
+   *                The clock used for timeout monitoring of all conversations
    */
   ConversationManager(diag::client::config_parser::DcmClientConfig config,
-                      diag::client::uds_transport::UdsTransportProtocolManager &uds_transport_mgr) noexcept;
+                      diag::client::uds_transport::UdsTransportProtocolManager &uds_transport_mgr,
+                      std::pmr::memory_resource *memory_resource, core_type::Clock &clock) noexcept;
 
   /**
    * @brief         Destructs an instance of ConversationManager
@@ -50,17 +68,54 @@ class ConversationManager {
 
   /**
    * @brief         Function to shutdown the ConversationManager
+   * @details       The connections of all conversations are stopped
    */
   void Shutdown() noexcept;
 
+  /**
+   * @brief         Function to abort all conversations on shutdown of diag client
+   * @details       The running and every further request end immediately without waiting for their response
+   * @param[in]     deadline
+   *                The time until the running requests are waited for to return
+   * @return        True when no request is running anymore, False when any is still running at the deadline
+   */
+  bool Abort(std::chrono::steady_clock::time_point deadline) noexcept;
+
   /**
    * @brief       Function to get DM conversation object based on conversation name
+   * @details     A new conversation object is created on every call. In the embedded profile all conversations are
+   *              created once at construction instead and the same object is returned, memory_resource is ignored then
    * @param[in]   conversation_name
    *              The passed conversation name
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation, nullptr for the one of conversation manager
    * @return      The reference to diag client conversation as per passed conversation name
    */
   diag::client::conversation::Conversation &GetDiagnosticClientConversation(
-      std::string_view conversation_name) noexcept;
+      std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept;
+
+  /**
+   * @brief       Function to get the latency metrics of all DM conversations
+   * @details     The metrics of a conversation are kept across all conversation objects created for its name
+   * @return      The metrics of all DM conversations sorted by conversation name
+   */
+  auto GetMetricsSnapshot() const noexcept -> metrics::MetricsSnapshot;
+
+  /**
+   * @brief       Function to apply a new configuration to the running conversations
+   * @details     Conversations missing in the new configuration are removed, conversations with changed timing are
+   *              updated in place and new conversations are added. Conversations with a changed connection, i.e. rx
+   *              buffer size, source address or tcp ip address, get a new object on the next
+   *              GetDiagnosticClientConversation(). Removed and replaced objects are drained: they stay usable for the
+   *              application holding them, e.g. to complete a request and shut down, and are released by a later
+   *              reload or shutdown once no handle of the application refers to them. Unchanged conversations are not
+   *              touched.
+   * @param[in]   config
+   *              The new configuration of dcm client
+   * @return      Result with void in case of success, otherwise error is returned when the vehicle discovery addresses
+   *              change, nothing is applied then
+   */
+  auto Reload(diag::client::config_parser::DcmClientConfig config) noexcept -> Result<void>;
 
  private:
   /**
@@ -76,17 +131,83 @@ class ConversationManager {
      * @brief      Store pointer to conversation object
      */
     std::unique_ptr<diag::client::conversation::Conversation> conversation{};
+
+    /**
+     * @brief      Store pointer to metrics of DM conversation, shared with its objects drained by a reload, empty for
+     *             vehicle discovery
+     */
+    std::shared_ptr<conversation::ConversationMetrics> metrics{};
+  };
+
+  /**
+   * @brief      Store conversation along with its configured name
+   */
+  struct ConversationEntry {
+    /**
+     * @brief      Store conversation name
+     */
+    std::string name{};
+
+    /**
+     * @brief      Store conversation
+     */
+    ConversationStorage storage{};
+  };
+
+  /**
+   * @brief      Store conversation object drained by a reload
+   */
+  struct RetiredConversation {
+    /**
+     * @brief      Store pointer to metrics referenced by the conversation object, kept alive as long as the object
+     */
+    std::shared_ptr<conversation::ConversationMetrics> metrics{};
+
+    /**
+     * @brief      Store pointer to conversation object, declared last to be destroyed before its metrics
+     */
+    std::unique_ptr<diag::client::conversation::Conversation> conversation{};
   };
 
+  /**
+   * @brief      Type alias of container of all conversations, fixed-capacity in the embedded profile. The vehicle
+   *             discovery conversation takes one entry in addition to the DM conversations
+   */
+  using ConversationContainer =
+      std::conditional_t<utility::capacity::kStaticCapacity,
+                         core_type::StaticVector<ConversationEntry, utility::capacity::kMaxConversationCount + 1U>,
+                         std::vector<ConversationEntry>>;
+
   /**
    * @brief         Store the reference to uds transport manager
    */
   uds_transport::UdsTransportProtocolManager &uds_transport_mgr_;
 
   /**
-   * @brief         Map to store conversation object(dm) along with conversation name
+   * @brief         Store the memory resource backing all conversations
+   */
+  std::pmr::memory_resource *memory_resource_;
+
+  /**
+   * @brief         Store the clock used for timeout monitoring of all conversations
    */
-  std::unordered_map<std::string, ConversationStorage> conversation_map_;
+  core_type::Clock &clock_;
+
+  /**
+   * @brief         Store conversation objects along with conversation name, looked up by a linear search which beats
+   *                hashing for the handful of conversations configured
+   */
+  ConversationContainer conversations_;
+
+  /**
+   * @brief         Store conversation objects removed or replaced by a reload, until the application releases them
+   */
+  std::vector<RetiredConversation> retired_conversations_;
+
+  /**
+   * @brief         For locking conversations against concurrent lookup and reload
+   */
+  mutable std::mutex conversations_mutex_;
 
   /**
    * @brief       Function to store the dcm client configuration internally
@@ -94,6 +215,40 @@ class ConversationManager {
    *              The Dcm client configuration
    */
   void StoreConversationConfig(diag::client::config_parser::DcmClientConfig &config) noexcept;
+
+  /**
+   * @brief       Function to get the number of configured conversations to be used, limited to the capacity
+   * @param[in]   config
+   *              The Dcm client configuration
+   * @return      The number of conversations used from the start of configured conversations
+   */
+  static std::size_t GetConversationCount(diag::client::config_parser::DcmClientConfig const &config) noexcept;
+
+  /**
+   * @brief       Function to get the stored configuration of a configured conversation
+   * @param[in]   conversation
+   *              The configured conversation
+   * @return      The configuration stored for the conversation, with rx buffer size limited to the capacity
+   */
+  static conversation::DMConversationType ToConversationType(
+      diag::client::config_parser::ConversationType const &conversation) noexcept;
+
+  /**
+   * @brief       Function to shut down and release the retired conversations no longer held by the application
+   * @details     Must be called with conversations_mutex_ locked
+   */
+  void ReleaseRetiredConversations() noexcept;
+
+  /**
+   * @brief       Function to create the conversation object of a stored configuration
+   * @param[in]   entry
+   *              The stored configuration along with conversation name
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation
+   * @return      The created conversation with its connection registered
+   */
+  std::unique_ptr<diag::client::conversation::Conversation> CreateConversation(
+      ConversationEntry &entry, std::pmr::memory_resource *memory_resource) noexcept;
 };
 }  // namespace conversation_manager
 }  // namespace client
@@ -0,0 +1,130 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+/* includes */
+#include "src/dcm/conversation/conversation_metrics.h"
+
+#include <string>
+
+namespace diag {
+namespace client {
+namespace conversation {
+namespace {
+
+/**
+ * @brief       Function to convert a measured duration into microseconds
+ * @param[in]   duration
+ *              The measured duration
+ * @return      The duration in microseconds, negative durations are clamped to zero
+ */
+auto ToMicroseconds(ConversationMetrics::Clock::duration duration) noexcept -> std::uint64_t {
+  std::int64_t const microseconds{std::chrono::duration_cast<std::chrono::microseconds>(duration).count()};
+  return microseconds > 0 ? static_cast<std::uint64_t>(microseconds) : 0U;
+}
+
+/**
+ * @brief       Function to summarize a histogram
+ * @param[in]   histogram
+ *              The histogram to be summarized
+ * @return      The summary of the histogram
+ */
+auto ToHistogramSnapshot(utility::metrics::LatencyHistogram const &histogram) noexcept -> metrics::HistogramSnapshot {
+  utility::metrics::LatencyHistogram::Snapshot const snapshot{histogram.TakeSnapshot()};
+  metrics::HistogramSnapshot histogram_snapshot{};
+  histogram_snapshot.count = snapshot.count;
+  histogram_snapshot.min = snapshot.min;
+  histogram_snapshot.max = snapshot.max;
+  histogram_snapshot.mean = snapshot.GetMean();
+  histogram_snapshot.p50 = snapshot.GetValueAtPercentile(50.0);
+  histogram_snapshot.p90 = snapshot.GetValueAtPercentile(90.0);
+  histogram_snapshot.p99 = snapshot.GetValueAtPercentile(99.0);
+  histogram_snapshot.p999 = snapshot.GetValueAtPercentile(99.9);
+  return histogram_snapshot;
+}
+
+}  // namespace
+
+ConversationMetrics::ConversationMetrics() noexcept
+    : routing_activation_{},
+      conversation_histograms_{},
+      service_histograms_{} {}
+
+ConversationMetrics::~ConversationMetrics() noexcept {
+  for (std::atomic<RequestHistograms *> &service_histograms: service_histograms_) {
+    delete service_histograms.load(std::memory_order_acquire);
+  }
+}
+
+void ConversationMetrics::RecordRoutingActivation(Clock::duration duration) noexcept {
+  routing_activation_.Record(ToMicroseconds(duration));
+}
+
+void ConversationMetrics::RecordAckLatency(std::uint8_t service_id, Clock::duration duration) noexcept {
+  std::uint64_t const microseconds{ToMicroseconds(duration)};
+  conversation_histograms_.ack_latency.Record(microseconds);
+  GetServiceHistograms(service_id).ack_latency.Record(microseconds);
+}
+
+void ConversationMetrics::RecordTimeToFirstByte(std::uint8_t service_id, Clock::duration duration) noexcept {
+  std::uint64_t const microseconds{ToMicroseconds(duration)};
+  conversation_histograms_.time_to_first_byte.Record(microseconds);
+  GetServiceHistograms(service_id).time_to_first_byte.Record(microseconds);
+}
+
+void ConversationMetrics::RecordTotalResponseTime(std::uint8_t service_id, Clock::duration duration) noexcept {
+  std::uint64_t const microseconds{ToMicroseconds(duration)};
+  conversation_histograms_.total_response_time.Record(microseconds);
+  GetServiceHistograms(service_id).total_response_time.Record(microseconds);
+}
+
+void ConversationMetrics::RecordPendingResponseCount(std::uint8_t service_id, std::uint32_t pending_count) noexcept {
+  conversation_histograms_.pending_response_count.Record(pending_count);
+  GetServiceHistograms(service_id).pending_response_count.Record(pending_count);
+}
+
+auto ConversationMetrics::GetSnapshot(std::string_view conversation_name) const noexcept
+    -> metrics::ConversationMetricsSnapshot {
+  metrics::ConversationMetricsSnapshot snapshot{};
+  snapshot.conversation_name = std::string{conversation_name};
+  snapshot.routing_activation = ToHistogramSnapshot(routing_activation_);
+  snapshot.ack_latency = ToHistogramSnapshot(conversation_histograms_.ack_latency);
+  snapshot.time_to_first_byte = ToHistogramSnapshot(conversation_histograms_.time_to_first_byte);
+  snapshot.total_response_time = ToHistogramSnapshot(conversation_histograms_.total_response_time);
+  snapshot.pending_response_count = ToHistogramSnapshot(conversation_histograms_.pending_response_count);
+  for (std::size_t service_id{0U}; service_id < service_histograms_.size(); ++service_id) {
+    RequestHistograms const *const service_histograms{service_histograms_[service_id].load(std::memory_order_acquire)};
+    if (service_histograms != nullptr) {
+      metrics::ServiceMetricsSnapshot service_snapshot{};
+      service_snapshot.service_id = static_cast<std::uint8_t>(service_id);
+      service_snapshot.ack_latency = ToHistogramSnapshot(service_histograms->ack_latency);
+      service_snapshot.time_to_first_byte = ToHistogramSnapshot(service_histograms->time_to_first_byte);
+      service_snapshot.total_response_time = ToHistogramSnapshot(service_histograms->total_response_time);
+      service_snapshot.pending_response_count = ToHistogramSnapshot(service_histograms->pending_response_count);
+      snapshot.services.emplace_back(service_snapshot);
+    }
+  }
+  return snapshot;
+}
+
+auto ConversationMetrics::GetServiceHistograms(std::uint8_t service_id) noexcept -> RequestHistograms & {
+  std::atomic<RequestHistograms *> &service_histograms{service_histograms_[service_id]};
+  RequestHistograms *histograms{service_histograms.load(std::memory_order_acquire)};
+  if (histograms == nullptr) {
+    // first request with this service identifier, publish new histograms unless another thread was faster
+    RequestHistograms *const new_histograms{new RequestHistograms{}};
+    if (service_histograms.compare_exchange_strong(histograms, new_histograms, std::memory_order_acq_rel)) {
+      histograms = new_histograms;
+    } else {
+      delete new_histograms;
+    }
+  }
+  return *histograms;
+}
+
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
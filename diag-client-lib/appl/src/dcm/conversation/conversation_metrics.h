@@ -0,0 +1,162 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_METRICS_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_METRICS_H
+/* includes */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "include/diagnostic_client_metrics.h"
+#include "utility/latency_histogram.h"
+
+namespace diag {
+namespace client {
+namespace conversation {
+
+/**
+ * @brief    Class to collect latency histograms of one conversation, in total and per service identifier
+ * @details  Recording is lock-free and may happen concurrently to taking a snapshot. The histograms of a service
+ *           identifier are allocated once on its first request and kept until the conversation manager is destroyed.
+ */
+class ConversationMetrics final {
+ public:
+  /**
+   * @brief         Type alias of the clock used for all measurements
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief         Constructs an instance of ConversationMetrics
+   */
+  ConversationMetrics() noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  ConversationMetrics(const ConversationMetrics &other) noexcept = delete;
+  ConversationMetrics &operator=(const ConversationMetrics &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  ConversationMetrics(ConversationMetrics &&other) noexcept = delete;
+  ConversationMetrics &operator=(ConversationMetrics &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of ConversationMetrics
+   */
+  ~ConversationMetrics() noexcept;
+
+  /**
+   * @brief         Function to record the duration of connecting including routing activation
+   * @param[in]     duration
+   *                The measured duration
+   */
+  void RecordRoutingActivation(Clock::duration duration) noexcept;
+
+  /**
+   * @brief         Function to record the time until the positive acknowledgement was received
+   * @param[in]     service_id
+   *                The service identifier of the request
+   * @param[in]     duration
+   *                The measured duration
+   */
+  void RecordAckLatency(std::uint8_t service_id, Clock::duration duration) noexcept;
+
+  /**
+   * @brief         Function to record the time until the first response was received
+   * @param[in]     service_id
+   *                The service identifier of the request
+   * @param[in]     duration
+   *                The measured duration
+   */
+  void RecordTimeToFirstByte(std::uint8_t service_id, Clock::duration duration) noexcept;
+
+  /**
+   * @brief         Function to record the time until the final response was received
+   * @param[in]     service_id
+   *                The service identifier of the request
+   * @param[in]     duration
+   *                The measured duration
+   */
+  void RecordTotalResponseTime(std::uint8_t service_id, Clock::duration duration) noexcept;
+
+  /**
+   * @brief         Function to record the number of pending responses received for one request
+   * @param[in]     service_id
+   *                The service identifier of the request
+   * @param[in]     pending_count
+   *                The number of pending responses
+   */
+  void RecordPendingResponseCount(std::uint8_t service_id, std::uint32_t pending_count) noexcept;
+
+  /**
+   * @brief         Function to get the snapshot of all histograms
+   * @param[in]     conversation_name
+   *                The name of the conversation stored in the snapshot
+   * @return        The summary of all histograms
+   */
+  auto GetSnapshot(std::string_view conversation_name) const noexcept -> metrics::ConversationMetricsSnapshot;
+
+ private:
+  /**
+   * @brief         Histograms recorded for every request
+   */
+  struct RequestHistograms {
+    /**
+     * @brief       Histogram of the acknowledgement latency
+     */
+    utility::metrics::LatencyHistogram ack_latency{};
+
+    /**
+     * @brief       Histogram of the time to first response
+     */
+    utility::metrics::LatencyHistogram time_to_first_byte{};
+
+    /**
+     * @brief       Histogram of the time to final response
+     */
+    utility::metrics::LatencyHistogram total_response_time{};
+
+    /**
+     * @brief       Histogram of the pending response count
+     */
+    utility::metrics::LatencyHistogram pending_response_count{};
+  };
+
+  /**
+   * @brief         Function to get the histograms of a service identifier, allocated on first use
+   * @param[in]     service_id
+   *                The service identifier
+   * @return        The histograms of the service identifier
+   */
+  auto GetServiceHistograms(std::uint8_t service_id) noexcept -> RequestHistograms &;
+
+  /**
+   * @brief         Store the histogram of routing activation
+   */
+  utility::metrics::LatencyHistogram routing_activation_;
+
+  /**
+   * @brief         Store the histograms of all requests
+   */
+  RequestHistograms conversation_histograms_;
+
+  /**
+   * @brief         Store the histograms per service identifier
+   */
+  std::array<std::atomic<RequestHistograms *>, 256U> service_histograms_;
+};
+
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_CONVERSATION_METRICS_H
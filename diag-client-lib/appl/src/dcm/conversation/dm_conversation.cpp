@@ -12,10 +12,25 @@
 #include "src/common/logger.h"
 #include "src/dcm/service/dm_uds_message.h"
 #include "uds_transport/conversation_handler.h"
+#include "utility/allocation_counter.h"
+#include "utility/static_capacity.h"
+#include "utility/trace.h"
 
 namespace diag {
 namespace client {
 namespace conversation {
+namespace {
+
+/**
+ * @brief  Size of request arena, holding the request and response message exchanged with transport protocol handler
+ */
+constexpr std::size_t kRequestArenaCapacity{512U};
+
+static_assert((2U * utility::memory::ResourceAllocated::GetAllocationSize(sizeof(uds_message::DmUdsMessage))) <=
+                  kRequestArenaCapacity,
+              "Request arena must hold the request and response message");
+
+}  // namespace
 
 /**
  * @brief    Class to manage reception from transport protocol handler to dm connection handler
@@ -102,7 +117,9 @@ class DmConversationHandler final : public ::uds_transport::ConversionHandler {
   DmConversation &dm_conversation_;
 };
 
-DmConversation::DmConversation(std::string_view conversion_name, DMConversationType &conversion_identifier)
+DmConversation::DmConversation(std::string_view conversion_name, DMConversationType &conversion_identifier,
+                               ConversationMetrics &conversation_metrics, std::pmr::memory_resource *memory_resource,
+                               std::pmr::memory_resource *response_resource, core_type::Clock &clock)
     : Conversation{},
       activity_status_{ActivityStatusType::kInactive},
       active_session_{SessionControlType::kDefaultSession},
@@ -113,9 +130,22 @@ DmConversation::DmConversation(std::string_view conversion_name, DMConversationT
       source_address_{conversion_identifier.source_address},
       target_address_{},
       conversation_name_{conversion_name},
-      dm_conversion_handler_{std::make_unique<DmConversationHandler>(conversion_identifier.handler_id, *this)} {
+      request_arena_{kRequestArenaCapacity, memory_resource},
+      response_resource_{response_resource},
+      dm_conversion_handler_{std::make_unique<DmConversationHandler>(conversion_identifier.handler_id, *this)},
+      sync_timer_{clock},
+      request_mutex_{},
+      conversation_metrics_{conversation_metrics},
+      request_start_time_{},
+      first_response_time_{0},
+      pending_response_count_{0U} {
   (void) (active_session_);
   (void) (active_security_level_);
+  if constexpr (utility::capacity::kStaticCapacity) {
+    // size the payload buffers for the largest message upfront, so that they never grow after initialization
+    payload_rx_buffer_.reserve(rx_buffer_size_);
+    payload_tx_buffer_.reserve(rx_buffer_size_);
+  }
 }
 
 DmConversation::~DmConversation() = default;
@@ -148,18 +178,29 @@ void DmConversation::Shutdown() noexcept {
                                                                       });
 }
 
+bool DmConversation::Abort(std::chrono::steady_clock::time_point deadline) noexcept {
+  // end the waits of the running request and of every further one
+  sync_timer_.Shutdown();
+  connection_ptr_->Abort();
+  std::unique_lock<std::timed_mutex> const request_lock{request_mutex_, deadline};
+  return request_lock.owns_lock();
+}
+
 DiagClientConversation::ConnectResult DmConversation::ConnectToDiagServer(std::uint16_t target_address,
                                                                           IpAddress host_ip_addr) noexcept {
+  std::lock_guard<std::timed_mutex> const request_lock{request_mutex_};
   // create an uds message just to get the port number
   // source address required for Routing Activation
   uds_transport::ByteVector payload{};  // empty payload
+  ConversationMetrics::Clock::time_point const connect_start_time{ConversationMetrics::Clock::now()};
   // Send Connect request to doip layer
   DiagClientConversation::ConnectResult const connection_result{static_cast<DiagClientConversation::ConnectResult>(
-      connection_ptr_->ConnectToHost(std::make_unique<diag::client::uds_message::DmUdsMessage>(
-          source_address_, target_address, host_ip_addr, payload)))};
+      connection_ptr_->ConnectToHost(utility::memory::MakeUniqueFromResource<uds_message::DmUdsMessage>(
+          request_arena_.GetUpstreamResource(), source_address_, target_address, host_ip_addr, payload)))};
   remote_address_ = host_ip_addr;
   target_address_ = target_address;
   if (connection_result == DiagClientConversation::ConnectResult::kConnectSuccess) {
+    conversation_metrics_.RecordRoutingActivation(ConversationMetrics::Clock::now() - connect_start_time);
     logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
         __FILE__, __LINE__, __func__, [this](std::stringstream &msg) {
           msg << "'" << conversation_name_ << "'"
@@ -209,17 +250,36 @@ DiagClientConversation::DisconnectResult DmConversation::DisconnectFromDiagServe
 
 Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> DmConversation::SendDiagnosticRequest(
     uds_message::UdsRequestMessageConstPtr message) noexcept {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
+  std::lock_guard<std::timed_mutex> const request_lock{request_mutex_};
   Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> result{
       Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError>::FromError(
           DiagClientConversation::DiagError::kDiagRequestSendFailed)};
   if (message) {
+    // reuse the arena, messages of previous request are released by now unless the server answered late
+    (void) request_arena_.Reset();
     // fill the data
-    uds_transport::ByteVector payload{message->GetPayload()};
+    payload_tx_buffer_.assign(message->GetPayload().begin(), message->GetPayload().end());
+    std::uint8_t const service_id{payload_tx_buffer_.empty() ? std::uint8_t{0U} : payload_tx_buffer_[0U]};
+    utility::trace::TraceScope const trace_scope{"dm", "SendDiagnosticRequest", service_id};
+    // reset the measurement of active request
+    first_response_time_.store(0, std::memory_order_relaxed);
+    pending_response_count_.store(0U, std::memory_order_relaxed);
+    request_start_time_ = ConversationMetrics::Clock::now();
+    // the request keeps the timing it is started with, even when updated meanwhile
+    std::uint16_t const p2_client_max{p2_client_max_.load(std::memory_order_relaxed)};
+    std::uint16_t const p2_star_client_max{p2_star_client_max_.load(std::memory_order_relaxed)};
+    // change state and arm the timer before sending, the response may be received before the transmission returns
+    conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagWaitForRes);
+    sync_timer_.Arm();
     // Initiate Sending of diagnostic request
-    uds_transport::UdsTransportProtocolMgr::TransmissionResult const transmission_result{
-        connection_ptr_->Transmit(std::make_unique<diag::client::uds_message::DmUdsMessage>(
-            source_address_, target_address_, message->GetHostIpAddress(), payload))};
+    uds_transport::UdsTransportProtocolMgr::TransmissionResult const transmission_result{[this, &message]() {
+      utility::trace::TraceScope const transmit_trace_scope{"dm", "TransmitRequest", payload_tx_buffer_.size()};
+      return connection_ptr_->Transmit(utility::memory::MakeUniqueFromResource<uds_message::DmUdsMessage>(
+          &request_arena_, source_address_, target_address_, message->GetHostIpAddress(), payload_tx_buffer_));
+    }()};
     if (transmission_result == uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
+      conversation_metrics_.RecordAckLatency(service_id, ConversationMetrics::Clock::now() - request_start_time_);
       // Diagnostic Request Sent successful
       logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
           __FILE__, __LINE__, __func__, [&](std::stringstream &msg) {
@@ -227,17 +287,16 @@ Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> Dm
                 << "-> "
                 << "Diagnostic Request Sent & Positive Ack received";
           });
-      conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagWaitForRes);
       // Wait P6Max / P2ClientMax
       sync_timer_.WaitForTimeout(
-          [this, &result]() {
+          [this, &result, p2_client_max]() {
             result.EmplaceError(DiagClientConversation::DiagError::kDiagResponseTimeout);
             conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kIdle);
             logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
                 __FILE__, __LINE__, "", [&](std::stringstream &msg) {
                   msg << "'" << conversation_name_ << "'"
                       << "-> "
-                      << "Diagnostic Response P2 Timeout happened after " << p2_client_max_ << " milliseconds";
+                      << "Diagnostic Response P2 Timeout happened after " << p2_client_max << " milliseconds";
                 });
           },
           [this]() {
@@ -251,7 +310,7 @@ Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> Dm
               conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagStartP2StarTimer);
             }
           },
-          std::chrono::milliseconds{p2_client_max_});
+          std::chrono::milliseconds{p2_client_max});
 
       // Wait until final response or timeout
       while (conversation_state_.GetConversationStateContext().GetActiveState().GetState() !=
@@ -267,12 +326,12 @@ Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> Dm
           case ConversationState::kDiagStartP2StarTimer:
             // wait P6Star/ P2 star client time
             sync_timer_.WaitForTimeout(
-                [this, &result]() {
+                [this, &result, p2_star_client_max]() {
                   logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
                       __FILE__, __LINE__, "", [&](std::stringstream &msg) {
                         msg << "'" << conversation_name_ << "'"
                             << "-> "
-                            << "Diagnostic Response P2 Star Timeout happened after " << p2_star_client_max_
+                            << "Diagnostic Response P2 Star Timeout happened after " << p2_star_client_max
                             << " milliseconds";
                         ;
                       });
@@ -291,11 +350,17 @@ Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> Dm
                         ConversationState::kDiagStartP2StarTimer);
                   }
                 },
-                std::chrono::milliseconds{p2_star_client_max_});
+                std::chrono::milliseconds{p2_star_client_max});
             break;
           case ConversationState::kDiagSuccess:
             // change state to idle, form the uds response and return
-            result.EmplaceValue(std::make_unique<diag::client::uds_message::DmUdsResponse>(payload_rx_buffer_));
+            conversation_metrics_.RecordTotalResponseTime(service_id,
+                                                          ConversationMetrics::Clock::now() - request_start_time_);
+            {
+              utility::trace::TraceScope const copy_trace_scope{"dm", "CopyToApplication", payload_rx_buffer_.size()};
+              result.EmplaceValue(utility::memory::MakeUniqueFromResource<uds_message::DmUdsResponse>(
+                  response_resource_, payload_rx_buffer_));
+            }
             conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kIdle);
             break;
           default:
@@ -303,8 +368,10 @@ Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError> Dm
             break;
         }
       }
+      RecordResponseMetrics(service_id, result.HasValue());
     } else {
       // failure
+      conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kIdle);
       result.EmplaceError(ConvertResponseType(transmission_result));
     }
   } else {
@@ -327,17 +394,34 @@ void DmConversation::RegisterConnection(std::unique_ptr<uds_transport::Connectio
   return *dm_conversion_handler_;
 }
 
+void DmConversation::UpdateTimingParameters(std::uint16_t p2_client_max, std::uint16_t p2_star_client_max) noexcept {
+  p2_client_max_.store(p2_client_max, std::memory_order_relaxed);
+  p2_star_client_max_.store(p2_star_client_max, std::memory_order_relaxed);
+  logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+      __FILE__, __LINE__, __func__, [this, p2_client_max, p2_star_client_max](std::stringstream &msg) {
+        msg << "'" << conversation_name_ << "'"
+            << "-> "
+            << "Timing updated to P2ClientMax " << p2_client_max << " ms, P2StarClientMax " << p2_star_client_max
+            << " ms";
+      });
+}
+
 std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
 DmConversation::IndicateMessage(uds_transport::UdsMessage::Address, uds_transport::UdsMessage::Address,
                                 uds_transport::UdsMessage::TargetAddressType, uds_transport::ChannelID,
                                 std::size_t size, uds_transport::Priority, uds_transport::ProtocolKind,
                                 core_type::Span<std::uint8_t> payload_info) noexcept {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
   std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr> ret_val{
       uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationNOk, nullptr};
   // Verify the payload received :-
   if (!payload_info.empty()) {
     // Check for size, else kIndicationOverflow
     if (size <= rx_buffer_size_) {
+      // remember the arrival of first response of active request
+      ConversationMetrics::Clock::rep no_response_time{0};
+      (void) first_response_time_.compare_exchange_strong(
+          no_response_time, ConversationMetrics::Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
       // Check for pending response
       // payload = 0x7F XX 0x78
       if (payload_info[0U] == 0x7F && payload_info[2U] == 0x78) {
@@ -347,6 +431,8 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address, uds_transpor
                   << "-> "
                   << "Diagnostic pending response received in Conversation";
             });
+        pending_response_count_.fetch_add(1U, std::memory_order_relaxed);
+        utility::trace::TraceInstant("dm", "PendingResponse", payload_info[1U]);
         ret_val.first = uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationPending;
         conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagRecvdPendingRes);
       } else {
@@ -356,12 +442,13 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address, uds_transpor
                   << "-> "
                   << "Diagnostic final response received in Conversation";
             });
+        utility::trace::TraceInstant("dm", "FinalResponse", payload_info[0U]);
         // positive or negative response, provide valid buffer
         // resize the global rx buffer
         payload_rx_buffer_.resize(size);
         ret_val.first = uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk;
-        ret_val.second = std::make_unique<diag::client::uds_message::DmUdsMessage>(source_address_, target_address_, "",
-                                                                                   payload_rx_buffer_);
+        ret_val.second = utility::memory::MakeUniqueFromResource<uds_message::DmUdsMessage>(
+            &request_arena_, source_address_, target_address_, "", payload_rx_buffer_);
         conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagRecvdFinalRes);
       }
       sync_timer_.CancelWait();
@@ -386,11 +473,26 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address, uds_transpor
 }
 
 void DmConversation::HandleMessage(uds_transport::UdsMessagePtr message) noexcept {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
   if (message != nullptr) {
     conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagSuccess);
   }
 }
 
+void DmConversation::RecordResponseMetrics(std::uint8_t service_id, bool is_response_received) noexcept {
+  ConversationMetrics::Clock::rep const first_response_time{first_response_time_.load(std::memory_order_relaxed)};
+  if (first_response_time != 0) {
+    conversation_metrics_.RecordTimeToFirstByte(
+        service_id, ConversationMetrics::Clock::time_point{ConversationMetrics::Clock::duration{first_response_time}} -
+                        request_start_time_);
+  }
+  // a failed or timed out request would count the pending responses received until then
+  if (is_response_received) {
+    conversation_metrics_.RecordPendingResponseCount(service_id,
+                                                     pending_response_count_.load(std::memory_order_relaxed));
+  }
+}
+
 DiagClientConversation::DiagError DmConversation::ConvertResponseType(
     uds_transport::UdsTransportProtocolMgr::TransmissionResult result_type) {
   DiagClientConversation::DiagError ret_result{DiagClientConversation::DiagError::kDiagGenericFailure};
@@ -8,14 +8,20 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_H
 /* includes */
+#include <atomic>
+#include <chrono>
+#include <memory_resource>
+#include <mutex>
 #include <string_view>
 
 #include "include/diagnostic_client_conversation.h"
 #include "src/dcm/conversation/conversation.h"
+#include "src/dcm/conversation/conversation_metrics.h"
 #include "src/dcm/conversation/dm_conversation_state_impl.h"
 #include "src/dcm/conversation/dm_conversation_type.h"
 #include "uds_transport/connection.h"
 #include "uds_transport/protocol_types.h"
+#include "utility/memory_resource.h"
 #include "utility/sync_timer.h"
 
 namespace diag {
@@ -34,7 +40,7 @@ class DmConversation final : public Conversation {
   /**
    * @brief         Type alias for synchronous timer
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using SyncTimer = utility::sync_timer::SyncTimer;
 
   /**
    * @brief         Constructs an instance of DmConversation
@@ -42,8 +48,18 @@ class DmConversation final : public Conversation {
    *                The name of conversation
    * @param[in]     conversion_identifier
    *                The identifier consisting of conversation settings
+   * @param[in]     conversation_metrics
+   *                The reference to metrics of conversation, must outlive the conversation
+   * @param[in]     memory_resource
+   *                The memory resource backing the request arena, must outlive the conversation
+   * @param[in]     response_resource
+   *                The memory resource of response messages handed to the application
+   * @param[in]     clock
+   *                The clock used for P2 and P2* timeout monitoring, must outlive the conversation
    */
-  DmConversation(std::string_view conversion_name, DMConversationType &conversion_identifier);
+  DmConversation(std::string_view conversion_name, DMConversationType &conversion_identifier,
+                 ConversationMetrics &conversation_metrics, std::pmr::memory_resource *memory_resource,
+                 std::pmr::memory_resource *response_resource, core_type::Clock &clock);
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -72,6 +88,14 @@ class DmConversation final : public Conversation {
    */
   void Shutdown() noexcept override;
 
+  /**
+   * @brief         Function to abort the DmConversation on shutdown of diag client
+   * @param[in]     deadline
+   *                The time until the running request is waited for to return
+   * @return        True when no request is running anymore, False when still running at the deadline
+   */
+  bool Abort(std::chrono::steady_clock::time_point deadline) noexcept override;
+
   /**
    * @brief       Function to register the conversation to underlying transport protocol handler
    * @param[in]   connection
@@ -86,6 +110,16 @@ class DmConversation final : public Conversation {
    */
   ::uds_transport::ConversionHandler &GetConversationHandler() noexcept override;
 
+  /**
+   * @brief       Function to update the timing parameters, taking effect with the next request
+   * @details     A request in progress keeps the timing it was started with
+   * @param[in]   p2_client_max
+   *              The maximum p2 client time in milliseconds
+   * @param[in]   p2_star_client_max
+   *              The maximum p2 star client time in milliseconds
+   */
+  void UpdateTimingParameters(std::uint16_t p2_client_max, std::uint16_t p2_star_client_max) noexcept override;
+
   /**
    * @brief       Function to connect to Diagnostic Server
    * @param[in]   target_address
@@ -180,6 +214,15 @@ class DmConversation final : public Conversation {
   enum class ActivityStatusType : uint8_t { kActive = 0x00, kInactive = 0x01 };
 
  private:
+  /**
+   * @brief       Helper function to record time to first response and pending count of the finished request
+   * @param[in]   service_id
+   *              The service identifier of the finished request
+   * @param[in]   is_response_received
+   *              True when the final response was received, the pending count is only recorded then
+   */
+  void RecordResponseMetrics(std::uint8_t service_id, bool is_response_received) noexcept;
+
   /**
    * @brief       Helper function to convert response type
    * @param[in]   result_type
@@ -213,12 +256,12 @@ class DmConversation final : public Conversation {
   /**
    * @brief       Store the maximum p2 client time
    */
-  std::uint16_t p2_client_max_;
+  std::atomic<std::uint16_t> p2_client_max_;
 
   /**
    * @brief       Store the maximum p2 star client time
    */
-  std::uint16_t p2_star_client_max_;
+  std::atomic<std::uint16_t> p2_star_client_max_;
 
   /**
    * @brief       Store the logical source address of conversation
@@ -240,6 +283,16 @@ class DmConversation final : public Conversation {
    */
   std::string conversation_name_;
 
+  /**
+   * @brief       Store the arena serving the messages of active request, reset at the start of every request
+   */
+  utility::memory::MonotonicArenaResource request_arena_;
+
+  /**
+   * @brief       Store the memory resource of response messages handed to the application
+   */
+  std::pmr::memory_resource *response_resource_;
+
   /**
    * @brief       Store the dm conversation handler
    */
@@ -255,6 +308,16 @@ class DmConversation final : public Conversation {
    */
   SyncTimer sync_timer_;
 
+  /**
+   * @brief       Mutex held while a request is running, so that abort can wait for its end
+   */
+  std::timed_mutex request_mutex_;
+
+  /**
+   * @brief       Store the uds request to be sent
+   */
+  ::uds_transport::ByteVector payload_tx_buffer_;
+
   /**
    * @brief       Store the received uds response
    */
@@ -264,6 +327,26 @@ class DmConversation final : public Conversation {
    * @brief       Store the conversation state
    */
   conversation_state_impl::ConversationStateImpl conversation_state_;
+
+  /**
+   * @brief       Store the reference to metrics of conversation
+   */
+  ConversationMetrics &conversation_metrics_;
+
+  /**
+   * @brief       Store the time when the active request was started
+   */
+  ConversationMetrics::Clock::time_point request_start_time_;
+
+  /**
+   * @brief       Store the time since epoch of the first response to the active request, zero until received
+   */
+  std::atomic<ConversationMetrics::Clock::rep> first_response_time_;
+
+  /**
+   * @brief       Store the number of pending responses received for the active request
+   */
+  std::atomic<std::uint32_t> pending_response_count_;
 };
 
 }  // namespace conversation
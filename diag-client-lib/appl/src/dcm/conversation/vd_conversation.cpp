@@ -8,10 +8,12 @@
 
 #include "src/dcm/conversation/vd_conversation.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <utility>
 
+#include "core/include/endian_codec.h"
 #include "src/common/logger.h"
 #include "src/dcm/service/vd_message.h"
 
@@ -20,7 +22,7 @@ namespace client {
 namespace conversation {
 
 std::string ConvertToHexString(std::uint8_t char_start, std::uint8_t char_count,
-                               std::vector<std::uint8_t> &input_buffer) {
+                               ::uds_transport::ByteVector const &input_buffer) {
   std::string hex_string{};
   std::uint8_t total_char_count{static_cast<uint8_t>(char_start + char_count)};
 
@@ -39,7 +41,7 @@ std::string ConvertToHexString(std::uint8_t char_start, std::uint8_t char_count,
 }
 
 std::string ConvertToAsciiString(std::uint8_t char_start, std::uint8_t char_count,
-                                 std::vector<std::uint8_t> &input_buffer) {
+                                 ::uds_transport::ByteVector const &input_buffer) {
   std::string ascii_string{};
   std::uint8_t total_char_count{static_cast<uint8_t>(char_start + char_count)};
 
@@ -51,8 +53,8 @@ std::string ConvertToAsciiString(std::uint8_t char_start, std::uint8_t char_coun
   return ascii_string;
 }
 
-void SerializeEIDGIDFromString(std::string &input_string, std::vector<uint8_t> &output_buffer, std::uint8_t total_size,
-                               std::uint8_t substring_range) {
+void SerializeEIDGIDFromString(std::string &input_string, ::uds_transport::ByteVector &output_buffer,
+                               std::uint8_t total_size, std::uint8_t substring_range) {
 
   for (auto char_count = 0U; char_count < total_size; char_count += substring_range) {
     std::string input_string_new{input_string.substr(char_count, static_cast<std::uint8_t>(substring_range))};
@@ -63,8 +65,8 @@ void SerializeEIDGIDFromString(std::string &input_string, std::vector<uint8_t> &
   }
 }
 
-void SerializeVINFromString(std::string &input_string, std::vector<uint8_t> &output_buffer, std::uint8_t total_size,
-                            std::uint8_t substring_range) {
+void SerializeVINFromString(std::string &input_string, ::uds_transport::ByteVector &output_buffer,
+                            std::uint8_t total_size, std::uint8_t substring_range) {
 
   for (auto char_count = 0U; char_count < total_size; char_count += substring_range) {
     std::string input_string_new{input_string.substr(char_count, static_cast<std::uint8_t>(substring_range))};
@@ -77,10 +79,10 @@ void SerializeVINFromString(std::string &input_string, std::vector<uint8_t> &out
 // Vehicle Info Message implementation class
 class VehicleInfoMessageImpl final : public vehicle_info::VehicleInfoMessage {
  public:
-  explicit VehicleInfoMessageImpl(
-      std::map<std::uint16_t, vehicle_info::VehicleAddrInfoResponse> &vehicle_info_collection)
-      : vehicle_info_messages_{} {
-    for (std::pair<std::uint16_t, vehicle_info::VehicleAddrInfoResponse> vehicle_info: vehicle_info_collection) {
+  template<typename VehicleInfoCollection>
+  explicit VehicleInfoMessageImpl(VehicleInfoCollection &vehicle_info_collection) : vehicle_info_messages_{} {
+    vehicle_info_messages_.reserve(vehicle_info_collection.size());
+    for (std::pair<std::uint16_t, vehicle_info::VehicleAddrInfoResponse> &vehicle_info: vehicle_info_collection) {
       Push(vehicle_info.second);
     }
   }
@@ -191,7 +193,8 @@ VdConversation::VdConversation(std::string_view conversion_name, VDConversationT
       broadcast_address_{conversion_identifier.udp_broadcast_address},
       connection_ptr_{},
       vehicle_info_collection_{},
-      vehicle_info_container_mutex_{} {}
+      vehicle_info_container_mutex_{},
+      request_mutex_{} {}
 
 VdConversation::~VdConversation() = default;
 
@@ -207,6 +210,13 @@ void VdConversation::Shutdown() noexcept {
   connection_ptr_->Stop();
 }
 
+bool VdConversation::Abort(std::chrono::steady_clock::time_point deadline) noexcept {
+  // end the wait for vehicle identification responses of the running request and of every further one
+  connection_ptr_->Abort();
+  std::unique_lock<std::timed_mutex> const request_lock{request_mutex_, deadline};
+  return request_lock.owns_lock();
+}
+
 void VdConversation::RegisterConnection(std::unique_ptr<uds_transport::Connection> connection) noexcept {
   connection_ptr_ = std::move(connection);
 }
@@ -214,6 +224,7 @@ void VdConversation::RegisterConnection(std::unique_ptr<uds_transport::Connectio
 core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
 VdConversation::SendVehicleIdentificationRequest(
     vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept {
+  std::lock_guard<std::timed_mutex> const request_lock{request_mutex_};
   using VehicleIdentificationResponseResult =
       core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                         DiagClient::VehicleInfoResponseError>;
@@ -277,7 +288,25 @@ void VdConversation::HandleMessage(uds_transport::UdsMessagePtr message) noexcep
     std::pair<std::uint16_t, VehicleAddrInfoResponseStruct> vehicle_info_request{
         DeserializeVehicleInfoResponse(std::move(message))};
 
-    vehicle_info_collection_.emplace(vehicle_info_request.first, vehicle_info_request.second);
+    // keep the collection sorted by logical address, the first response of a server is kept
+    auto const it = std::lower_bound(
+        vehicle_info_collection_.begin(), vehicle_info_collection_.end(), vehicle_info_request.first,
+        [](std::pair<LogicalAddress, VehicleAddrInfoResponseStruct> const &vehicle_info,
+           LogicalAddress logical_address) { return vehicle_info.first < logical_address; });
+    if ((it == vehicle_info_collection_.end()) || (it->first != vehicle_info_request.first)) {
+      if (vehicle_info_collection_.size() < utility::capacity::kMaxVehicleResponseCount) {
+        (void) vehicle_info_collection_.emplace(it, std::move(vehicle_info_request));
+      } else {
+        logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+            __FILE__, __LINE__, __func__, [this, &vehicle_info_request](std::stringstream &msg) {
+              msg << "'" << conversation_name_ << "'"
+                  << "-> "
+                  << "Vehicle identification response of server with LA= 0x" << std::hex
+                  << vehicle_info_request.first << " dropped, " << std::dec
+                  << utility::capacity::kMaxVehicleResponseCount << " responses already collected";
+            });
+      }
+    }
   }
 }
 
@@ -318,7 +347,8 @@ VdConversation::DeserializeVehicleInfoResponse(uds_transport::UdsMessagePtr mess
       ConvertToHexString(start_index_gid, total_eid_gid_length, message->GetPayload())};
 
   LogicalAddress const logical_address{
-      (static_cast<std::uint16_t>(((message->GetPayload()[17U] & 0xFF) << 8) | (message->GetPayload()[18U] & 0xFF)))};
+      core_type::ReadBigEndian<std::uint16_t>(core_type::Span<std::uint8_t const>{message->GetPayload()}, 17U)
+          .value_or(0U)};
 
   // Create the structure out of the extracted string
   VehicleAddrInfoResponseStruct const vehicle_addr_info{std::string{message->GetHostIpAddress()},  // remote ip address
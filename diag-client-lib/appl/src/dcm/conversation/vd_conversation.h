@@ -12,8 +12,12 @@
 #include <chrono>
 #include <mutex>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "core/include/result.h"
+#include "core/include/static_vector.h"
 #include "include/diagnostic_client.h"
 #include "include/diagnostic_client_uds_message_type.h"
 #include "include/diagnostic_client_vehicle_info_message_type.h"
@@ -22,6 +26,7 @@
 #include "uds_transport/connection.h"
 #include "uds_transport/conversation_handler.h"
 #include "uds_transport/protocol_types.h"
+#include "utility/static_capacity.h"
 
 namespace diag {
 namespace client {
@@ -40,7 +45,7 @@ class VdConversation final : public Conversation {
   /**
    * @brief         Type alias of pre-selection value in terms of vector
    */
-  using PreselectionValue = std::vector<std::uint8_t>;
+  using PreselectionValue = ::uds_transport::ByteVector;
 
   /**
    * @brief         Type alias of vehicle address info response
@@ -52,6 +57,16 @@ class VdConversation final : public Conversation {
    */
   using LogicalAddress = std::uint16_t;
 
+  /**
+   * @brief         Type alias of vehicle info collection sorted by logical address, fixed-capacity in the embedded
+   *                profile
+   */
+  using VehicleInfoCollection = std::conditional_t<
+      utility::capacity::kStaticCapacity,
+      core_type::StaticVector<std::pair<LogicalAddress, VehicleAddrInfoResponseStruct>,
+                              utility::capacity::kMaxVehicleResponseCount>,
+      std::vector<std::pair<LogicalAddress, VehicleAddrInfoResponseStruct>>>;
+
  public:
   /**
    * @brief         Constructs an instance of VdConversation
@@ -89,6 +104,14 @@ class VdConversation final : public Conversation {
    */
   void Shutdown() noexcept override;
 
+  /**
+   * @brief         Function to abort the VdConversation on shutdown of diag client
+   * @param[in]     deadline
+   *                The time until the running request is waited for to return
+   * @return        True when no request is running anymore, False when still running at the deadline
+   */
+  bool Abort(std::chrono::steady_clock::time_point deadline) noexcept override;
+
   /**
    * @brief       Function to register the conversation to underlying transport protocol handler
    * @param[in]   connection
@@ -158,6 +181,15 @@ class VdConversation final : public Conversation {
    */
   vehicle_info::VehicleInfoMessageResponseUniquePtr GetDiagnosticServerList();
 
+  /**
+   * @brief       Function to deserialize the received Vehicle Identification Response/ Announcement
+   * @param[in]   message
+   *              The message to deserialize
+   * @return      The pair with logical address of server and Vehicle address information
+   */
+  static std::pair<LogicalAddress, VehicleAddrInfoResponseStruct> DeserializeVehicleInfoResponse(
+      ::uds_transport::UdsMessagePtr message);
+
  private:
   /**
    * @brief       Function to verify the received vehicle info request
@@ -169,15 +201,6 @@ class VdConversation final : public Conversation {
    */
   bool VerifyVehicleInfoRequest(PreselectionMode preselection_mode, std::uint8_t preselection_value_length);
 
-  /**
-   * @brief       Function to deserialize the received Vehicle Identification Response/ Announcement
-   * @param[in]   message
-   *              The message to deserialize
-   * @return      The pair with logical address of server and Vehicle address information
-   */
-  static std::pair<LogicalAddress, VehicleAddrInfoResponseStruct> DeserializeVehicleInfoResponse(
-      ::uds_transport::UdsMessagePtr message);
-
   /**
    * @brief       Function to deserialize the Vehicle Information request from user
    * @param[in]   vehicle_info_request
@@ -210,12 +233,17 @@ class VdConversation final : public Conversation {
   /**
    * @brief       Store the vehicle info collection received till now
    */
-  std::map<std::uint16_t, VehicleAddrInfoResponseStruct> vehicle_info_collection_;
+  VehicleInfoCollection vehicle_info_collection_;
 
   /**
    * @brief       Mutex to lock the vehicle info collection container
    */
   std::mutex vehicle_info_container_mutex_;
+
+  /**
+   * @brief       Mutex held while a request is running, so that abort can wait for its end
+   */
+  std::timed_mutex request_mutex_;
 };
 
 }  // namespace conversation
@@ -8,33 +8,34 @@
 /* includes */
 #include "src/dcm/dcm_client.h"
 
-#include <optional>
+#include <chrono>
+#include <utility>
 
 #include "src/common/logger.h"
+#include "src/dcm/error_domain/dm_error_domain.h"
+
+// Time for which running requests are waited for on shutdown, set by the build
+#ifndef DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS
+#define DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS 100U
+#endif
 
 namespace diag {
 namespace client {
 namespace dcm {
-namespace {
-
-/**
- * @brief    Store the conversation manager reference optionally
- */
-std::optional<std::reference_wrapper<conversation_manager::ConversationManager>> conversation_manager_ref{};
-
-}  // namespace
 
 // string representing of vehicle discovery conversation name
 constexpr std::string_view VehicleDiscoveryConversation{"VehicleDiscovery"};
 
-DCMClient::DCMClient(config_parser::DcmClientConfig dcm_client_config)
+// Time for which the aborted requests are waited for to return on shutdown
+constexpr std::chrono::milliseconds kShutdownTimeout{DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS};
+
+DCMClient::DCMClient(config_parser::DcmClientConfig dcm_client_config, std::pmr::memory_resource *memory_resource,
+                     core_type::Clock &clock)
     : DiagnosticManager{},
-      uds_transport_protocol_mgr_{std::make_unique<uds_transport::UdsTransportProtocolManager>()},
-      conversation_mgr_{std::move(dcm_client_config), *uds_transport_protocol_mgr_},
-      vehicle_discovery_conversation_{conversation_mgr_.GetDiagnosticClientConversation(VehicleDiscoveryConversation)} {
-  // make the conversation manager reference available externally
-  conversation_manager_ref.emplace(conversation_mgr_);
-}
+      uds_transport_protocol_mgr_{std::make_unique<uds_transport::UdsTransportProtocolManager>(clock, GetIoContext())},
+      conversation_mgr_{std::move(dcm_client_config), *uds_transport_protocol_mgr_, memory_resource, clock},
+      vehicle_discovery_conversation_{
+          conversation_mgr_.GetDiagnosticClientConversation(VehicleDiscoveryConversation, nullptr)} {}
 
 DCMClient::~DCMClient() noexcept = default;
 
@@ -69,9 +70,25 @@ void DCMClient::Shutdown() noexcept {
       __FILE__, __LINE__, __func__, [](std::stringstream &msg) { msg << "Dcm Client Shutdown completed"; });
 }
 
+Result<void> DCMClient::SignalShutdown() noexcept {
+  // end the requests still waiting for a response, so that no caller stays blocked until its timeout
+  bool const requests_ended{conversation_mgr_.Abort(std::chrono::steady_clock::now() + kShutdownTimeout)};
+  // the event loop is stopped in any case, the sockets are closed by Shutdown()
+  Result<void> result{DiagnosticManager::SignalShutdown()};
+  if (!requests_ended) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        __FILE__, __LINE__, __func__, [](std::stringstream &msg) {
+          msg << "Requests still running after " << kShutdownTimeout.count() << " milliseconds of shutdown";
+        });
+    result.EmplaceError(error_domain::MakeErrorCode(error_domain::DmErrorErrc::kDeInitializationFailed));
+  }
+  return result;
+}
+
 conversation::DiagClientConversation DCMClient::GetDiagnosticClientConversation(
-    std::string_view conversation_name) noexcept {
-  return conversation::DiagClientConversation{conversation_name};
+    std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept {
+  return conversation::DiagClientConversation{
+      conversation_mgr_.GetDiagnosticClientConversation(conversation_name, memory_resource)};
 }
 
 core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
@@ -80,12 +97,12 @@ DCMClient::SendVehicleIdentificationRequest(
   return vehicle_discovery_conversation_.SendVehicleIdentificationRequest(vehicle_info_request);
 }
 
-auto GetConversationManager() noexcept -> conversation_manager::ConversationManager & {
-  if (!conversation_manager_ref) {
-    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatal(
-        __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
-  }
-  return conversation_manager_ref.value();
+metrics::MetricsSnapshot DCMClient::GetMetricsSnapshot() const noexcept {
+  return conversation_mgr_.GetMetricsSnapshot();
+}
+
+Result<void> DCMClient::Reload(config_parser::DcmClientConfig config) noexcept {
+  return conversation_mgr_.Reload(std::move(config));
 }
 
 }  // namespace dcm
@@ -8,6 +8,7 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DIAGNOSTIC_COMMUNICATION_MANAGER_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DIAGNOSTIC_COMMUNICATION_MANAGER_H
 /* includes */
+#include <memory_resource>
 #include <string_view>
 
 #include "core/include/result.h"
@@ -29,8 +30,13 @@ class DCMClient final : public diag::client::common::DiagnosticManager {
    * @brief         Constructs an instance of DCMClient
    * @param[in]     dcm_client_config
    *                The configuration of dcm client
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  explicit DCMClient(config_parser::DcmClientConfig dcm_client_config);
+  DCMClient(config_parser::DcmClientConfig dcm_client_config, std::pmr::memory_resource *memory_resource,
+            core_type::Clock &clock);
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -64,14 +70,24 @@ class DCMClient final : public diag::client::common::DiagnosticManager {
    */
   void Shutdown() noexcept override;
 
+  /**
+   * @brief         Function to initiate shutdown of DCMClient
+   * @details       The requests of all conversations are aborted before the event loop is stopped, running requests
+   *                are waited for at most the shutdown timeout set by the build
+   * @return        Result with void in case of success, otherwise error when a request is still running
+   */
+  Result<void> SignalShutdown() noexcept override;
+
   /**
    * @brief       Function to get required diag client conversation object based on conversation name
    * @param[in]   conversation_name
    *              Name of conversation configured as json parameter "ConversationName"
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation, nullptr for the one of diag client
    * @return      Diag client conversation object as per passed conversation name
    */
   conversation::DiagClientConversation GetDiagnosticClientConversation(
-      std::string_view conversation_name) noexcept override;
+      std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept override;
 
   /**
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
@@ -84,6 +100,20 @@ class DCMClient final : public diag::client::common::DiagnosticManager {
   SendVehicleIdentificationRequest(
       diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept override;
 
+  /**
+   * @brief       Function to get the latency metrics of all conversations
+   * @return      The metrics of all conversations sorted by conversation name
+   */
+  metrics::MetricsSnapshot GetMetricsSnapshot() const noexcept override;
+
+  /**
+   * @brief       Function to apply a new configuration without restarting
+   * @param[in]   config
+   *              The new configuration of dcm client
+   * @return      Result with void in case of success, otherwise error is returned
+   */
+  Result<void> Reload(config_parser::DcmClientConfig config) noexcept override;
+
  private:
   /**
    * @brief         Stores the uds transport protocol manager
@@ -101,12 +131,6 @@ class DCMClient final : public diag::client::common::DiagnosticManager {
   conversation::Conversation &vehicle_discovery_conversation_;
 };
 
-/**
- * @brief       Function to get the reference to conversation manager
- * @return      Reference to conversation manager
- */
-auto GetConversationManager() noexcept -> conversation_manager::ConversationManager &;
-
 }  // namespace dcm
 }  // namespace client
 }  // namespace diag
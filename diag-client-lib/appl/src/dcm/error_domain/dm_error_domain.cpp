@@ -37,6 +37,12 @@ auto ConvertErrorCodeToString(core_type::ErrorDomain::CodeType error_code) noexc
     case DmErrorErrc::kDeInitializationFailed:
       result = "DeInitializationFailed";
       break;
+    case DmErrorErrc::kInvalidConfiguration:
+      result = "InvalidConfiguration";
+      break;
+    case DmErrorErrc::kReloadFailed:
+      result = "ReloadFailed";
+      break;
   }
   return result;
 }
@@ -53,8 +59,8 @@ const char* DmErrorDomain::Message(core_type::ErrorDomain::CodeType error_code)
   return message_.c_str();
 }
 
-core_type::ErrorCode MakeErrorCode(DmErrorErrc, core_type::ErrorDomain::SupportDataType data) noexcept {
-  return core_type::ErrorCode{data, dm_error_domain};
+core_type::ErrorCode MakeErrorCode(DmErrorErrc code, core_type::ErrorDomain::SupportDataType data) noexcept {
+  return core_type::ErrorCode{static_cast<core_type::ErrorDomain::CodeType>(code), dm_error_domain, data};
 }
 
 }  // namespace error_domain
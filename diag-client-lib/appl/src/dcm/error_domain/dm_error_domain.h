@@ -21,8 +21,10 @@ namespace error_domain {
  * @brief  Definition of error code in Dcm Client
  */
 enum class DmErrorErrc : core_type::ErrorDomain::CodeType {
-  kInitializationFailed = 0U,  /**< Failure on Initialization */
-  kDeInitializationFailed = 1U /**< Failure on De-Initialization */
+  kInitializationFailed = 0U,   /**< Failure on Initialization */
+  kDeInitializationFailed = 1U, /**< Failure on De-Initialization */
+  kInvalidConfiguration = 2U,   /**< Failure on Initialization due to invalid configuration */
+  kReloadFailed = 3U            /**< Failure on Reload of configuration */
 };
 
 /**
@@ -11,15 +11,17 @@
 #include "include/diagnostic_client_uds_message_type.h"
 #include "include/diagnostic_client_vehicle_info_message_type.h"
 #include "uds_transport/uds_message.h"
+#include "utility/memory_resource.h"
 
 namespace diag {
 namespace client {
 namespace uds_message {
 
-class DmUdsMessage final : public uds_transport::UdsMessage {
+// uds message exchanged with the transport protocol handler, may be allocated from a memory resource of conversation
+class DmUdsMessage final : public ::uds_transport::UdsMessage, public utility::memory::ResourceAllocated {
  public:
   // ctor
-  DmUdsMessage(Address sa, Address ta, IpAddress host_ip_address, uds_transport::ByteVector &payload);
+  DmUdsMessage(Address sa, Address ta, IpAddress host_ip_address, ::uds_transport::ByteVector &payload);
 
   // dtor
   ~DmUdsMessage() noexcept override = default;
@@ -38,7 +40,7 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
   std::string host_ip_address_;
 
   // store only UDS payload to be sent
-  uds_transport::ByteVector &uds_payload_;
+  ::uds_transport::ByteVector &uds_payload_;
 
   // add new metaInfo to this message.
   void AddMetaInfo(std::shared_ptr<const MetaInfoMap>) override {
@@ -46,10 +48,10 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
   }
 
   // Get the UDS message data starting with the SID (A_Data as per ISO)
-  const uds_transport::ByteVector &GetPayload() const override { return uds_payload_; }
+  const ::uds_transport::ByteVector &GetPayload() const override { return uds_payload_; }
 
   // return the underlying buffer for write access
-  uds_transport::ByteVector &GetPayload() override { return uds_payload_; }
+  ::uds_transport::ByteVector &GetPayload() override { return uds_payload_; }
 
   // Get the source address of the uds message.
   Address GetSa() const noexcept override { return source_address_; }
@@ -67,7 +69,8 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
   PortNumber GetHostPortNumber() const noexcept override { return 13400U; }
 };
 
-class DmUdsResponse final : public UdsMessage {
+// uds response handed to the application, may be allocated from a memory resource of diag client
+class DmUdsResponse final : public UdsMessage, public utility::memory::ResourceAllocated {
  public:
   explicit DmUdsResponse(ByteVector &payload);
 
@@ -11,12 +11,18 @@
 #include "include/diagnostic_client_uds_message_type.h"
 #include "include/diagnostic_client_vehicle_info_message_type.h"
 #include "uds_transport/uds_message.h"
+#include "utility/object_pool.h"
 
 namespace diag {
 namespace client {
 namespace vd_message {
 
-class VdMessage final : public uds_transport::UdsMessage {
+// number of messages recycled by the object pool
+constexpr std::size_t kVdMessagePoolCapacity{16U};
+
+// vehicle discovery message, the storage is recycled by an object pool
+class VdMessage final : public ::uds_transport::UdsMessage,
+                        public utility::memory::PoolAllocated<VdMessage, kVdMessagePoolCapacity> {
  public:
   // ctor
   VdMessage(std::uint8_t preselection_mode, uds_transport::ByteVector& preselection_value,
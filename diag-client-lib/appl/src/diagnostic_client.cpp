@@ -9,16 +9,23 @@
 
 #include <pthread.h>
 
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <utility>
 #include <thread>
 
 #include "core/include/result.h"
 #include "parser/json_parser.h"
 #include "src/common/diagnostic_manager.h"
 #include "src/common/logger.h"
+#include "src/dcm/config_parser/json_config_reader.h"
 #include "src/dcm/dcm_client.h"
 #include "src/dcm/error_domain/dm_error_domain.h"
+#include "utility/allocation_counter.h"
+#include "utility/trace.h"
 
 namespace diag {
 namespace client {
@@ -32,12 +39,61 @@ class DiagClient::DiagClientImpl final {
    * @brief         Constructs an instance of DiagClient
    * @param[in]     diag_client_config_path
    *                The path to diag client config file
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    * @implements    DiagClientLib-Construction
    */
-  explicit DiagClientImpl(std::string_view diag_client_config_path) noexcept
+  DiagClientImpl(std::string_view diag_client_config_path, std::pmr::memory_resource *memory_resource,
+                 core_type::Clock &clock) noexcept
       : dcm_instance_{},
         dcm_thread_{},
-        diag_client_config_path_{diag_client_config_path} {}
+        diag_client_config_path_{diag_client_config_path},
+        json_config_{},
+        dcm_client_config_{},
+        memory_resource_{memory_resource},
+        clock_{clock} {}
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a configuration built in code
+   * @param[in]     config
+   *                The configuration, copied
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClientImpl(config::DiagClientConfig const &config, std::pmr::memory_resource *memory_resource,
+                 core_type::Clock &clock) noexcept
+      : dcm_instance_{},
+        dcm_thread_{},
+        diag_client_config_path_{},
+        json_config_{},
+        dcm_client_config_{ReadStaticConfig(config)},
+        memory_resource_{memory_resource},
+        clock_{clock} {}
+
+  /**
+   * @brief         Constructs an instance of DiagClient with a json configuration held in memory
+   * @param[in]     config
+   *                The json configuration, copied
+   * @param[in]     memory_resource
+   *                The memory resource backing all conversations
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @implements    DiagClientLib-Construction
+   */
+  DiagClientImpl(config::JsonConfig const &config, std::pmr::memory_resource *memory_resource,
+                 core_type::Clock &clock) noexcept
+      : dcm_instance_{},
+        dcm_thread_{},
+        diag_client_config_path_{},
+        json_config_{std::string{config.content}},
+        dcm_client_config_{},
+        memory_resource_{memory_resource},
+        clock_{clock} {}
 
   /**
    * @brief  Deleted copy assignment and copy constructor
@@ -67,23 +123,19 @@ class DiagClient::DiagClientImpl final {
     logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
         __FILE__, __LINE__, __func__, [](std::stringstream &msg) { msg << "DiagClient Initialization started"; });
 
-    // read configuration
-    boost_support::parser::boost_tree config{};
-    return boost_support::parser::Read(diag_client_config_path_, config)
-        .MapError([](boost_support::parser::ParsingErrorCode const &) noexcept {
-          logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
-              __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient Initialization failed"; });
-          return error_domain::MakeErrorCode(error_domain::DmErrorErrc::kInitializationFailed);
-        })
-        .AndThen([this, &config]() {
-          // create single dcm instance and pass the configuration
-          dcm_instance_ = std::make_unique<diag::client::dcm::DCMClient>(config_parser::ReadDcmClientConfig(config));
-          // start dcm client thread
-          dcm_thread_ = std::thread([this]() noexcept { this->dcm_instance_->Main(); });
-          pthread_setname_np(dcm_thread_.native_handle(), "dcm_client");
-          logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-              __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient Initialization completed"; });
-        });
+    return ReadConfig().AndThen([this](config_parser::DcmClientConfig dcm_client_config) {
+      // create single dcm instance and pass the configuration
+      dcm_instance_ =
+          std::make_unique<diag::client::dcm::DCMClient>(std::move(dcm_client_config), memory_resource_, clock_);
+      // start dcm client thread
+      dcm_thread_ = std::thread([this]() noexcept {
+        utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDiagClient};
+        this->dcm_instance_->Main();
+      });
+      pthread_setname_np(dcm_thread_.native_handle(), "dcm_client");
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+          __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient Initialization completed"; });
+    });
   }
 
   /**
@@ -103,7 +155,9 @@ class DiagClient::DiagClientImpl final {
           logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
               __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient De-Initialization completed"; });
         })
-        .OrElse([](core_type::ErrorCode const &) {
+        .OrElse([this](core_type::ErrorCode const &) {
+          // the dcm thread stops even when a request did not end in time
+          if (dcm_thread_.joinable()) { dcm_thread_.join(); }
           return error_domain::MakeErrorCode(error_domain::DmErrorErrc::kDeInitializationFailed);
         });
   }
@@ -112,15 +166,18 @@ class DiagClient::DiagClientImpl final {
    * @brief       Function to get required diag client conversation object based on conversation name
    * @param[in]   conversation_name
    *              Name of conversation configured as json parameter "ConversationName"
+   * @param[in]   memory_resource
+   *              The memory resource backing the arena of conversation, nullptr for the one of diag client
    * @return      Diag client conversation object as per passed conversation name
    * @implements  DiagClientLib-MultipleTester-Connection, DiagClientLib-Conversation-Construction
    */
-  conversation::DiagClientConversation GetDiagnosticClientConversation(std::string_view conversation_name) noexcept {
+  conversation::DiagClientConversation GetDiagnosticClientConversation(
+      std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept {
     if (!dcm_instance_) {
       logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatal(
           __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
     }
-    return dcm_instance_->GetDiagnosticClientConversation(conversation_name);
+    return dcm_instance_->GetDiagnosticClientConversation(conversation_name, memory_resource);
   }
 
   /**
@@ -140,7 +197,158 @@ class DiagClient::DiagClientImpl final {
     return dcm_instance_->SendVehicleIdentificationRequest(std::move(vehicle_info_request));
   }
 
+  /**
+   * @brief       Function to get a snapshot of the latency metrics of all conversations
+   * @return      The metrics of all conversations sorted by conversation name
+   */
+  metrics::MetricsSnapshot GetMetricsSnapshot() const noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatal(
+          __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+    }
+    return dcm_instance_->GetMetricsSnapshot();
+  }
+
+  /**
+   * @brief       Function to apply a changed json config file without restarting the diag client
+   * @param[in]   diag_client_config_path
+   *              The path to diag client config file
+   * @return      Result with void in case of success, otherwise error is returned
+   */
+  Result<void> Reload(std::string_view diag_client_config_path) noexcept {
+    return Reload(ReadConfigFile(diag_client_config_path)).AndThen([this, diag_client_config_path]() {
+      SetConfigSource(std::string{diag_client_config_path}, std::nullopt, std::nullopt);
+    });
+  }
+
+  /**
+   * @brief       Function to apply a changed configuration built in code without restarting the diag client
+   * @param[in]   config
+   *              The configuration
+   * @return      Result with void in case of success, otherwise error is returned
+   */
+  Result<void> Reload(config::DiagClientConfig const &config) noexcept {
+    Result<config_parser::DcmClientConfig> dcm_client_config{ReadStaticConfig(config)};
+    return Reload(dcm_client_config).AndThen([this, &dcm_client_config]() {
+      SetConfigSource(std::string{}, std::nullopt, std::move(dcm_client_config));
+    });
+  }
+
+  /**
+   * @brief       Function to apply a changed json configuration held in memory without restarting the diag client
+   * @param[in]   config
+   *              The json configuration
+   * @return      Result with void in case of success, otherwise error is returned
+   */
+  Result<void> Reload(config::JsonConfig const &config) noexcept {
+    return Reload(ReadJsonConfig(config.content)).AndThen([this, &config]() {
+      SetConfigSource(std::string{}, std::string{config.content}, std::nullopt);
+    });
+  }
+
  private:
+  /**
+   * @brief       Function to make the source of a successfully reloaded configuration the one read by Initialize()
+   * @param[in]   diag_client_config_path
+   *              The path to diag client config file, empty when not given
+   * @param[in]   json_config
+   *              The json configuration held in memory, empty when not given
+   * @param[in]   dcm_client_config
+   *              The configuration built in code, empty when not given
+   */
+  void SetConfigSource(std::string diag_client_config_path, std::optional<std::string> json_config,
+                       std::optional<Result<config_parser::DcmClientConfig>> dcm_client_config) noexcept {
+    diag_client_config_path_ = std::move(diag_client_config_path);
+    json_config_ = std::move(json_config);
+    dcm_client_config_ = std::move(dcm_client_config);
+  }
+
+  /**
+   * @brief       Function to get the dcm client configuration
+   * @details     A configuration built in code is taken as it is, a json configuration held in memory is parsed,
+   *              otherwise the json file is read and parsed
+   * @return      The configuration on success, otherwise error is returned
+   */
+  Result<config_parser::DcmClientConfig> ReadConfig() const noexcept {
+    if (dcm_client_config_) { return *dcm_client_config_; }
+    if (json_config_) { return ReadJsonConfig(*json_config_); }
+    return ReadConfigFile(diag_client_config_path_);
+  }
+
+  /**
+   * @brief       Function to check and convert a configuration built in code
+   * @param[in]   config
+   *              The configuration built in code
+   * @return      The configuration on success, otherwise error is returned
+   */
+  static Result<config_parser::DcmClientConfig> ReadStaticConfig(config::DiagClientConfig const &config) noexcept {
+    // the conversation count is held in 8 bit, the same as NumberOfConversation of a json configuration
+    constexpr std::size_t kMaxConfiguredConversationCount{
+        std::numeric_limits<decltype(config_parser::DcmClientConfig::num_of_conversation)>::max()};
+    if (config.conversations.size() > kMaxConfiguredConversationCount) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          __FILE__, __LINE__, "", [&config, kMaxConfiguredConversationCount](std::stringstream &msg) {
+            msg << "DiagClient configuration is invalid: " << config.conversations.size()
+                << " conversations exceed " << kMaxConfiguredConversationCount;
+          });
+      return Result<config_parser::DcmClientConfig>::FromError(
+          error_domain::MakeErrorCode(error_domain::DmErrorErrc::kInvalidConfiguration));
+    }
+    return Result<config_parser::DcmClientConfig>::FromValue(config_parser::ReadDcmClientConfig(config));
+  }
+
+  /**
+   * @brief       Function to parse a json configuration held in memory
+   * @param[in]   json_config
+   *              The json text
+   * @return      The configuration on success, otherwise error is returned
+   */
+  static Result<config_parser::DcmClientConfig> ReadJsonConfig(std::string_view json_config) noexcept {
+    return config_parser::ReadDcmClientConfig(config::JsonConfig{json_config})
+        .MapError([](config::ConfigError const &error) noexcept {
+          logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+              __FILE__, __LINE__, "", [&error](std::stringstream &msg) {
+                msg << "DiagClient configuration is invalid at line " << error.line << ", column " << error.column
+                    << ": " << error.message;
+              });
+          return error_domain::MakeErrorCode(error_domain::DmErrorErrc::kInvalidConfiguration);
+        });
+  }
+
+  /**
+   * @brief       Function to read and parse a json config file
+   * @param[in]   diag_client_config_path
+   *              The path to diag client config file
+   * @return      The configuration on success, otherwise error is returned
+   */
+  static Result<config_parser::DcmClientConfig> ReadConfigFile(std::string_view diag_client_config_path) noexcept {
+    boost_support::parser::boost_tree config{};
+    return boost_support::parser::Read(std::string{diag_client_config_path}, config)
+        .MapError([](boost_support::parser::ParsingErrorCode const &) noexcept {
+          logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+              __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient config file reading failed"; });
+          return error_domain::MakeErrorCode(error_domain::DmErrorErrc::kInitializationFailed);
+        })
+        .AndThen([&config]() { return config_parser::ReadDcmClientConfig(config); });
+  }
+
+  /**
+   * @brief       Function to apply a configuration to the initialized dcm client
+   * @param[in]   config
+   *              The configuration on success, otherwise the error of reading it
+   * @return      Result with void in case of success, otherwise error is returned
+   */
+  Result<void> Reload(Result<config_parser::DcmClientConfig> config) noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          __FILE__, __LINE__, "", [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+      return Result<void>::FromError(error_domain::MakeErrorCode(error_domain::DmErrorErrc::kReloadFailed));
+    }
+    return std::move(config).AndThen([this](config_parser::DcmClientConfig dcm_client_config) {
+      return dcm_instance_->Reload(std::move(dcm_client_config));
+    });
+  }
+
   /**
    * @brief    Unique pointer to dcm client instance
    */
@@ -155,10 +363,51 @@ class DiagClient::DiagClientImpl final {
    * @brief    Store the diag client config path
    */
   std::string diag_client_config_path_;
+
+  /**
+   * @brief    Store the json configuration held in memory, empty when not given
+   */
+  std::optional<std::string> json_config_;
+
+  /**
+   * @brief    Store the configuration built in code or the error of converting it, empty when not given
+   */
+  std::optional<Result<config_parser::DcmClientConfig>> dcm_client_config_;
+
+  /**
+   * @brief    Store the memory resource backing all conversations
+   */
+  std::pmr::memory_resource *memory_resource_;
+
+  /**
+   * @brief    Store the clock used for timeout monitoring
+   */
+  core_type::Clock &clock_;
 };
 
 DiagClient::DiagClient(std::string_view diag_client_config_path) noexcept
-    : diag_client_impl_{std::make_unique<DiagClientImpl>(diag_client_config_path)} {}
+    : DiagClient{diag_client_config_path, std::pmr::get_default_resource()} {}
+
+DiagClient::DiagClient(std::string_view diag_client_config_path, std::pmr::memory_resource *memory_resource) noexcept
+    : DiagClient{diag_client_config_path, memory_resource, core_type::Clock::GetSteadyClock()} {}
+
+DiagClient::DiagClient(std::string_view diag_client_config_path, std::pmr::memory_resource *memory_resource,
+                       core_type::Clock &clock) noexcept
+    : diag_client_impl_{std::make_unique<DiagClientImpl>(diag_client_config_path, memory_resource, clock)} {}
+
+DiagClient::DiagClient(config::DiagClientConfig const &config) noexcept
+    : DiagClient{config, std::pmr::get_default_resource(), core_type::Clock::GetSteadyClock()} {}
+
+DiagClient::DiagClient(config::DiagClientConfig const &config, std::pmr::memory_resource *memory_resource,
+                       core_type::Clock &clock) noexcept
+    : diag_client_impl_{std::make_unique<DiagClientImpl>(config, memory_resource, clock)} {}
+
+DiagClient::DiagClient(config::JsonConfig const &config) noexcept
+    : DiagClient{config, std::pmr::get_default_resource(), core_type::Clock::GetSteadyClock()} {}
+
+DiagClient::DiagClient(config::JsonConfig const &config, std::pmr::memory_resource *memory_resource,
+                       core_type::Clock &clock) noexcept
+    : diag_client_impl_{std::make_unique<DiagClientImpl>(config, memory_resource, clock)} {}
 
 DiagClient::~DiagClient() noexcept = default;
 
@@ -174,12 +423,64 @@ DiagClient::SendVehicleIdentificationRequest(
 
 conversation::DiagClientConversation DiagClient::GetDiagnosticClientConversation(
     std::string_view conversation_name) noexcept {
-  return diag_client_impl_->GetDiagnosticClientConversation(conversation_name);
+  return diag_client_impl_->GetDiagnosticClientConversation(conversation_name, nullptr);
+}
+
+conversation::DiagClientConversation DiagClient::GetDiagnosticClientConversation(
+    std::string_view conversation_name, std::pmr::memory_resource *memory_resource) noexcept {
+  return diag_client_impl_->GetDiagnosticClientConversation(conversation_name, memory_resource);
+}
+
+metrics::MetricsSnapshot DiagClient::GetMetricsSnapshot() const noexcept {
+  return diag_client_impl_->GetMetricsSnapshot();
+}
+
+Result<void> DiagClient::Reload(std::string_view diag_client_config_path) noexcept {
+  return diag_client_impl_->Reload(diag_client_config_path);
+}
+
+Result<void> DiagClient::Reload(config::DiagClientConfig const &config) noexcept {
+  return diag_client_impl_->Reload(config);
 }
 
+Result<void> DiagClient::Reload(config::JsonConfig const &config) noexcept { return diag_client_impl_->Reload(config); }
+
+std::string DiagClient::DumpTrace() const { return utility::trace::TraceBuffer::GetInstance().DumpChromeTrace(); }
+
 std::unique_ptr<DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path) {
   return (std::make_unique<DiagClient>(diag_client_config_path));
 }
 
+std::unique_ptr<DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path,
+                                                   std::pmr::memory_resource *memory_resource) {
+  return (std::make_unique<DiagClient>(diag_client_config_path, memory_resource));
+}
+
+std::unique_ptr<DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path,
+                                                   std::pmr::memory_resource *memory_resource,
+                                                   core_type::Clock &clock) {
+  return (std::make_unique<DiagClient>(diag_client_config_path, memory_resource, clock));
+}
+
+std::unique_ptr<DiagClient> CreateDiagnosticClient(config::DiagClientConfig const &config) {
+  return (std::make_unique<DiagClient>(config));
+}
+
+std::unique_ptr<DiagClient> CreateDiagnosticClient(config::DiagClientConfig const &config,
+                                                   std::pmr::memory_resource *memory_resource,
+                                                   core_type::Clock &clock) {
+  return (std::make_unique<DiagClient>(config, memory_resource, clock));
+}
+
+std::unique_ptr<DiagClient> CreateDiagnosticClient(config::JsonConfig const &config) {
+  return (std::make_unique<DiagClient>(config));
+}
+
+std::unique_ptr<DiagClient> CreateDiagnosticClient(config::JsonConfig const &config,
+                                                   std::pmr::memory_resource *memory_resource,
+                                                   core_type::Clock &clock) {
+  return (std::make_unique<DiagClient>(config, memory_resource, clock));
+}
+
 }  // namespace client
 }  // namespace diag
@@ -10,7 +10,6 @@
 #include <memory>
 
 #include "src/dcm/conversation/conversation.h"
-#include "src/dcm/dcm_client.h"
 
 namespace diag {
 namespace client {
@@ -20,11 +19,12 @@ class DiagClientConversation::DiagClientConversationImpl final {
  public:
   /**
    * @brief         Constructor an instance of DiagClientConversationImpl
-   * @param[in]     conversation_name
-   *                The name of conversation configured as json parameter under "ConversationName"
+   * @param[in]     conversation
+   *                The conversation of the diag client
    */
-  explicit DiagClientConversationImpl(std::string_view conversation_name) noexcept
-      : internal_conversation_{dcm::GetConversationManager().GetDiagnosticClientConversation(conversation_name)} {}
+  explicit DiagClientConversationImpl(Conversation &conversation) noexcept
+      : internal_conversation_{conversation},
+        handle_token_{conversation.GetHandleToken()} {}
 
   /**
    * @brief         Destructor an instance of DiagClientConversationImpl
@@ -83,10 +83,15 @@ class DiagClientConversation::DiagClientConversationImpl final {
    * @brief         Reference to valid conversation created
    */
   Conversation& internal_conversation_;
+
+  /**
+   * @brief         Token telling the diag client that the conversation is still held by the application
+   */
+  std::shared_ptr<void const> handle_token_;
 };
 
-DiagClientConversation::DiagClientConversation(std::string_view conversation_name) noexcept
-    : diag_client_conversation_impl_{std::make_unique<DiagClientConversationImpl>(conversation_name)} {}
+DiagClientConversation::DiagClientConversation(Conversation &conversation) noexcept
+    : diag_client_conversation_impl_{std::make_unique<DiagClientConversationImpl>(conversation)} {}
 
 DiagClientConversation::~DiagClientConversation() noexcept = default;
 
@@ -0,0 +1,80 @@
+#  Diagnostic Client library CMake File
+#  Copyright (C) 2024  Avijit Dey
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# generate_diag_client_config(<json file> <header file> <variable name>)
+#
+# Generates a header defining `inline constexpr diag::client::config::DiagClientConfig <variable name>` out of a diag
+# client json config file, to be passed to CreateDiagnosticClient() instead of the path of json file. The header is
+# regenerated whenever the json file changes. Requires CMake 3.19 or newer.
+#
+
+# escape a json string value to be placed into a C++ string literal
+function(_diag_client_config_escape OUTPUT_VARIABLE VALUE)
+    string(REPLACE "\\" "\\\\" VALUE "${VALUE}")
+    string(REPLACE "\"" "\\\"" VALUE "${VALUE}")
+    string(REPLACE "\n" "\\n" VALUE "${VALUE}")
+    string(REPLACE "\r" "\\r" VALUE "${VALUE}")
+    string(REPLACE "\t" "\\t" VALUE "${VALUE}")
+    set(${OUTPUT_VARIABLE} "${VALUE}" PARENT_SCOPE)
+endfunction()
+
+function(generate_diag_client_config JSON_FILE HEADER_FILE VARIABLE_NAME)
+    if (CMAKE_VERSION VERSION_LESS 3.19)
+        message(FATAL_ERROR "generate_diag_client_config requires CMake 3.19 or newer")
+    endif ()
+    get_filename_component(JSON_FILE "${JSON_FILE}" ABSOLUTE)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${JSON_FILE}")
+    file(READ "${JSON_FILE}" CONFIG_JSON)
+
+    string(JSON UDP_IP_ADDRESS GET "${CONFIG_JSON}" UdpIpAddress)
+    string(JSON UDP_BROADCAST_ADDRESS GET "${CONFIG_JSON}" UdpBroadcastAddress)
+    _diag_client_config_escape(UDP_IP_ADDRESS "${UDP_IP_ADDRESS}")
+    _diag_client_config_escape(UDP_BROADCAST_ADDRESS "${UDP_BROADCAST_ADDRESS}")
+    string(JSON NUMBER_OF_CONVERSATION GET "${CONFIG_JSON}" Conversation NumberOfConversation)
+    string(JSON CONVERSATION_COUNT LENGTH "${CONFIG_JSON}" Conversation ConversationProperty)
+    # same as the json parser, only the configured number of conversations is used
+    if (NUMBER_OF_CONVERSATION LESS CONVERSATION_COUNT)
+        set(CONVERSATION_COUNT ${NUMBER_OF_CONVERSATION})
+    endif ()
+    if (CONVERSATION_COUNT LESS 1)
+        message(FATAL_ERROR "${JSON_FILE}: at least one conversation is required")
+    endif ()
+
+    set(CONVERSATIONS "")
+    math(EXPR LAST_CONVERSATION "${CONVERSATION_COUNT} - 1")
+    foreach (INDEX RANGE ${LAST_CONVERSATION})
+        foreach (KEY ConversationName P2ClientMax P2StarClientMax RxBufferSize SourceAddress)
+            string(JSON ${KEY} GET "${CONFIG_JSON}" Conversation ConversationProperty ${INDEX} ${KEY})
+        endforeach ()
+        string(JSON TCP_IP_ADDRESS GET "${CONFIG_JSON}" Conversation ConversationProperty ${INDEX} Network TcpIpAddress)
+        _diag_client_config_escape(ConversationName "${ConversationName}")
+        _diag_client_config_escape(TCP_IP_ADDRESS "${TCP_IP_ADDRESS}")
+        string(APPEND CONVERSATIONS
+                "    diag::client::config::ConversationConfig{\"${ConversationName}\", ${P2ClientMax}U, "
+                "${P2StarClientMax}U, ${RxBufferSize}U, ${SourceAddress}U, \"${TCP_IP_ADDRESS}\"},\n")
+    endforeach ()
+
+    string(MAKE_C_IDENTIFIER "${VARIABLE_NAME}_H" INCLUDE_GUARD)
+    string(TOUPPER "${INCLUDE_GUARD}" INCLUDE_GUARD)
+    string(CONCAT HEADER_CONTENT
+            "// Generated by generate_diag_client_config() from ${JSON_FILE}, do not edit\n"
+            "#ifndef ${INCLUDE_GUARD}\n"
+            "#define ${INCLUDE_GUARD}\n\n"
+            "#include <array>\n\n"
+            "#include \"include/diagnostic_client_config.h\"\n\n"
+            "inline constexpr std::array<diag::client::config::ConversationConfig, ${CONVERSATION_COUNT}U> "
+            "${VARIABLE_NAME}Conversations{\n"
+            "${CONVERSATIONS}};\n\n"
+            "inline constexpr diag::client::config::DiagClientConfig ${VARIABLE_NAME}{\n"
+            "    \"${UDP_IP_ADDRESS}\", \"${UDP_BROADCAST_ADDRESS}\",\n"
+            "    core_type::Span<diag::client::config::ConversationConfig const>{${VARIABLE_NAME}Conversations}};\n\n"
+            "#endif  // ${INCLUDE_GUARD}\n")
+    # only touch the header when its content changes, so that dependent sources are not rebuilt needlessly
+    file(WRITE "${HEADER_FILE}.tmp" "${HEADER_CONTENT}")
+    configure_file("${HEADER_FILE}.tmp" "${HEADER_FILE}" COPYONLY)
+    file(REMOVE "${HEADER_FILE}.tmp")
+endfunction()
@@ -0,0 +1,56 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "socket/io_context.h"
+
+#include "common/logger.h"
+
+namespace boost_support {
+namespace socket {
+
+IoContext::IoContext() noexcept
+    : io_context_{},
+      work_guard_{boost::asio::make_work_guard(io_context_)},
+      running_{false},
+      thread_id_{},
+      execution_mutex_{},
+      mutex_{},
+      cond_var_{} {}
+
+IoContext::~IoContext() noexcept { Stop(); }
+
+void IoContext::Run() noexcept {
+  {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    running_ = true;
+    thread_id_ = std::this_thread::get_id();
+  }
+  common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(__FILE__, __LINE__, __func__,
+                                                                           "Event loop started");
+  io_context_.run();
+  {
+    // functions passed to Execute() before stopping are still handled, later ones are executed directly
+    std::lock_guard<std::mutex> const execution_lock{execution_mutex_};
+    {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      running_ = false;
+    }
+    io_context_.restart();
+    io_context_.poll();
+  }
+  common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(__FILE__, __LINE__, __func__,
+                                                                           "Event loop stopped");
+}
+
+void IoContext::Stop() noexcept {
+  work_guard_.reset();
+  io_context_.stop();
+}
+
+}  // namespace socket
+}  // namespace boost_support
@@ -0,0 +1,160 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_CONTEXT_H_
+#define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_CONTEXT_H_
+// includes
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace boost_support {
+namespace socket {
+
+/**
+ * @brief       Class used as event loop, running the asynchronous operations and timers of all sockets on one thread
+ */
+class IoContext final {
+ public:
+  /**
+   * @brief  Type alias for boost io context
+   */
+  using Context = boost::asio::io_context;
+
+  /**
+   * @brief         Constructs an instance of IoContext
+   */
+  IoContext() noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  IoContext(const IoContext &other) noexcept = delete;
+  IoContext &operator=(const IoContext &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  IoContext(IoContext &&other) noexcept = delete;
+  IoContext &operator=(IoContext &&other) noexcept = delete;
+
+  /**
+   * @brief         Destruct an instance of IoContext
+   */
+  ~IoContext() noexcept;
+
+  /**
+   * @brief         Function to run the event loop on the calling thread until Stop() is called
+   * @details       The event loop runs once, a stopped event loop is not run again
+   */
+  void Run() noexcept;
+
+  /**
+   * @brief         Function to stop the event loop, functions already passed to Execute() still run
+   */
+  void Stop() noexcept;
+
+  /**
+   * @brief         Function to get the underlying boost io context
+   * @return        The reference to boost io context
+   */
+  auto GetContext() noexcept -> Context & { return io_context_; }
+
+  /**
+   * @brief         Function to execute the function on the event loop and wait for its completion
+   * @details       The function is executed directly when called on the event loop or when the event loop is not
+   *                running. Since the event loop handles its work in order, completions already pending for a socket
+   *                are handled once this function returns.
+   * @param[in]     function
+   *                The function to be executed
+   */
+  template<typename Function>
+  void Execute(Function &&function) noexcept {
+    bool posted{false};
+    bool completed{false};
+    {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      if (running_ && (std::this_thread::get_id() != thread_id_)) {
+        boost::asio::post(io_context_, [this, &function, &completed]() {
+          function();
+          {
+            std::lock_guard<std::mutex> const completed_lock{mutex_};
+            completed = true;
+          }
+          cond_var_.notify_all();
+        });
+        posted = true;
+      }
+    }
+    if (posted) {
+      std::unique_lock<std::mutex> lock{mutex_};
+      cond_var_.wait(lock, [&completed]() { return completed; });
+    } else if (std::this_thread::get_id() == GetThreadId()) {
+      function();
+    } else {
+      // the event loop may still be handling the work left when stopped
+      std::lock_guard<std::mutex> const execution_lock{execution_mutex_};
+      function();
+    }
+  }
+
+ private:
+  /**
+   * @brief  Function to get the id of thread running the event loop
+   * @return The thread id, default constructed when the event loop never ran
+   */
+  auto GetThreadId() noexcept -> std::thread::id {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    return thread_id_;
+  }
+
+  /**
+   * @brief  Type alias for the work guard keeping the event loop running without pending work
+   */
+  using WorkGuard = boost::asio::executor_work_guard<Context::executor_type>;
+
+  /**
+   * @brief  boost io context
+   */
+  Context io_context_;
+
+  /**
+   * @brief  Store the work guard
+   */
+  WorkGuard work_guard_;
+
+  /**
+   * @brief  Flag telling whether the event loop is running
+   */
+  bool running_;
+
+  /**
+   * @brief  Store the id of thread running the event loop
+   */
+  std::thread::id thread_id_;
+
+  /**
+   * @brief  mutex held while the event loop handles the work left when stopped
+   */
+  std::mutex execution_mutex_;
+
+  /**
+   * @brief  mutex to lock the running state and the completion of executed functions
+   */
+  std::mutex mutex_;
+
+  /**
+   * @brief  Conditional variable to wait for the completion of executed functions
+   */
+  std::condition_variable cond_var_;
+};
+
+}  // namespace socket
+}  // namespace boost_support
+#endif  // DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_CONTEXT_H_
@@ -11,46 +11,26 @@
 #include <utility>
 
 #include "common/logger.h"
+#include "core/include/endian_codec.h"
+#include "utility/allocation_counter.h"
+#include "utility/trace.h"
 
 namespace boost_support {
 namespace socket {
 namespace tcp {
 
 TcpClientSocket::TcpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
-                                 TcpHandlerRead tcp_handler_read)
+                                 TcpHandlerRead tcp_handler_read, IoContext &io_context)
     : local_ip_address_{local_ip_address},
       local_port_num_{local_port_num},
-      io_context_{},
-      tcp_socket_{io_context_},
-      exit_request_{false},
-      running_{false},
-      cond_var_{},
-      mutex_{},
-      tcp_handler_read_{std::move(tcp_handler_read)} {
-  // Start thread to receive messages
-  thread_ = std::thread([this]() {
-    std::unique_lock<std::mutex> lck(mutex_);
-    while (!exit_request_) {
-      if (!running_) {
-        cond_var_.wait(lck, [this]() { return exit_request_ || running_; });
-      }
-      if (!exit_request_.load()) {
-        if (running_) {
-          lck.unlock();
-          HandleMessage();
-          lck.lock();
-        }
-      }
-    }
-  });
-}
+      remote_ip_address_{},
+      remote_port_num_{},
+      io_context_{io_context},
+      tcp_socket_{io_context.GetContext()},
+      rx_buffer_{},
+      tcp_handler_read_{std::move(tcp_handler_read)} {}
 
-TcpClientSocket::~TcpClientSocket() {
-  exit_request_ = true;
-  running_ = false;
-  cond_var_.notify_all();
-  thread_.join();
-}
+TcpClientSocket::~TcpClientSocket() { static_cast<void>(Destroy()); }
 
 core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Open() {
   core_type::Result<void, TcpErrorCode> result{TcpErrorCode::kGenericError};
@@ -61,6 +41,8 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Open() {
   if (ec.value() == boost::system::errc::success) {
     // reuse address
     tcp_socket_.set_option(boost::asio::socket_base::reuse_address{true});
+    // send every message immediately, request and response are too small to be worth coalescing
+    tcp_socket_.set_option(Tcp::no_delay{true});
     // Set socket to non blocking
     tcp_socket_.non_blocking(false);
     // Bind to local ip address and random port
@@ -74,6 +56,10 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Open() {
             msg << "Tcp Socket opened and bound to "
                 << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
           });
+#ifdef ENABLE_RX_HANDOFF
+      // the processing thread is only spent on sockets in use
+      StartProcessing();
+#endif
       result.EmplaceValue();
     } else {
       // Socket binding failed
@@ -99,17 +85,13 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::ConnectT
   // connect to provided ipAddress
   tcp_socket_.connect(Tcp::endpoint(TcpIpAddress::from_string(std::string{host_ip_address}), host_port_num), ec);
   if (ec.value() == boost::system::errc::success) {
+    Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint(ec)};
+    remote_ip_address_ = endpoint_.address().to_string();
+    remote_port_num_ = endpoint_.port();
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-        __FILE__, __LINE__, __func__, [this](std::stringstream &msg) {
-          Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint()};
-          msg << "Tcp Socket connected to host "
-              << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
-        });
-    {  // start reading
-      std::lock_guard<std::mutex> lock{mutex_};
-      running_ = true;
-      cond_var_.notify_all();
-    }
+        __FILE__, __LINE__, __func__, "Tcp Socket connected to host <{},{}>", remote_ip_address_, remote_port_num_);
+    // start reading on the event loop
+    io_context_.Execute([this]() { ReadHeader(); });
     result.EmplaceValue();
   } else {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
@@ -123,11 +105,9 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Disconne
   core_type::Result<void, TcpErrorCode> result{TcpErrorCode::kGenericError};
   TcpErrorCodeType ec{};
 
-  // Graceful shutdown
-  tcp_socket_.shutdown(TcpSocket::shutdown_both, ec);
+  // Graceful shutdown, the pending read ends with the shutdown
+  io_context_.Execute([this, &ec]() { tcp_socket_.shutdown(TcpSocket::shutdown_both, ec); });
   if (ec.value() == boost::system::errc::success) {
-    // stop reading
-    running_ = false;
     // Socket shutdown success
     result.EmplaceValue();
   } else {
@@ -143,16 +123,14 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Transmit
   core_type::Result<void, TcpErrorCode> result{TcpErrorCode::kGenericError};
   TcpErrorCodeType ec{};
 
-  boost::asio::write(tcp_socket_, boost::asio::buffer(tcp_message->GetTxBuffer(), tcp_message->GetTxBuffer().size()),
-                     ec);
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kBoostSupport};
+  utility::trace::TraceScope const trace_scope{"socket", "TcpWrite", tcp_message->GetTxBuffer().size()};
+  boost::asio::write(tcp_socket_,
+                     boost::asio::buffer(tcp_message->GetTxBuffer().data(), tcp_message->GetTxBuffer().size()), ec);
   // Check for error
   if (ec.value() == boost::system::errc::success) {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-        __FILE__, __LINE__, __func__, [this](std::stringstream &msg) {
-          Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint()};
-          msg << "Tcp message sent to "
-              << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
-        });
+        __FILE__, __LINE__, __func__, "Tcp message sent to <{},{}>", remote_ip_address_, remote_port_num_);
     result.EmplaceValue();
   } else {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
@@ -164,54 +142,111 @@ core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Transmit
 
 core_type::Result<void, TcpClientSocket::TcpErrorCode> TcpClientSocket::Destroy() {
   core_type::Result<void, TcpErrorCode> result{TcpErrorCode::kGenericError};
-  // destroy the socket
-  tcp_socket_.close();
+  // close on the event loop, the pending read is aborted
+  io_context_.Execute([this]() {
+    TcpErrorCodeType ec{};
+    tcp_socket_.close(ec);
+  });
+  // wait for the completions already pending to be handled
+  io_context_.Execute([]() {});
+#ifdef ENABLE_RX_HANDOFF
+  StopProcessing();
+#endif
   result.EmplaceValue();
   return result;
 }
 
-void TcpClientSocket::HandleMessage() {
-  TcpErrorCodeType ec{};
-  // create and reserve the buffer
-  TcpMessage::BufferType rx_buffer{};
-  rx_buffer.resize(kDoipheadrSize);
-  // start blocking read to read Header first
-  boost::asio::read(tcp_socket_, boost::asio::buffer(&rx_buffer[0u], kDoipheadrSize), ec);
+void TcpClientSocket::ReadHeader() {
+  // no further read once the socket is closed
+  if (!tcp_socket_.is_open()) { return; }
+  rx_buffer_.resize(kDoipheadrSize);
+  boost::asio::async_read(tcp_socket_, boost::asio::buffer(&rx_buffer_[0u], kDoipheadrSize),
+                          [this](TcpErrorCodeType const &error, std::size_t) {
+                            // the socket may already be destroyed when aborted
+                            if (error != boost::asio::error::operation_aborted) { HandleHeader(error); }
+                          });
+}
+
+void TcpClientSocket::HandleHeader(TcpErrorCodeType const &error) {
   // Check for error
-  if (ec.value() == boost::system::errc::success) {
+  if (error.value() == boost::system::errc::success) {
+    utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kBoostSupport};
     // read the next bytes to read
-    std::uint32_t const read_next_bytes = [&rx_buffer]() noexcept -> std::uint32_t {
-      return static_cast<std::uint32_t>((static_cast<std::uint32_t>(rx_buffer[4u] << 24u) & 0xFF000000) |
-                                        (static_cast<std::uint32_t>(rx_buffer[5u] << 16u) & 0x00FF0000) |
-                                        (static_cast<std::uint32_t>(rx_buffer[6u] << 8u) & 0x0000FF00) |
-                                        (static_cast<std::uint32_t>(rx_buffer[7u] & 0x000000FF)));
-    }();
+    std::uint32_t const read_next_bytes{core_type::LoadBigEndian<std::uint32_t>(&rx_buffer_[4u])};
     // reserve the buffer
-    rx_buffer.resize(kDoipheadrSize + std::size_t(read_next_bytes));
-    boost::asio::read(tcp_socket_, boost::asio::buffer(&rx_buffer[kDoipheadrSize], read_next_bytes), ec);
+    rx_buffer_.resize(kDoipheadrSize + std::size_t(read_next_bytes));
+    boost::asio::async_read(tcp_socket_, boost::asio::buffer(&rx_buffer_[kDoipheadrSize], read_next_bytes),
+                            [this](TcpErrorCodeType const &read_error, std::size_t) {
+                              // the socket may already be destroyed when aborted
+                              if (read_error != boost::asio::error::operation_aborted) { HandlePayload(read_error); }
+                            });
+  } else {
+    HandleReadError(error);
+  }
+}
 
+void TcpClientSocket::HandlePayload(TcpErrorCodeType const &error) {
+  // Check for error
+  if (error.value() == boost::system::errc::success) {
+    utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kBoostSupport};
+    utility::trace::TraceScope const trace_scope{"socket", "TcpReceive"};
     // all message received, transfer to upper layer
-    Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint()};
     TcpMessagePtr tcp_rx_message{
-        std::make_unique<TcpMessage>(endpoint_.address().to_string(), endpoint_.port(), std::move(rx_buffer))};
+        std::make_unique<TcpMessage>(remote_ip_address_, remote_port_num_, std::move(rx_buffer_))};
+    rx_buffer_ = TcpMessage::BufferType{};
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-        __FILE__, __LINE__, __func__, [endpoint_](std::stringstream &msg) {
-          msg << "Tcp Message received from "
-              << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
-        });
+        __FILE__, __LINE__, __func__, "Tcp Message received from <{},{}>", remote_ip_address_, remote_port_num_);
     // notify upper layer about received message
-    tcp_handler_read_(std::move(tcp_rx_message));
-  } else if (ec.value() == boost::asio::error::eof) {
-    running_ = false;
+    DeliverMessage(std::move(tcp_rx_message));
+    // continue with the next message
+    ReadHeader();
+  } else {
+    HandleReadError(error);
+  }
+}
+
+void TcpClientSocket::HandleReadError(TcpErrorCodeType const &error) {
+  if (error.value() == boost::asio::error::eof) {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         __FILE__, __LINE__, __func__,
-        [ec](std::stringstream &msg) { msg << "Remote Disconnected with: " << ec.message(); });
+        [error](std::stringstream &msg) { msg << "Remote Disconnected with: " << error.message(); });
   } else {
-    running_ = false;
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
         __FILE__, __LINE__, __func__,
-        [ec](std::stringstream &msg) { msg << "Remote Disconnected with undefined error: " << ec.message(); });
+        [error](std::stringstream &msg) { msg << "Remote Disconnected with undefined error: " << error.message(); });
+  }
+}
+
+#ifdef ENABLE_RX_HANDOFF
+void TcpClientSocket::StartProcessing() {
+  if (processing_thread_.joinable()) { return; }
+  rx_handoff_.Restart();
+  // Start thread to process received messages in batches, it only blocks when no message is pending
+  processing_thread_ = std::thread([this]() {
+    utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDoipClient};
+    while (rx_handoff_.ConsumeBatch(
+        [this](TcpMessagePtr tcp_rx_message) { tcp_handler_read_(std::move(tcp_rx_message)); })) {}
+  });
+}
+
+void TcpClientSocket::StopProcessing() {
+  if (!processing_thread_.joinable()) { return; }
+  // messages already received are still processed before the thread terminates
+  rx_handoff_.Stop();
+  processing_thread_.join();
+}
+#endif
+
+void TcpClientSocket::DeliverMessage(TcpMessagePtr tcp_rx_message) {
+#ifdef ENABLE_RX_HANDOFF
+  if (!rx_handoff_.Push(std::move(tcp_rx_message))) {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogWarn(
+        __FILE__, __LINE__, __func__, "Tcp message from <{},{}> dropped on shutdown", remote_ip_address_,
+        remote_port_num_);
   }
+#else
+  tcp_handler_read_(std::move(tcp_rx_message));
+#endif
 }
 }  // namespace tcp
 }  // namespace socket
@@ -14,7 +14,12 @@
 #include <thread>
 
 #include "core/include/result.h"
+#include "socket/io_context.h"
 #include "socket/tcp/tcp_message.h"
+#include "utility/inline_function.h"
+#ifdef ENABLE_RX_HANDOFF
+#include "utility/spsc_handoff.h"
+#endif
 
 namespace boost_support {
 namespace socket {
@@ -31,9 +36,10 @@ class TcpClientSocket final {
   enum class TcpErrorCode : std::uint8_t { kOpenFailed, kBindingFailed, kGenericError };
 
   /**
-   * @brief         Tcp function template used for reception
+   * @brief         Tcp function template used for reception, stored without allocation
    */
-  using TcpHandlerRead = std::function<void(TcpMessagePtr)>;
+  using TcpHandlerRead =
+      utility::function::InlineFunction<void(TcpMessagePtr), utility::function::kDefaultInlineCapacity>;
 
  public:
   /**
@@ -43,9 +49,12 @@ class TcpClientSocket final {
    * @param[in]     local_port_num
    *                The local port number
    * @param[in]     tcp_handler_read
-   *                The handler to send received data to user
+   *                The handler to send received data to user, called on the event loop
+   * @param[in]     io_context
+   *                The event loop receiving messages of the socket
    */
-  TcpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, TcpHandlerRead tcp_handler_read);
+  TcpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, TcpHandlerRead tcp_handler_read,
+                  IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of TcpClientSocket
@@ -120,9 +129,19 @@ class TcpClientSocket final {
   std::uint16_t local_port_num_;
 
   /**
-   * @brief  boost io context
+   * @brief  Store remote ip address of the connected host, cached to avoid querying the socket per message
    */
-  boost::asio::io_context io_context_;
+  std::string remote_ip_address_;
+
+  /**
+   * @brief  Store remote port number of the connected host
+   */
+  std::uint16_t remote_port_num_;
+
+  /**
+   * @brief  Store the reference to event loop
+   */
+  IoContext &io_context_;
 
   /**
    * @brief  Store tcp socket
@@ -130,40 +149,77 @@ class TcpClientSocket final {
   TcpSocket tcp_socket_;
 
   /**
-   * @brief  Flag to terminate the thread
+   * @brief  Reception buffer of the message being read
    */
-  std::atomic_bool exit_request_;
+  TcpMessage::BufferType rx_buffer_;
 
   /**
-   * @brief  Flag to start the thread
+   * @brief  Store the handler
    */
-  std::atomic_bool running_;
+  TcpHandlerRead tcp_handler_read_;
 
+#ifdef ENABLE_RX_HANDOFF
   /**
-   * @brief  Conditional variable to block the thread
+   * @brief  Number of received messages buffered between the event loop and the processing thread
    */
-  std::condition_variable cond_var_;
+  static constexpr std::size_t kRxHandoffCapacity{32U};
 
   /**
-   * @brief  The thread itself
+   * @brief  Handoff of received messages from the event loop to the processing thread
    */
-  std::thread thread_;
+  utility::ring_buffer::SpscHandoff<TcpMessagePtr, kRxHandoffCapacity> rx_handoff_;
 
   /**
-   * @brief  mutex to lock critical section
+   * @brief  The thread passing received messages to the handler, it runs from opening until destroying the socket
    */
-  std::mutex mutex_;
+  std::thread processing_thread_;
+#endif
 
+ private:
   /**
-   * @brief  Store the handler
+   * @brief  Function to start the asynchronous read of the next message header
    */
-  TcpHandlerRead tcp_handler_read_;
+  void ReadHeader();
+
+  /**
+   * @brief  Function to handle the received message header and start reading the payload
+   * @param[in]     error
+   *                The error of reading
+   */
+  void HandleHeader(const TcpErrorCodeType &error);
+
+  /**
+   * @brief  Function to handle the received message payload and start reading the next message
+   * @param[in]     error
+   *                The error of reading
+   */
+  void HandlePayload(const TcpErrorCodeType &error);
+
+  /**
+   * @brief  Function to log the end of reception
+   * @param[in]     error
+   *                The error of reading
+   */
+  void HandleReadError(const TcpErrorCodeType &error);
+
+#ifdef ENABLE_RX_HANDOFF
+  /**
+   * @brief  Function to start the processing thread, if not yet running
+   */
+  void StartProcessing();
+
+  /**
+   * @brief  Function to stop the processing thread and wait for its termination, if running
+   */
+  void StopProcessing();
+#endif
 
- private:
   /**
-   * @brief  Function to handle the reception of tcp message
+   * @brief  Function to pass the received message to the handler, directly or through the processing thread
+   * @param[in]     tcp_rx_message
+   *                The received tcp message
    */
-  void HandleMessage();
+  void DeliverMessage(TcpMessagePtr tcp_rx_message);
 };
 }  // namespace tcp
 }  // namespace socket
@@ -11,18 +11,32 @@
 #include <memory>
 #include <string>
 #include <string_view>
-#include <vector>
 
+#include "core/include/small_byte_vector.h"
 #include "core/include/span.h"
+#include "utility/object_pool.h"
+#include "utility/static_capacity.h"
 
 namespace boost_support {
 namespace socket {
 namespace tcp {
 
+/**
+ * @brief    Number of tcp messages recycled by the object pool, more messages alive at a time are taken from the heap
+ */
+constexpr std::size_t kTcpMessagePoolCapacity{utility::capacity::kTcpMessagePoolSize};
+
+/**
+ * @brief    Number of bytes kept inside a tcp message buffer without heap allocation, covers the DoIP header, the
+ *           diagnostic message addresses and a short UDS payload
+ */
+constexpr std::size_t kTcpMessageInlineCapacity{64U};
+
 /**
  * @brief    Immutable class to store received tcp message
+ * @details  The storage of messages is recycled by an object pool, so that TcpMessagePtr keeps the default deleter
  */
-class TcpMessage final {
+class TcpMessage final : public utility::memory::PoolAllocated<TcpMessage, kTcpMessagePoolCapacity> {
  public:
   /**
    * @brief    Definition of different socket state
@@ -45,7 +59,7 @@ class TcpMessage final {
   /**
    * @brief    Type alias for underlying buffer
    */
-  using BufferType = std::vector<uint8_t>;
+  using BufferType = core_type::SmallByteVector<kTcpMessageInlineCapacity>;
 
   /**
    * @brief    Type alias of IP address type
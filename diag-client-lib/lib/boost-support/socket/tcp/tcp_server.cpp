@@ -8,6 +8,7 @@
 #include "socket/tcp/tcp_server.h"
 
 #include "common/logger.h"
+#include "core/include/endian_codec.h"
 
 namespace boost_support {
 namespace socket {
@@ -37,6 +38,8 @@ CreateTcpServerSocket::TcpServerConnection CreateTcpServerSocket::GetTcpServerCo
   // blocking accept
   static_cast<void>(tcp_accepter_->accept(tcp_connection.GetSocket(), endpoint, ec));
   if (ec.value() == boost::system::errc::success) {
+    // send every message immediately, the response must not wait for the acknowledgement of preceding message
+    tcp_connection.GetSocket().set_option(Tcp::no_delay{true}, ec);
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         __FILE__, __LINE__, __func__, [endpoint](std::stringstream &msg) {
           msg << "Tcp Socket connection received from client "
@@ -53,7 +56,7 @@ CreateTcpServerSocket::TcpServerConnection CreateTcpServerSocket::GetTcpServerCo
 CreateTcpServerSocket::TcpServerConnection::TcpServerConnection(boost::asio::io_context &io_context,
                                                                 TcpHandlerRead &&tcp_handler_read)
     : tcp_socket_{io_context},
-      tcp_handler_read_{tcp_handler_read} {}
+      tcp_handler_read_{std::move(tcp_handler_read)} {}
 
 TcpSocket &CreateTcpServerSocket::TcpServerConnection::GetSocket() { return tcp_socket_; }
 
@@ -62,10 +65,11 @@ bool CreateTcpServerSocket::TcpServerConnection::Transmit(TcpMessageConstPtr tcp
   bool ret_val{false};
   boost::asio::write(
       tcp_socket_,
-      boost::asio::buffer(tcp_tx_message->GetTxBuffer(), std::size_t(tcp_tx_message->GetTxBuffer().size())), ec);
+      boost::asio::buffer(tcp_tx_message->GetTxBuffer().data(), tcp_tx_message->GetTxBuffer().size()), ec);
   // Check for error
   if (ec.value() == boost::system::errc::success) {
-    Tcp::endpoint endpoint_{tcp_socket_.remote_endpoint()};
+    // the client may already have disconnected after receiving the message, the endpoint is only logged
+    Tcp::endpoint endpoint_{tcp_socket_.remote_endpoint(ec)};
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         __FILE__, __LINE__, __func__, [endpoint_](std::stringstream &msg) {
           msg << "Tcp message sent to "
@@ -92,12 +96,7 @@ bool CreateTcpServerSocket::TcpServerConnection::ReceivedMessage() {
   // Check for error
   if (ec.value() == boost::system::errc::success) {
     // read the next bytes to read
-    std::uint32_t const read_next_bytes = [&rx_buffer]() noexcept -> std::uint32_t {
-      return static_cast<std::uint32_t>((static_cast<std::uint32_t>(rx_buffer[4u] << 24u) & 0xFF000000) |
-                                        (static_cast<std::uint32_t>(rx_buffer[5u] << 16u) & 0x00FF0000) |
-                                        (static_cast<std::uint32_t>(rx_buffer[6u] << 8u) & 0x0000FF00) |
-                                        (static_cast<std::uint32_t>(rx_buffer[7u] & 0x000000FF)));
-    }();
+    std::uint32_t const read_next_bytes{core_type::LoadBigEndian<std::uint32_t>(&rx_buffer[4u])};
     // reserve the buffer
     rx_buffer.resize(kDoipheadrSize + std::size_t(read_next_bytes));
     boost::asio::read(tcp_socket_, boost::asio::buffer(&rx_buffer[kDoipheadrSize], read_next_bytes), ec);
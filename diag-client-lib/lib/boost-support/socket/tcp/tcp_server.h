@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "tcp_message.h"
+#include "utility/inline_function.h"
 
 namespace boost_support {
 namespace socket {
@@ -24,8 +25,9 @@ using TcpSocket = Tcp::socket;
 
 class CreateTcpServerSocket {
  public:
-  // Tcp function template used for reception
-  using TcpHandlerRead = std::function<void(TcpMessagePtr)>;
+  // Tcp function template used for reception, stored without allocation
+  using TcpHandlerRead =
+      utility::function::InlineFunction<void(TcpMessagePtr), utility::function::kDefaultInlineCapacity>;
 
   // Tcp Server connection class to create connection with client
   class TcpServerConnection {
@@ -84,10 +86,10 @@ class CreateTcpServerSocket {
   std::string local_ip_address_;
   // local port number
   uint16_t local_port_num_;
+  // boost io context, declared first as it must outlive the accepter
+  boost::asio::io_context io_context_;
   // tcp socket accepter
   std::unique_ptr<TcpAccepter> tcp_accepter_;
-  // boost io context
-  boost::asio::io_context io_context_;
 };
 
 }  // namespace tcp
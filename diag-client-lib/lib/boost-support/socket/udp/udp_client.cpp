@@ -8,50 +8,107 @@
 
 #include "socket/udp/udp_client.h"
 
+#include <utility>
+
 #include "common/logger.h"
+#include "utility/allocation_counter.h"
 
 namespace boost_support {
 namespace socket {
 namespace udp {
+namespace {
+
+/**
+ * @brief  Rate limit of the log site reporting ignored messages, burst of 5 messages then 1 message per second
+ */
+constexpr std::uint32_t kIgnoredMessageLogBurst{5U};
+constexpr std::chrono::milliseconds kIgnoredMessageLogInterval{1000U};
+
+}  // namespace
 
 UdpClientSocket::UdpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, PortType port_type,
-                                 UdpHandlerRead udp_handler_read)
+                                 UdpHandlerRead udp_handler_read, IoContext &io_context)
+    : UdpClientSocket{local_ip_address, local_port_num, port_type, std::move(udp_handler_read), io_context,
+                      std::chrono::milliseconds::zero()} {}
+
+UdpClientSocket::UdpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, PortType port_type,
+                                 UdpHandlerRead udp_handler_read, IoContext &io_context,
+                                 std::chrono::milliseconds idle_timeout)
     : local_ip_address_{local_ip_address},
       local_port_num_{local_port_num},
-      io_context_{},
-      udp_socket_{io_context_},
-      exit_request_{false},
-      running_{false},
-      cond_var_{},
-      mutex_{},
+      io_context_{io_context},
+      udp_socket_{io_context.GetContext()},
+      idle_timer_{io_context.GetContext()},
+      idle_timeout_{idle_timeout},
+      last_activity_{},
       port_type_{port_type},
       udp_handler_read_{std::move(udp_handler_read)},
-      rx_buffer_{} {
-  // Start thread to receive messages
-  thread_ = std::thread([this]() {
-    std::unique_lock<std::mutex> lck(mutex_);
-    while (!exit_request_) {
-      if (!running_) {
-        cond_var_.wait(lck, [this]() { return exit_request_ || running_; });
-      }
-      if (!exit_request_) {
-        if (running_) {
-          io_context_.restart();
-          io_context_.run();
-        }
+      rx_buffer_{} {}
+
+UdpClientSocket::~UdpClientSocket() { Destroy(); }
+
+core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Open() {
+  core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
+  io_context_.Execute([this, &result]() {
+    last_activity_ = Clock::now();
+    if (udp_socket_.is_open()) {
+      result.EmplaceValue();
+    } else {
+      result = OpenSocket();
+    }
+  });
+  return result;
+}
+
+core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Transmit(UdpMessageConstPtr udp_message) {
+  core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
+  io_context_.Execute([this, &result, &udp_message]() {
+    last_activity_ = Clock::now();
+    try {
+      // Transmit to remote endpoints
+      std::size_t send_size{udp_socket_.send_to(
+          boost::asio::buffer(udp_message->GetTxBuffer(), std::size_t(udp_message->GetTxBuffer().size())),
+          Udp::endpoint{UdpIpAddress::from_string(std::string{udp_message->GetHostIpAddress()}),
+                        udp_message->GetHostPortNumber()})};
+      // Check for error
+      if (send_size == udp_message->GetTxBuffer().size()) {
+        // successful
+        common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+            __FILE__, __LINE__, __func__, "Udp message sent : <{},{}> -> <{},{}>", local_ip_address_, local_port_num_,
+            udp_message->GetHostIpAddress(), udp_message->GetHostPortNumber());
+        result.EmplaceValue();
+        // start async receive
+        Receive();
       }
+    } catch (boost::system::system_error const &ec) {
+      UdpErrorCodeType error = ec.code();
+      std::cerr << error.message() << "\n";
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+          __FILE__, __LINE__, __func__, [error, &udp_message](std::stringstream &msg) {
+            msg << "Udp message sending to "
+                << "<" << udp_message->GetHostIpAddress() << "> "
+                << "failed with error: " << error.message();
+          });
     }
   });
+  return result;
 }
 
-UdpClientSocket::~UdpClientSocket() {
-  exit_request_ = true;
-  running_ = false;
-  cond_var_.notify_all();
-  thread_.join();
+core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Destroy() {
+  core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
+  // destroy the socket on the event loop, the pending reception and idle timer are aborted
+  io_context_.Execute([this]() {
+    UdpErrorCodeType ec{};
+    idle_timer_.cancel();
+    udp_socket_.close(ec);
+  });
+  // wait for the completions already pending to be handled
+  io_context_.Execute([]() {});
+  result.EmplaceValue();
+  return result;
 }
 
-core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Open() {
+core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::OpenSocket() {
   core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
   UdpErrorCodeType ec{};
 
@@ -82,15 +139,9 @@ core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Open() {
           });
       // Update the port number with new one
       local_port_num_ = udp_socket_.local_endpoint().port();
-      {  // start reading
-        std::lock_guard<std::mutex> lock{mutex_};
-        running_ = true;
-        cond_var_.notify_all();
-      }
       // start async receive
-      udp_socket_.async_receive_from(
-          boost::asio::buffer(rx_buffer_), remote_endpoint_,
-          [this](const UdpErrorCodeType &error, std::size_t bytes_recvd) { HandleMessage(error, bytes_recvd); });
+      Receive();
+      if (idle_timeout_ != std::chrono::milliseconds::zero()) { StartIdleTimer(); }
       result.EmplaceValue();
     } else {
       // Socket binding failed
@@ -106,58 +157,43 @@ core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Open() {
   return result;
 }
 
-core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Transmit(UdpMessageConstPtr udp_message) {
-  core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
-  try {
-    // Transmit to remote endpoints
-    std::size_t send_size{udp_socket_.send_to(
-        boost::asio::buffer(udp_message->GetTxBuffer(), std::size_t(udp_message->GetTxBuffer().size())),
-        Udp::endpoint{UdpIpAddress::from_string(std::string{udp_message->GetHostIpAddress()}),
-                      udp_message->GetHostPortNumber()})};
-    // Check for error
-    if (send_size == udp_message->GetTxBuffer().size()) {
-      // successful
-      Udp::endpoint endpoint{udp_socket_.local_endpoint()};
-      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-          __FILE__, __LINE__, __func__, [&udp_message, endpoint](std::stringstream &msg) {
-            msg << "Udp message sent : "
-                << "<" << endpoint.address().to_string() << "," << endpoint.port() << ">"
-                << " -> "
-                << "<" << udp_message->GetHostIpAddress() << "," << udp_message->GetHostPortNumber() << ">";
-          });
-      result.EmplaceValue();
-      // start async receive
-      udp_socket_.async_receive_from(
-          boost::asio::buffer(rx_buffer_), remote_endpoint_,
-          [this](const UdpErrorCodeType &error, std::size_t bytes_received) { HandleMessage(error, bytes_received); });
-    }
-  } catch (boost::system::system_error const &ec) {
-    UdpErrorCodeType error = ec.code();
-    std::cerr << error.message() << "\n";
-    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
-        __FILE__, __LINE__, __func__, [error, &udp_message](std::stringstream &msg) {
-          msg << "Udp message sending to "
-              << "<" << udp_message->GetHostIpAddress() << "> "
-              << "failed with error: " << error.message();
-        });
-  }
-  return result;
+void UdpClientSocket::Receive() {
+  // no further reception once the socket is closed
+  if (!udp_socket_.is_open()) { return; }
+  udp_socket_.async_receive_from(boost::asio::buffer(rx_buffer_), remote_endpoint_,
+                                 [this](const UdpErrorCodeType &error, std::size_t bytes_received) {
+                                   HandleMessage(error, bytes_received);
+                                 });
 }
 
-core_type::Result<void, UdpClientSocket::UdpErrorCode> UdpClientSocket::Destroy() {
-  core_type::Result<void, UdpErrorCode> result{UdpErrorCode::kGenericError};
-  // destroy the socket
-  udp_socket_.close();
-  running_ = false;
-  io_context_.stop();
-  result.EmplaceValue();
-  return result;
+void UdpClientSocket::StartIdleTimer() {
+  idle_timer_.expires_at(last_activity_ + idle_timeout_);
+  idle_timer_.async_wait([this](const UdpErrorCodeType &error) {
+    // the socket may already be destroyed when aborted
+    if (error != boost::asio::error::operation_aborted) { ReleaseWhenIdle(); }
+  });
+}
+
+void UdpClientSocket::ReleaseWhenIdle() {
+  if (!udp_socket_.is_open()) { return; }
+  if (Clock::now() - last_activity_ >= idle_timeout_) {
+    UdpErrorCodeType ec{};
+    udp_socket_.close(ec);
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+        __FILE__, __LINE__, __func__, "Udp Socket <{},{}> released after being idle", local_ip_address_,
+        local_port_num_);
+  } else {
+    // activity happened meanwhile
+    StartIdleTimer();
+  }
 }
 
 // function invoked when datagram is received
 void UdpClientSocket::HandleMessage(const UdpErrorCodeType &error, std::size_t total_bytes_received) {
   // Check for error
   if (error.value() == boost::system::errc::success) {
+    utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kBoostSupport};
+    last_activity_ = Clock::now();
     if (local_ip_address_ != remote_endpoint_.address().to_string()) {
       UdpMessage::BufferType received_data{};
       received_data.reserve(total_bytes_received);
@@ -168,29 +204,25 @@ void UdpClientSocket::HandleMessage(const UdpErrorCodeType &error, std::size_t t
                                                                 remote_endpoint_.port(), std::move(received_data))};
 
       common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogInfo(
-          __FILE__, __LINE__, __func__, [this, &udp_rx_message](std::stringstream &msg) {
-            msg << "Udp Message received: "
-                << "<" << udp_rx_message->GetHostIpAddress() << "," << udp_rx_message->GetHostPortNumber() << ">"
-                << " -> "
-                << "<" << local_ip_address_ << "," << local_port_num_ << ">";
-          });
+          __FILE__, __LINE__, __func__, "Udp Message received: <{},{}> -> <{},{}>", udp_rx_message->GetHostIpAddress(),
+          udp_rx_message->GetHostPortNumber(), local_ip_address_, local_port_num_);
 
       // send data to upper layer
       udp_handler_read_(std::move(udp_rx_message));
       // start async receive
-      udp_socket_.async_receive_from(boost::asio::buffer(rx_buffer_), remote_endpoint_,
-                                     [this](const UdpErrorCodeType &error_received, std::size_t bytes_received) {
-                                       HandleMessage(error_received, bytes_received);
-                                     });
+      Receive();
     } else {
       Udp::endpoint endpoint_{remote_endpoint_};
-      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogVerbose(
-          __FILE__, __LINE__, __func__, [endpoint_, this](std::stringstream &msg) {
-            msg << "Udp Message received from "
-                << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">"
-                << " ignored as received by self ip"
-                << " <" << local_ip_address_ << ">";
-          });
+      static utility::logger::LogRateLimiter rate_limiter{kIgnoredMessageLogBurst, kIgnoredMessageLogInterval};
+      common::logger::LibBoostLogger::GetLibBoostLogger()
+          .GetLogger()
+          .LogRateLimited<utility::logger::LogLevel::kVerbose>(
+              rate_limiter, __FILE__, __LINE__, __func__, [endpoint_, this](std::stringstream &msg) {
+                msg << "Udp Message received from "
+                    << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">"
+                    << " ignored as received by self ip"
+                    << " <" << local_ip_address_ << ">";
+              });
     }
   } else {
     if (error.value() != boost::asio::error::operation_aborted) {
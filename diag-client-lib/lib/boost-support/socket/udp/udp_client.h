@@ -9,13 +9,15 @@
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_UDP_UDP_CLIENT_H_
 // includes
 #include <boost/asio.hpp>
+#include <chrono>
 #include <string>
 #include <string_view>
-#include <thread>
 #include <vector>
 
 #include "core/include/result.h"
+#include "socket/io_context.h"
 #include "socket/udp/udp_message.h"
+#include "utility/inline_function.h"
 
 namespace boost_support {
 namespace socket {
@@ -37,9 +39,10 @@ class UdpClientSocket final {
   enum class PortType : std::uint8_t { kUdp_Broadcast = 0, kUdp_Unicast };
 
   /**
-   * @brief         Udp function template used for reception
+   * @brief         Udp function template used for reception, stored without allocation
    */
-  using UdpHandlerRead = std::function<void(UdpMessagePtr)>;
+  using UdpHandlerRead =
+      utility::function::InlineFunction<void(UdpMessagePtr), utility::function::kDefaultInlineCapacity>;
 
  public:
   /**
@@ -51,10 +54,32 @@ class UdpClientSocket final {
    * @param[in]     port_type
    *                The type of socket port
    * @param[in]     UdpHandlerRead
-   *                The handler to send received data to user
+   *                The handler to send received data to user, called on the event loop
+   * @param[in]     io_context
+   *                The event loop receiving messages of the socket
    */
   UdpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, PortType port_type,
-                  UdpHandlerRead udp_handler_read);
+                  UdpHandlerRead udp_handler_read, IoContext &io_context);
+
+  /**
+   * @brief         Constructs an instance of UdpClientSocket released when idle
+   * @details       The socket is released when no message was transmitted or received for the idle timeout, a released
+   *                socket is opened again by Open()
+   * @param[in]     local_ip_address
+   *                The local ip address
+   * @param[in]     local_port_num
+   *                The local port number
+   * @param[in]     port_type
+   *                The type of socket port
+   * @param[in]     UdpHandlerRead
+   *                The handler to send received data to user, called on the event loop
+   * @param[in]     io_context
+   *                The event loop receiving messages of the socket and monitoring its idle time
+   * @param[in]     idle_timeout
+   *                The idle time after which the socket is released, zero keeps the socket open until destroyed
+   */
+  UdpClientSocket(std::string_view local_ip_address, std::uint16_t local_port_num, PortType port_type,
+                  UdpHandlerRead udp_handler_read, IoContext &io_context, std::chrono::milliseconds idle_timeout);
 
   /**
    * @brief         Destruct an instance of UdpClientSocket
@@ -62,7 +87,7 @@ class UdpClientSocket final {
   virtual ~UdpClientSocket();
 
   /**
-   * @brief         Function to Open the socket
+   * @brief         Function to Open the socket, an already opened socket stays open
    * @return        Empty result on success otherwise error code
    */
   core_type::Result<void, UdpErrorCode> Open();
@@ -102,6 +127,11 @@ class UdpClientSocket final {
    */
   using UdpErrorCodeType = boost::system::error_code;
 
+  /**
+   * @brief  Type alias for the clock measuring the idle time
+   */
+  using Clock = std::chrono::steady_clock;
+
   /**
    * @brief  Store local ip address
    */
@@ -113,39 +143,29 @@ class UdpClientSocket final {
   std::uint16_t local_port_num_;
 
   /**
-   * @brief  boost io context
+   * @brief  Store the reference to event loop
    */
-  boost::asio::io_context io_context_;
+  IoContext &io_context_;
 
   /**
-   * @brief  Store tcp socket
+   * @brief  Store udp socket
    */
   UdpSocket udp_socket_;
 
   /**
-   * @brief  Flag to terminate the thread
-   */
-  std::atomic_bool exit_request_;
-
-  /**
-   * @brief  Flag to start the thread
-   */
-  std::atomic_bool running_;
-
-  /**
-   * @brief  Conditional variable to block the thread
+   * @brief  Timer releasing the socket when idle
    */
-  std::condition_variable cond_var_;
+  boost::asio::steady_timer idle_timer_;
 
   /**
-   * @brief  The thread itself
+   * @brief  Store the idle time after which the socket is released, zero when never released
    */
-  std::thread thread_;
+  std::chrono::milliseconds idle_timeout_;
 
   /**
-   * @brief  mutex to lock critical section
+   * @brief  Store the time of the last transmission or reception
    */
-  std::mutex mutex_;
+  Clock::time_point last_activity_;
 
   /**
    * @brief  Store the remote endpoint
@@ -169,7 +189,28 @@ class UdpClientSocket final {
 
  private:
   /**
-   * @brief  Function to handle the reception of tcp message
+   * @brief  Function to open the socket on the event loop
+   * @return Empty result on success otherwise error code
+   */
+  core_type::Result<void, UdpErrorCode> OpenSocket();
+
+  /**
+   * @brief  Function to start the asynchronous reception of the next message
+   */
+  void Receive();
+
+  /**
+   * @brief  Function to arm the idle timer to expire once the idle timeout passed since the last activity
+   */
+  void StartIdleTimer();
+
+  /**
+   * @brief  Function to close the socket when it was idle for the idle timeout, otherwise re-arm the idle timer
+   */
+  void ReleaseWhenIdle();
+
+  /**
+   * @brief  Function to handle the reception of udp message
    */
   void HandleMessage(const UdpErrorCodeType &error, std::size_t bytes_received);
 };
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "core/include/span.h"
+#include "utility/object_pool.h"
 
 namespace boost_support {
 namespace socket {
@@ -25,10 +26,16 @@ namespace udp {
    */
 constexpr std::uint8_t kDoipUdpResSize{40u};
 
+/**
+ * @brief    Number of udp messages recycled by the object pool, more messages alive at a time are taken from the heap
+ */
+constexpr std::size_t kUdpMessagePoolCapacity{16U};
+
 /**
  * @brief    Immutable class to store received udp message
+ * @details  The storage of messages is recycled by an object pool, so that UdpMessagePtr keeps the default deleter
  */
-class UdpMessage final {
+class UdpMessage final : public utility::memory::PoolAllocated<UdpMessage, kUdpMessagePoolCapacity> {
  public:
   /**
    * @brief    Type alias for underlying buffer
@@ -9,13 +9,16 @@
 #include "channel/tcp_channel/doip_diagnostic_message_handler.h"
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
+#include "core/include/endian_codec.h"
 #include "utility/state.h"
 #include "utility/sync_timer.h"
+#include "utility/trace.h"
 
 namespace doip_client {
 namespace channel {
@@ -29,6 +32,12 @@ constexpr std::uint16_t kDoip_DiagMessage_Type{0x8001};
 constexpr std::uint16_t kDoip_DiagMessagePosAck_Type{0x8002};
 constexpr std::uint16_t kDoip_DiagMessageNegAck_Type{0x8003};
 
+/**
+ * @brief  Rate limit of log sites reporting ignored responses, burst of 5 messages then 1 message per second
+ */
+constexpr std::uint32_t kIgnoredResponseLogBurst{5U};
+constexpr std::chrono::milliseconds kIgnoredResponseLogInterval{1000U};
+
 /**
  * @brief  Diagnostic Message negative acknowledgement code
  */
@@ -268,7 +277,7 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
   /**
    * @brief  Type alias for Sync timer
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using SyncTimer = utility::sync_timer::SyncTimer;
 
   /**
    * @brief         Constructs an instance of DiagnosticMessageHandlerImpl
@@ -276,12 +285,16 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
    *                The reference to socket handler
    * @param[in]     channel
    *                The reference to doip channel
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  DiagnosticMessageHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel)
+  DiagnosticMessageHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel,
+                               core_type::Clock &clock)
       : tcp_socket_handler_{tcp_socket_handler},
         channel_{channel},
         state_context_{},
-        sync_timer_{} {
+        sync_timer_{clock},
+        positive_ack_received_{false} {
     // create and add state for Diagnostic State
     // kIdle
     state_context_.AddState(DiagnosticMessageState::kIdle, std::make_unique<kIdle>(DiagnosticMessageState::kIdle));
@@ -328,6 +341,12 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
    */
   void Reset() { Stop(); }
 
+  /**
+   * @brief        Function to abort the handler on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  void Abort() { sync_timer_.Shutdown(); }
+
   /**
    * @brief       Function to get the Diagnostic Message State context
    * @return      The reference to state context
@@ -352,6 +371,23 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
    */
   auto GetSyncTimer() noexcept -> SyncTimer & { return sync_timer_; }
 
+  /**
+   * @brief       Function to remember whether the active request was positively acknowledged
+   * @param[in]   positive_ack_received
+   *              True when positive acknowledgement was received
+   */
+  void SetPositiveAckReceived(bool positive_ack_received) noexcept {
+    positive_ack_received_.store(positive_ack_received, std::memory_order_release);
+  }
+
+  /**
+   * @brief       Function to check whether the active request was positively acknowledged
+   * @return      True when positive acknowledgement was received
+   */
+  auto IsPositiveAckReceived() const noexcept -> bool {
+    return positive_ack_received_.load(std::memory_order_acquire);
+  }
+
  private:
   /**
    * @brief  The reference to socket handler
@@ -372,11 +408,16 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
    * @brief  Store the synchronous timer
    */
   SyncTimer sync_timer_;
+
+  /**
+   * @brief  Store whether the active request was positively acknowledged
+   */
+  std::atomic_bool positive_ack_received_;
 };
 
 DiagnosticMessageHandler::DiagnosticMessageHandler(sockets::TcpSocketHandler &tcp_socket_handler,
-                                                   DoipTcpChannel &channel)
-    : handler_impl_{std::make_unique<DiagnosticMessageHandlerImpl>(tcp_socket_handler, channel)} {}
+                                                   DoipTcpChannel &channel, core_type::Clock &clock)
+    : handler_impl_{std::make_unique<DiagnosticMessageHandlerImpl>(tcp_socket_handler, channel, clock)} {}
 
 DiagnosticMessageHandler::~DiagnosticMessageHandler() = default;
 
@@ -386,14 +427,19 @@ void DiagnosticMessageHandler::Stop() { handler_impl_->Stop(); }
 
 void DiagnosticMessageHandler::Reset() { handler_impl_->Reset(); }
 
+void DiagnosticMessageHandler::Abort() { handler_impl_->Abort(); }
+
 auto DiagnosticMessageHandler::ProcessDoIPDiagnosticAckMessageResponse(DoipMessage &doip_payload) noexcept -> void {
   DiagnosticMessageState final_state{DiagnosticMessageState::kDiagnosticNegativeAckRecvd};
   if (handler_impl_->GetStateContext().GetActiveState().GetState() == DiagnosticMessageState::kWaitForDiagnosticAck) {
     // get the ack code
     DiagAckType const diag_ack_type{doip_payload.GetPayload()[0u]};
+    utility::trace::TraceInstant("doip", "DiagnosticAck", diag_ack_type.ack_type_);
     if (doip_payload.GetPayloadType() == kDoip_DiagMessagePosAck_Type) {
       if (diag_ack_type.ack_type_ == kDoip_DiagnosticMessage_PosAckCode_Confirm) {
-        final_state = DiagnosticMessageState::kDiagnosticPositiveAckRecvd;
+        // wait for the response right away, it may follow the acknowledgement before the requester is woken up
+        final_state = DiagnosticMessageState::kWaitForDiagnosticResponse;
+        handler_impl_->SetPositiveAckReceived(true);
         logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
             __FILE__, __LINE__, __func__, [&doip_payload](std::stringstream &msg) {
               msg << "Diagnostic message positively acknowledged from remote server "
@@ -419,6 +465,8 @@ auto DiagnosticMessageHandler::ProcessDoIPDiagnosticAckMessageResponse(DoipMessa
 auto DiagnosticMessageHandler::ProcessDoIPDiagnosticMessageResponse(DoipMessage &doip_payload) noexcept -> void {
   if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
       DiagnosticMessageState::kWaitForDiagnosticResponse) {
+    utility::trace::TraceScope const trace_scope{"doip", "ProcessDiagnosticResponse",
+                                                 doip_payload.GetPayload().size()};
     // Indicate upper layer about incoming data
     std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr> ret_val{
         handler_impl_->GetDoipChannel().IndicateMessage(
@@ -432,20 +480,22 @@ auto DiagnosticMessageHandler::ProcessDoIPDiagnosticMessageResponse(DoipMessage
       if ((ret_val.first == uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk) &&
           (ret_val.second != nullptr)) {
         // copy to application buffer
+        utility::trace::TraceScope const copy_trace_scope{"doip", "CopyResponse", doip_payload.GetPayload().size()};
         (void) std::copy(doip_payload.GetPayload().begin(), doip_payload.GetPayload().end(),
                          ret_val.second->GetPayload().begin());
         handler_impl_->GetDoipChannel().HandleMessage(std::move(ret_val.second));
       } else {
-        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
-            __FILE__, __LINE__, __func__,
-            [](std::stringstream &msg) { msg << "Diagnostic message response ignored due to unknown error"; });
+        static utility::logger::LogRateLimiter rate_limiter{kIgnoredResponseLogBurst, kIgnoredResponseLogInterval};
+        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogRateLimited<utility::logger::LogLevel::kVerbose>(
+            rate_limiter, __FILE__, __LINE__, __func__, "Diagnostic message response ignored due to unknown error");
       }
       handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kIdle);
     }
   } else {
     // ignore
-    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
-        __FILE__, __LINE__, __func__, [this](std::stringstream &msg) {
+    static utility::logger::LogRateLimiter rate_limiter{kIgnoredResponseLogBurst, kIgnoredResponseLogInterval};
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogRateLimited<utility::logger::LogLevel::kVerbose>(
+        rate_limiter, __FILE__, __LINE__, __func__, [this](std::stringstream &msg) {
           msg << "Diagnostic message response ignored due to channel in state: "
               << static_cast<int>(handler_impl_->GetStateContext().GetActiveState().GetState());
         });
@@ -457,9 +507,14 @@ auto DiagnosticMessageHandler::HandleDiagnosticRequest(uds_transport::UdsMessage
   uds_transport::UdsTransportProtocolMgr::TransmissionResult result{
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
   if (handler_impl_->GetStateContext().GetActiveState().GetState() == DiagnosticMessageState::kIdle) {
+    // change state and arm the timer before sending, the acknowledgement may be received before the transmission
+    // returns
+    handler_impl_->SetPositiveAckReceived(false);
+    handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kWaitForDiagnosticAck);
+    handler_impl_->GetSyncTimer().Arm();
     if (SendDiagnosticRequest(std::move(diagnostic_request)) ==
         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
-      handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kWaitForDiagnosticAck);
+      utility::trace::TraceScope const trace_scope{"doip", "WaitForDiagnosticAck"};
       handler_impl_->GetSyncTimer().WaitForTimeout(
           [this, &result]() {
             result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNoTransmitAckReceived;
@@ -471,10 +526,8 @@ auto DiagnosticMessageHandler::HandleDiagnosticRequest(uds_transport::UdsMessage
                 });
           },
           [this, &result]() {
-            if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-                DiagnosticMessageState::kDiagnosticPositiveAckRecvd) {
-              handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kWaitForDiagnosticResponse);
-              // success
+            if (handler_impl_->IsPositiveAckReceived()) {
+              // success, already waiting for the response
               result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
               logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
                   __FILE__, __LINE__, "",
@@ -500,8 +553,7 @@ auto DiagnosticMessageHandler::HandleDiagnosticRequest(uds_transport::UdsMessage
     // channel not in idle state
     result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kBusyProcessing;
     logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
-        __FILE__, __LINE__, "",
-        [](std::stringstream &msg) { msg << "Diagnostic Message Transmission already in progress"; });
+        __FILE__, __LINE__, __func__, "Diagnostic Message Transmission already in progress");
   }
   return result;
 }
@@ -512,6 +564,7 @@ auto DiagnosticMessageHandler::SendDiagnosticRequest(uds_transport::UdsMessageCo
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
   constexpr std::uint8_t kDoipheadrSize{8u};
   constexpr std::uint8_t kSourceAddressSize{4u};
+  utility::trace::TraceScope const trace_scope{"doip", "SendDiagnosticMessage", diagnostic_request->GetPayload().size()};
   TcpMessagePtr doip_diag_req = std::make_unique<TcpMessage>();
   // reserve bytes in vector
   doip_diag_req->GetTxBuffer().reserve(kDoipheadrSize + kDoip_DiagMessage_ReqResMinLen +
@@ -521,11 +574,9 @@ auto DiagnosticMessageHandler::SendDiagnosticRequest(uds_transport::UdsMessageCo
       doip_diag_req->GetTxBuffer(), kDoip_DiagMessage_Type,
       kDoip_DiagMessage_ReqResMinLen + static_cast<std::uint32_t>(diagnostic_request->GetPayload().size()));
   // Add source address
-  doip_diag_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>((diagnostic_request->GetSa() & 0xFF00) >> 8u));
-  doip_diag_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(diagnostic_request->GetSa() & 0x00FF));
+  core_type::AppendBigEndian(doip_diag_req->GetTxBuffer(), diagnostic_request->GetSa());
   // Add target address
-  doip_diag_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>((diagnostic_request->GetSa() & 0xFF00) >> 8u));
-  doip_diag_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(diagnostic_request->GetSa() & 0x00FF));
+  core_type::AppendBigEndian(doip_diag_req->GetTxBuffer(), diagnostic_request->GetTa());
   // Copy data bytes
   doip_diag_req->GetTxBuffer().insert(doip_diag_req->GetTxBuffer().begin() + kDoipheadrSize + kSourceAddressSize,
                                       diagnostic_request->GetPayload().begin(), diagnostic_request->GetPayload().end());
@@ -537,16 +588,12 @@ auto DiagnosticMessageHandler::SendDiagnosticRequest(uds_transport::UdsMessageCo
   return ret_val;
 }
 
-void DiagnosticMessageHandler::CreateDoipGenericHeader(std::vector<std::uint8_t> &doip_header_buffer,
+void DiagnosticMessageHandler::CreateDoipGenericHeader(TcpMessage::BufferType &doip_header_buffer,
                                                        std::uint16_t payload_type, std::uint32_t payload_len) {
   doip_header_buffer.emplace_back(kDoip_ProtocolVersion);
   doip_header_buffer.emplace_back(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion)));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_type & 0xFF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_type & 0x00FF));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0xFF000000) >> 24));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x00FF0000) >> 16));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x0000FF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_len & 0x000000FF));
+  core_type::AppendBigEndian(doip_header_buffer, payload_type);
+  core_type::AppendBigEndian(doip_header_buffer, payload_len);
 }
 
 }  // namespace tcp_channel
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "common/doip_message.h"
+#include "core/include/clock.h"
 #include "sockets/tcp_socket_handler.h"
 #include "uds_transport/protocol_mgr.h"
 #include "uds_transport/uds_message.h"
@@ -45,8 +46,11 @@ class DiagnosticMessageHandler final {
    *                The reference to socket handler
    * @param[in]     channel
    *                The reference to doip channel
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  DiagnosticMessageHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel);
+  DiagnosticMessageHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel,
+                           core_type::Clock &clock);
 
   /**
    * @brief         Destruct an instance of DiagnosticMessageHandler
@@ -70,6 +74,12 @@ class DiagnosticMessageHandler final {
    */
   void Reset();
 
+  /**
+   * @brief        Function to abort the handler on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  void Abort();
+
   /**
    * @brief       Function to process received diagnostic acknowledgement from server
    * @param[in]   doip_payload
@@ -112,7 +122,7 @@ class DiagnosticMessageHandler final {
    * @param[in]        payload_len
    *                   The length of payload
    */
-  static void CreateDoipGenericHeader(std::vector<std::uint8_t> &doip_header, std::uint16_t payload_type,
+  static void CreateDoipGenericHeader(TcpMessage::BufferType &doip_header, std::uint16_t payload_type,
                                       std::uint32_t payload_len);
 
  private:
@@ -13,6 +13,7 @@
 #include "channel/tcp_channel/doip_tcp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
+#include "core/include/endian_codec.h"
 #include "utility/state.h"
 #include "utility/sync_timer.h"
 
@@ -222,17 +223,19 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
   /**
    * @brief  Type alias for Sync timer
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using SyncTimer = utility::sync_timer::SyncTimer;
 
   /**
    * @brief         Constructs an instance of RoutingActivationHandlerImpl
    * @param[in]     tcp_socket_handler
    *                The reference to socket handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  explicit RoutingActivationHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler)
+  RoutingActivationHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler, core_type::Clock &clock)
       : tcp_socket_handler_{tcp_socket_handler},
         state_context_{},
-        sync_timer_{} {
+        sync_timer_{clock} {
     // create and add state for routing activation
     // kIdle
     state_context_.AddState(RoutingActivationState::kIdle, std::make_unique<kIdle>(RoutingActivationState::kIdle));
@@ -272,6 +275,12 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
    */
   void Reset() { Stop(); }
 
+  /**
+   * @brief        Function to abort the handler on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  void Abort() { sync_timer_.Shutdown(); }
+
   /**
    * @brief       Function to get the Routing Activation State context
    * @return      The reference to state context
@@ -307,8 +316,9 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
   SyncTimer sync_timer_;
 };
 
-RoutingActivationHandler::RoutingActivationHandler(sockets::TcpSocketHandler &tcp_socket_handler)
-    : handler_impl_{std::make_unique<RoutingActivationHandlerImpl>(tcp_socket_handler)} {}
+RoutingActivationHandler::RoutingActivationHandler(sockets::TcpSocketHandler &tcp_socket_handler,
+                                                   core_type::Clock &clock)
+    : handler_impl_{std::make_unique<RoutingActivationHandlerImpl>(tcp_socket_handler, clock)} {}
 
 RoutingActivationHandler::~RoutingActivationHandler() = default;
 
@@ -318,6 +328,8 @@ void RoutingActivationHandler::Stop() { handler_impl_->Stop(); }
 
 void RoutingActivationHandler::Reset() { handler_impl_->Reset(); }
 
+void RoutingActivationHandler::Abort() { handler_impl_->Abort(); }
+
 auto RoutingActivationHandler::ProcessDoIPRoutingActivationResponse(DoipMessage &doip_payload) noexcept -> void {
   RoutingActivationState final_state{RoutingActivationState::kRoutingActivationFailed};
   if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
@@ -362,10 +374,12 @@ auto RoutingActivationHandler::HandleRoutingActivationRequest(
   uds_transport::UdsTransportProtocolMgr::ConnectionResult result{
       uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionFailed};
   if (handler_impl_->GetStateContext().GetActiveState().GetState() == RoutingActivationState::kIdle) {
+    // change state and arm the timer before sending, the response may be received before the transmission returns
+    handler_impl_->GetStateContext().TransitionTo(RoutingActivationState::kWaitForRoutingActivationRes);
+    handler_impl_->GetSyncTimer().Arm();
     if (SendRoutingActivationRequest(std::move(routing_activation_request)) ==
         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
       // Wait for routing activation response
-      handler_impl_->GetStateContext().TransitionTo(RoutingActivationState::kWaitForRoutingActivationRes);
       handler_impl_->GetSyncTimer().WaitForTimeout(
           [this, &result]() {
             result = uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionTimeout;
@@ -423,8 +437,7 @@ auto RoutingActivationHandler::SendRoutingActivationRequest(uds_transport::UdsMe
   CreateDoipGenericHeader(doip_routing_act_req->GetTxBuffer(), kDoip_RoutingActivation_ReqType,
                           kDoip_RoutingActivation_ReqMinLen);
   // Add source address
-  doip_routing_act_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>((message->GetSa() & 0xFF00) >> 8u));
-  doip_routing_act_req->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(message->GetSa() & 0x00FF));
+  core_type::AppendBigEndian(doip_routing_act_req->GetTxBuffer(), message->GetSa());
   // Add activation type
   doip_routing_act_req->GetTxBuffer().emplace_back(kDoip_RoutingActivation_ReqActType_Default);
   // Add reservation byte , default zeroes
@@ -440,16 +453,12 @@ auto RoutingActivationHandler::SendRoutingActivationRequest(uds_transport::UdsMe
   return ret_val;
 }
 
-void RoutingActivationHandler::CreateDoipGenericHeader(std::vector<std::uint8_t> &doip_header_buffer,
+void RoutingActivationHandler::CreateDoipGenericHeader(TcpMessage::BufferType &doip_header_buffer,
                                                        std::uint16_t payload_type, std::uint32_t payload_len) {
   doip_header_buffer.emplace_back(kDoip_ProtocolVersion);
   doip_header_buffer.emplace_back(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion)));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_type & 0xFF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_type & 0x00FF));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0xFF000000) >> 24));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x00FF0000) >> 16));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x0000FF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_len & 0x000000FF));
+  core_type::AppendBigEndian(doip_header_buffer, payload_type);
+  core_type::AppendBigEndian(doip_header_buffer, payload_len);
 }
 
 }  // namespace tcp_channel
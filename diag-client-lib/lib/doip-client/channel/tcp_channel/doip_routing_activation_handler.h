@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "common/doip_message.h"
+#include "core/include/clock.h"
 #include "sockets/tcp_socket_handler.h"
 #include "uds_transport/protocol_mgr.h"
 #include "uds_transport/uds_message.h"
@@ -43,8 +44,10 @@ class RoutingActivationHandler final {
    * @brief         Constructs an instance of RoutingActivationHandler
    * @param[in]     tcp_socket_handler
    *                The reference to socket handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  explicit RoutingActivationHandler(sockets::TcpSocketHandler &tcp_socket_handler);
+  RoutingActivationHandler(sockets::TcpSocketHandler &tcp_socket_handler, core_type::Clock &clock);
 
   /**
    * @brief         Destruct an instance of RoutingActivationHandler
@@ -68,6 +71,12 @@ class RoutingActivationHandler final {
    */
   void Reset();
 
+  /**
+   * @brief        Function to abort the handler on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  void Abort();
+
   /**
    * @brief       Function to process received routing activation response
    * @param[in]   doip_payload
@@ -109,7 +118,7 @@ class RoutingActivationHandler final {
    * @param[in]        payload_len
    *                   The length of payload
    */
-  static void CreateDoipGenericHeader(std::vector<std::uint8_t> &doip_header, std::uint16_t payload_type,
+  static void CreateDoipGenericHeader(TcpMessage::BufferType &doip_header, std::uint16_t payload_type,
                                       std::uint32_t payload_len);
 
  private:
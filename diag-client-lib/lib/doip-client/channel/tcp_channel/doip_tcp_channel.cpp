@@ -12,14 +12,16 @@
 
 #include "common/logger.h"
 #include "sockets/tcp_socket_handler.h"
+#include "utility/allocation_counter.h"
 
 namespace doip_client {
 namespace channel {
 namespace tcp_channel {
 
-DoipTcpChannel::DoipTcpChannel(std::string_view tcp_ip_address, std::uint16_t, uds_transport::Connection &connection)
-    : tcp_socket_handler_{tcp_ip_address, *this},
-      tcp_channel_handler_{tcp_socket_handler_, *this},
+DoipTcpChannel::DoipTcpChannel(std::string_view tcp_ip_address, std::uint16_t, uds_transport::Connection &connection,
+                               core_type::Clock &clock, boost_support::socket::IoContext &io_context)
+    : tcp_socket_handler_{tcp_ip_address, *this, io_context},
+      tcp_channel_handler_{tcp_socket_handler_, *this, clock},
       connection_{connection} {}
 
 void DoipTcpChannel::Start() {
@@ -32,6 +34,8 @@ void DoipTcpChannel::Stop() {
   tcp_channel_handler_.Stop();
 }
 
+void DoipTcpChannel::Abort() { tcp_channel_handler_.Abort(); }
+
 bool DoipTcpChannel::IsConnectToHost() {
   return (tcp_socket_handler_.GetSocketHandlerState() == TcpSocketHandler::SocketHandlerState::kSocketConnected);
 }
@@ -71,11 +75,13 @@ uds_transport::UdsTransportProtocolMgr::DisconnectionResult DoipTcpChannel::Disc
 }
 
 void DoipTcpChannel::ProcessReceivedTcpMessage(TcpMessagePtr tcp_rx_message) {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDoipClient};
   tcp_channel_handler_.HandleMessage(std::move(tcp_rx_message));
 }
 
 uds_transport::UdsTransportProtocolMgr::TransmissionResult DoipTcpChannel::Transmit(
     uds_transport::UdsMessageConstPtr message) {
+  utility::allocation::LayerScope const layer_scope{utility::allocation::Layer::kDoipClient};
   uds_transport::UdsTransportProtocolMgr::TransmissionResult ret_val{
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
   // Routing activation should be active before sending diag request
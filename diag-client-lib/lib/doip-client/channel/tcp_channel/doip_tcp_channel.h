@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "channel/tcp_channel/doip_tcp_channel_handler.h"
+#include "core/include/clock.h"
 #include "sockets/tcp_socket_handler.h"
 #include "uds_transport/connection.h"
 
@@ -38,8 +39,13 @@ class DoipTcpChannel final {
    *                The reference to tcp transport handler
    * @param[in]     connection
    *                The reference to tcp transport handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @param[in]     io_context
+   *                The event loop receiving messages of the channel
    */
-  DoipTcpChannel(std::string_view tcp_ip_address, std::uint16_t port_num, uds_transport::Connection &connection);
+  DoipTcpChannel(std::string_view tcp_ip_address, std::uint16_t port_num, uds_transport::Connection &connection,
+                 core_type::Clock &clock, boost_support::socket::IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of TcpChannel
@@ -56,6 +62,12 @@ class DoipTcpChannel final {
    */
   void Stop();
 
+  /**
+   * @brief        Function to abort the channel on shutdown
+   * @details      The running and every further wait for a response ends immediately, the socket stays open
+   */
+  void Abort();
+
   /**
    * @brief        Function to check if connected to host remote server
    * @return       True if connection, False otherwise
@@ -63,9 +63,10 @@ constexpr std::uint32_t kDoip_RoutingActivation_ResMaxLen{13u};  //with OEM spec
 
 }  // namespace
 
-DoipTcpChannelHandler::DoipTcpChannelHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel)
-    : routing_activation_handler_{tcp_socket_handler},
-      diagnostic_message_handler_{tcp_socket_handler, channel} {}
+DoipTcpChannelHandler::DoipTcpChannelHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel,
+                                             core_type::Clock &clock)
+    : routing_activation_handler_{tcp_socket_handler, clock},
+      diagnostic_message_handler_{tcp_socket_handler, channel, clock} {}
 
 void DoipTcpChannelHandler::Start() {
   routing_activation_handler_.Start();
@@ -82,6 +83,11 @@ void DoipTcpChannelHandler::Reset() {
   diagnostic_message_handler_.Reset();
 }
 
+void DoipTcpChannelHandler::Abort() {
+  routing_activation_handler_.Abort();
+  diagnostic_message_handler_.Abort();
+}
+
 auto DoipTcpChannelHandler::SendRoutingActivationRequest(
     uds_transport::UdsMessageConstPtr routing_activation_request) noexcept
     -> uds_transport::UdsTransportProtocolMgr::ConnectionResult {
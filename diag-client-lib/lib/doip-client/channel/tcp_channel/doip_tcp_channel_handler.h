@@ -11,6 +11,7 @@
 #include "channel/tcp_channel/doip_diagnostic_message_handler.h"
 #include "channel/tcp_channel/doip_routing_activation_handler.h"
 #include "common/doip_message.h"
+#include "core/include/clock.h"
 #include "sockets/tcp_socket_handler.h"
 #include "uds_transport/protocol_mgr.h"
 #include "uds_transport/uds_message.h"
@@ -38,8 +39,11 @@ class DoipTcpChannelHandler final {
    *                The reference to socket handler
    * @param[in]     channel
    *                The reference to tcp transport handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  DoipTcpChannelHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel);
+  DoipTcpChannelHandler(sockets::TcpSocketHandler &tcp_socket_handler, DoipTcpChannel &channel,
+                        core_type::Clock &clock);
 
   /**
    * @brief        Function to start the handler
@@ -58,6 +62,12 @@ class DoipTcpChannelHandler final {
    */
   void Reset();
 
+  /**
+   * @brief        Function to abort the handler on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  void Abort();
+
   /**
    * @brief         Function to send routing activation request
    * @param[in]     routing_activation_request
@@ -13,10 +13,13 @@ namespace channel {
 namespace udp_channel {
 
 udp_channel::DoipUdpChannel::DoipUdpChannel(std::string_view udp_ip_address, std::uint16_t port_num,
-                                            uds_transport::Connection &connection)
-    : udp_socket_handler_broadcast_{udp_ip_address, port_num, UdpSocketHandler::PortType::kUdp_Broadcast, *this},
-      udp_socket_handler_unicast_{udp_ip_address, port_num, UdpSocketHandler::PortType::kUdp_Unicast, *this},
-      udp_channel_handler_{udp_socket_handler_broadcast_, udp_socket_handler_unicast_, *this},
+                                            uds_transport::Connection &connection, core_type::Clock &clock,
+                                            boost_support::socket::IoContext &io_context)
+    : udp_socket_handler_broadcast_{udp_ip_address, port_num, UdpSocketHandler::PortType::kUdp_Broadcast, *this,
+                                    io_context},
+      udp_socket_handler_unicast_{udp_ip_address, port_num, UdpSocketHandler::PortType::kUdp_Unicast, *this,
+                                  io_context},
+      udp_channel_handler_{udp_socket_handler_broadcast_, udp_socket_handler_unicast_, *this, clock},
       connection_{connection} {}
 
 void DoipUdpChannel::Start() {
@@ -29,6 +32,8 @@ void DoipUdpChannel::Stop() {
   udp_socket_handler_unicast_.Stop();
 }
 
+void DoipUdpChannel::Abort() { udp_channel_handler_.Abort(); }
+
 void DoipUdpChannel::ProcessReceivedUdpBroadcast(DoipUdpChannel::UdpMessagePtr udp_rx_message) {
   udp_channel_handler_.HandleMessageBroadcast(std::move(udp_rx_message));
 }
@@ -39,6 +44,8 @@ void DoipUdpChannel::ProcessReceivedUdpUnicast(DoipUdpChannel::UdpMessagePtr udp
 
 uds_transport::UdsTransportProtocolMgr::TransmissionResult DoipUdpChannel::Transmit(
     uds_transport::UdsMessageConstPtr message) {
+  // listen to vehicle announcements while vehicles are identified, the unicast socket opens on transmission
+  static_cast<void>(udp_socket_handler_broadcast_.Open());
   return udp_channel_handler_.SendVehicleIdentificationRequest(std::move(message));
 }
 
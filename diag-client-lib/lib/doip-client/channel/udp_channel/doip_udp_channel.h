@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "channel/udp_channel/doip_udp_channel_handler.h"
+#include "core/include/clock.h"
 #include "sockets/udp_socket_handler.h"
 #include "uds_transport/connection.h"
 
@@ -38,8 +39,13 @@ class DoipUdpChannel final {
    *                The reference to tcp transport handler
    * @param[in]     connection
    *                The reference to tcp transport handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @param[in]     io_context
+   *                The event loop receiving messages of the channel
    */
-  DoipUdpChannel(std::string_view udp_ip_address, std::uint16_t port_num, uds_transport::Connection &connection);
+  DoipUdpChannel(std::string_view udp_ip_address, std::uint16_t port_num, uds_transport::Connection &connection,
+                 core_type::Clock &clock, boost_support::socket::IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of UdpChannel
@@ -56,6 +62,12 @@ class DoipUdpChannel final {
    */
   void Stop();
 
+  /**
+   * @brief        Function to abort the channel on shutdown
+   * @details      The running and every further wait for a response ends immediately, the socket stays open
+   */
+  void Abort();
+
   /**
    * @brief       Function to indicate a start of reception of message
    * @details     This is called to indicate the reception of new message by underlying transport protocol handler
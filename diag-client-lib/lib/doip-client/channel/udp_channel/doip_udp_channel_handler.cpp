@@ -29,9 +29,11 @@ constexpr std::uint8_t kDoip_GenericHeader_InvalidPayloadLen{0x04};
 
 DoipUdpChannelHandler::DoipUdpChannelHandler(sockets::UdpSocketHandler &udp_socket_handler_broadcast,
                                              sockets::UdpSocketHandler &udp_socket_handler_unicast,
-                                             DoipUdpChannel &channel)
+                                             DoipUdpChannel &channel, core_type::Clock &clock)
     : vehicle_discovery_handler_{udp_socket_handler_broadcast, channel},
-      vehicle_identification_handler_{udp_socket_handler_unicast, channel} {}
+      vehicle_identification_handler_{udp_socket_handler_unicast, channel, clock} {}
+
+void DoipUdpChannelHandler::Abort() noexcept { vehicle_identification_handler_.Abort(); }
 
 auto DoipUdpChannelHandler::SendVehicleIdentificationRequest(
     uds_transport::UdsMessageConstPtr vehicle_identification_request) noexcept
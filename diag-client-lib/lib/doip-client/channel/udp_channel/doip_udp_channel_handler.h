@@ -40,9 +40,12 @@ class DoipUdpChannelHandler final {
    *                The reference to socket handler with unicast mechanism
    * @param[in]     channel
    *                The reference to tcp transport handler
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
   DoipUdpChannelHandler(sockets::UdpSocketHandler &udp_socket_handler_broadcast,
-                        sockets::UdpSocketHandler &udp_socket_handler_unicast, DoipUdpChannel &channel);
+                        sockets::UdpSocketHandler &udp_socket_handler_unicast, DoipUdpChannel &channel,
+                        core_type::Clock &clock);
 
   /**
    * @brief         Function to vehicle identification request to the connected network
@@ -68,6 +71,12 @@ class DoipUdpChannelHandler final {
    */
   void HandleMessageBroadcast(UdpMessagePtr udp_rx_message) noexcept;
 
+  /**
+   * @brief         Function to abort the handler on shutdown
+   * @details       The running and every further wait for vehicle identification responses ends immediately
+   */
+  void Abort() noexcept;
+
  private:
   /**
    * @brief         Function to process doip header in received response
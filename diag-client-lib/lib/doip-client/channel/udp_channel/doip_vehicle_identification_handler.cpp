@@ -11,6 +11,7 @@
 #include "channel/udp_channel/doip_udp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
+#include "core/include/endian_codec.h"
 #include "utility/state.h"
 #include "utility/sync_timer.h"
 
@@ -134,12 +135,8 @@ void CreateDoipGenericHeader(std::vector<std::uint8_t> &doip_header_buffer, std:
                              std::uint32_t payload_len) {
   doip_header_buffer.emplace_back(kDoip_ProtocolVersion);
   doip_header_buffer.emplace_back(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion)));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_type & 0xFF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_type & 0x00FF));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0xFF000000) >> 24));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x00FF0000) >> 16));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x0000FF00) >> 8));
-  doip_header_buffer.emplace_back(static_cast<std::uint8_t>(payload_len & 0x000000FF));
+  core_type::AppendBigEndian(doip_header_buffer, payload_type);
+  core_type::AppendBigEndian(doip_header_buffer, payload_len);
 }
 
 /**
@@ -185,17 +182,23 @@ class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
   /**
    * @brief  Type alias for Sync timer
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using SyncTimer = utility::sync_timer::SyncTimer;
 
   /**
    * @brief         Constructs an instance of VehicleDiscoveryHandlerImpl
    * @param[in]     udp_socket_handler
    *                The reference to socket handler
+   * @param[in]     channel
+   *                The reference to doip udp channel
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  explicit VehicleIdentificationHandlerImpl(sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &channel)
+  VehicleIdentificationHandlerImpl(sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &channel,
+                                   core_type::Clock &clock)
       : udp_socket_handler_{udp_socket_handler},
         channel_{channel},
-        state_context_{} {
+        state_context_{},
+        sync_timer_{clock} {
     // create and add state for vehicle identification
     // kIdle
     state_context_.AddState(VehicleIdentificationState::kIdle,
@@ -262,11 +265,13 @@ class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
 };
 
 VehicleIdentificationHandler::VehicleIdentificationHandler(sockets::UdpSocketHandler &udp_socket_handler,
-                                                           DoipUdpChannel &channel)
-    : handler_impl_{std::make_unique<VehicleIdentificationHandlerImpl>(udp_socket_handler, channel)} {}
+                                                           DoipUdpChannel &channel, core_type::Clock &clock)
+    : handler_impl_{std::make_unique<VehicleIdentificationHandlerImpl>(udp_socket_handler, channel, clock)} {}
 
 VehicleIdentificationHandler::~VehicleIdentificationHandler() = default;
 
+void VehicleIdentificationHandler::Abort() noexcept { handler_impl_->GetSyncTimer().Shutdown(); }
+
 auto VehicleIdentificationHandler::HandleVehicleIdentificationRequest(
     uds_transport::UdsMessageConstPtr vehicle_identification_request) noexcept
     -> uds_transport::UdsTransportProtocolMgr::TransmissionResult {
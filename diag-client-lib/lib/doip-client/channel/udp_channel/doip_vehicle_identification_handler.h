@@ -9,6 +9,7 @@
 #define DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_UDP_CHANNEL_DOIP_VEHICLE_IDENTIFICATION_HANDLER_H_
 
 #include "common/doip_message.h"
+#include "core/include/clock.h"
 #include "sockets/udp_socket_handler.h"
 #include "uds_transport/protocol_mgr.h"
 #include "uds_transport/uds_message.h"
@@ -42,8 +43,11 @@ class VehicleIdentificationHandler final {
    *                The reference to socket handler
    * @param[in]     channel
    *                The reference to doip udp channel
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
    */
-  VehicleIdentificationHandler(sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &channel);
+  VehicleIdentificationHandler(sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &channel,
+                               core_type::Clock &clock);
 
   /**
    * @brief         Destruct an instance of VehicleIdentificationHandler
@@ -66,6 +70,12 @@ class VehicleIdentificationHandler final {
    */
   void ProcessVehicleIdentificationResponse(DoipMessage &doip_payload) noexcept;
 
+  /**
+   * @brief       Function to abort the handler on shutdown
+   * @details     The running and every further wait for vehicle identification responses ends immediately
+   */
+  void Abort() noexcept;
+
  private:
   /**
    * @brief       Function to send vehicle identification request
@@ -7,26 +7,26 @@
 */
 #include "common/doip_message.h"
 
+#include "core/include/endian_codec.h"
+
 namespace doip_client {
 namespace {
 
 auto GetDoIPPayloadType(core_type::Span<std::uint8_t> payload) noexcept -> std::uint16_t {
-  return (static_cast<std::uint16_t>(((payload[2u] & 0xFF) << 8) | (payload[3u] & 0xFF)));
+  return core_type::ReadBigEndian<std::uint16_t>(payload, 2u).value_or(0u);
 }
 
 auto GetDoIPPayloadLength(core_type::Span<std::uint8_t> payload) noexcept -> std::uint32_t {
-  return ((static_cast<std::uint32_t>(payload[4u] << 24) & 0xFF000000) |
-          (static_cast<std::uint32_t>(payload[5u] << 16) & 0x00FF0000) |
-          (static_cast<std::uint32_t>(payload[6u] << 8) & 0x0000FF00) |
-          (static_cast<std::uint32_t>(payload[7u] & 0x000000FF)));
+  return core_type::ReadBigEndian<std::uint32_t>(payload, 4u).value_or(0u);
 }
 
+// addresses follow the generic header
 auto GetServerAddr(core_type::Span<std::uint8_t> payload) noexcept -> std::uint16_t {
-  return (static_cast<std::uint16_t>(((payload[0u] & 0xFF) << 8) | (payload[1u] & 0xFF)));
+  return core_type::ReadBigEndian<std::uint16_t>(payload, 8u).value_or(0u);
 }
 
 auto GetClientAddr(core_type::Span<std::uint8_t> payload) noexcept -> std::uint16_t {
-  return (static_cast<std::uint16_t>(((payload[2u] & 0xFF) << 8) | (payload[3u] & 0xFF)));
+  return core_type::ReadBigEndian<std::uint16_t>(payload, 10u).value_or(0u);
 }
 
 }  // namespace
@@ -33,11 +33,15 @@ class DoipTcpConnection final : public uds_transport::Connection {
    *              The local tcp ip address
    * @param[in]   port_num
    *              The local port number
+   * @param[in]   clock
+   *              The clock used for timeout monitoring
+   * @param[in]   io_context
+   *              The event loop receiving messages of the connection
    */
   DoipTcpConnection(uds_transport::ConversionHandler const &conversation_handler, std::string_view tcp_ip_address,
-                    std::uint16_t port_num)
+                    std::uint16_t port_num, core_type::Clock &clock, boost_support::socket::IoContext &io_context)
       : uds_transport::Connection{1, conversation_handler},
-        doip_tcp_channel_{tcp_ip_address, port_num, *this} {}
+        doip_tcp_channel_{tcp_ip_address, port_num, *this, clock, io_context} {}
 
   /**
    * @brief         Destruct an instance of DoipTcpConnection
@@ -60,6 +64,11 @@ class DoipTcpConnection final : public uds_transport::Connection {
    */
   void Stop() override { doip_tcp_channel_.Stop(); }
 
+  /**
+   * @brief        Function to abort the connection on shutdown
+   */
+  void Abort() override { doip_tcp_channel_.Abort(); }
+
   /**
    * @brief        Function to check if connected to host remote server
    * @return       True if connection, False otherwise
@@ -166,11 +175,15 @@ class DoipUdpConnection final : public uds_transport::Connection {
    *              The local tcp ip address
    * @param[in]   port_num
    *              The local port number
+   * @param[in]   clock
+   *              The clock used for timeout monitoring
+   * @param[in]   io_context
+   *              The event loop receiving messages of the connection
    */
   DoipUdpConnection(uds_transport::ConversionHandler const &conversation_handler, std::string_view udp_ip_address,
-                    std::uint16_t port_num)
+                    std::uint16_t port_num, core_type::Clock &clock, boost_support::socket::IoContext &io_context)
       : uds_transport::Connection(1, conversation_handler),
-        doip_udp_channel_{udp_ip_address, port_num, *this} {}
+        doip_udp_channel_{udp_ip_address, port_num, *this, clock, io_context} {}
 
   /**
    * @brief         Destruct an instance of DoipUdpConnection
@@ -193,6 +206,11 @@ class DoipUdpConnection final : public uds_transport::Connection {
    */
   void Stop() override { doip_udp_channel_.Stop(); }
 
+  /**
+   * @brief        Function to abort the connection on shutdown
+   */
+  void Abort() override { doip_udp_channel_.Abort(); }
+
   /**
    * @brief        Function to check if connected to host remote server
    * @return       True if connection, False otherwise
@@ -282,12 +300,12 @@ class DoipUdpConnection final : public uds_transport::Connection {
 
 std::unique_ptr<uds_transport::Connection> DoipConnectionManager::FindOrCreateTcpConnection(
     uds_transport::ConversionHandler const &conversation, std::string_view tcp_ip_address, std::uint16_t port_num) {
-  return (std::make_unique<DoipTcpConnection>(conversation, tcp_ip_address, port_num));
+  return (std::make_unique<DoipTcpConnection>(conversation, tcp_ip_address, port_num, clock_, io_context_));
 }
 
 std::unique_ptr<uds_transport::Connection> DoipConnectionManager::FindOrCreateUdpConnection(
     uds_transport::ConversionHandler const &conversation, std::string_view udp_ip_address, std::uint16_t port_num) {
-  return (std::make_unique<DoipUdpConnection>(conversation, udp_ip_address, port_num));
+  return (std::make_unique<DoipUdpConnection>(conversation, udp_ip_address, port_num, clock_, io_context_));
 }
 }  // namespace connection
 }  // namespace doip_client
@@ -12,6 +12,8 @@
 #include <string_view>
 #include <utility>
 
+#include "core/include/clock.h"
+#include "socket/io_context.h"
 #include "uds_transport/connection.h"
 
 namespace doip_client {
@@ -24,8 +26,14 @@ class DoipConnectionManager final {
  public:
   /**
    * @brief         Constructs an instance of DoipConnectionManager
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @param[in]     io_context
+   *                The event loop receiving messages of all connections
    */
-  DoipConnectionManager() = default;
+  DoipConnectionManager(core_type::Clock &clock, boost_support::socket::IoContext &io_context) noexcept
+      : clock_{clock},
+        io_context_{io_context} {}
 
   /**
    * @brief         Destruct an instance of DoipConnectionManager
@@ -57,6 +65,17 @@ class DoipConnectionManager final {
    */
   std::unique_ptr<uds_transport::Connection> FindOrCreateUdpConnection(
       uds_transport::ConversionHandler const &conversation, std::string_view udp_ip_address, std::uint16_t port_num);
+
+ private:
+  /**
+   * @brief         Store the clock passed to all connections
+   */
+  core_type::Clock &clock_;
+
+  /**
+   * @brief         Store the event loop passed to all connections
+   */
+  boost_support::socket::IoContext &io_context_;
 };
 }  // namespace connection
 }  // namespace doip_client
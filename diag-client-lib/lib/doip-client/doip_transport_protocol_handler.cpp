@@ -15,9 +15,10 @@ namespace transport_protocol_handler {
 
 DoipTransportProtocolHandler::DoipTransportProtocolHandler(
     UdsTransportProtocolHandlerId const handler_id,
-    uds_transport::UdsTransportProtocolMgr const &transport_protocol_mgr)
+    uds_transport::UdsTransportProtocolMgr const &transport_protocol_mgr, core_type::Clock &clock,
+    boost_support::socket::IoContext &io_context)
     : uds_transport::UdsTransportProtocolHandler(handler_id, transport_protocol_mgr),
-      doip_connection_mgr_{} {}
+      doip_connection_mgr_{clock, io_context} {}
 
 DoipTransportProtocolHandler::~DoipTransportProtocolHandler() = default;
 
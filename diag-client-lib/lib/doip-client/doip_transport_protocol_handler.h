@@ -40,9 +40,14 @@ class DoipTransportProtocolHandler final : public uds_transport::UdsTransportPro
    *                The id of this transport protocol handler
    * @param[in]     transport_protocol_mgr
    *                The reference to transport protocol manager
+   * @param[in]     clock
+   *                The clock used for timeout monitoring
+   * @param[in]     io_context
+   *                The event loop receiving messages of all connections
    */
   DoipTransportProtocolHandler(UdsTransportProtocolHandlerId handler_id,
-                               uds_transport::UdsTransportProtocolMgr const &transport_protocol_mgr);
+                               uds_transport::UdsTransportProtocolMgr const &transport_protocol_mgr,
+                               core_type::Clock &clock, boost_support::socket::IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of DoipTransportProtocolHandler
@@ -18,7 +18,7 @@ namespace {
 /**
  * @brief  Store the unique identifier of this domain
  */
-constexpr core_type::ErrorDomain::IdType unique_identifier{0x5000000000000001};
+constexpr core_type::ErrorDomain::IdType unique_identifier{0x5000000000000002};
 
 /**
  * @brief  Dm error domain
@@ -58,8 +58,8 @@ const char* DoipErrorDomain::Message(core_type::ErrorDomain::CodeType error_code
   return message_.c_str();
 }
 
-core_type::ErrorCode MakeErrorCode(DoipErrorErrc, core_type::ErrorDomain::SupportDataType data) noexcept {
-  return core_type::ErrorCode{data, doip_error_domain};
+core_type::ErrorCode MakeErrorCode(DoipErrorErrc code, core_type::ErrorDomain::SupportDataType data) noexcept {
+  return core_type::ErrorCode{static_cast<core_type::ErrorDomain::CodeType>(code), doip_error_domain, data};
 }
 
 }  // namespace error_domain
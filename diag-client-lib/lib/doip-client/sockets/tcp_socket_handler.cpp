@@ -16,17 +16,19 @@
 namespace doip_client {
 namespace sockets {
 
-TcpSocketHandler::TcpSocketHandler(std::string_view local_ip_address, TcpChannel &channel)
+TcpSocketHandler::TcpSocketHandler(std::string_view local_ip_address, TcpChannel &channel,
+                                   boost_support::socket::IoContext &io_context)
     : local_ip_address_{local_ip_address},
       local_port_num_{0U},  // port number with "0" will create socket with random port number at client side
       tcp_socket_{},
       channel_{channel},
+      io_context_{io_context},
       state_{SocketHandlerState::kSocketOffline} {}
 
 void TcpSocketHandler::Start() {
-  tcp_socket_.emplace(local_ip_address_, local_port_num_, [this](TcpMessagePtr tcp_message) {
-    channel_.ProcessReceivedTcpMessage(std::move(tcp_message));
-  });
+  tcp_socket_.emplace(
+      local_ip_address_, local_port_num_,
+      [this](TcpMessagePtr tcp_message) { channel_.ProcessReceivedTcpMessage(std::move(tcp_message)); }, io_context_);
 }
 
 void TcpSocketHandler::Stop() {
@@ -67,8 +67,11 @@ class TcpSocketHandler final {
    *                The local ip address
    * @param[in]     channel
    *                The reference to tcp transport handler
+   * @param[in]     io_context
+   *                The event loop receiving messages of the socket
    */
-  TcpSocketHandler(std::string_view local_ip_address, TcpChannel &channel);
+  TcpSocketHandler(std::string_view local_ip_address, TcpChannel &channel,
+                   boost_support::socket::IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of TcpSocketHandler
@@ -141,6 +144,11 @@ class TcpSocketHandler final {
    */
   TcpChannel &channel_;
 
+  /**
+   * @brief  Store the reference to event loop
+   */
+  boost_support::socket::IoContext &io_context_;
+
   /**
    * @brief  Store the state of handler
    */
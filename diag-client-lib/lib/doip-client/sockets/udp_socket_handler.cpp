@@ -7,36 +7,64 @@
  */
 #include "sockets/udp_socket_handler.h"
 
+#include <chrono>
+
 #include "channel/udp_channel/doip_udp_channel.h"
 #include "error_domain/doip_error_domain.h"
 
+// Idle time after which udp sockets are released, set by the build
+#ifndef DIAG_CLIENT_SOCKET_IDLE_TIMEOUT_MS
+#define DIAG_CLIENT_SOCKET_IDLE_TIMEOUT_MS 10000U
+#endif
+
 namespace doip_client {
 namespace sockets {
+namespace {
+
+/**
+ * @brief  Idle time after which the socket is released, zero keeps the socket open while started
+ */
+constexpr std::chrono::milliseconds kSocketIdleTimeout{DIAG_CLIENT_SOCKET_IDLE_TIMEOUT_MS};
+
+}  // namespace
+
 UdpSocketHandler::UdpSocketHandler(std::string_view local_ip_address, std::uint16_t port_num, PortType port_type,
-                                   DoipUdpChannel &channel)
+                                   DoipUdpChannel &channel, boost_support::socket::IoContext &io_context)
     : local_ip_address_{local_ip_address},
       local_port_num_{port_num},
       port_type_{port_type},
-      channel_{channel} {
+      channel_{channel},
+      started_{false} {
   // create sockets and start receiving
   if (port_type == UdpSocket::PortType::kUdp_Broadcast) {
     udp_socket_ = std::make_unique<UdpSocket>(
         local_ip_address_, local_port_num_, port_type_,
-        [this](UdpMessagePtr udp_rx_message) { channel_.ProcessReceivedUdpBroadcast(std::move(udp_rx_message)); });
+        [this](UdpMessagePtr udp_rx_message) { channel_.ProcessReceivedUdpBroadcast(std::move(udp_rx_message)); },
+        io_context, kSocketIdleTimeout);
   } else {
     udp_socket_ = std::make_unique<UdpSocket>(
         local_ip_address_, local_port_num_, port_type_,
-        [this](UdpMessagePtr udp_rx_message) { channel_.ProcessReceivedUdpUnicast(std::move(udp_rx_message)); });
+        [this](UdpMessagePtr udp_rx_message) { channel_.ProcessReceivedUdpUnicast(std::move(udp_rx_message)); },
+        io_context, kSocketIdleTimeout);
   }
 }
 
-void UdpSocketHandler::Start() { udp_socket_->Open(); }
+void UdpSocketHandler::Start() { started_.store(true); }
 
-void UdpSocketHandler::Stop() { udp_socket_->Destroy(); }
+void UdpSocketHandler::Stop() {
+  started_.store(false);
+  udp_socket_->Destroy();
+}
+
+core_type::Result<void> UdpSocketHandler::Open() {
+  core_type::Result<void> result{error_domain::MakeErrorCode(error_domain::DoipErrorErrc::kGenericError)};
+  if (started_.load() && udp_socket_->Open().HasValue()) { result.EmplaceValue(); }
+  return result;
+}
 
 core_type::Result<void> UdpSocketHandler::Transmit(UdpMessageConstPtr udp_message) {
   core_type::Result<void> result{error_domain::MakeErrorCode(error_domain::DoipErrorErrc::kGenericError)};
-  if (udp_socket_->Transmit(std::move(udp_message)).HasValue()) { result.EmplaceValue(); }
+  if (Open().HasValue() && udp_socket_->Transmit(std::move(udp_message)).HasValue()) { result.EmplaceValue(); }
   return result;
 }
 }  // namespace sockets
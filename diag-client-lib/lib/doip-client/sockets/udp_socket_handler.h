@@ -8,6 +8,7 @@
 #ifndef DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_SOCKETS_UDP_SOCKET_HANDLER_H_
 #define DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_SOCKETS_UDP_SOCKET_HANDLER_H_
 //includes
+#include <atomic>
 #include <string>
 #include <string_view>
 
@@ -61,9 +62,11 @@ class UdpSocketHandler final {
    *                The local ip address
    * @param[in]     channel
    *                The reference to tcp transport handler
+   * @param[in]     io_context
+   *                The event loop receiving messages of the socket
    */
   UdpSocketHandler(std::string_view local_ip_address, std::uint16_t port_num, PortType port_type,
-                   DoipUdpChannel &channel);
+                   DoipUdpChannel &channel, boost_support::socket::IoContext &io_context);
 
   /**
    * @brief         Destruct an instance of UdpSocketHandler
@@ -71,7 +74,7 @@ class UdpSocketHandler final {
   ~UdpSocketHandler() = default;
 
   /**
-   * @brief        Function to start the socket handler
+   * @brief        Function to start the socket handler, the socket is opened on first use
    */
   void Start();
 
@@ -81,7 +84,14 @@ class UdpSocketHandler final {
   void Stop();
 
   /**
-   * @brief         Function to transmit the provided udp message
+   * @brief         Function to open the socket of the started handler, if not yet open
+   * @details       The socket is released again when idle for the configured socket idle timeout
+   * @return        Empty result on success otherwise error code
+   */
+  core_type::Result<void> Open();
+
+  /**
+   * @brief         Function to open the socket if needed and transmit the provided udp message
    * @param[in]     udp_message
    *                The udp message
    * @return        The
@@ -118,6 +128,11 @@ class UdpSocketHandler final {
    * @brief  Store the reference to tcp channel
    */
   DoipUdpChannel &channel_;
+
+  /**
+   * @brief  Flag telling whether the handler is started
+   */
+  std::atomic_bool started_;
 };
 }  // namespace sockets
 }  // namespace doip_client
@@ -0,0 +1,246 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_CLOCK_H_
+#define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_CLOCK_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace core_type {
+
+/**
+ * @brief       Source of time for all timeouts, waits on the clock end when the time of clock reaches the deadline
+ */
+class Clock {
+ public:
+  /**
+   * @brief  Type alias of duration
+   */
+  using Duration = std::chrono::steady_clock::duration;
+
+  /**
+   * @brief  Type alias of time point
+   */
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  /**
+   * @brief       Interface of objects waiting on the clock, woken up whenever the time of clock jumps
+   */
+  class Waiter {
+   public:
+    /**
+     * @brief       Function to wake up the waiting thread to re-check its deadline
+     * @details     Must lock the mutex passed to WaitUntil() before notifying the conditional variable
+     */
+    virtual void WakeUp() noexcept = 0;
+
+   protected:
+    /**
+     * @brief       Default constructor and destructor, only for use as base class
+     */
+    Waiter() noexcept = default;
+    ~Waiter() noexcept = default;
+  };
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  Clock(const Clock &other) noexcept = delete;
+  Clock &operator=(const Clock &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  Clock(Clock &&other) noexcept = delete;
+  Clock &operator=(Clock &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of Clock
+   */
+  virtual ~Clock() noexcept = default;
+
+  /**
+   * @brief       Function to get the current time
+   * @return      The current time point
+   */
+  virtual auto Now() const noexcept -> TimePoint = 0;
+
+  /**
+   * @brief       Function to block on the conditional variable until notified or the deadline is reached
+   * @details     May return spuriously, the caller must re-check its condition and the deadline
+   * @param[in]   lock
+   *              The locked lock protecting the condition of caller
+   * @param[in]   cond_var
+   *              The conditional variable to block on
+   * @param[in]   deadline
+   *              The time point to wake up at latest
+   */
+  virtual void WaitUntil(std::unique_lock<std::mutex> &lock, std::condition_variable &cond_var,
+                         TimePoint deadline) = 0;
+
+  /**
+   * @brief       Function to register an object waiting on the clock
+   * @param[in]   waiter
+   *              The waiter, must be removed before destruction
+   */
+  virtual void AddWaiter(Waiter &waiter) = 0;
+
+  /**
+   * @brief       Function to remove an object registered by AddWaiter()
+   * @param[in]   waiter
+   *              The waiter
+   */
+  virtual void RemoveWaiter(Waiter &waiter) noexcept = 0;
+
+  /**
+   * @brief       Get the clock following std::chrono::steady_clock, used when no other clock is injected
+   * @return      The steady clock
+   */
+  static auto GetSteadyClock() noexcept -> Clock &;
+
+ protected:
+  /**
+   * @brief       Default constructor, only for use as base class
+   */
+  Clock() noexcept = default;
+};
+
+/**
+ * @brief       Clock following std::chrono::steady_clock
+ */
+class SteadyClock final : public Clock {
+ public:
+  /**
+   * @brief       Construct an instance of SteadyClock
+   */
+  SteadyClock() noexcept = default;
+
+  /**
+   * @brief       Destruct an instance of SteadyClock
+   */
+  ~SteadyClock() noexcept override = default;
+
+  /**
+   * @brief       Function to get the current time
+   */
+  auto Now() const noexcept -> TimePoint override;
+
+  /**
+   * @brief       Function to block on the conditional variable until notified or the deadline is reached
+   */
+  void WaitUntil(std::unique_lock<std::mutex> &lock, std::condition_variable &cond_var, TimePoint deadline) override;
+
+  /**
+   * @brief       Function to register an object waiting on the clock, nothing to do as time never jumps
+   */
+  void AddWaiter(Waiter &waiter) override;
+
+  /**
+   * @brief       Function to remove an object registered by AddWaiter(), nothing to do as time never jumps
+   */
+  void RemoveWaiter(Waiter &waiter) noexcept override;
+};
+
+/**
+ * @brief       Virtual clock only advanced explicitly, so that timeouts are deterministic and take no real time
+ * @details     Waits block until the clock is advanced past their deadline or their conditional variable is notified
+ */
+class ManualClock final : public Clock {
+ public:
+  /**
+   * @brief       Construct an instance of ManualClock
+   * @param[in]   start_time
+   *              The initial time of clock
+   */
+  explicit ManualClock(TimePoint start_time = TimePoint{}) noexcept;
+
+  /**
+   * @brief       Destruct an instance of ManualClock, all waiters must have been removed
+   */
+  ~ManualClock() noexcept override = default;
+
+  /**
+   * @brief       Function to get the current time
+   */
+  auto Now() const noexcept -> TimePoint override;
+
+  /**
+   * @brief       Function to block on the conditional variable until notified or the clock is advanced
+   */
+  void WaitUntil(std::unique_lock<std::mutex> &lock, std::condition_variable &cond_var, TimePoint deadline) override;
+
+  /**
+   * @brief       Function to register an object waiting on the clock
+   */
+  void AddWaiter(Waiter &waiter) override;
+
+  /**
+   * @brief       Function to remove an object registered by AddWaiter()
+   */
+  void RemoveWaiter(Waiter &waiter) noexcept override;
+
+  /**
+   * @brief       Function to advance the time and wake up all waiters
+   * @param[in]   duration
+   *              The duration to advance
+   */
+  void Advance(Duration duration) noexcept;
+
+  /**
+   * @brief       Function to block until the given number of threads wait on the clock
+   * @details     Used to advance the clock only after the timeout monitoring under test was started
+   * @param[in]   count
+   *              The number of waiting threads
+   */
+  void WaitForWaiting(std::size_t count);
+
+  /**
+   * @brief       Function to get the number of threads waiting on the clock
+   * @return      The number of waiting threads
+   */
+  auto GetWaitingCount() const noexcept -> std::size_t;
+
+ private:
+  /**
+   * @brief       Store the current time since epoch of steady clock
+   */
+  std::atomic<Duration::rep> now_;
+
+  /**
+   * @brief       Store the registered waiters
+   */
+  std::vector<Waiter *> waiters_;
+
+  /**
+   * @brief       Mutex protecting the waiters
+   */
+  std::mutex waiters_mutex_;
+
+  /**
+   * @brief       Store the number of waiting threads
+   */
+  std::size_t waiting_count_;
+
+  /**
+   * @brief       Mutex protecting the number of waiting threads
+   */
+  mutable std::mutex waiting_mutex_;
+
+  /**
+   * @brief       Conditional variable notified when the number of waiting threads grows
+   */
+  std::condition_variable waiting_cond_var_;
+};
+
+}  // namespace core_type
+
+#endif  // DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_CLOCK_H_
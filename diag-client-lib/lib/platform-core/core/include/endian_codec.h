@@ -0,0 +1,139 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_ENDIAN_CODEC_H_
+#define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_ENDIAN_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "core/include/span.h"
+
+namespace core_type {
+namespace details {
+
+/**
+ * @brief       Helper alias to restrict the codec to unsigned integer fields
+ */
+template<typename T>
+using RequireUnsignedField =
+    std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>>;
+
+/**
+ * @brief       Helper alias to restrict the codec to buffers of bytes
+ */
+template<typename Byte>
+using RequireByteBuffer = std::enable_if_t<std::is_same_v<std::remove_const_t<Byte>, std::uint8_t>>;
+
+/**
+ * @brief       Helper function to combine the bytes of a big-endian field, unrolled at compile time
+ */
+template<typename T, std::size_t... Index>
+constexpr auto LoadBigEndian(std::uint8_t const *data, std::index_sequence<Index...>) noexcept -> T {
+  return static_cast<T>(((static_cast<T>(data[Index]) << (8U * (sizeof(T) - 1U - Index))) | ...));
+}
+
+/**
+ * @brief       Helper function to split a field into big-endian bytes, unrolled at compile time
+ */
+template<typename T, std::size_t... Index>
+constexpr void StoreBigEndian(std::uint8_t *data, T value, std::index_sequence<Index...>) noexcept {
+  ((data[Index] = static_cast<std::uint8_t>(value >> (8U * (sizeof(T) - 1U - Index)))), ...);
+}
+
+}  // namespace details
+
+/**
+ * @brief       Function to read a big-endian field without bounds check
+ * @details     The byte-wise pattern is folded by the compiler into a single load and byte swap
+ * @tparam      T
+ *              The unsigned integer type of field
+ * @param[in]   data
+ *              The first byte of field, sizeof(T) bytes must be readable
+ * @return      The field value in host byte order
+ */
+template<typename T, typename = details::RequireUnsignedField<T>>
+constexpr auto LoadBigEndian(std::uint8_t const *data) noexcept -> T {
+  return details::LoadBigEndian<T>(data, std::make_index_sequence<sizeof(T)>{});
+}
+
+/**
+ * @brief       Function to write a big-endian field without bounds check
+ * @details     The byte-wise pattern is folded by the compiler into a single byte swap and store
+ * @tparam      T
+ *              The unsigned integer type of field
+ * @param[in]   data
+ *              The first byte of field, sizeof(T) bytes must be writable
+ * @param[in]   value
+ *              The field value in host byte order
+ */
+template<typename T, typename = details::RequireUnsignedField<T>>
+constexpr void StoreBigEndian(std::uint8_t *data, T value) noexcept {
+  details::StoreBigEndian<T>(data, value, std::make_index_sequence<sizeof(T)>{});
+}
+
+/**
+ * @brief       Function to read a big-endian field from a buffer
+ * @tparam      T
+ *              The unsigned integer type of field
+ * @param[in]   buffer
+ *              The buffer to read from
+ * @param[in]   offset
+ *              The position of field in buffer
+ * @return      The field value in host byte order, empty when the field does not fit into the buffer
+ */
+template<typename T, typename Byte, std::size_t Extent, typename = details::RequireUnsignedField<T>,
+         typename = details::RequireByteBuffer<Byte>>
+constexpr auto ReadBigEndian(Span<Byte, Extent> buffer, std::size_t offset) noexcept -> std::optional<T> {
+  return ((offset <= buffer.size()) && ((buffer.size() - offset) >= sizeof(T)))
+             ? std::optional<T>{LoadBigEndian<T>(buffer.data() + offset)}
+             : std::nullopt;
+}
+
+/**
+ * @brief       Function to write a big-endian field into a buffer
+ * @tparam      T
+ *              The unsigned integer type of field
+ * @param[in]   buffer
+ *              The buffer to write into
+ * @param[in]   offset
+ *              The position of field in buffer
+ * @param[in]   value
+ *              The field value in host byte order
+ * @return      True when written, false when the field does not fit into the buffer
+ */
+template<typename T, std::size_t Extent, typename = details::RequireUnsignedField<T>>
+constexpr auto WriteBigEndian(Span<std::uint8_t, Extent> buffer, std::size_t offset, T value) noexcept -> bool {
+  bool const fits{(offset <= buffer.size()) && ((buffer.size() - offset) >= sizeof(T))};
+  if (fits) { StoreBigEndian<T>(buffer.data() + offset, value); }
+  return fits;
+}
+
+/**
+ * @brief       Function to append a big-endian field to a growable byte container
+ * @tparam      T
+ *              The unsigned integer type of field
+ * @tparam      Container
+ *              The container type providing resize() and data(), like std::vector<std::uint8_t>
+ * @param[in]   buffer
+ *              The container to append to
+ * @param[in]   value
+ *              The field value in host byte order
+ */
+template<typename T, typename Container, typename = details::RequireUnsignedField<T>>
+void AppendBigEndian(Container &buffer, T value) {
+  std::size_t const offset{buffer.size()};
+  buffer.resize(offset + sizeof(T));
+  StoreBigEndian<T>(buffer.data() + offset, value);
+}
+
+}  // namespace core_type
+
+#endif  // DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_ENDIAN_CODEC_H_
@@ -9,6 +9,7 @@
 #define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_ERROR_CODE_H_
 
 #include <string_view>
+#include <type_traits>
 
 #include "core/include/error_domain.h"
 
@@ -17,7 +18,9 @@ namespace core_type {
 /**
  * @brief       Encapsulation of an error code. An ErrorCode contains a raw error code value and an error domain.
  *              The raw error code value is specific to this error domain.
- * @details     This class is implemented based on API specification of ara::core::ErrorCode from Adaptive Platform Core AUTOSAR AP R21-11
+ * @details     This class is implemented based on API specification of ara::core::ErrorCode from Adaptive Platform Core AUTOSAR AP R21-11.
+ *              It is a trivially copyable literal type, the domain is referred by pointer so that copying an ErrorCode
+ *              is a plain copy of 16 bytes.
  */
 class ErrorCode final {
  public:
@@ -31,8 +34,9 @@ class ErrorCode final {
    * @param[in]   data
    *              Optional vendor-specific supplementary error context data
    */
-  template<typename EnumT>
-  explicit ErrorCode(EnumT e, ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType{}) noexcept;
+  template<typename EnumT, typename = std::enable_if_t<std::is_enum_v<EnumT>>>
+  explicit ErrorCode(EnumT e, ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType{}) noexcept
+      : ErrorCode{MakeErrorCode(e, data)} {}
 
   /**
    * @brief       Construct a new ErrorCode instance with parameters
@@ -45,44 +49,47 @@ class ErrorCode final {
    * @param[in]   data
    *              Optional vendor-specific supplementary error context data
    */
-  ErrorCode(ErrorDomain::CodeType value, ErrorDomain &domain,
-            ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType{}) noexcept;
+  constexpr ErrorCode(ErrorDomain::CodeType value, ErrorDomain &domain,
+                      ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType{}) noexcept
+      : domain_{&domain},
+        code_value_{value},
+        support_data_{data} {}
 
   /**
    * @brief       Return the raw error code value.
    * @return      The raw code value
    */
-  constexpr ErrorDomain::CodeType Value() const noexcept;
+  constexpr ErrorDomain::CodeType Value() const noexcept { return code_value_; }
 
   /**
    * @brief       Return the domain with which this ErrorCode is associated.
    * @return      The reference to error domain
    */
-  constexpr const ErrorDomain &Domain() const noexcept;
+  constexpr const ErrorDomain &Domain() const noexcept { return *domain_; }
 
   /**
    * @brief       Return the supplementary error context data.
    * @details     The underlying type and the meaning of the returned value are implementation-defined
    * @return      The support data type
    */
-  constexpr ErrorDomain::SupportDataType SupportData() const noexcept;
+  constexpr ErrorDomain::SupportDataType SupportData() const noexcept { return support_data_; }
 
   /**
    * @brief       Return a textual representation of this ErrorCode.
    * @return      The error message
    */
-  std::string_view Message() noexcept;
+  std::string_view Message() const noexcept;
 
  private:
   /**
-   * @brief       Store the domain error code value
+   * @brief       Store the pointer to error domain contained, never null
    */
-  ErrorDomain::CodeType code_value_{};
+  ErrorDomain *domain_;
 
   /**
-   * @brief       Store the reference to error domain contained
+   * @brief       Store the domain error code value
    */
-  ErrorDomain &domain_;
+  ErrorDomain::CodeType code_value_{};
 
   /**
    * @brief       Store the supported data
@@ -90,6 +97,30 @@ class ErrorCode final {
   ErrorDomain::SupportDataType support_data_{};
 };
 
+/**
+ * @brief       Global operator== for ErrorCode
+ * @details     Two ErrorCode instances compare equal if the results of their Value() and Domain().Id() are equal.
+ *              The result of SupportData() is not considered for equality.
+ * @param[in]   lhs
+ *              The left hand side of the comparison
+ * @param[in]   rhs
+ *              The right hand side of the comparison
+ * @return      True if the two instances compare equal, false otherwise
+ */
+constexpr bool operator==(const ErrorCode &lhs, const ErrorCode &rhs) noexcept {
+  return (lhs.Value() == rhs.Value()) && (lhs.Domain().Id() == rhs.Domain().Id());
+}
+
+/**
+ * @brief       Global operator!= for ErrorCode
+ * @param[in]   lhs
+ *              The left hand side of the comparison
+ * @param[in]   rhs
+ *              The right hand side of the comparison
+ * @return      True if the two instances compare not equal, false otherwise
+ */
+constexpr bool operator!=(const ErrorCode &lhs, const ErrorCode &rhs) noexcept { return !(lhs == rhs); }
+
 }  // namespace core_type
 
 #endif  // DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_ERROR_CODE_H_
\ No newline at end of file
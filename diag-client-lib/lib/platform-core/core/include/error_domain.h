@@ -58,7 +58,7 @@ class ErrorDomain {
    * @brief       Return the unique domain identifier.
    * @return      The unique identifier
    */
-  constexpr IdType Id() const noexcept;
+  constexpr IdType Id() const noexcept { return id_; }
 
   /**
    * @brief       Return the name of this error domain.
@@ -80,7 +80,7 @@ class ErrorDomain {
    * @param[in]   id
    *              The unique identifier
    */
-  explicit ErrorDomain(IdType id) noexcept;
+  constexpr explicit ErrorDomain(IdType id) noexcept : id_{id} {}
 
   /**
    * @brief       Destructor.
@@ -8,15 +8,209 @@
 #ifndef DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_RESULT_H_
 #define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_RESULT_H_
 
+#include <memory>
+#include <new>
 #include <optional>
 #include <type_traits>
 #include <utility>
-#include <variant>
 
 #include "core/include/error_code.h"
 
 namespace core_type {
 
+template<typename T, typename E>
+class Result;
+
+namespace details {
+
+/**
+ * @brief       Helper to deduce the Result type of AndThen, a returned Result with the same error type is not nested
+ */
+template<typename R, typename E>
+struct AndThenResult {
+  using type = Result<R, E>;
+};
+
+template<typename U, typename E>
+struct AndThenResult<Result<U, E>, E> {
+  using type = Result<U, E>;
+};
+
+/**
+ * @brief       Tags to select the value or the error when constructing the storage of Result
+ */
+struct ValueTag {};
+struct ErrorTag {};
+
+/**
+ * @brief       Union of value and error, trivially destructible for trivially destructible T and E
+ */
+template<typename T, typename E, bool = std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>>
+union ResultUnion {
+  constexpr ResultUnion() noexcept : empty_{} {}
+
+  template<typename... Args>
+  constexpr explicit ResultUnion(ValueTag, Args &&...args) noexcept : value_{std::forward<Args>(args)...} {}
+
+  template<typename... Args>
+  constexpr explicit ResultUnion(ErrorTag, Args &&...args) noexcept : error_{std::forward<Args>(args)...} {}
+
+  char empty_;
+  T value_;
+  E error_;
+};
+
+template<typename T, typename E>
+union ResultUnion<T, E, false> {
+  constexpr ResultUnion() noexcept : empty_{} {}
+
+  template<typename... Args>
+  constexpr explicit ResultUnion(ValueTag, Args &&...args) noexcept : value_{std::forward<Args>(args)...} {}
+
+  template<typename... Args>
+  constexpr explicit ResultUnion(ErrorTag, Args &&...args) noexcept : error_{std::forward<Args>(args)...} {}
+
+  ~ResultUnion() noexcept {}
+
+  char empty_;
+  T value_;
+  E error_;
+};
+
+/**
+ * @brief       Value and error side by side, used instead of the union for trivial T and E like integers and enums
+ * @details     The compiler keeps the members of such a Result in separate registers, while overlapping members of
+ *              different size in a union force it through the stack
+ */
+template<typename T, typename E>
+struct ResultPair {
+  constexpr ResultPair() noexcept : value_{}, error_{} {}
+
+  template<typename... Args>
+  constexpr explicit ResultPair(ValueTag, Args &&...args) noexcept : value_{std::forward<Args>(args)...}, error_{} {}
+
+  template<typename... Args>
+  constexpr explicit ResultPair(ErrorTag, Args &&...args) noexcept : value_{}, error_{std::forward<Args>(args)...} {}
+
+  T value_;
+  E error_;
+};
+
+/**
+ * @brief       Helper alias to select the members of the storage of Result
+ */
+template<typename T, typename E>
+using ResultMembers =
+    std::conditional_t<std::is_trivial_v<T> && std::is_trivial_v<E>, ResultPair<T, E>, ResultUnion<T, E>>;
+
+/**
+ * @brief       Storage of Result, a value or an error together with a flag which one is contained
+ * @details     Unlike std::variant the flag and the value or error are plain members, which lets the compiler keep a
+ *              Result in registers across inlined calls
+ */
+template<typename T, typename E>
+class ResultStorageBase {
+ public:
+  template<typename... Args>
+  constexpr explicit ResultStorageBase(ValueTag tag, Args &&...args) noexcept
+      : members_{tag, std::forward<Args>(args)...},
+        has_value_{true} {}
+
+  template<typename... Args>
+  constexpr explicit ResultStorageBase(ErrorTag tag, Args &&...args) noexcept
+      : members_{tag, std::forward<Args>(args)...},
+        has_value_{false} {}
+
+  constexpr bool HasValue() const noexcept { return has_value_; }
+
+  constexpr T &Value() noexcept { return members_.value_; }
+
+  constexpr const T &Value() const noexcept { return members_.value_; }
+
+  constexpr E &Error() noexcept { return members_.error_; }
+
+  constexpr const E &Error() const noexcept { return members_.error_; }
+
+ protected:
+  /**
+   * @brief       Construct the storage without a contained object, must be followed by Construct
+   */
+  constexpr ResultStorageBase() noexcept : members_{}, has_value_{false} {}
+
+  void Construct(const ResultStorageBase &other) noexcept {
+    if (other.has_value_) {
+      ::new (static_cast<void *>(std::addressof(members_.value_))) T(other.members_.value_);
+    } else {
+      ::new (static_cast<void *>(std::addressof(members_.error_))) E(other.members_.error_);
+    }
+    has_value_ = other.has_value_;
+  }
+
+  void Construct(ResultStorageBase &&other) noexcept {
+    if (other.has_value_) {
+      ::new (static_cast<void *>(std::addressof(members_.value_))) T(std::move(other.members_.value_));
+    } else {
+      ::new (static_cast<void *>(std::addressof(members_.error_))) E(std::move(other.members_.error_));
+    }
+    has_value_ = other.has_value_;
+  }
+
+  void Destroy() noexcept {
+    if (has_value_) {
+      members_.value_.~T();
+    } else {
+      members_.error_.~E();
+    }
+  }
+
+ private:
+  ResultMembers<T, E> members_;
+
+  bool has_value_;
+};
+
+/**
+ * @brief       Storage of Result with its copy and move operations
+ * @details     For trivially copyable T and E the implicit operations are kept, so that Result is trivially copyable
+ */
+template<typename T, typename E, bool = std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<E>>
+class ResultStorage : public ResultStorageBase<T, E> {
+ public:
+  using ResultStorageBase<T, E>::ResultStorageBase;
+};
+
+template<typename T, typename E>
+class ResultStorage<T, E, false> : public ResultStorageBase<T, E> {
+  using Base = ResultStorageBase<T, E>;
+
+ public:
+  using Base::Base;
+
+  ResultStorage(const ResultStorage &other) noexcept : Base{} { this->Construct(other); }
+
+  ResultStorage(ResultStorage &&other) noexcept : Base{} { this->Construct(std::move(other)); }
+
+  ResultStorage &operator=(const ResultStorage &other) noexcept {
+    if (this != &other) {
+      this->Destroy();
+      this->Construct(other);
+    }
+    return *this;
+  }
+
+  ResultStorage &operator=(ResultStorage &&other) noexcept {
+    if (this != &other) {
+      this->Destroy();
+      this->Construct(std::move(other));
+    }
+    return *this;
+  }
+
+  ~ResultStorage() noexcept { this->Destroy(); }
+};
+
+}  // namespace details
+
 /**
  * @brief       Class type to contains a value (of type ValueType), or an error (of type ErrorType)
  * @details     This class is implemented based on API specification of ara::core::Result from Adaptive Platform Core AUTOSAR AP R21-11
@@ -45,7 +239,7 @@ class Result final {
    * @return      Result
    *              A Result that contains the value t
    */
-  static Result FromValue(T &t) noexcept { return Result{t}; }
+  static constexpr Result FromValue(T &t) noexcept { return Result{t}; }
 
   /**
    * @brief       Build a new Result from the specified value (given as rvalue)
@@ -54,7 +248,7 @@ class Result final {
    * @return      Result
    *              A Result that contains the value t
    */
-  static Result FromValue(T &&t) noexcept { return Result{std::move(t)}; }
+  static constexpr Result FromValue(T &&t) noexcept { return Result{std::move(t)}; }
 
   /**
    * @brief       Build a new Result from a value that is constructed in-place from the given arguments
@@ -69,7 +263,7 @@ class Result final {
    *              A Result that contains a value
    */
   template<typename... Args>
-  static Result FromValue(Args &&...args) noexcept {
+  static constexpr Result FromValue(Args &&...args) noexcept {
     return Result{std::forward<Args>(args)...};
   }
 
@@ -80,7 +274,7 @@ class Result final {
    * @return      Result
    *              A Result that contains the error e
    */
-  static Result FromError(const E &e) noexcept { return Result{e}; }
+  static constexpr Result FromError(const E &e) noexcept { return Result{e}; }
 
   /**
    * @brief       Build a new Result from the specified error (given as rvalue)
@@ -89,7 +283,7 @@ class Result final {
    * @return      Result
    *              A Result that contains the error e
    */
-  static Result FromError(E &&e) noexcept { return Result{std::move(e)}; }
+  static constexpr Result FromError(E &&e) noexcept { return Result{std::move(e)}; }
 
   /**
    * @brief       Build a new Result from an error that is constructed in-place from the given arguments
@@ -104,7 +298,7 @@ class Result final {
    *              A Result that contains an error
    */
   template<typename... Args>
-  static Result FromError(Args &&...args) noexcept {
+  static constexpr Result FromError(Args &&...args) noexcept {
     return Result{std::forward<Args>(args)...};
   }
 
@@ -113,28 +307,28 @@ class Result final {
    * @param[in]   t
    *              The value to put into the Result
    */
-  constexpr explicit Result(const T &t) noexcept : storage_{t} {}
+  constexpr explicit Result(const T &t) noexcept : storage_{details::ValueTag{}, t} {}
 
   /**
    * @brief       Construct a new Result from the specified value (given as rvalue)
    * @param[in]   t
    *              The value to put into the Result
    */
-  constexpr explicit Result(T &&t) noexcept : storage_{std::move(t)} {}
+  constexpr explicit Result(T &&t) noexcept : storage_{details::ValueTag{}, std::move(t)} {}
 
   /**
    * @brief       Construct a new Result from the specified error (given as lvalue)
    * @param[in]   e
    *              The error to put into the Result
    */
-  constexpr explicit Result(const E &e) noexcept : storage_{e} {}
+  constexpr explicit Result(const E &e) noexcept : storage_{details::ErrorTag{}, e} {}
 
   /**
    * @brief       Construct a new Result from the specified error (given as rvalue)
    * @param[in]   e
    *              The error to put into the Result
    */
-  constexpr explicit Result(E &&e) noexcept : storage_{std::move(e)} {}
+  constexpr explicit Result(E &&e) noexcept : storage_{details::ErrorTag{}, std::move(e)} {}
 
   /**
    * @brief       Copy-construct a new Result from another instance
@@ -185,7 +379,7 @@ class Result final {
    */
   template<typename... Args>
   void EmplaceValue(Args &&...args) noexcept {
-    storage_.template emplace<value_type>(std::forward<Args>(args)...);
+    storage_ = Storage{details::ValueTag{}, std::forward<Args>(args)...};
   }
 
   /**
@@ -197,7 +391,7 @@ class Result final {
    */
   template<typename... Args>
   void EmplaceError(Args &&...args) noexcept {
-    storage_.template emplace<error_type>(std::forward<Args>(args)...);
+    storage_ = Storage{details::ErrorTag{}, std::forward<Args>(args)...};
   }
 
   /**
@@ -205,14 +399,14 @@ class Result final {
    * @return      bool
    *              True if *this contains a value, false otherwise
    */
-  bool HasValue() const noexcept { return std::holds_alternative<value_type>(storage_); }
+  constexpr bool HasValue() const noexcept { return storage_.HasValue(); }
 
   /**
    * @brief       Check whether *this contains a value
    * @return      bool
    *              True if *this contains a value, false otherwise
    */
-  explicit operator bool() const noexcept { return HasValue(); }
+  constexpr explicit operator bool() const noexcept { return HasValue(); }
 
   /**
    * @brief       Access the contained value
@@ -220,7 +414,7 @@ class Result final {
    * @return      const T &
    *              A const_reference to the contained value
    */
-  const T &operator*() const &noexcept { return std::get<value_type>(storage_); }
+  constexpr const T &operator*() const &noexcept { return storage_.Value(); }
 
   /**
    * @brief       Access the contained value
@@ -228,7 +422,7 @@ class Result final {
    * @return      T &&
    *              An rvalue reference to the contained value
    */
-  T &&operator*() &&noexcept { return std::move(std::get<value_type>(storage_)); }
+  constexpr T &&operator*() &&noexcept { return std::move(storage_.Value()); }
 
   /**
    * @brief       Access the contained value
@@ -236,7 +430,7 @@ class Result final {
    * @return      const T *
    *              A pointer to the contained value
    */
-  const T *operator->() const noexcept { return std::get_if<value_type>(storage_); }
+  constexpr const T *operator->() const noexcept { return std::addressof(storage_.Value()); }
 
   /**
    * @brief       Access the contained value
@@ -244,7 +438,7 @@ class Result final {
    * @return      const T &
    *              A const reference to the contained value
    */
-  const T &Value() const &noexcept { return std::get<value_type>(storage_); }
+  constexpr const T &Value() const &noexcept { return storage_.Value(); }
 
   /**
    * @brief       Access the contained value
@@ -252,7 +446,7 @@ class Result final {
    * @return      T &&
    *              An rvalue reference to the contained value
    */
-  T &&Value() &&noexcept { return std::move(std::get<value_type>(storage_)); }
+  constexpr T &&Value() &&noexcept { return std::move(storage_.Value()); }
 
   /**
    * @brief       Access the contained error
@@ -260,7 +454,7 @@ class Result final {
    * @return      const E &
    *              A const reference to the contained error
    */
-  const E &Error() const &noexcept { return std::get<error_type>(storage_); }
+  constexpr const E &Error() const &noexcept { return storage_.Error(); }
 
   /**
    * @brief       Access the contained error
@@ -268,14 +462,14 @@ class Result final {
    * @return      E &&
    *              An rvalue reference to the contained error
    */
-  E &&Error() &&noexcept { return std::move(std::get<error_type>(storage_)); }
+  constexpr E &&Error() &&noexcept { return std::move(storage_.Error()); }
 
   /**
    * @brief       Return the contained value as an Optional
    * @return      std::optional<T>
    *              An Optional with the value, if present
    */
-  std::optional<T> Ok() const &noexcept {
+  constexpr std::optional<T> Ok() const &noexcept {
     std::optional<T> opt_val{};
     if (HasValue()) { opt_val.emplace(Value()); }
     return opt_val;
@@ -286,9 +480,9 @@ class Result final {
    * @return      std::optional<T>
    *              An Optional with the value, if present
    */
-  std::optional<T> Ok() &&noexcept {
+  constexpr std::optional<T> Ok() &&noexcept {
     std::optional<T> opt_val{};
-    if (HasValue()) { opt_val.emplace(std::move(Value())); }
+    if (HasValue()) { opt_val.emplace(std::move(*this).Value()); }
     return opt_val;
   }
 
@@ -297,7 +491,7 @@ class Result final {
    * @return      std::optional<E>
    *              An Optional with the error, if present
    */
-  std::optional<E> Err() const &noexcept {
+  constexpr std::optional<E> Err() const &noexcept {
     std::optional<E> opt_err{};
     if (!HasValue()) { opt_err.emplace(Error()); }
     return opt_err;
@@ -308,15 +502,17 @@ class Result final {
    * @return      std::optional<E>
    *              An Optional with the error, if present
    */
-  std::optional<E> Err() &&noexcept {
+  constexpr std::optional<E> Err() &&noexcept {
     std::optional<E> opt_err{};
-    if (!HasValue()) { opt_err.emplace(std::move(Error())); }
+    if (!HasValue()) { opt_err.emplace(std::move(*this).Error()); }
     return opt_err;
   }
 
   /**
    * @brief       Returns the result of the given function on the contained value if it exists;
    *              otherwise, returns the result itself
+   * @details     The function may return a plain value, void or a Result with the same error type. A returned Result
+   *              is passed on as it is, so that fallible steps can be chained without nesting
    * @tparam      F
    *              Functor type
    * @param[in]   fn
@@ -324,9 +520,18 @@ class Result final {
    * @return      Result
    *              An Result
    */
-  template<typename F, typename T2 = typename std::invoke_result_t<F, T>>
-  Result<T2, E> AndThen(F &&fn) &&noexcept {
-    return HasValue() ? Result<T2, E>{fn(std::move(*this).Value())} : Result<T2, E>{*this};
+  template<typename F, typename R = std::invoke_result_t<F, T>>
+  constexpr typename details::AndThenResult<R, E>::type AndThen(F &&fn) &&noexcept {
+    using ResultType = typename details::AndThenResult<R, E>::type;
+    if (!HasValue()) { return ResultType{std::move(*this).Error()}; }
+    if constexpr (std::is_void_v<R>) {
+      fn(std::move(*this).Value());
+      return ResultType{};
+    } else if constexpr (std::is_same_v<R, ResultType>) {
+      return fn(std::move(*this).Value());
+    } else {
+      return ResultType{fn(std::move(*this).Value())};
+    }
   }
 
   /**
@@ -340,7 +545,7 @@ class Result final {
    *              An Result
    */
   template<typename F, typename E2 = std::invoke_result_t<F, E>>
-  Result<T, E2> MapError(F &&fn) {
+  constexpr Result<T, E2> MapError(F &&fn) {
     return HasValue() ? Result<T, E2>{std::move(*this).Value()} : Result<T, E2>{fn(std::move(*this).Error())};
   }
 
@@ -355,7 +560,7 @@ class Result final {
    *              An Result
    */
   template<typename F>
-  Result OrElse(F &&fn) &&noexcept {
+  constexpr Result OrElse(F &&fn) &&noexcept {
     return HasValue() ? Result{std::move(*this)} : Result{fn(std::move(*this).Error())};
   }
 
@@ -370,8 +575,8 @@ class Result final {
    *              The value
    */
   template<typename U>
-  T ValueOr(U &&defaultValue) const &noexcept {
-    return HasValue() ? Result{*this} : static_cast<T>(defaultValue);
+  constexpr T ValueOr(U &&defaultValue) const &noexcept {
+    return HasValue() ? Value() : static_cast<T>(std::forward<U>(defaultValue));
   }
 
   /**
@@ -385,8 +590,8 @@ class Result final {
    *              The value
    */
   template<typename U>
-  T ValueOr(U &&defaultValue) &&noexcept {
-    return HasValue() ? Result{std::move(*this)} : static_cast<T>(defaultValue);
+  constexpr T ValueOr(U &&defaultValue) &&noexcept {
+    return HasValue() ? std::move(*this).Value() : static_cast<T>(std::forward<U>(defaultValue));
   }
 
   /**
@@ -400,8 +605,8 @@ class Result final {
    *              The error
    */
   template<typename G>
-  E ErrorOr(G &&defaultError) const &noexcept {
-    return !HasValue() ? Result{*this} : static_cast<E>(defaultError);
+  constexpr E ErrorOr(G &&defaultError) const &noexcept {
+    return !HasValue() ? Error() : static_cast<E>(std::forward<G>(defaultError));
   }
 
   /**
@@ -415,8 +620,8 @@ class Result final {
    *              The error
    */
   template<typename G>
-  E ErrorOr(G &&defaultError) &&noexcept {
-    return !HasValue() ? Result{std::move(*this)} : static_cast<E>(defaultError);
+  constexpr E ErrorOr(G &&defaultError) &&noexcept {
+    return !HasValue() ? std::move(*this).Error() : static_cast<E>(std::forward<G>(defaultError));
   }
 
   /**
@@ -432,15 +637,20 @@ class Result final {
    *              The value
    */
   template<typename F>
-  T Resolve(F &&f) const {
-    return HasValue() ? Result{*this} : f(Error());
+  constexpr T Resolve(F &&f) const {
+    return HasValue() ? Value() : f(Error());
   }
 
  private:
+  /**
+   * @brief      Type alias for the storage, trivially copyable if T and E are
+   */
+  using Storage = details::ResultStorage<T, E>;
+
   /**
    * @brief      Storage to contain value of type T or error of type E
    */
-  std::variant<T, E> storage_;
+  Storage storage_;
 };
 
 /**
@@ -467,7 +677,7 @@ class Result<void, E> final {
    * @param[in]   t
    *              The value to put into the Result
    */
-  static Result FromValue() noexcept { return Result{}; }
+  static constexpr Result FromValue() noexcept { return Result{}; }
 
   /**
    * @brief       Build a new Result from the specified error (given as lvalue)
@@ -476,7 +686,7 @@ class Result<void, E> final {
    * @return      Result
    *              A Result that contains the error e
    */
-  static Result FromError(const E &e) noexcept { return Result{e}; }
+  static constexpr Result FromError(const E &e) noexcept { return Result{e}; }
 
   /**
    * @brief       Build a new Result from the specified error (given as rvalue)
@@ -485,7 +695,7 @@ class Result<void, E> final {
    * @return      Result
    *              A Result that contains the error e
    */
-  static Result FromError(E &&e) noexcept { return Result{std::move(e)}; }
+  static constexpr Result FromError(E &&e) noexcept { return Result{std::move(e)}; }
 
   /**
    * @brief       Build a new Result from an error that is constructed in-place from the given arguments
@@ -500,7 +710,7 @@ class Result<void, E> final {
    *              A Result that contains an error
    */
   template<typename... Args>
-  static Result FromError(Args &&...args) noexcept {
+  static constexpr Result FromError(Args &&...args) noexcept {
     return Result{std::forward<Args>(args)...};
   }
 
@@ -559,7 +769,7 @@ class Result<void, E> final {
   /**
    * @brief      Destruct an instance of Result
    */
-  ~Result() noexcept { static_assert(std::is_trivially_destructible<E>::value); }
+  ~Result() noexcept = default;
 
   /**
    * @brief       Put a new value into this instance, constructed in-place from the given arguments
@@ -583,14 +793,14 @@ class Result<void, E> final {
    * @return      bool
    *              True if *this contains a value, false otherwise
    */
-  bool HasValue() const noexcept { return storage_.HasValue(); }
+  constexpr bool HasValue() const noexcept { return storage_.HasValue(); }
 
   /**
    * @brief       Check whether *this contains a value
    * @return      bool
    *              True if *this contains a value, false otherwise
    */
-  explicit operator bool() const noexcept { return HasValue(); }
+  constexpr explicit operator bool() const noexcept { return HasValue(); }
 
   /**
    * @brief       Access the contained error
@@ -598,7 +808,7 @@ class Result<void, E> final {
    * @return      const E &
    *              A const reference to the contained error
    */
-  const E &Error() const &noexcept { return storage_.Error(); }
+  constexpr const E &Error() const &noexcept { return storage_.Error(); }
 
   /**
    * @brief       Access the contained error
@@ -606,14 +816,14 @@ class Result<void, E> final {
    * @return      E &&
    *              An rvalue reference to the contained error
    */
-  E &&Error() &&noexcept { return std::move(storage_.Error()); }
+  constexpr E &&Error() &&noexcept { return std::move(storage_).Error(); }
 
   /**
    * @brief       Return the contained error as an Optional
    * @return      std::optional<E>
    *              An Optional with the error, if present
    */
-  std::optional<E> Err() const &noexcept {
+  constexpr std::optional<E> Err() const &noexcept {
     std::optional<E> opt_err{};
     if (!HasValue()) { opt_err.emplace(Error()); }
     return opt_err;
@@ -624,9 +834,9 @@ class Result<void, E> final {
    * @return      std::optional<E>
    *              An Optional with the error, if present
    */
-  std::optional<E> Err() &&noexcept {
+  constexpr std::optional<E> Err() &&noexcept {
     std::optional<E> opt_err{};
-    if (!HasValue()) { opt_err.emplace(std::move(Error())); }
+    if (!HasValue()) { opt_err.emplace(std::move(*this).Error()); }
     return opt_err;
   }
 
@@ -641,7 +851,7 @@ class Result<void, E> final {
    *              An Result
    */
   template<typename F, typename E2 = std::invoke_result_t<F, E>>
-  Result<void, E2> MapError(F &&fn) {
+  constexpr Result<void, E2> MapError(F &&fn) {
     return HasValue() ? Result<void, E2>{} : Result<void, E2>{fn(Error())};
   }
 
@@ -656,13 +866,15 @@ class Result<void, E> final {
    *              An Result
    */
   template<typename F, typename E2 = std::invoke_result_t<F, E>>
-  Result<void, E2> CheckError(F &&fn) {
+  constexpr Result<void, E2> CheckError(F &&fn) {
     return HasValue() ? Result<void, E2>{} : Result<void, E2>{fn(Error())};
   }
 
   /**
    * @brief       Returns the result of the given function on the contained value if it exists;
    *              otherwise, returns the result itself
+   * @details     The function may return void, a plain value or a Result with the same error type. A returned Result
+   *              is passed on as it is, so that fallible steps can be chained without nesting
    * @tparam      F
    *              Functor type
    * @param[in]   fn
@@ -670,10 +882,20 @@ class Result<void, E> final {
    * @return      Result
    *              An Result
    */
-  template<typename F>
-  Result AndThen(F &&fn) &&noexcept {
-    if (HasValue()) { fn(); }
-    return Result{std::move(*this)};
+  template<typename F, typename R = std::invoke_result_t<F>>
+  constexpr typename details::AndThenResult<R, E>::type AndThen(F &&fn) &&noexcept {
+    using ResultType = typename details::AndThenResult<R, E>::type;
+    if constexpr (std::is_void_v<R>) {
+      if (HasValue()) { fn(); }
+      return Result{std::move(*this)};
+    } else {
+      if (!HasValue()) { return ResultType{std::move(*this).Error()}; }
+      if constexpr (std::is_same_v<R, ResultType>) {
+        return fn();
+      } else {
+        return ResultType{fn()};
+      }
+    }
   }
 
   /**
@@ -687,7 +909,7 @@ class Result<void, E> final {
    *              An Result
    */
   template<typename F>
-  Result OrElse(F &&fn) &&noexcept {
+  constexpr Result OrElse(F &&fn) &&noexcept {
     return HasValue() ? Result{std::move(*this)} : Result{fn(Error())};
   }
 
@@ -702,8 +924,8 @@ class Result<void, E> final {
    *              The error
    */
   template<typename G>
-  E ErrorOr(G &&defaultError) const &noexcept {
-    return !HasValue() ? Result{*this} : static_cast<E>(defaultError);
+  constexpr E ErrorOr(G &&defaultError) const &noexcept {
+    return !HasValue() ? Error() : static_cast<E>(std::forward<G>(defaultError));
   }
 
   /**
@@ -717,8 +939,8 @@ class Result<void, E> final {
    *              The error
    */
   template<typename G>
-  E ErrorOr(G &&defaultError) &&noexcept {
-    return !HasValue() ? Result{std::move(*this)} : static_cast<E>(defaultError);
+  constexpr E ErrorOr(G &&defaultError) &&noexcept {
+    return !HasValue() ? std::move(*this).Error() : static_cast<E>(std::forward<G>(defaultError));
   }
 
   /**
@@ -733,8 +955,8 @@ class Result<void, E> final {
    *              The value
    */
   template<typename F>
-  void Resolve(F &&f) const {
-    f(Error());
+  constexpr void Resolve(F &&f) const {
+    if (!HasValue()) { f(Error()); }
   }
 
  private:
@@ -0,0 +1,422 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_SMALL_BYTE_VECTOR_H_
+#define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_SMALL_BYTE_VECTOR_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace core_type {
+
+/**
+ * @brief       Contiguous container of bytes keeping up to InlineCapacity bytes inside the object
+ * @details     The interface follows std::vector<std::uint8_t>, so that existing code using a byte vector compiles
+ *              unchanged. The heap is only touched once the size grows beyond InlineCapacity. Iterators are plain
+ *              pointers, they are invalidated by every operation that may reallocate, like for std::vector, and
+ *              additionally by moving a container whose bytes are kept inline.
+ * @tparam      InlineCapacity
+ *              The number of bytes stored without heap allocation
+ */
+template<std::size_t InlineCapacity>
+class SmallByteVector final {
+  static_assert(InlineCapacity > 0U, "Inline capacity must not be zero");
+
+  /**
+   * @brief       Helper alias to restrict overloads to iterator arguments, like std::vector does
+   */
+  template<typename InputIterator>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIterator>::iterator_category, std::input_iterator_tag>>;
+
+ public:
+  using value_type = std::uint8_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = value_type const &;
+  using pointer = value_type *;
+  using const_pointer = value_type const *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief       The number of bytes stored without heap allocation
+   */
+  static constexpr size_type kInlineCapacity{InlineCapacity};
+
+  /**
+   * @brief       Construct an empty container
+   */
+  SmallByteVector() noexcept
+      : inline_buffer_{},
+        data_{inline_buffer_.data()},
+        size_{0U},
+        capacity_{kInlineCapacity} {}
+
+  /**
+   * @brief       Construct a container with count value-initialized bytes
+   * @param[in]   count
+   *              The number of bytes
+   */
+  explicit SmallByteVector(size_type count) : SmallByteVector{} { resize(count); }
+
+  /**
+   * @brief       Construct a container with count copies of value
+   * @param[in]   count
+   *              The number of bytes
+   * @param[in]   value
+   *              The value of all bytes
+   */
+  SmallByteVector(size_type count, value_type value) : SmallByteVector{} { resize(count, value); }
+
+  /**
+   * @brief       Construct a container with the bytes of the range [first, last)
+   * @param[in]   first
+   *              The begin of range
+   * @param[in]   last
+   *              The end of range
+   */
+  template<typename InputIterator, typename = RequireInputIterator<InputIterator>>
+  SmallByteVector(InputIterator first, InputIterator last) : SmallByteVector{} {
+    assign(first, last);
+  }
+
+  /**
+   * @brief       Construct a container with the bytes of the initializer list
+   * @param[in]   init
+   *              The initializer list
+   */
+  SmallByteVector(std::initializer_list<value_type> init) : SmallByteVector{} { assign(init.begin(), init.end()); }
+
+  /**
+   * @brief       Construct a container with the bytes of a std::vector, for compatibility with existing code
+   * @param[in]   other
+   *              The vector to copy from
+   */
+  SmallByteVector(std::vector<value_type> const &other) : SmallByteVector{} {  // NOLINT(google-explicit-constructor)
+    assign(other.begin(), other.end());
+  }
+
+  /**
+   * @brief       Copy constructor
+   */
+  SmallByteVector(SmallByteVector const &other) : SmallByteVector{} { assign(other.begin(), other.end()); }
+
+  /**
+   * @brief       Move constructor, takes over the heap buffer of other or copies its inline bytes
+   */
+  SmallByteVector(SmallByteVector &&other) noexcept : SmallByteVector{} { MoveFrom(other); }
+
+  /**
+   * @brief       Copy assignment
+   */
+  SmallByteVector &operator=(SmallByteVector const &other) {
+    if (this != &other) { assign(other.begin(), other.end()); }
+    return *this;
+  }
+
+  /**
+   * @brief       Move assignment
+   */
+  SmallByteVector &operator=(SmallByteVector &&other) noexcept {
+    if (this != &other) {
+      Release();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief       Assignment from an initializer list
+   */
+  SmallByteVector &operator=(std::initializer_list<value_type> init) {
+    assign(init.begin(), init.end());
+    return *this;
+  }
+
+  /**
+   * @brief       Destruct an instance of SmallByteVector
+   */
+  ~SmallByteVector() noexcept { Release(); }
+
+  /**
+   * @brief       Convert to std::vector, for compatibility with existing code
+   */
+  operator std::vector<value_type>() const {  // NOLINT(google-explicit-constructor)
+    return std::vector<value_type>(begin(), end());
+  }
+
+  /**
+   * @brief       Replace the content with count copies of value
+   */
+  void assign(size_type count, value_type value) {
+    clear();
+    resize(count, value);
+  }
+
+  /**
+   * @brief       Replace the content with the bytes of the range [first, last)
+   */
+  template<typename InputIterator, typename = RequireInputIterator<InputIterator>>
+  void assign(InputIterator first, InputIterator last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<InputIterator>::iterator_category>) {
+      size_type const count{static_cast<size_type>(std::distance(first, last))};
+      clear();
+      reserve(count);
+      (void) std::copy(first, last, data_);
+      size_ = count;
+    } else {
+      clear();
+      for (; first != last; ++first) { push_back(static_cast<value_type>(*first)); }
+    }
+  }
+
+  /**
+   * @brief       Replace the content with the bytes of the initializer list
+   */
+  void assign(std::initializer_list<value_type> init) { assign(init.begin(), init.end()); }
+
+  reference operator[](size_type pos) noexcept { return data_[pos]; }
+
+  const_reference operator[](size_type pos) const noexcept { return data_[pos]; }
+
+  reference front() noexcept { return data_[0U]; }
+
+  const_reference front() const noexcept { return data_[0U]; }
+
+  reference back() noexcept { return data_[size_ - 1U]; }
+
+  const_reference back() const noexcept { return data_[size_ - 1U]; }
+
+  pointer data() noexcept { return data_; }
+
+  const_pointer data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+
+  const_iterator begin() const noexcept { return data_; }
+
+  const_iterator cbegin() const noexcept { return data_; }
+
+  iterator end() noexcept { return data_ + size_; }
+
+  const_iterator end() const noexcept { return data_ + size_; }
+
+  const_iterator cend() const noexcept { return data_ + size_; }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+
+  reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+
+  bool empty() const noexcept { return size_ == 0U; }
+
+  size_type size() const noexcept { return size_; }
+
+  static constexpr size_type max_size() noexcept { return std::numeric_limits<difference_type>::max(); }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  /**
+   * @brief       Function to check if the bytes are stored inside the object
+   * @return      True when no heap buffer is in use, false otherwise
+   */
+  bool IsInline() const noexcept { return data_ == inline_buffer_.data(); }
+
+  /**
+   * @brief       Increase the capacity to at least new_capacity, never shrinks
+   */
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) { Reallocate(new_capacity); }
+  }
+
+  /**
+   * @brief       Give the heap buffer back when the bytes fit inline again
+   */
+  void shrink_to_fit() {
+    if (!IsInline() && (size_ <= kInlineCapacity)) {
+      (void) std::memcpy(inline_buffer_.data(), data_, size_);
+      delete[] data_;
+      data_ = inline_buffer_.data();
+      capacity_ = kInlineCapacity;
+    }
+  }
+
+  void clear() noexcept { size_ = 0U; }
+
+  iterator insert(const_iterator pos, value_type value) { return insert(pos, size_type{1U}, value); }
+
+  iterator insert(const_iterator pos, size_type count, value_type value) {
+    size_type const index{MakeRoom(pos, count)};
+    (void) std::memset(data_ + index, value, count);
+    return data_ + index;
+  }
+
+  template<typename InputIterator, typename = RequireInputIterator<InputIterator>>
+  iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+    size_type index{static_cast<size_type>(pos - data_)};
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<InputIterator>::iterator_category>) {
+      index = MakeRoom(pos, static_cast<size_type>(std::distance(first, last)));
+      (void) std::copy(first, last, data_ + index);
+    } else {
+      // single pass range, collect first to know its size
+      SmallByteVector const range{first, last};
+      index = MakeRoom(pos, range.size());
+      (void) std::copy(range.begin(), range.end(), data_ + index);
+    }
+    return data_ + index;
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<value_type> init) {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    size_type const index{static_cast<size_type>(first - data_)};
+    size_type const count{static_cast<size_type>(last - first)};
+    (void) std::memmove(data_ + index, data_ + index + count, size_ - index - count);
+    size_ -= count;
+    return data_ + index;
+  }
+
+  void push_back(value_type value) {
+    if (size_ == capacity_) { Reallocate(capacity_ * 2U); }
+    data_[size_++] = value;
+  }
+
+  reference emplace_back(value_type value) {
+    push_back(value);
+    return back();
+  }
+
+  void pop_back() noexcept { --size_; }
+
+  /**
+   * @brief       Change the size, added bytes are value-initialized
+   */
+  void resize(size_type count) { resize(count, value_type{0U}); }
+
+  /**
+   * @brief       Change the size, added bytes are copies of value
+   */
+  void resize(size_type count, value_type value) {
+    if (count > size_) {
+      reserve(count);
+      (void) std::memset(data_ + size_, value, count - size_);
+    }
+    size_ = count;
+  }
+
+  void swap(SmallByteVector &other) noexcept {
+    SmallByteVector temp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  friend bool operator==(SmallByteVector const &lhs, SmallByteVector const &rhs) noexcept {
+    return (lhs.size_ == rhs.size_) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  friend bool operator!=(SmallByteVector const &lhs, SmallByteVector const &rhs) noexcept { return !(lhs == rhs); }
+
+  friend bool operator<(SmallByteVector const &lhs, SmallByteVector const &rhs) noexcept {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+ private:
+  /**
+   * @brief       Function to move the storage to a buffer of the given capacity on heap
+   */
+  void Reallocate(size_type new_capacity) {
+    pointer const new_data{new value_type[new_capacity]};
+    (void) std::memcpy(new_data, data_, size_);
+    if (!IsInline()) { delete[] data_; }
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  /**
+   * @brief       Function to open a gap of count bytes at pos
+   * @return      The index of gap
+   */
+  size_type MakeRoom(const_iterator pos, size_type count) {
+    size_type const index{static_cast<size_type>(pos - data_)};
+    if ((size_ + count) > capacity_) { Reallocate(std::max(size_ + count, capacity_ * 2U)); }
+    (void) std::memmove(data_ + index + count, data_ + index, size_ - index);
+    size_ += count;
+    return index;
+  }
+
+  /**
+   * @brief       Function to free the heap buffer if any, leaves the object empty with inline storage
+   */
+  void Release() noexcept {
+    if (!IsInline()) { delete[] data_; }
+    data_ = inline_buffer_.data();
+    size_ = 0U;
+    capacity_ = kInlineCapacity;
+  }
+
+  /**
+   * @brief       Function to take over the content of other, which is left empty, this must be empty and inline
+   */
+  void MoveFrom(SmallByteVector &other) noexcept {
+    if (other.IsInline()) {
+      (void) std::memcpy(data_, other.data_, other.size_);
+      size_ = other.size_;
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_buffer_.data();
+      other.capacity_ = kInlineCapacity;
+    }
+    other.size_ = 0U;
+  }
+
+  /**
+   * @brief       Store the bytes as long as they fit, declared first as data_ points into it on construction
+   */
+  std::array<value_type, kInlineCapacity> inline_buffer_;
+
+  /**
+   * @brief       Store the pointer to the bytes, either to the inline buffer or to the heap buffer
+   */
+  pointer data_;
+
+  /**
+   * @brief       Store the number of bytes
+   */
+  size_type size_;
+
+  /**
+   * @brief       Store the number of bytes fitting without reallocation
+   */
+  size_type capacity_;
+};
+
+}  // namespace core_type
+
+#endif  // DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_SMALL_BYTE_VECTOR_H_
@@ -0,0 +1,224 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_STATIC_VECTOR_H_
+#define DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_STATIC_VECTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace core_type {
+
+/**
+ * @brief       Contiguous container of up to Capacity elements stored inside the object, never touching the heap
+ * @details     The interface follows std::vector, so that a container can be switched between both by a type alias.
+ *              Growing beyond Capacity is a precondition violation, callers check size() against max_size() first,
+ *              which works for std::vector as well. Iterators are plain pointers, they are invalidated by inserting or
+ *              erasing before them and by moving the container.
+ * @tparam      T
+ *              The type of elements
+ * @tparam      Capacity
+ *              The maximum number of elements
+ */
+template<typename T, std::size_t Capacity>
+class StaticVector final {
+  static_assert(Capacity > 0U, "Capacity must not be zero");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = value_type const &;
+  using pointer = value_type *;
+  using const_pointer = value_type const *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief       The maximum number of elements
+   */
+  static constexpr size_type kCapacity{Capacity};
+
+  /**
+   * @brief       Construct an empty container
+   */
+  StaticVector() noexcept : size_{0U} {}
+
+  /**
+   * @brief       Copy constructor
+   */
+  StaticVector(StaticVector const &other) : StaticVector{} {
+    for (const_reference element: other) { (void) emplace_back(element); }
+  }
+
+  /**
+   * @brief       Move constructor, moves the elements one by one
+   */
+  StaticVector(StaticVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) : StaticVector{} {
+    for (reference element: other) { (void) emplace_back(std::move(element)); }
+    other.clear();
+  }
+
+  /**
+   * @brief       Copy assignment
+   */
+  StaticVector &operator=(StaticVector const &other) {
+    if (this != &other) {
+      clear();
+      for (const_reference element: other) { (void) emplace_back(element); }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief       Move assignment
+   */
+  StaticVector &operator=(StaticVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      clear();
+      for (reference element: other) { (void) emplace_back(std::move(element)); }
+      other.clear();
+    }
+    return *this;
+  }
+
+  /**
+   * @brief       Destruct an instance of StaticVector
+   */
+  ~StaticVector() noexcept { clear(); }
+
+  reference operator[](size_type pos) noexcept { return data()[pos]; }
+
+  const_reference operator[](size_type pos) const noexcept { return data()[pos]; }
+
+  reference front() noexcept { return data()[0U]; }
+
+  const_reference front() const noexcept { return data()[0U]; }
+
+  reference back() noexcept { return data()[size_ - 1U]; }
+
+  const_reference back() const noexcept { return data()[size_ - 1U]; }
+
+  pointer data() noexcept { return std::launder(reinterpret_cast<pointer>(storage_)); }
+
+  const_pointer data() const noexcept { return std::launder(reinterpret_cast<const_pointer>(storage_)); }
+
+  iterator begin() noexcept { return data(); }
+
+  const_iterator begin() const noexcept { return data(); }
+
+  const_iterator cbegin() const noexcept { return data(); }
+
+  iterator end() noexcept { return data() + size_; }
+
+  const_iterator end() const noexcept { return data() + size_; }
+
+  const_iterator cend() const noexcept { return data() + size_; }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+
+  reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+
+  bool empty() const noexcept { return size_ == 0U; }
+
+  size_type size() const noexcept { return size_; }
+
+  static constexpr size_type max_size() noexcept { return kCapacity; }
+
+  static constexpr size_type capacity() noexcept { return kCapacity; }
+
+  /**
+   * @brief       Tell whether no further element fits
+   */
+  bool full() const noexcept { return size_ == kCapacity; }
+
+  /**
+   * @brief       Reserve is a no-op, the storage is always present, kept for compatibility with std::vector
+   */
+  void reserve(size_type new_capacity) const noexcept {
+    assert((new_capacity <= kCapacity) && "StaticVector cannot grow beyond its capacity");
+    static_cast<void>(new_capacity);
+  }
+
+  void clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0U;
+  }
+
+  /**
+   * @brief       Construct an element at the end, the container must not be full
+   */
+  template<typename... Args>
+  reference emplace_back(Args &&...args) {
+    assert(!full() && "StaticVector cannot grow beyond its capacity");
+    pointer const element{::new (static_cast<void *>(data() + size_)) value_type(std::forward<Args>(args)...)};
+    ++size_;
+    return *element;
+  }
+
+  void push_back(const_reference value) { (void) emplace_back(value); }
+
+  void push_back(value_type &&value) { (void) emplace_back(std::move(value)); }
+
+  /**
+   * @brief       Construct an element before pos, the container must not be full
+   */
+  template<typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type const index{static_cast<size_type>(pos - begin())};
+    (void) emplace_back(std::forward<Args>(args)...);
+    std::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+
+  iterator insert(const_iterator pos, value_type &&value) { return emplace(pos, std::move(value)); }
+
+  iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    iterator const first_erased{begin() + (first - begin())};
+    iterator const new_end{std::move(first_erased + (last - first), end(), first_erased)};
+    std::destroy(new_end, end());
+    size_ = static_cast<size_type>(new_end - begin());
+    return first_erased;
+  }
+
+  void pop_back() noexcept {
+    --size_;
+    std::destroy_at(data() + size_);
+  }
+
+ private:
+  /**
+   * @brief       Store the number of elements
+   */
+  size_type size_;
+
+  /**
+   * @brief       Store the elements, only the first size_ are constructed
+   */
+  alignas(T) std::byte storage_[sizeof(T) * kCapacity];
+};
+
+}  // namespace core_type
+
+#endif  // DIAG_CLIENT_LIB_LIB_PLATFORM_CORE_STATIC_VECTOR_H_
@@ -0,0 +1,81 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/include/clock.h"
+
+#include <algorithm>
+
+namespace core_type {
+
+auto Clock::GetSteadyClock() noexcept -> Clock & {
+  static SteadyClock steady_clock{};
+  return steady_clock;
+}
+
+auto SteadyClock::Now() const noexcept -> TimePoint { return std::chrono::steady_clock::now(); }
+
+void SteadyClock::WaitUntil(std::unique_lock<std::mutex> &lock, std::condition_variable &cond_var,
+                            TimePoint deadline) {
+  (void) cond_var.wait_until(lock, deadline);
+}
+
+void SteadyClock::AddWaiter(Waiter &) {}
+
+void SteadyClock::RemoveWaiter(Waiter &) noexcept {}
+
+ManualClock::ManualClock(TimePoint start_time) noexcept
+    : Clock{},
+      now_{start_time.time_since_epoch().count()},
+      waiters_{},
+      waiters_mutex_{},
+      waiting_count_{0U},
+      waiting_mutex_{},
+      waiting_cond_var_{} {}
+
+auto ManualClock::Now() const noexcept -> TimePoint {
+  return TimePoint{Duration{now_.load(std::memory_order_acquire)}};
+}
+
+void ManualClock::WaitUntil(std::unique_lock<std::mutex> &lock, std::condition_variable &cond_var, TimePoint) {
+  {
+    std::lock_guard<std::mutex> const waiting_lock{waiting_mutex_};
+    ++waiting_count_;
+  }
+  waiting_cond_var_.notify_all();
+  // the deadline is re-checked by the caller whenever Advance() wakes it up
+  cond_var.wait(lock);
+  std::lock_guard<std::mutex> const waiting_lock{waiting_mutex_};
+  --waiting_count_;
+}
+
+void ManualClock::AddWaiter(Waiter &waiter) {
+  std::lock_guard<std::mutex> const lock{waiters_mutex_};
+  waiters_.emplace_back(&waiter);
+}
+
+void ManualClock::RemoveWaiter(Waiter &waiter) noexcept {
+  std::lock_guard<std::mutex> const lock{waiters_mutex_};
+  waiters_.erase(std::remove(waiters_.begin(), waiters_.end(), &waiter), waiters_.end());
+}
+
+void ManualClock::Advance(Duration duration) noexcept {
+  std::lock_guard<std::mutex> const lock{waiters_mutex_};
+  (void) now_.fetch_add(duration.count(), std::memory_order_acq_rel);
+  for (Waiter *const waiter: waiters_) { waiter->WakeUp(); }
+}
+
+void ManualClock::WaitForWaiting(std::size_t count) {
+  std::unique_lock<std::mutex> lock{waiting_mutex_};
+  waiting_cond_var_.wait(lock, [this, count]() { return waiting_count_ >= count; });
+}
+
+auto ManualClock::GetWaitingCount() const noexcept -> std::size_t {
+  std::lock_guard<std::mutex> const lock{waiting_mutex_};
+  return waiting_count_;
+}
+
+}  // namespace core_type
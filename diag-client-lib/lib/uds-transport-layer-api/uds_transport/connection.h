@@ -70,6 +70,12 @@ class Connection {
    */
   virtual void Stop() = 0;
 
+  /**
+   * @brief        Function to abort the connection on shutdown
+   * @details      The running and every further wait for a response ends immediately
+   */
+  virtual void Abort() = 0;
+
   /**
    * @brief        Function to check if connected to host remote server
    * @return       True if connection, False otherwise
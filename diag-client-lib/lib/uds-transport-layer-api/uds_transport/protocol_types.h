@@ -15,10 +15,14 @@
 #include <string_view>
 #include <vector>
 
+#include "core/include/small_byte_vector.h"
+
 namespace uds_transport {
 
+// Number of payload bytes kept inside a ByteVector without heap allocation, covers most UDS requests and responses
+constexpr std::size_t kByteVectorInlineCapacity{48U};
 // This is the type of ByteVector
-using ByteVector = std::vector<std::uint8_t>;
+using ByteVector = core_type::SmallByteVector<kByteVectorInlineCapacity>;
 // This is the type of Channel ID
 using ChannelID = uint32_t;
 // This is the type of Priority
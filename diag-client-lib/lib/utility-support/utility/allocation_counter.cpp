@@ -0,0 +1,271 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/allocation_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace utility {
+namespace allocation {
+namespace {
+
+/**
+ * @brief       Counters of one thread and layer, updated by the owning thread and read by any thread
+ */
+struct AtomicAllocationCount {
+  std::atomic<std::uint64_t> allocations{0U};
+  std::atomic<std::uint64_t> deallocations{0U};
+  std::atomic<std::uint64_t> bytes{0U};
+};
+
+/**
+ * @brief       Counters of one thread, split by layer
+ */
+struct ThreadRecord {
+  std::array<AtomicAllocationCount, kLayerCount> layers{};
+};
+
+/**
+ * @brief       Records of all threads, constant initialized so that allocations before main are counted as well
+ */
+std::array<ThreadRecord, kMaxThreadCount> thread_records{};
+
+/**
+ * @brief       Number of threads that claimed a record
+ */
+std::atomic<std::size_t> thread_record_count{0U};
+
+/**
+ * @brief       Record of the calling thread, claimed on first allocation
+ */
+thread_local ThreadRecord *current_record{nullptr};
+
+/**
+ * @brief       Layer of the calling thread
+ */
+thread_local Layer current_layer{Layer::kApplication};
+
+/**
+ * @brief       Function to get the record of the calling thread
+ * @details     Must not allocate, it is called from operator new
+ */
+auto GetCurrentRecord() noexcept -> ThreadRecord & {
+  if (current_record == nullptr) {
+    std::size_t const index{std::min(thread_record_count.fetch_add(1U, std::memory_order_relaxed),
+                                     kMaxThreadCount - 1U)};
+    current_record = &thread_records[index];
+  }
+  return *current_record;
+}
+
+}  // namespace
+
+auto GetLayerName(Layer layer) noexcept -> char const * {
+  switch (layer) {
+    case Layer::kApplication:
+      return "application";
+    case Layer::kDiagClient:
+      return "diag-client";
+    case Layer::kDoipClient:
+      return "doip-client";
+    case Layer::kBoostSupport:
+      return "boost-support";
+    case Layer::kUtility:
+      return "utility-support";
+    default:
+      return "unknown";
+  }
+}
+
+auto GetLayerCount(Layer layer) noexcept -> AllocationCount {
+  AllocationCount count{};
+  std::size_t const layer_index{static_cast<std::size_t>(layer)};
+  if (layer_index < kLayerCount) {
+    for (std::size_t index{0U}; index < GetThreadCount(); ++index) {
+      AtomicAllocationCount const &thread_count{thread_records[index].layers[layer_index]};
+      count.allocations += thread_count.allocations.load(std::memory_order_relaxed);
+      count.deallocations += thread_count.deallocations.load(std::memory_order_relaxed);
+      count.bytes += thread_count.bytes.load(std::memory_order_relaxed);
+    }
+  }
+  return count;
+}
+
+auto GetThreadCount() noexcept -> std::size_t {
+  return std::min(thread_record_count.load(std::memory_order_relaxed), kMaxThreadCount);
+}
+
+auto GetThreadAllocationCount(std::size_t index) noexcept -> std::optional<ThreadAllocationCount> {
+  std::optional<ThreadAllocationCount> result{};
+  if (index < GetThreadCount()) {
+    ThreadAllocationCount count{};
+    count.thread_id = static_cast<std::uint32_t>(index + 1U);
+    for (std::size_t layer_index{0U}; layer_index < kLayerCount; ++layer_index) {
+      AtomicAllocationCount const &thread_count{thread_records[index].layers[layer_index]};
+      count.layers[layer_index].allocations = thread_count.allocations.load(std::memory_order_relaxed);
+      count.layers[layer_index].deallocations = thread_count.deallocations.load(std::memory_order_relaxed);
+      count.layers[layer_index].bytes = thread_count.bytes.load(std::memory_order_relaxed);
+    }
+    result.emplace(count);
+  }
+  return result;
+}
+
+auto GetCurrentThreadId() noexcept -> std::uint32_t {
+  std::uint32_t thread_id{0U};
+  if constexpr (kAllocationCounterCompiled) {
+    thread_id = static_cast<std::uint32_t>((&GetCurrentRecord() - thread_records.data()) + 1);
+  }
+  return thread_id;
+}
+
+namespace details {
+
+auto ExchangeLayer(Layer layer) noexcept -> Layer { return std::exchange(current_layer, layer); }
+
+}  // namespace details
+
+#ifdef ENABLE_ALLOCATION_COUNTER
+namespace {
+
+/**
+ * @brief       Function to get the counters of the calling thread and its current layer
+ */
+auto GetCurrentCount() noexcept -> AtomicAllocationCount & {
+  return GetCurrentRecord().layers[static_cast<std::size_t>(current_layer)];
+}
+
+/**
+ * @brief       Function to count one allocation of the calling thread
+ */
+void CountAllocation(std::size_t size) noexcept {
+  AtomicAllocationCount &count{GetCurrentCount()};
+  count.allocations.fetch_add(1U, std::memory_order_relaxed);
+  count.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+/**
+ * @brief       Function to count one deallocation of the calling thread
+ */
+void CountDeallocation(void const *pointer) noexcept {
+  if (pointer != nullptr) { GetCurrentCount().deallocations.fetch_add(1U, std::memory_order_relaxed); }
+}
+
+/**
+ * @brief       Function to allocate memory like operator new does, retrying through the new handler
+ * @return      The memory, nullptr when no memory is available and no new handler is installed
+ */
+auto Allocate(std::size_t size, std::size_t alignment) noexcept -> void * {
+  // aligned_alloc requires the size to be a multiple of alignment
+  std::size_t const aligned_size{(std::max<std::size_t>(size, 1U) + alignment - 1U) & ~(alignment - 1U)};
+  void *pointer{nullptr};
+  while (pointer == nullptr) {
+    pointer = (alignment <= alignof(std::max_align_t)) ? std::malloc(aligned_size)
+                                                       : std::aligned_alloc(alignment, aligned_size);
+    if (pointer == nullptr) {
+      std::new_handler const handler{std::get_new_handler()};
+      if (handler == nullptr) { break; }
+      try {
+        handler();
+      } catch (...) { break; }
+    }
+  }
+  if (pointer != nullptr) { CountAllocation(size); }
+  return pointer;
+}
+
+/**
+ * @brief       Function to release memory allocated by Allocate()
+ */
+void Deallocate(void *pointer) noexcept {
+  CountDeallocation(pointer);
+  std::free(pointer);
+}
+
+}  // namespace
+#endif
+}  // namespace allocation
+}  // namespace utility
+
+#ifdef ENABLE_ALLOCATION_COUNTER
+// Replacements of the global allocation functions, active for the whole process linking this library
+void *operator new(std::size_t size) {
+  void *pointer{utility::allocation::Allocate(size, alignof(std::max_align_t))};
+  if (pointer == nullptr) { throw std::bad_alloc{}; }
+  return pointer;
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  void *pointer{utility::allocation::Allocate(size, static_cast<std::size_t>(alignment))};
+  if (pointer == nullptr) { throw std::bad_alloc{}; }
+  return pointer;
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+
+void *operator new(std::size_t size, std::nothrow_t const &) noexcept {
+  return utility::allocation::Allocate(size, alignof(std::max_align_t));
+}
+
+void *operator new[](std::size_t size, std::nothrow_t const &) noexcept {
+  return utility::allocation::Allocate(size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const &) noexcept {
+  return utility::allocation::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const &) noexcept {
+  return utility::allocation::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept { utility::allocation::Deallocate(pointer); }
+
+void operator delete[](void *pointer) noexcept { utility::allocation::Deallocate(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { utility::allocation::Deallocate(pointer); }
+
+void operator delete[](void *pointer, std::size_t) noexcept { utility::allocation::Deallocate(pointer); }
+
+void operator delete(void *pointer, std::align_val_t) noexcept { utility::allocation::Deallocate(pointer); }
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::nothrow_t const &) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::nothrow_t const &) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t, std::nothrow_t const &) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t, std::nothrow_t const &) noexcept {
+  utility::allocation::Deallocate(pointer);
+}
+#endif
@@ -0,0 +1,178 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ALLOCATION_COUNTER_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ALLOCATION_COUNTER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace utility {
+namespace allocation {
+
+/**
+ * @brief  Flag telling whether the global operator new is instrumented, all functions are no-ops otherwise
+ */
+#ifdef ENABLE_ALLOCATION_COUNTER
+constexpr bool kAllocationCounterCompiled{true};
+#else
+constexpr bool kAllocationCounterCompiled{false};
+#endif
+
+/**
+ * @brief  Definition of the library layers allocations are attributed to
+ */
+enum class Layer : std::uint8_t {
+  kApplication = 0U, /**< Code outside of the library, default of every thread */
+  kDiagClient,       /**< Diag client api, conversations and dcm */
+  kDoipClient,       /**< DoIP protocol handling */
+  kBoostSupport,     /**< Sockets and io threads */
+  kUtility,          /**< Logging backends */
+  kCount             /**< Number of layers, not a layer */
+};
+
+/**
+ * @brief  Number of layers
+ */
+constexpr std::size_t kLayerCount{static_cast<std::size_t>(Layer::kCount)};
+
+/**
+ * @brief  Maximum number of threads counted separately, allocations of further threads are added to the last one
+ */
+constexpr std::size_t kMaxThreadCount{64U};
+
+/**
+ * @brief  Counters of one thread and layer, or of a sum of them
+ */
+struct AllocationCount {
+  /**
+   * @brief  Number of calls to operator new
+   */
+  std::uint64_t allocations{0U};
+
+  /**
+   * @brief  Number of calls to operator delete with a non-null pointer
+   */
+  std::uint64_t deallocations{0U};
+
+  /**
+   * @brief  Number of bytes requested from operator new
+   */
+  std::uint64_t bytes{0U};
+};
+
+/**
+ * @brief  Counters of one thread, split by layer
+ */
+struct ThreadAllocationCount {
+  /**
+   * @brief  The identifier of thread, in order of first allocation starting at 1
+   */
+  std::uint32_t thread_id{0U};
+
+  /**
+   * @brief  The counters per layer, indexed by Layer
+   */
+  std::array<AllocationCount, kLayerCount> layers{};
+};
+
+/**
+ * @brief       Function to get the name of a layer
+ * @param[in]   layer
+ *              The layer
+ * @return      The name of layer
+ */
+auto GetLayerName(Layer layer) noexcept -> char const *;
+
+/**
+ * @brief       Function to get the counters of one layer summed over all threads
+ * @param[in]   layer
+ *              The layer
+ * @return      The counters, all zero when instrumentation is not compiled in
+ */
+auto GetLayerCount(Layer layer) noexcept -> AllocationCount;
+
+/**
+ * @brief       Function to get the number of threads that allocated memory so far
+ * @return      The number of threads, at most kMaxThreadCount
+ */
+auto GetThreadCount() noexcept -> std::size_t;
+
+/**
+ * @brief       Function to get the counters of one thread
+ * @param[in]   index
+ *              The index of thread, lower than GetThreadCount()
+ * @return      The counters, empty for an invalid index
+ */
+auto GetThreadAllocationCount(std::size_t index) noexcept -> std::optional<ThreadAllocationCount>;
+
+/**
+ * @brief       Function to get the identifier the calling thread is counted under
+ * @return      The identifier, 0 when instrumentation is not compiled in
+ */
+auto GetCurrentThreadId() noexcept -> std::uint32_t;
+
+namespace details {
+
+/**
+ * @brief       Function to set the layer of the calling thread
+ * @param[in]   layer
+ *              The new layer
+ * @return      The previous layer
+ */
+auto ExchangeLayer(Layer layer) noexcept -> Layer;
+
+}  // namespace details
+
+/**
+ * @brief       Attribute all allocations of the calling thread to a layer until the end of the enclosing scope
+ * @details     Placed at the entry points of a layer and at the start of threads owned by a layer. Scopes nest, the
+ *              previous layer is restored on destruction.
+ */
+class LayerScope final {
+ public:
+  /**
+   * @brief       Enter the layer
+   * @param[in]   layer
+   *              The layer
+   */
+  explicit LayerScope(Layer layer) noexcept : previous_layer_{layer} {
+    if constexpr (kAllocationCounterCompiled) { previous_layer_ = details::ExchangeLayer(layer); }
+  }
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  LayerScope(const LayerScope &other) noexcept = delete;
+  LayerScope &operator=(const LayerScope &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  LayerScope(LayerScope &&other) noexcept = delete;
+  LayerScope &operator=(LayerScope &&other) noexcept = delete;
+
+  /**
+   * @brief       Restore the previous layer
+   */
+  ~LayerScope() noexcept {
+    if constexpr (kAllocationCounterCompiled) { static_cast<void>(details::ExchangeLayer(previous_layer_)); }
+  }
+
+ private:
+  /**
+   * @brief       Store the layer active before this scope
+   */
+  Layer previous_layer_;
+};
+
+}  // namespace allocation
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ALLOCATION_COUNTER_H
@@ -0,0 +1,313 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/async_log_backend.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <ctime>
+
+#include "utility/allocation_counter.h"
+
+namespace utility {
+namespace logger {
+namespace {
+
+/**
+ * @brief  Interval in which the formatting thread polls the rings when idle
+ */
+constexpr std::chrono::milliseconds kDrainInterval{10U};
+
+/**
+ * @brief       Function to get the printable name of a log level
+ */
+auto GetLogLevelName(LogLevel level) noexcept -> std::string_view {
+  switch (level) {
+    case LogLevel::kFatal:
+      return "fatal  ";
+    case LogLevel::kError:
+      return "error  ";
+    case LogLevel::kWarn:
+      return "warn   ";
+    case LogLevel::kInfo:
+      return "info   ";
+    case LogLevel::kDebug:
+      return "debug  ";
+    case LogLevel::kVerbose:
+      return "verbose";
+    default:
+      return "off    ";
+  }
+}
+
+/**
+ * @brief       Function to append an integer value to the line
+ */
+template<typename T>
+void AppendNumber(T value, std::string &line, int width = 0) {
+  std::array<char, 32U> buffer{};
+  auto const result{std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)};
+  std::size_t const length{static_cast<std::size_t>(result.ptr - buffer.data())};
+  if (static_cast<std::size_t>(width) > length) { line.append(static_cast<std::size_t>(width) - length, '0'); }
+  line.append(buffer.data(), length);
+}
+
+/**
+ * @brief       Function to append the wall clock time stamp in "YYYY-MM-DD hh:mm:ss.uuuuuu" format
+ */
+void AppendTimestamp(std::int64_t timestamp_ns, std::string &line) {
+  std::time_t const seconds{static_cast<std::time_t>(timestamp_ns / 1'000'000'000)};
+  std::tm local_time{};
+  localtime_r(&seconds, &local_time);
+  AppendNumber(local_time.tm_year + 1900, line, 4);
+  line.push_back('-');
+  AppendNumber(local_time.tm_mon + 1, line, 2);
+  line.push_back('-');
+  AppendNumber(local_time.tm_mday, line, 2);
+  line.push_back(' ');
+  AppendNumber(local_time.tm_hour, line, 2);
+  line.push_back(':');
+  AppendNumber(local_time.tm_min, line, 2);
+  line.push_back(':');
+  AppendNumber(local_time.tm_sec, line, 2);
+  line.push_back('.');
+  AppendNumber((timestamp_ns % 1'000'000'000) / 1'000, line, 6);
+}
+
+/**
+ * @brief       Function to decode the next argument of a record and append it to the line
+ * @return      std::size_t
+ *              The offset of the following argument, or the arguments size when nothing was decoded
+ */
+auto AppendArgument(const LogRecord &record, std::size_t offset, std::string &line) -> std::size_t {
+  std::size_t const end{record.arguments_size};
+  if (offset >= end) { return end; }
+  const std::uint8_t *const data{&record.arguments[offset]};
+  auto const read = [data](std::size_t position, auto &value) {
+    std::memcpy(&value, data + position, sizeof(value));
+    return position + sizeof(value);
+  };
+  std::size_t position{1U};
+  switch (static_cast<LogArgumentType>(data[0U])) {
+    case LogArgumentType::kSigned: {
+      std::int64_t value{};
+      position = read(position, value);
+      AppendNumber(value, line);
+    } break;
+    case LogArgumentType::kUnsigned: {
+      std::uint64_t value{};
+      position = read(position, value);
+      AppendNumber(value, line);
+    } break;
+    case LogArgumentType::kDouble: {
+      double value{};
+      position = read(position, value);
+      std::array<char, 32U> buffer{};
+      int const length{std::snprintf(buffer.data(), buffer.size(), "%g", value)};
+      line.append(buffer.data(), static_cast<std::size_t>(std::max(length, 0)));
+    } break;
+    case LogArgumentType::kBool: {
+      bool value{};
+      position = read(position, value);
+      line.append(value ? "true" : "false");
+    } break;
+    case LogArgumentType::kChar: {
+      char value{};
+      position = read(position, value);
+      line.push_back(value);
+    } break;
+    case LogArgumentType::kString: {
+      std::uint16_t length{};
+      position = read(position, length);
+      line.append(reinterpret_cast<const char *>(data + position), length);
+      position += length;
+    } break;
+    default:
+      return end;
+  }
+  return offset + position;
+}
+
+}  // namespace
+
+StreamLogSink::StreamLogSink(std::FILE *stream) noexcept : stream_{stream} {}
+
+StreamLogSink::~StreamLogSink() { Flush(); }
+
+void StreamLogSink::Write(std::string_view line) noexcept { std::fwrite(line.data(), 1U, line.size(), stream_); }
+
+void StreamLogSink::Flush() noexcept { std::fflush(stream_); }
+
+FileLogSink::FileLogSink(std::string_view file_path) noexcept
+    : file_{std::fopen(std::string{file_path}.c_str(), "a")} {}
+
+FileLogSink::~FileLogSink() {
+  if (file_ != nullptr) { std::fclose(file_); }
+}
+
+void FileLogSink::Write(std::string_view line) noexcept {
+  std::fwrite(line.data(), 1U, line.size(), file_ != nullptr ? file_ : stderr);
+}
+
+void FileLogSink::Flush() noexcept { std::fflush(file_ != nullptr ? file_ : stderr); }
+
+auto AsyncLogBackend::GetInstance() noexcept -> AsyncLogBackend & {
+  static AsyncLogBackend async_log_backend_;
+  return async_log_backend_;
+}
+
+AsyncLogBackend::AsyncLogBackend()
+    : rings_{},
+      rings_mutex_{},
+      rings_generation_{0U},
+      drained_rings_{},
+      drained_rings_generation_{0U},
+      drain_mutex_{},
+      sink_{std::make_unique<StreamLogSink>(stdout)},
+      line_{},
+      dropped_count_{0U},
+      reported_dropped_count_{0U},
+      exit_request_{false},
+      cond_var_{},
+      mutex_lock_{},
+      thread_{} {
+  thread_ = std::thread([this]() {
+    allocation::LayerScope const layer_scope{allocation::Layer::kUtility};
+    std::unique_lock<std::mutex> lck(mutex_lock_);
+    while (!exit_request_.load()) {
+      lck.unlock();
+      {
+        std::lock_guard<std::mutex> const drain_lck{drain_mutex_};
+        if (Drain() != 0U) { sink_->Flush(); }
+      }
+      lck.lock();
+      cond_var_.wait_for(lck, kDrainInterval, [this]() { return exit_request_.load(); });
+    }
+  });
+}
+
+AsyncLogBackend::~AsyncLogBackend() {
+  {
+    std::lock_guard<std::mutex> const lck{mutex_lock_};
+    exit_request_.store(true);
+    cond_var_.notify_all();
+  }
+  thread_.join();
+  Flush();
+}
+
+auto AsyncLogBackend::GetThreadRing() noexcept -> ThreadRing * {
+  struct ThreadRingOwner {
+    ~ThreadRingOwner() {
+      if (thread_ring) { thread_ring->orphaned.store(true, std::memory_order_release); }
+    }
+
+    std::shared_ptr<ThreadRing> thread_ring{};
+  };
+
+  thread_local ThreadRingOwner owner{};
+  if (!owner.thread_ring) {
+    owner.thread_ring = std::make_shared<ThreadRing>();
+    std::lock_guard<std::mutex> const lck{rings_mutex_};
+    rings_.emplace_back(owner.thread_ring);
+    rings_generation_.fetch_add(1U, std::memory_order_release);
+  }
+  return owner.thread_ring.get();
+}
+
+auto AsyncLogBackend::AcquireRecord() noexcept -> LogRecord * {
+  LogRecord *const record{GetThreadRing()->ring.Reserve()};
+  if (record == nullptr) { dropped_count_.fetch_add(1U, std::memory_order_relaxed); }
+  return record;
+}
+
+void AsyncLogBackend::CommitRecord() noexcept { GetThreadRing()->ring.Commit(); }
+
+void AsyncLogBackend::SetSink(std::unique_ptr<LogSink> sink) noexcept {
+  std::lock_guard<std::mutex> const drain_lck{drain_mutex_};
+  Drain();
+  sink_->Flush();
+  if (sink) { sink_ = std::move(sink); }
+}
+
+void AsyncLogBackend::Flush() noexcept {
+  std::lock_guard<std::mutex> const drain_lck{drain_mutex_};
+  Drain();
+  sink_->Flush();
+}
+
+auto AsyncLogBackend::GetDroppedCount() const noexcept -> std::uint64_t {
+  return dropped_count_.load(std::memory_order_relaxed);
+}
+
+auto AsyncLogBackend::Drain() noexcept -> std::size_t {
+  // the snapshot is only refreshed when a producer thread registered its ring since the last drain
+  if (rings_generation_.load(std::memory_order_acquire) != drained_rings_generation_) {
+    std::lock_guard<std::mutex> const lck{rings_mutex_};
+    drained_rings_ = rings_;
+    drained_rings_generation_ = rings_generation_.load(std::memory_order_relaxed);
+  }
+  std::size_t formatted_records{0U};
+  for (auto iter = drained_rings_.begin(); iter != drained_rings_.end();) {
+    ThreadRing &thread_ring{**iter};
+    // read the orphaned flag before draining, so that records committed before thread exit are not lost
+    bool const orphaned{thread_ring.orphaned.load(std::memory_order_acquire)};
+    while (LogRecord *const record = thread_ring.ring.Front()) {
+      line_.clear();
+      FormatRecord(*record, line_);
+      thread_ring.ring.Pop();
+      line_.push_back('\n');
+      sink_->Write(line_);
+      ++formatted_records;
+    }
+    if (orphaned) {
+      {
+        std::lock_guard<std::mutex> const lck{rings_mutex_};
+        rings_.erase(std::remove(rings_.begin(), rings_.end(), *iter), rings_.end());
+      }
+      iter = drained_rings_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  std::uint64_t const dropped_count{dropped_count_.load(std::memory_order_relaxed)};
+  if (dropped_count != reported_dropped_count_) {
+    line_.assign("log records dropped: ");
+    AppendNumber(dropped_count - reported_dropped_count_, line_);
+    line_.push_back('\n');
+    sink_->Write(line_);
+    reported_dropped_count_ = dropped_count;
+  }
+  return formatted_records;
+}
+
+void AsyncLogBackend::FormatRecord(const LogRecord &record, std::string &line) {
+  AppendTimestamp(record.timestamp_ns, line);
+  line.push_back(' ');
+  line.append(record.context.data(), record.context_size);
+  line.push_back(' ');
+  line.append(GetLogLevelName(record.level));
+  line.push_back(' ');
+  std::size_t argument_offset{0U};
+  std::string_view format{record.format};
+  for (std::size_t pos{format.find("{}")}; pos != std::string_view::npos; pos = format.find("{}")) {
+    line.append(format.substr(0U, pos));
+    argument_offset = AppendArgument(record, argument_offset, line);
+    format.remove_prefix(pos + 2U);
+  }
+  line.append(format);
+  line.append(" [");
+  line.append(record.file_name);
+  line.push_back(':');
+  AppendNumber(record.line_no, line);
+  line.push_back(']');
+}
+
+}  // namespace logger
+}  // namespace utility
@@ -0,0 +1,312 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ASYNC_LOG_BACKEND_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ASYNC_LOG_BACKEND_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "utility/log_record.h"
+#include "utility/spsc_ring_buffer.h"
+
+namespace utility {
+namespace logger {
+
+/**
+ * @brief       Interface of a destination for formatted log lines
+ */
+class LogSink {
+ public:
+  /**
+   * @brief       Construct an instance of LogSink
+   */
+  LogSink() noexcept = default;
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  LogSink(const LogSink &other) noexcept = delete;
+  LogSink &operator=(const LogSink &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  LogSink(LogSink &&other) noexcept = delete;
+  LogSink &operator=(LogSink &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of LogSink
+   */
+  virtual ~LogSink() = default;
+
+  /**
+   * @brief       Write one formatted line, including the trailing new line
+   * @param[in]   line
+   *              The formatted line
+   */
+  virtual void Write(std::string_view line) noexcept = 0;
+
+  /**
+   * @brief       Flush all buffered lines to the destination
+   */
+  virtual void Flush() noexcept = 0;
+};
+
+/**
+ * @brief       Log sink writing to a C stream, used for stdout
+ */
+class StreamLogSink final : public LogSink {
+ public:
+  /**
+   * @brief       Construct an instance of StreamLogSink
+   * @param[in]   stream
+   *              The stream to write to, ownership is not transferred
+   */
+  explicit StreamLogSink(std::FILE *stream) noexcept;
+
+  /**
+   * @brief       Destruct an instance of StreamLogSink
+   */
+  ~StreamLogSink() override;
+
+  void Write(std::string_view line) noexcept override;
+
+  void Flush() noexcept override;
+
+ private:
+  /**
+   * @brief       Store the stream
+   */
+  std::FILE *stream_;
+};
+
+/**
+ * @brief       Log sink appending to a file
+ * @details     When the file cannot be opened the lines are written to stderr instead
+ */
+class FileLogSink final : public LogSink {
+ public:
+  /**
+   * @brief       Construct an instance of FileLogSink
+   * @param[in]   file_path
+   *              The path of the log file
+   */
+  explicit FileLogSink(std::string_view file_path) noexcept;
+
+  /**
+   * @brief       Destruct an instance of FileLogSink
+   */
+  ~FileLogSink() override;
+
+  void Write(std::string_view line) noexcept override;
+
+  void Flush() noexcept override;
+
+ private:
+  /**
+   * @brief       Store the opened file, nullptr on failure
+   */
+  std::FILE *file_;
+};
+
+/**
+ * @brief       Asynchronous logging backend
+ * @details     Every producer thread owns a lock-free single producer single consumer ring of binary log records.
+ *              A background thread drains all rings, formats the records and hands the lines over to the log sink.
+ *              A record is dropped (and counted) when the ring of the producer is full, producers never block.
+ */
+class AsyncLogBackend final {
+ public:
+  /**
+   * @brief  Number of records buffered per producer thread
+   */
+  static constexpr std::size_t kRingCapacity{512U};
+
+  /**
+   * @brief  Type alias of the per thread ring
+   */
+  using RecordRing = ring_buffer::SpscRingBuffer<LogRecord, kRingCapacity>;
+
+  /**
+   * @brief       Get the backend instance
+   * @return      AsyncLogBackend
+   *              The singleton instance
+   */
+  static auto GetInstance() noexcept -> AsyncLogBackend &;
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  AsyncLogBackend(const AsyncLogBackend &other) noexcept = delete;
+  AsyncLogBackend &operator=(const AsyncLogBackend &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  AsyncLogBackend(AsyncLogBackend &&other) noexcept = delete;
+  AsyncLogBackend &operator=(AsyncLogBackend &&other) noexcept = delete;
+
+  /**
+   * @brief       Reserve a record in the ring of the calling thread
+   * @return      LogRecord *
+   *              The record to be filled, nullptr when the ring is full
+   */
+  auto AcquireRecord() noexcept -> LogRecord *;
+
+  /**
+   * @brief       Publish the record previously returned by AcquireRecord() on the calling thread
+   */
+  void CommitRecord() noexcept;
+
+  /**
+   * @brief       Replace the log sink, default sink writes to stdout
+   * @param[in]   sink
+   *              The new log sink
+   */
+  void SetSink(std::unique_ptr<LogSink> sink) noexcept;
+
+  /**
+   * @brief       Synchronously format all pending records and flush the sink
+   */
+  void Flush() noexcept;
+
+  /**
+   * @brief       Get the number of records dropped because a ring was full
+   */
+  auto GetDroppedCount() const noexcept -> std::uint64_t;
+
+  /**
+   * @brief       Function to format a record into a text line without trailing new line
+   * @param[in]   record
+   *              The record to be formatted
+   * @param[out]  line
+   *              The formatted line, appended to
+   */
+  static void FormatRecord(const LogRecord &record, std::string &line);
+
+ private:
+  /**
+   * @brief       Ring owned by one producer thread
+   */
+  struct ThreadRing {
+    /**
+     * @brief  The ring with records
+     */
+    RecordRing ring{};
+
+    /**
+     * @brief  Set once the producer thread exited, the ring is released after it was drained
+     */
+    std::atomic<bool> orphaned{false};
+  };
+
+  /**
+   * @brief       Construct an instance of AsyncLogBackend and start the formatting thread
+   */
+  AsyncLogBackend();
+
+  /**
+   * @brief       Destruct an instance of AsyncLogBackend, pending records are flushed
+   */
+  ~AsyncLogBackend();
+
+  /**
+   * @brief       Get the ring of the calling thread, registers a new ring on first use
+   */
+  auto GetThreadRing() noexcept -> ThreadRing *;
+
+  /**
+   * @brief       Function to format and write all pending records, must be called with drain_mutex_ held
+   * @return      std::size_t
+   *              The number of formatted records
+   */
+  auto Drain() noexcept -> std::size_t;
+
+  /**
+   * @brief       Store all registered rings
+   */
+  std::vector<std::shared_ptr<ThreadRing>> rings_;
+
+  /**
+   * @brief       The mutex protecting the registered rings
+   */
+  std::mutex rings_mutex_;
+
+  /**
+   * @brief       Store the number of ring registrations, tells the formatting side to refresh its snapshot
+   */
+  std::atomic<std::uint64_t> rings_generation_;
+
+  /**
+   * @brief       Store the snapshot of the registered rings drained by the formatting side, guarded by drain_mutex_
+   */
+  std::vector<std::shared_ptr<ThreadRing>> drained_rings_;
+
+  /**
+   * @brief       Store the registration count the snapshot was taken at, guarded by drain_mutex_
+   */
+  std::uint64_t drained_rings_generation_;
+
+  /**
+   * @brief       The mutex serializing the consumer side and the sink
+   */
+  std::mutex drain_mutex_;
+
+  /**
+   * @brief       Store the log sink
+   */
+  std::unique_ptr<LogSink> sink_;
+
+  /**
+   * @brief       Store the reusable line buffer
+   */
+  std::string line_;
+
+  /**
+   * @brief       Store the number of dropped records
+   */
+  std::atomic<std::uint64_t> dropped_count_;
+
+  /**
+   * @brief       Store the number of dropped records already reported to the sink
+   */
+  std::uint64_t reported_dropped_count_;
+
+  /**
+   * @brief       The flag to terminate the formatting thread
+   */
+  std::atomic<bool> exit_request_;
+
+  /**
+   * @brief       The conditional variable to wake up the formatting thread
+   */
+  std::condition_variable cond_var_;
+
+  /**
+   * @brief       The mutex for the conditional variable
+   */
+  std::mutex mutex_lock_;
+
+  /**
+   * @brief       Store the formatting thread
+   */
+  std::thread thread_;
+};
+
+}  // namespace logger
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_ASYNC_LOG_BACKEND_H
@@ -14,6 +14,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <utility>
 
 namespace utility {
 namespace executor {
@@ -30,11 +31,12 @@ class Executor {
         if (running_) {
           std::unique_lock<std::mutex> lck(mutex_lock_);
           while (!queue_.empty()) {
-            auto func = queue_.front();
+            // moved out, so that move-only handlers are supported
+            ExecutorHandler func{std::move(queue_.front())};
+            queue_.pop();
             lck.unlock();
             func();
             lck.lock();
-            queue_.pop();
           }
           running_.store(false);
         }
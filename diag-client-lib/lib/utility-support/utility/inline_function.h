@@ -0,0 +1,217 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_INLINE_FUNCTION_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_INLINE_FUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace utility {
+namespace function {
+
+/**
+ * @brief       Capacity in bytes used for handlers capturing a few pointers
+ */
+constexpr std::size_t kDefaultInlineCapacity{4U * sizeof(void *)};
+
+/**
+ * @brief       Declaration of InlineFunction, only defined for function types
+ */
+template<typename Signature, std::size_t kCapacity>
+class InlineFunction;
+
+/**
+ * @brief       Move-only function wrapper storing the callable inside the object, it never allocates
+ * @details     A callable not fitting into kCapacity bytes is rejected at compile time instead of being allocated.
+ *              Moving transfers the callable and leaves the source empty, a copy is never made.
+ * @tparam      R
+ *              The return type
+ * @tparam      Args
+ *              The argument types
+ * @tparam      kCapacity
+ *              The storage size in bytes for the callable
+ */
+template<typename R, typename... Args, std::size_t kCapacity>
+class InlineFunction<R(Args...), kCapacity> final {
+ public:
+  /**
+   * @brief       Construct an empty function
+   */
+  InlineFunction() noexcept : storage_{}, operations_{nullptr} {}
+
+  /**
+   * @brief       Construct an empty function
+   */
+  InlineFunction(std::nullptr_t) noexcept : InlineFunction{} {}
+
+  /**
+   * @brief       Construct a function holding the callable
+   * @tparam      Callable
+   *              The callable type, must be nothrow move constructible
+   * @param[in]   callable
+   *              The callable, moved or copied into the storage
+   */
+  template<typename Callable,
+           typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InlineFunction> &&
+                                       std::is_invocable_r_v<R, std::decay_t<Callable> &, Args...>>>
+  InlineFunction(Callable &&callable) noexcept(std::is_nothrow_constructible_v<std::decay_t<Callable>, Callable &&>)
+      : storage_{},
+        operations_{&kOperations<std::decay_t<Callable>>} {
+    using Function = std::decay_t<Callable>;
+    static_assert(sizeof(Function) <= kCapacity, "Callable does not fit into the inline storage");
+    static_assert(alignof(Function) <= alignof(Storage), "Callable is over-aligned for the inline storage");
+    static_assert(std::is_nothrow_move_constructible_v<Function>, "Callable must be nothrow move constructible");
+    ::new (static_cast<void *>(&storage_)) Function(std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  InlineFunction(const InlineFunction &other) = delete;
+  InlineFunction &operator=(const InlineFunction &other) = delete;
+
+  /**
+   * @brief       Move the callable of other function, which is left empty
+   * @param[in]   other
+   *              The function moved from
+   */
+  InlineFunction(InlineFunction &&other) noexcept : storage_{}, operations_{other.operations_} {
+    if (operations_ != nullptr) {
+      operations_->move(&storage_, &other.storage_);
+      other.operations_ = nullptr;
+    }
+  }
+
+  /**
+   * @brief       Destroy the held callable and move the callable of other function, which is left empty
+   * @param[in]   other
+   *              The function moved from
+   * @return      The reference to this function
+   */
+  InlineFunction &operator=(InlineFunction &&other) noexcept {
+    if (this != &other) {
+      Reset();
+      if (other.operations_ != nullptr) {
+        other.operations_->move(&storage_, &other.storage_);
+        operations_ = other.operations_;
+        other.operations_ = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief       Destroy the held callable
+   * @return      The reference to this function
+   */
+  InlineFunction &operator=(std::nullptr_t) noexcept {
+    Reset();
+    return *this;
+  }
+
+  /**
+   * @brief       Destruct an instance of InlineFunction
+   */
+  ~InlineFunction() noexcept { Reset(); }
+
+  /**
+   * @brief       Check whether a callable is held
+   * @return      True when a callable is held, otherwise false
+   */
+  explicit operator bool() const noexcept { return operations_ != nullptr; }
+
+  /**
+   * @brief       Call the held callable, the function must not be empty
+   * @param[in]   args
+   *              The arguments passed to the callable
+   * @return      The result of the callable
+   */
+  R operator()(Args... args) { return operations_->invoke(&storage_, std::forward<Args>(args)...); }
+
+ private:
+  /**
+   * @brief       Type alias of the storage for the callable
+   */
+  using Storage = std::aligned_storage_t<kCapacity, alignof(std::max_align_t)>;
+
+  /**
+   * @brief       Operations on the held callable, one static table per callable type
+   */
+  struct Operations {
+    R (*invoke)(void *storage, Args &&...args);
+    void (*move)(void *destination, void *source) noexcept;
+    void (*destroy)(void *storage) noexcept;
+  };
+
+  /**
+   * @brief       Function to get the held callable of the storage
+   */
+  template<typename Function>
+  static auto Get(void *storage) noexcept -> Function & {
+    return *std::launder(static_cast<Function *>(storage));
+  }
+
+  /**
+   * @brief       Function to call the held callable
+   */
+  template<typename Function>
+  static R Invoke(void *storage, Args &&...args) {
+    return std::invoke(Get<Function>(storage), std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief       Function to move the held callable into the destination storage and destroy the source
+   */
+  template<typename Function>
+  static void Move(void *destination, void *source) noexcept {
+    ::new (destination) Function(std::move(Get<Function>(source)));
+    Get<Function>(source).~Function();
+  }
+
+  /**
+   * @brief       Function to destroy the held callable
+   */
+  template<typename Function>
+  static void Destroy(void *storage) noexcept {
+    Get<Function>(storage).~Function();
+  }
+
+  /**
+   * @brief       The operations of each callable type
+   */
+  template<typename Function>
+  static constexpr Operations kOperations{&Invoke<Function>, &Move<Function>, &Destroy<Function>};
+
+  /**
+   * @brief       Function to destroy the held callable, if any
+   */
+  void Reset() noexcept {
+    if (operations_ != nullptr) {
+      operations_->destroy(&storage_);
+      operations_ = nullptr;
+    }
+  }
+
+  /**
+   * @brief       The storage of callable
+   */
+  Storage storage_;
+
+  /**
+   * @brief       The operations of held callable, nullptr when empty
+   */
+  Operations const *operations_;
+};
+
+}  // namespace function
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_INLINE_FUNCTION_H
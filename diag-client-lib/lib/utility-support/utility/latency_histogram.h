@@ -0,0 +1,253 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LATENCY_HISTOGRAM_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace utility {
+namespace metrics {
+
+/**
+ * @brief       Lock-free histogram with logarithmic buckets and linear sub buckets, similar to HdrHistogram
+ * @details     Values below kSubBucketCount are counted exactly, larger values are counted in buckets whose width
+ *              doubles with every power of two. The relative error of every reported value is below
+ *              1 / (kSubBucketCount / 2), about 3 %. Values above kMaxTrackableValue are counted as kMaxTrackableValue.
+ *              Recording only uses relaxed atomic increments, so it may be called from any number of threads.
+ */
+class LatencyHistogram final {
+ public:
+  /**
+   * @brief  Number of bits used for the linear sub buckets
+   */
+  static constexpr std::uint8_t kSubBucketBits{5U};
+
+  /**
+   * @brief  Number of linear sub buckets in the first bucket
+   */
+  static constexpr std::uint64_t kSubBucketCount{1U << kSubBucketBits};
+
+  /**
+   * @brief  Number of linear sub buckets in every further bucket
+   */
+  static constexpr std::uint64_t kSubBucketHalfCount{kSubBucketCount / 2U};
+
+  /**
+   * @brief  Number of bits of the largest value tracked with full precision
+   */
+  static constexpr std::uint8_t kMaxTrackableBits{32U};
+
+  /**
+   * @brief  Largest value tracked with full precision
+   */
+  static constexpr std::uint64_t kMaxTrackableValue{(std::uint64_t{1U} << kMaxTrackableBits) - 1U};
+
+  /**
+   * @brief  Number of buckets needed to cover all values up to kMaxTrackableValue
+   */
+  static constexpr std::size_t kBucketCount{(kMaxTrackableBits - kSubBucketBits + 2U) * kSubBucketHalfCount};
+
+  /**
+   * @brief  Snapshot of the histogram, copied out of the atomic counters
+   */
+  struct Snapshot {
+    /**
+     * @brief  Number of recorded values
+     */
+    std::uint64_t count{};
+
+    /**
+     * @brief  Sum of all recorded values
+     */
+    std::uint64_t sum{};
+
+    /**
+     * @brief  Smallest recorded value, zero when empty
+     */
+    std::uint64_t min{};
+
+    /**
+     * @brief  Largest recorded value, zero when empty
+     */
+    std::uint64_t max{};
+
+    /**
+     * @brief  Count of every bucket
+     */
+    std::array<std::uint64_t, kBucketCount> buckets{};
+
+    /**
+     * @brief       Get the arithmetic mean of all recorded values
+     * @return      double
+     *              The mean, zero when empty
+     */
+    auto GetMean() const noexcept -> double {
+      return count == 0U ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+    }
+
+    /**
+     * @brief       Get the value below or equal to which the given percentage of recorded values lie
+     * @param[in]   percentile
+     *              The percentile in range [0, 100]
+     * @return      std::uint64_t
+     *              The highest value equivalent to the bucket holding the percentile, zero when empty
+     */
+    auto GetValueAtPercentile(double percentile) const noexcept -> std::uint64_t {
+      if (count == 0U) { return 0U; }
+      double const clamped_percentile{std::clamp(percentile, 0.0, 100.0)};
+      std::uint64_t const rank{std::max<std::uint64_t>(
+          1U, static_cast<std::uint64_t>((clamped_percentile / 100.0) * static_cast<double>(count) + 0.5))};
+      std::uint64_t accumulated{0U};
+      for (std::size_t index{0U}; index < buckets.size(); ++index) {
+        accumulated += buckets[index];
+        if (accumulated >= rank) { return std::clamp(GetHighestEquivalentValue(index), min, max); }
+      }
+      return max;
+    }
+  };
+
+  /**
+   * @brief       Construct an empty histogram
+   */
+  LatencyHistogram() noexcept = default;
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  LatencyHistogram(const LatencyHistogram &other) noexcept = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  LatencyHistogram(LatencyHistogram &&other) noexcept = delete;
+  LatencyHistogram &operator=(LatencyHistogram &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of LatencyHistogram
+   */
+  ~LatencyHistogram() noexcept = default;
+
+  /**
+   * @brief       Record one value
+   * @param[in]   value
+   *              The value to be recorded
+   */
+  void Record(std::uint64_t value) noexcept {
+    std::uint64_t const clamped_value{std::min(value, kMaxTrackableValue)};
+    buckets_[GetBucketIndex(clamped_value)].fetch_add(1U, std::memory_order_relaxed);
+    sum_.fetch_add(clamped_value, std::memory_order_relaxed);
+    std::uint64_t current_min{min_.load(std::memory_order_relaxed)};
+    while ((clamped_value < current_min) &&
+           !min_.compare_exchange_weak(current_min, clamped_value, std::memory_order_relaxed)) {}
+    std::uint64_t current_max{max_.load(std::memory_order_relaxed)};
+    while ((clamped_value > current_max) &&
+           !max_.compare_exchange_weak(current_max, clamped_value, std::memory_order_relaxed)) {}
+    // count is published last, so that a snapshot never sees more values than bucket entries
+    count_.fetch_add(1U, std::memory_order_release);
+  }
+
+  /**
+   * @brief       Take a snapshot of the histogram
+   * @details     Recording may continue concurrently, the snapshot then contains a consistent subset of the values
+   *              recorded in the meantime
+   * @return      Snapshot
+   *              The copied histogram
+   */
+  auto TakeSnapshot() const noexcept -> Snapshot {
+    Snapshot snapshot{};
+    snapshot.count = count_.load(std::memory_order_acquire);
+    if (snapshot.count != 0U) {
+      std::uint64_t bucket_total{0U};
+      for (std::size_t index{0U}; index < buckets_.size(); ++index) {
+        snapshot.buckets[index] = buckets_[index].load(std::memory_order_relaxed);
+        bucket_total += snapshot.buckets[index];
+      }
+      snapshot.count = std::min(snapshot.count, bucket_total);
+      snapshot.sum = sum_.load(std::memory_order_relaxed);
+      snapshot.min = min_.load(std::memory_order_relaxed);
+      snapshot.max = max_.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+  /**
+   * @brief       Get the bucket index of a value
+   * @param[in]   value
+   *              The value, must not exceed kMaxTrackableValue
+   * @return      std::size_t
+   *              The index of the bucket counting the value
+   */
+  static constexpr auto GetBucketIndex(std::uint64_t value) noexcept -> std::size_t {
+    if (value < kSubBucketCount) { return static_cast<std::size_t>(value); }
+    std::uint8_t most_significant_bit{0U};
+    std::uint64_t remaining{value};
+    for (std::uint8_t step{32U}; step != 0U; step >>= 1U) {
+      if ((remaining >> step) != 0U) {
+        remaining >>= step;
+        most_significant_bit += step;
+      }
+    }
+    std::uint8_t const shift{static_cast<std::uint8_t>(most_significant_bit - kSubBucketBits + 1U)};
+    return static_cast<std::size_t>((shift * kSubBucketHalfCount) + (value >> shift));
+  }
+
+  /**
+   * @brief       Get the largest value counted by a bucket
+   * @param[in]   index
+   *              The index of the bucket
+   * @return      std::uint64_t
+   *              The largest value mapped to the bucket
+   */
+  static constexpr auto GetHighestEquivalentValue(std::size_t index) noexcept -> std::uint64_t {
+    if (index < kSubBucketCount) { return static_cast<std::uint64_t>(index); }
+    std::uint64_t const shift{(index / kSubBucketHalfCount) - 1U};
+    std::uint64_t const sub_bucket{(index % kSubBucketHalfCount) + kSubBucketHalfCount};
+    return ((sub_bucket + 1U) << shift) - 1U;
+  }
+
+ private:
+  /**
+   * @brief       Store the count of every bucket
+   */
+  std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+
+  /**
+   * @brief       Store the number of recorded values
+   */
+  std::atomic<std::uint64_t> count_{0U};
+
+  /**
+   * @brief       Store the sum of recorded values
+   */
+  std::atomic<std::uint64_t> sum_{0U};
+
+  /**
+   * @brief       Store the smallest recorded value
+   */
+  std::atomic<std::uint64_t> min_{std::numeric_limits<std::uint64_t>::max()};
+
+  /**
+   * @brief       Store the largest recorded value
+   */
+  std::atomic<std::uint64_t> max_{0U};
+};
+
+static_assert(LatencyHistogram::GetBucketIndex(LatencyHistogram::kMaxTrackableValue) + 1U ==
+                  LatencyHistogram::kBucketCount,
+              "Bucket count must cover the largest trackable value");
+
+}  // namespace metrics
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LATENCY_HISTOGRAM_H
@@ -0,0 +1,90 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_FORMAT_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_FORMAT_H
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace utility {
+namespace logger {
+namespace format {
+
+/**
+ * @brief       Append a string argument
+ */
+inline void AppendArgument(std::string &out, std::string_view value) { out.append(value); }
+
+inline void AppendArgument(std::string &out, const char *value) { out.append(value != nullptr ? value : "(null)"); }
+
+inline void AppendArgument(std::string &out, const std::string &value) { out.append(value); }
+
+inline void AppendArgument(std::string &out, bool value) { out.append(value ? "true" : "false"); }
+
+inline void AppendArgument(std::string &out, char value) { out.push_back(value); }
+
+/**
+ * @brief       Append an arithmetic or enum argument without using iostreams
+ */
+template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+void AppendArgument(std::string &out, T value) {
+  if constexpr (std::is_enum_v<T>) {
+    AppendArgument(out, static_cast<std::underlying_type_t<T>>(value));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // std::to_chars of floating point is missing in libstdc++ before GCC 11
+    std::array<char, 32U> buffer{};
+    int const length{std::snprintf(buffer.data(), buffer.size(), "%g", static_cast<double>(value))};
+    out.append(buffer.data(), static_cast<std::size_t>(std::max(length, 0)));
+  } else {
+    std::array<char, 32U> buffer{};
+    // promote 8 bit integers, so that they are printed as numbers
+    auto const result{std::to_chars(buffer.data(), buffer.data() + buffer.size(), +value)};
+    out.append(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+  }
+}
+
+/**
+ * @brief       Function to append the format string to the output, each "{}" is replaced with the next argument
+ * @details     Placeholders without a matching argument are dropped, surplus arguments are ignored
+ * @param[out]  out
+ *              The output string, appended to
+ * @param[in]   format
+ *              The format string
+ * @param[in]   args
+ *              The arguments
+ */
+template<typename... Args>
+void FormatTo(std::string &out, std::string_view format, const Args &...args) {
+  if constexpr (sizeof...(Args) != 0U) {
+    auto const append_next = [&out, &format](const auto &arg) {
+      std::size_t const pos{format.find("{}")};
+      if (pos != std::string_view::npos) {
+        out.append(format.substr(0U, pos));
+        AppendArgument(out, arg);
+        format.remove_prefix(pos + 2U);
+      }
+    };
+    (append_next(args), ...);
+  }
+  for (std::size_t pos{format.find("{}")}; pos != std::string_view::npos; pos = format.find("{}")) {
+    out.append(format.substr(0U, pos));
+    format.remove_prefix(pos + 2U);
+  }
+  out.append(format);
+}
+
+}  // namespace format
+}  // namespace logger
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_FORMAT_H
@@ -0,0 +1,119 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RATE_LIMITER_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RATE_LIMITER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace utility {
+namespace logger {
+
+/**
+ * @brief       Lock-free token bucket limiting the number of messages written by one log site
+ * @details     The bucket holds up to "burst" tokens and regains one token per "refill_interval". It is implemented as
+ *              generic cell rate algorithm, so the whole state is a single atomic time stamp. Rejected messages are
+ *              counted, so that the log site can report how many messages were suppressed.
+ *              Intended usage is one function local static instance per log site.
+ */
+class LogRateLimiter final {
+ public:
+  /**
+   * @brief  Type alias of the clock used for refilling tokens
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief       Construct an instance of LogRateLimiter
+   * @param[in]   burst
+   *              The maximum number of messages written back to back
+   * @param[in]   refill_interval
+   *              The interval after which one more message is allowed
+   */
+  constexpr LogRateLimiter(std::uint32_t burst, std::chrono::milliseconds refill_interval) noexcept
+      : interval_ns_{std::chrono::duration_cast<std::chrono::nanoseconds>(refill_interval).count()},
+        tolerance_ns_{interval_ns_ * static_cast<std::int64_t>(std::max(burst, 1U) - 1U)},
+        theoretical_arrival_ns_{0},
+        suppressed_count_{0U} {}
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  LogRateLimiter(const LogRateLimiter &other) noexcept = delete;
+  LogRateLimiter &operator=(const LogRateLimiter &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  LogRateLimiter(LogRateLimiter &&other) noexcept = delete;
+  LogRateLimiter &operator=(LogRateLimiter &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of LogRateLimiter
+   */
+  ~LogRateLimiter() noexcept = default;
+
+  /**
+   * @brief       Try to take one token from the bucket
+   * @return      bool
+   *              True when the message may be written, false when it must be suppressed
+   */
+  auto TryAcquire() noexcept -> bool {
+    std::int64_t const now_ns{
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count()};
+    std::int64_t arrival_ns{theoretical_arrival_ns_.load(std::memory_order_relaxed)};
+    do {
+      std::int64_t const earliest_ns{std::max(arrival_ns, now_ns)};
+      if ((earliest_ns - now_ns) > tolerance_ns_) {
+        suppressed_count_.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+      }
+      if (theoretical_arrival_ns_.compare_exchange_weak(arrival_ns, earliest_ns + interval_ns_,
+                                                        std::memory_order_relaxed)) {
+        return true;
+      }
+    } while (true);
+  }
+
+  /**
+   * @brief       Get and reset the number of suppressed messages
+   * @return      std::uint64_t
+   *              The number of messages suppressed since the last call
+   */
+  auto TakeSuppressedCount() noexcept -> std::uint64_t {
+    return suppressed_count_.exchange(0U, std::memory_order_relaxed);
+  }
+
+ private:
+  /**
+   * @brief       Store the refill interval in nanoseconds
+   */
+  std::int64_t interval_ns_;
+
+  /**
+   * @brief       Store how far the theoretical arrival time may run ahead of now
+   */
+  std::int64_t tolerance_ns_;
+
+  /**
+   * @brief       Store the theoretical arrival time of the next conforming message
+   */
+  std::atomic<std::int64_t> theoretical_arrival_ns_;
+
+  /**
+   * @brief       Store the number of suppressed messages
+   */
+  std::atomic<std::uint64_t> suppressed_count_;
+};
+
+}  // namespace logger
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RATE_LIMITER_H
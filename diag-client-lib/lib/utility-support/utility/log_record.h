@@ -0,0 +1,312 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RECORD_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RECORD_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace utility {
+namespace logger {
+
+/**
+ * @brief       Definitions of log levels, ordered from most to least severe
+ */
+enum class LogLevel : std::uint8_t { kOff = 0U, kFatal, kError, kWarn, kInfo, kDebug, kVerbose };
+
+/**
+ * @brief       Definitions of the type tags used to encode arguments inside a log record
+ */
+enum class LogArgumentType : std::uint8_t { kSigned = 0U, kUnsigned, kDouble, kBool, kChar, kString };
+
+/**
+ * @brief       Fixed size binary log record that is written by producers and formatted by the logging backend
+ * @details     The file name, function name and format string must refer to static storage (e.g. __FILE__, __func__
+ *              or a string literal), only their views are copied into the record. Arguments are stored type tagged in
+ *              the inline argument area.
+ */
+struct LogRecord final {
+  /**
+   * @brief  Size of the inline argument area in bytes
+   */
+  static constexpr std::size_t kMaxArgumentSize{176U};
+
+  /**
+   * @brief  Maximum length of the context id
+   */
+  static constexpr std::size_t kMaxContextSize{4U};
+
+  /**
+   * @brief  Wall clock time of the log call in nanoseconds since epoch
+   */
+  std::int64_t timestamp_ns{};
+
+  /**
+   * @brief  The file name of the log site
+   */
+  std::string_view file_name{};
+
+  /**
+   * @brief  The function name of the log site
+   */
+  std::string_view func_name{};
+
+  /**
+   * @brief  The format string of the log site, every "{}" is replaced with the next argument
+   */
+  std::string_view format{};
+
+  /**
+   * @brief  The line number of the log site
+   */
+  std::int32_t line_no{};
+
+  /**
+   * @brief  The log level
+   */
+  LogLevel level{LogLevel::kOff};
+
+  /**
+   * @brief  The number of valid characters in context
+   */
+  std::uint8_t context_size{};
+
+  /**
+   * @brief  The number of used bytes in arguments
+   */
+  std::uint16_t arguments_size{};
+
+  /**
+   * @brief  The context id of the logger
+   */
+  std::array<char, kMaxContextSize> context{};
+
+  /**
+   * @brief  The encoded arguments
+   */
+  std::array<std::uint8_t, kMaxArgumentSize> arguments{};
+};
+
+/**
+ * @brief       Class to encode typed arguments into the argument area of a log record
+ * @details     Arguments that do not fit anymore are silently dropped, strings are truncated to the remaining space
+ */
+class LogArgumentEncoder final {
+ public:
+  /**
+   * @brief       Construct an instance of LogArgumentEncoder
+   * @param[in]   record
+   *              The record to which arguments are appended
+   */
+  explicit LogArgumentEncoder(LogRecord &record) noexcept : record_{record} { record_.arguments_size = 0U; }
+
+  /**
+   * @brief       Encode a string argument
+   * @param[in]   value
+   *              The string to be encoded
+   */
+  void Encode(std::string_view value) noexcept {
+    constexpr std::size_t kLengthSize{sizeof(std::uint16_t)};
+    if (Remaining() <= kLengthSize) { return; }
+    std::uint16_t const length{static_cast<std::uint16_t>(std::min(value.size(), Remaining() - kLengthSize - 1U))};
+    Put(LogArgumentType::kString);
+    Append(&length, kLengthSize);
+    Append(value.data(), length);
+  }
+
+  void Encode(const char *value) noexcept { Encode(std::string_view{value != nullptr ? value : "(null)"}); }
+
+  void Encode(const std::string &value) noexcept { Encode(std::string_view{value}); }
+
+  void Encode(bool value) noexcept { EncodeScalar(LogArgumentType::kBool, value); }
+
+  void Encode(char value) noexcept { EncodeScalar(LogArgumentType::kChar, value); }
+
+  /**
+   * @brief       Start a string argument whose characters are written in place, ended with EndString()
+   * @return      std::pair<char *, std::size_t>
+   *              The place of the characters and the number of characters fitting, nullptr when nothing fits
+   */
+  auto BeginString() noexcept -> std::pair<char *, std::size_t> {
+    constexpr std::size_t kLengthSize{sizeof(std::uint16_t)};
+    if (Remaining() <= (sizeof(LogArgumentType) + kLengthSize)) { return {nullptr, 0U}; }
+    Put(LogArgumentType::kString);
+    string_length_offset_ = record_.arguments_size;
+    record_.arguments_size = static_cast<std::uint16_t>(record_.arguments_size + kLengthSize);
+    return {reinterpret_cast<char *>(&record_.arguments[record_.arguments_size]), Remaining()};
+  }
+
+  /**
+   * @brief       End the string argument started with BeginString()
+   * @param[in]   length
+   *              The number of characters written
+   */
+  void EndString(std::size_t length) noexcept {
+    std::uint16_t const string_length{static_cast<std::uint16_t>(length)};
+    std::memcpy(&record_.arguments[string_length_offset_], &string_length, sizeof(string_length));
+    record_.arguments_size = static_cast<std::uint16_t>(record_.arguments_size + string_length);
+  }
+
+  /**
+   * @brief       Encode an arithmetic or enum argument
+   * @tparam      T
+   *              The argument type
+   * @param[in]   value
+   *              The value to be encoded
+   */
+  template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+  void Encode(T value) noexcept {
+    if constexpr (std::is_enum_v<T>) {
+      Encode(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      EncodeScalar(LogArgumentType::kDouble, static_cast<double>(value));
+    } else if constexpr (std::is_signed_v<T>) {
+      EncodeScalar(LogArgumentType::kSigned, static_cast<std::int64_t>(value));
+    } else {
+      EncodeScalar(LogArgumentType::kUnsigned, static_cast<std::uint64_t>(value));
+    }
+  }
+
+ private:
+  /**
+   * @brief       Get the number of free bytes in the argument area
+   */
+  auto Remaining() const noexcept -> std::size_t { return LogRecord::kMaxArgumentSize - record_.arguments_size; }
+
+  /**
+   * @brief       Encode a tagged scalar value if it fits completely
+   */
+  template<typename T>
+  void EncodeScalar(LogArgumentType type, T value) noexcept {
+    if (Remaining() < (sizeof(type) + sizeof(T))) { return; }
+    Put(type);
+    Append(&value, sizeof(T));
+  }
+
+  /**
+   * @brief       Append the type tag
+   */
+  void Put(LogArgumentType type) noexcept {
+    record_.arguments[record_.arguments_size] = static_cast<std::uint8_t>(type);
+    ++record_.arguments_size;
+  }
+
+  /**
+   * @brief       Append raw bytes
+   */
+  void Append(const void *data, std::size_t size) noexcept {
+    std::memcpy(&record_.arguments[record_.arguments_size], data, size);
+    record_.arguments_size = static_cast<std::uint16_t>(record_.arguments_size + size);
+  }
+
+  /**
+   * @brief       Store the record being encoded
+   */
+  LogRecord &record_;
+
+  /**
+   * @brief       Store the offset of the length of the string started with BeginString()
+   */
+  std::uint16_t string_length_offset_{};
+};
+
+/**
+ * @brief       Stream writing the text of a message built with a functor directly into a log record
+ * @details     One instance per thread is reused, so that no string stream is constructed and no string is allocated
+ *              per message. The text is stored as one string argument, text not fitting anymore is dropped.
+ */
+class LogArgumentStream final : private std::streambuf {
+ public:
+  /**
+   * @brief       Get the stream of the calling thread
+   */
+  static auto GetThreadInstance() noexcept -> LogArgumentStream & {
+    thread_local LogArgumentStream log_argument_stream{};
+    return log_argument_stream;
+  }
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  LogArgumentStream(const LogArgumentStream &other) noexcept = delete;
+  LogArgumentStream &operator=(const LogArgumentStream &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  LogArgumentStream(LogArgumentStream &&other) noexcept = delete;
+  LogArgumentStream &operator=(LogArgumentStream &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of LogArgumentStream
+   */
+  ~LogArgumentStream() override = default;
+
+  /**
+   * @brief       Encode the text written by the functor as a string argument
+   * @tparam      Func
+   *              The functor type
+   * @param[in]   encoder
+   *              The encoder of the record
+   * @param[in]   func
+   *              The functor writing the text, invoked with a stream in default format state
+   */
+  template<typename Func>
+  void Encode(LogArgumentEncoder &encoder, Func &&func) {
+    auto const [text, capacity] = encoder.BeginString();
+    if (text == nullptr) { return; }
+    setp(text, text + capacity);
+    stream_.clear();
+    stream_.flags(default_flags_);
+    stream_.fill(default_fill_);
+    stream_.precision(default_precision_);
+    stream_.width(0);
+    func(stream_);
+    encoder.EndString(static_cast<std::size_t>(pptr() - pbase()));
+    setp(nullptr, nullptr);
+  }
+
+ private:
+  /**
+   * @brief       Construct an instance of LogArgumentStream, the stream writes into this buffer
+   */
+  LogArgumentStream()
+      : std::streambuf{},
+        stream_{},
+        default_flags_{stream_.flags()},
+        default_fill_{stream_.fill()},
+        default_precision_{stream_.precision()} {
+    static_cast<std::ios &>(stream_).rdbuf(this);
+  }
+
+  /**
+   * @brief       Store the stream handed to the functor
+   */
+  std::stringstream stream_;
+
+  /**
+   * @brief       Store the format state of a new stream
+   */
+  std::ios::fmtflags const default_flags_;
+  char const default_fill_;
+  std::streamsize const default_precision_;
+};
+
+}  // namespace logger
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_RECORD_H
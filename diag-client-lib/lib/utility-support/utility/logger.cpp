@@ -8,8 +8,70 @@
 
 #include "utility/logger.h"
 
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace utility {
 namespace logger {
+namespace {
+
+/**
+ * @brief       Registry of all living logger instances, used to change log levels by context id
+ */
+struct LoggerRegistry final {
+  /**
+   * @brief  The mutex protecting the registered loggers
+   */
+  std::mutex mutex{};
+
+  /**
+   * @brief  Store the registered loggers
+   */
+  std::vector<std::pair<std::string, Logger *>> loggers{};
+
+  /**
+   * @brief  Store the log levels set by context id, applied to loggers created later with that context id
+   */
+  std::vector<std::pair<std::string, LogLevel>> levels{};
+};
+
+/**
+ * @brief       Function to get the logger registry
+ */
+auto GetLoggerRegistry() noexcept -> LoggerRegistry & {
+  static LoggerRegistry logger_registry_;
+  return logger_registry_;
+}
+
+/**
+ * @brief       Function to register a logger instance
+ */
+void RegisterLogger(std::string_view context_id, Logger *logger) {
+  LoggerRegistry &registry{GetLoggerRegistry()};
+  std::lock_guard<std::mutex> const lck{registry.mutex};
+  auto const level = std::find_if(
+      registry.levels.cbegin(), registry.levels.cend(),
+      [context_id](std::pair<std::string, LogLevel> const &entry) { return entry.first == context_id; });
+  if (level != registry.levels.cend()) { logger->SetLogLevel(level->second); }
+  registry.loggers.emplace_back(std::string{context_id}, logger);
+}
+
+/**
+ * @brief       Function to unregister a logger instance
+ */
+void UnregisterLogger(Logger *logger) {
+  LoggerRegistry &registry{GetLoggerRegistry()};
+  std::lock_guard<std::mutex> const lck{registry.mutex};
+  registry.loggers.erase(
+      std::remove_if(registry.loggers.begin(), registry.loggers.end(),
+                     [logger](std::pair<std::string, Logger *> const &entry) { return entry.second == logger; }),
+      registry.loggers.end());
+}
+
+}  // namespace
 
 Logger::Logger(std::string_view context_id)
     : contxt_{},
@@ -18,9 +80,14 @@ Logger::Logger(std::string_view context_id)
       registration_with_app_id_{false} {
 #ifdef ENABLE_DLT_LOGGER
   DLT_REGISTER_CONTEXT(contxt_, context_id_.c_str(), "Application Context");
+#elif defined(ENABLE_ASYNC_LOGGER)
+  // construct the backend before the logger, so that it outlives every logger instance
+  UNUSED_PARAM(AsyncLogBackend::GetInstance());
+  UNUSED_PARAM(registration_with_app_id_);
 #else
   UNUSED_PARAM(registration_with_app_id_);
 #endif
+  RegisterLogger(context_id_, this);
 }
 
 Logger::Logger(std::string_view app_id, std::string_view context_id)
@@ -31,17 +98,43 @@ Logger::Logger(std::string_view app_id, std::string_view context_id)
 #ifdef ENABLE_DLT_LOGGER
   DLT_REGISTER_APP(app_id_.c_str(), "Application Id");
   DLT_REGISTER_CONTEXT(contxt_, context_id_.c_str(), "Application Context");
+#elif defined(ENABLE_ASYNC_LOGGER)
+  UNUSED_PARAM(AsyncLogBackend::GetInstance());
+  UNUSED_PARAM(registration_with_app_id_);
 #else
   UNUSED_PARAM(registration_with_app_id_);
 #endif
+  RegisterLogger(context_id_, this);
 }
 
 Logger::~Logger() {
+  UnregisterLogger(this);
 #ifdef ENABLE_DLT_LOGGER
   DLT_UNREGISTER_CONTEXT(contxt_);
   if (registration_with_app_id_) { DLT_UNREGISTER_APP(); }
 #endif
 }
 
+auto Logger::SetLogLevel(std::string_view context_id, LogLevel level) noexcept -> bool {
+  bool found{false};
+  LoggerRegistry &registry{GetLoggerRegistry()};
+  std::lock_guard<std::mutex> const lck{registry.mutex};
+  auto const stored_level = std::find_if(
+      registry.levels.begin(), registry.levels.end(),
+      [context_id](std::pair<std::string, LogLevel> const &entry) { return entry.first == context_id; });
+  if (stored_level != registry.levels.end()) {
+    stored_level->second = level;
+  } else {
+    registry.levels.emplace_back(std::string{context_id}, level);
+  }
+  for (std::pair<std::string, Logger *> const &entry: registry.loggers) {
+    if (entry.first == context_id) {
+      entry.second->SetLogLevel(level);
+      found = true;
+    }
+  }
+  return found;
+}
+
 }  // namespace logger
 }  // namespace utility
@@ -11,6 +11,9 @@
 #ifdef ENABLE_DLT_LOGGER
 #include <dlt/dlt.h>
 #endif
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -18,16 +21,51 @@
 #include <string_view>
 #include <utility>
 
+#include "utility/log_format.h"
+#include "utility/log_rate_limiter.h"
+#include "utility/log_record.h"
+#ifdef ENABLE_ASYNC_LOGGER
+#include "utility/async_log_backend.h"
+#endif
+
 #define UNUSED_PARAM(expr) \
   do { (void) (expr); } while (0)
 
+// Most verbose log level compiled into the binary, set by cmake flag "BUILD_LOG_LEVEL"
+#ifndef LOGGER_COMPILE_LEVEL
+#define LOGGER_COMPILE_LEVEL 6
+#endif
+
 namespace utility {
 namespace logger {
 
+/**
+ * @brief       Most verbose log level compiled into the binary, log calls above it compile to nothing
+ */
+#if defined(ENABLE_DLT_LOGGER) || defined(ENABLE_ASYNC_LOGGER)
+constexpr LogLevel kCompileLogLevel{static_cast<LogLevel>(LOGGER_COMPILE_LEVEL)};
+#else
+constexpr LogLevel kCompileLogLevel{LogLevel::kOff};
+#endif
+
+/**
+ * @brief       Function to check whether a log level is compiled into the binary
+ * @param[in]   level
+ *              The log level to check
+ * @return      bool
+ *              True when log calls with this level are compiled in, false otherwise
+ */
+constexpr auto IsLogLevelCompiled(LogLevel level) noexcept -> bool {
+  return (level != LogLevel::kOff) && (level <= kCompileLogLevel);
+}
+
 /**
  * @brief       Logger class that is used to log Dlt messages from the component
  * @details     This class uses COVESA DLT infrastructure to send message to DLT. Also the class does not log dlt message
- *              if "ENABLE_DLT_LOGGER" cmake flag is set to OFF
+ *              if "ENABLE_DLT_LOGGER" cmake flag is set to OFF. Without DLT, messages are handed over to the
+ *              asynchronous logging backend if "ENABLE_ASYNC_LOGGER" is set, otherwise they are discarded.
+ *              Log calls above the compile time level compile to nothing, log calls above the runtime level return
+ *              before the functor is invoked or any argument is formatted.
  */
 class Logger final {
  public:
@@ -47,14 +85,33 @@ class Logger final {
   template<typename Func>
   auto LogFatal(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_FATAL, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kFatal>(file_name, line_no, func_name, std::forward<Func>(func));
+    FlushBeforeAbort();
+    std::abort();  // abort in case of fatal issue
+  }
+
+  /**
+   * @brief       Log fatal message using a format string and abort
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogFatal(const std::string_view file_name, int line_no, const std::string_view func_name,
+                const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kFatal>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
+    FlushBeforeAbort();
     std::abort();  // abort in case of fatal issue
   }
 
@@ -74,14 +131,30 @@ class Logger final {
   template<typename Func>
   auto LogError(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_ERROR, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kError>(file_name, line_no, func_name, std::forward<Func>(func));
+  }
+
+  /**
+   * @brief       Log error message using a format string
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogError(const std::string_view file_name, int line_no, const std::string_view func_name,
+                const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kError>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
   }
 
   /**
@@ -100,14 +173,30 @@ class Logger final {
   template<typename Func>
   auto LogWarn(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_WARN, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kWarn>(file_name, line_no, func_name, std::forward<Func>(func));
+  }
+
+  /**
+   * @brief       Log warning message using a format string
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogWarn(const std::string_view file_name, int line_no, const std::string_view func_name,
+               const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kWarn>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
   }
 
   /**
@@ -126,14 +215,30 @@ class Logger final {
   template<typename Func>
   auto LogInfo(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_INFO, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kInfo>(file_name, line_no, func_name, std::forward<Func>(func));
+  }
+
+  /**
+   * @brief       Log info message using a format string
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogInfo(const std::string_view file_name, int line_no, const std::string_view func_name,
+               const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kInfo>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
   }
 
   /**
@@ -152,14 +257,30 @@ class Logger final {
   template<typename Func>
   auto LogDebug(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_DEBUG, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kDebug>(file_name, line_no, func_name, std::forward<Func>(func));
+  }
+
+  /**
+   * @brief       Log debug message using a format string
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogDebug(const std::string_view file_name, int line_no, const std::string_view func_name,
+                const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kDebug>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
   }
 
   /**
@@ -178,14 +299,126 @@ class Logger final {
   template<typename Func>
   auto LogVerbose(const std::string_view file_name, int line_no, const std::string_view func_name, Func &&func) noexcept
       -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_VERBOSE, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    UNUSED_PARAM(file_name);
-    UNUSED_PARAM(line_no);
-    UNUSED_PARAM(func_name);
-    UNUSED_PARAM(func);
-#endif
+    LogMessage<LogLevel::kVerbose>(file_name, line_no, func_name, std::forward<Func>(func));
+  }
+
+  /**
+   * @brief       Log verbose message using a format string
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<std::size_t N, typename... Args>
+  auto LogVerbose(const std::string_view file_name, int line_no, const std::string_view func_name,
+                  const char (&format)[N], const Args &...args) noexcept -> void {
+    LogFormatMessage<LogLevel::kVerbose>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
+  }
+
+  /**
+   * @brief       Log message through a rate limiter, used for log sites that can be flooded by remote peers
+   * @details     Messages exceeding the rate of the limiter are dropped. The next message that passes is preceded by a
+   *              summary with the number of suppressed messages.
+   * @tparam      kLevel
+   *              The log level
+   * @tparam      Func
+   *              The functor type invoked when the message is written
+   * @param[in]   rate_limiter
+   *              The rate limiter of the log site
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   func
+   *              The functor which gets invoked when the message is written
+   */
+  template<LogLevel kLevel, typename Func>
+  auto LogRateLimited(LogRateLimiter &rate_limiter, const std::string_view file_name, int line_no,
+                      const std::string_view func_name, Func &&func) noexcept -> void {
+    if (IsLogLevelEnabled(kLevel) && AcquireRateLimit<kLevel>(rate_limiter, file_name, line_no, func_name)) {
+      LogMessage<kLevel>(file_name, line_no, func_name, std::forward<Func>(func));
+    }
+  }
+
+  /**
+   * @brief       Log message using a format string through a rate limiter
+   * @tparam      kLevel
+   *              The log level
+   * @tparam      N
+   *              The size of the format string literal
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   rate_limiter
+   *              The rate limiter of the log site
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string literal, every "{}" is replaced with the next argument
+   * @param[in]   args
+   *              The arguments
+   */
+  template<LogLevel kLevel, std::size_t N, typename... Args>
+  auto LogRateLimited(LogRateLimiter &rate_limiter, const std::string_view file_name, int line_no,
+                      const std::string_view func_name, const char (&format)[N], const Args &...args) noexcept
+      -> void {
+    if (IsLogLevelEnabled(kLevel) && AcquireRateLimit<kLevel>(rate_limiter, file_name, line_no, func_name)) {
+      LogFormatMessage<kLevel>(file_name, line_no, func_name, std::string_view{format, N - 1U}, args...);
+    }
+  }
+
+  /**
+   * @brief       Set the runtime log level of every logger registered with the given context id
+   * @details     Takes effect immediately for all threads, no restart needed. The level is kept for the context id, so
+   *              that loggers created later with it, e.g. on first use, start with this level
+   * @param[in]   context_id
+   *              The context id of the logger, e.g. "dcap", "doip" or "dcbs"
+   * @param[in]   level
+   *              The new log level
+   * @return      bool
+   *              True when at least one logger with the context id exists, false when the level is only kept for
+   *              loggers created later
+   */
+  static auto SetLogLevel(std::string_view context_id, LogLevel level) noexcept -> bool;
+
+  /**
+   * @brief       Set the runtime log level, messages above this level are discarded
+   * @param[in]   level
+   *              The new log level
+   */
+  void SetLogLevel(LogLevel level) noexcept { log_level_.store(level, std::memory_order_relaxed); }
+
+  /**
+   * @brief       Get the runtime log level
+   * @return      LogLevel
+   *              The current log level
+   */
+  auto GetLogLevel() const noexcept -> LogLevel { return log_level_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief       Check whether messages of the given level are logged
+   * @param[in]   level
+   *              The log level to check
+   * @return      bool
+   *              True when the level is compiled in and enabled at runtime, false otherwise
+   */
+  auto IsLogLevelEnabled(LogLevel level) const noexcept -> bool {
+    return IsLogLevelCompiled(level) && (level <= GetLogLevel());
   }
 
  public:
@@ -211,6 +444,113 @@ class Logger final {
   ~Logger();
 
  private:
+  /**
+   * @brief       Function to dispatch a message with functor to the enabled logging backend
+   * @tparam      kLevel
+   *              The log level
+   * @tparam      Func
+   *              The functor type
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   func
+   *              The functor which gets invoked
+   */
+  template<LogLevel kLevel, typename Func>
+  void LogMessage(const std::string_view file_name, int line_no, const std::string_view func_name,
+                  Func &&func) noexcept {
+    if constexpr (IsLogLevelCompiled(kLevel)) {
+      if (kLevel <= GetLogLevel()) {
+#ifdef ENABLE_DLT_LOGGER
+        LogDltMessage(ToDltLogLevel(kLevel), file_name, func_name, line_no, std::forward<Func>(func));
+#elif defined(ENABLE_ASYNC_LOGGER)
+        LogAsyncMessage(kLevel, file_name, func_name, line_no, std::forward<Func>(func));
+#endif
+      }
+    } else {
+      UNUSED_PARAM(file_name);
+      UNUSED_PARAM(line_no);
+      UNUSED_PARAM(func_name);
+      UNUSED_PARAM(func);
+    }
+  }
+
+  /**
+   * @brief       Function to dispatch a message with format string to the enabled logging backend
+   * @tparam      kLevel
+   *              The log level
+   * @tparam      Args
+   *              The argument types
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   format
+   *              The format string with static storage duration
+   * @param[in]   args
+   *              The arguments
+   */
+  template<LogLevel kLevel, typename... Args>
+  void LogFormatMessage(const std::string_view file_name, int line_no, const std::string_view func_name,
+                        const std::string_view format, const Args &...args) noexcept {
+    if constexpr (IsLogLevelCompiled(kLevel)) {
+      if (kLevel <= GetLogLevel()) {
+#ifdef ENABLE_DLT_LOGGER
+        DLT_LOG(contxt_, ToDltLogLevel(kLevel),
+                DLT_CSTRING(CreateFormattedMessage(file_name, line_no, format, args...).c_str()));
+        UNUSED_PARAM(func_name);
+#elif defined(ENABLE_ASYNC_LOGGER)
+        AsyncLogBackend &backend{AsyncLogBackend::GetInstance()};
+        LogRecord *const record{backend.AcquireRecord()};
+        if (record != nullptr) {
+          FillRecord(*record, kLevel, file_name, func_name, line_no, format);
+          LogArgumentEncoder encoder{*record};
+          (encoder.Encode(args), ...);
+          backend.CommitRecord();
+        }
+#endif
+      }
+    } else {
+      UNUSED_PARAM(file_name);
+      UNUSED_PARAM(line_no);
+      UNUSED_PARAM(func_name);
+      UNUSED_PARAM(format);
+      (static_cast<void>(args), ...);
+    }
+  }
+
+  /**
+   * @brief       Function to take a token of the rate limiter and report previously suppressed messages
+   * @return      bool
+   *              True when the message may be written, false otherwise
+   */
+  template<LogLevel kLevel>
+  auto AcquireRateLimit(LogRateLimiter &rate_limiter, const std::string_view file_name, int line_no,
+                        const std::string_view func_name) noexcept -> bool {
+    bool const acquired{rate_limiter.TryAcquire()};
+    if (acquired) {
+      std::uint64_t const suppressed_count{rate_limiter.TakeSuppressedCount()};
+      if (suppressed_count != 0U) {
+        LogFormatMessage<kLevel>(file_name, line_no, func_name, "{} similar messages suppressed", suppressed_count);
+      }
+    }
+    return acquired;
+  }
+
+  /**
+   * @brief       Function to make sure all buffered messages are written before abort
+   */
+  static void FlushBeforeAbort() noexcept {
+#if defined(ENABLE_ASYNC_LOGGER) && !defined(ENABLE_DLT_LOGGER)
+    AsyncLogBackend::GetInstance().Flush();
+#endif
+  }
+
   /**
    * @brief       Function to create the final logging message
    * @tparam      Func
@@ -233,6 +573,49 @@ class Logger final {
     return msg;
   }
 
+  /**
+   * @brief       Function to create the final logging message from a format string without using iostreams
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   format
+   *              The format string
+   * @param[in]   args
+   *              The arguments
+   */
+  template<typename... Args>
+  static auto CreateFormattedMessage(const std::string_view file_name, int line_no, const std::string_view format,
+                                     const Args &...args) noexcept -> std::string {
+    std::string msg{};
+    format::FormatTo(msg, format, args...);
+    format::FormatTo(msg, " [{}:{}]", file_name, line_no);
+    return msg;
+  }
+
+#ifdef ENABLE_DLT_LOGGER
+  /**
+   * @brief       Function to convert the log level into dlt log level
+   */
+  static constexpr auto ToDltLogLevel(LogLevel level) noexcept -> DltLogLevelType {
+    switch (level) {
+      case LogLevel::kFatal:
+        return DLT_LOG_FATAL;
+      case LogLevel::kError:
+        return DLT_LOG_ERROR;
+      case LogLevel::kWarn:
+        return DLT_LOG_WARN;
+      case LogLevel::kInfo:
+        return DLT_LOG_INFO;
+      case LogLevel::kDebug:
+        return DLT_LOG_DEBUG;
+      case LogLevel::kVerbose:
+        return DLT_LOG_VERBOSE;
+      default:
+        return DLT_LOG_OFF;
+    }
+  }
+
   /**
    * @brief       Function to send the messages to dlt infrastructure
    * @tparam      log_level
@@ -246,7 +629,6 @@ class Logger final {
    * @param[in]   func
    *              The functor which gets invoked
    */
-#ifdef ENABLE_DLT_LOGGER
   template<typename Func>
   void LogDltMessage(DltLogLevelType log_level, const std::string_view file_name, const std::string_view func_name,
                      int line_no, Func &&func) {
@@ -256,6 +638,52 @@ class Logger final {
   }
 #endif
 
+#ifdef ENABLE_ASYNC_LOGGER
+  /**
+   * @brief       Function to send the messages to the asynchronous logging backend
+   * @details     The functor may capture locals by reference, so it runs on the calling thread. It writes the text
+   *              directly into the record, the record is formatted into a line on the backend thread.
+   * @param[in]   log_level
+   *              The log level
+   * @param[in]   file_name
+   *              The file name
+   * @param[in]   func_name
+   *              The function name
+   * @param[in]   line_no
+   *              The line number
+   * @param[in]   func
+   *              The functor which gets invoked
+   */
+  template<typename Func>
+  void LogAsyncMessage(LogLevel log_level, const std::string_view file_name, const std::string_view func_name,
+                       int line_no, Func &&func) noexcept {
+    AsyncLogBackend &backend{AsyncLogBackend::GetInstance()};
+    LogRecord *const record{backend.AcquireRecord()};
+    if (record != nullptr) {
+      FillRecord(*record, log_level, file_name, func_name, line_no, "{}");
+      LogArgumentEncoder encoder{*record};
+      LogArgumentStream::GetThreadInstance().Encode(encoder, std::forward<Func>(func));
+      backend.CommitRecord();
+    }
+  }
+
+  /**
+   * @brief       Function to fill the header of a log record
+   */
+  void FillRecord(LogRecord &record, LogLevel log_level, const std::string_view file_name,
+                  const std::string_view func_name, int line_no, const std::string_view format) const noexcept {
+    record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::system_clock::now().time_since_epoch())
+                              .count();
+    record.file_name = file_name;
+    record.func_name = func_name;
+    record.format = format;
+    record.line_no = line_no;
+    record.level = log_level;
+    record.context_size = static_cast<std::uint8_t>(context_id_.copy(record.context.data(), record.context.size()));
+  }
+#endif
+
 #ifdef ENABLE_DLT_LOGGER
   // Declare the context
   DLT_DECLARE_CONTEXT(contxt_)
@@ -270,6 +698,9 @@ class Logger final {
 
   // store the information about registration with app id
   bool registration_with_app_id_{};
+
+  // Stores the runtime log level
+  std::atomic<LogLevel> log_level_{LogLevel::kVerbose};
 };
 }  // namespace logger
 }  // namespace utility
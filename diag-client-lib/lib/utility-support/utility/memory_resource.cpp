@@ -0,0 +1,171 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/memory_resource.h"
+
+#include <cstdint>
+#include <functional>
+#include <new>
+
+namespace utility {
+namespace memory {
+namespace {
+
+/**
+ * @brief       Function to round a size up to a multiple of the alignment, alignment must be a power of two
+ */
+constexpr auto AlignUp(std::size_t size, std::size_t alignment) noexcept -> std::size_t {
+  return (size + (alignment - 1U)) & ~(alignment - 1U);
+}
+
+/**
+ * @brief       Function to check whether the memory lies within the buffer
+ */
+auto IsWithin(void const *pointer, std::byte const *buffer, std::size_t size) noexcept -> bool {
+  std::less_equal<void const *> const less_equal{};
+  std::less<void const *> const less{};
+  return less_equal(buffer, pointer) && less(pointer, buffer + size);
+}
+
+}  // namespace
+
+MonotonicArenaResource::MonotonicArenaResource(std::size_t capacity, std::pmr::memory_resource *upstream)
+    : upstream_{upstream},
+      capacity_{capacity},
+      buffer_{static_cast<std::byte *>(upstream->allocate(capacity, alignof(std::max_align_t)))},
+      mutex_{},
+      offset_{0U},
+      live_allocation_count_{0U},
+      upstream_allocation_count_{0U} {}
+
+MonotonicArenaResource::~MonotonicArenaResource() noexcept {
+  upstream_->deallocate(buffer_, capacity_, alignof(std::max_align_t));
+}
+
+auto MonotonicArenaResource::Reset() noexcept -> bool {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  bool const is_unused{live_allocation_count_ == 0U};
+  if (is_unused) { offset_ = 0U; }
+  return is_unused;
+}
+
+auto MonotonicArenaResource::GetUsedSize() const noexcept -> std::size_t {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  return offset_;
+}
+
+auto MonotonicArenaResource::GetUpstreamAllocationCount() const noexcept -> std::size_t {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  return upstream_allocation_count_;
+}
+
+void *MonotonicArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  std::uintptr_t const buffer_address{reinterpret_cast<std::uintptr_t>(buffer_)};
+  std::size_t const aligned_offset{AlignUp(buffer_address + offset_, alignment) - buffer_address};
+  void *memory{nullptr};
+  if ((aligned_offset <= capacity_) && (bytes <= (capacity_ - aligned_offset))) {
+    memory = buffer_ + aligned_offset;
+    offset_ = aligned_offset + bytes;
+  } else {
+    memory = upstream_->allocate(bytes, alignment);
+    ++upstream_allocation_count_;
+  }
+  ++live_allocation_count_;
+  return memory;
+}
+
+void MonotonicArenaResource::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  if (!IsWithin(pointer, buffer_, capacity_)) { upstream_->deallocate(pointer, bytes, alignment); }
+  --live_allocation_count_;
+}
+
+FixedBlockPoolResource::FixedBlockPoolResource(std::size_t block_size, std::size_t block_count,
+                                               std::pmr::memory_resource *upstream)
+    : upstream_{upstream},
+      block_size_{AlignUp(block_size < sizeof(FreeBlock) ? sizeof(FreeBlock) : block_size, alignof(std::max_align_t))},
+      block_count_{block_count},
+      storage_{static_cast<std::byte *>(upstream->allocate(block_size_ * block_count_, alignof(std::max_align_t)))},
+      mutex_{},
+      free_list_{nullptr},
+      free_block_count_{block_count},
+      upstream_allocation_count_{0U} {
+  // link all blocks, the first block is handed out first
+  for (std::size_t block_index{block_count_}; block_index > 0U; --block_index) {
+    free_list_ = ::new (storage_ + ((block_index - 1U) * block_size_)) FreeBlock{free_list_};
+  }
+}
+
+FixedBlockPoolResource::~FixedBlockPoolResource() noexcept {
+  upstream_->deallocate(storage_, block_size_ * block_count_, alignof(std::max_align_t));
+}
+
+auto FixedBlockPoolResource::GetFreeBlockCount() const noexcept -> std::size_t {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  return free_block_count_;
+}
+
+auto FixedBlockPoolResource::GetUpstreamAllocationCount() const noexcept -> std::size_t {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  return upstream_allocation_count_;
+}
+
+void *FixedBlockPoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    if ((bytes <= block_size_) && (alignment <= alignof(std::max_align_t)) && (free_list_ != nullptr)) {
+      FreeBlock *const block{free_list_};
+      free_list_ = block->next;
+      --free_block_count_;
+      return block;
+    }
+    ++upstream_allocation_count_;
+  }
+  return upstream_->allocate(bytes, alignment);
+}
+
+void FixedBlockPoolResource::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) {
+  if (IsPoolBlock(pointer)) {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    free_list_ = ::new (pointer) FreeBlock{free_list_};
+    ++free_block_count_;
+  } else {
+    upstream_->deallocate(pointer, bytes, alignment);
+  }
+}
+
+auto FixedBlockPoolResource::IsPoolBlock(void const *pointer) const noexcept -> bool {
+  return IsWithin(pointer, storage_, block_size_ * block_count_);
+}
+
+void *ResourceAllocated::operator new(std::size_t size, std::pmr::memory_resource *resource) {
+  std::size_t const allocation_size{GetAllocationSize(size)};
+  void *const memory{resource->allocate(allocation_size, alignof(AllocationHeader))};
+  AllocationHeader *const header{::new (memory) AllocationHeader{resource, allocation_size}};
+  return header + 1;
+}
+
+void *ResourceAllocated::operator new(std::size_t size) {
+  return ResourceAllocated::operator new(size, std::pmr::new_delete_resource());
+}
+
+void ResourceAllocated::operator delete(void *object, std::pmr::memory_resource *) noexcept {
+  ResourceAllocated::operator delete(object);
+}
+
+void ResourceAllocated::operator delete(void *object) noexcept {
+  if (object != nullptr) {
+    AllocationHeader *const header{static_cast<AllocationHeader *>(object) - 1};
+    std::pmr::memory_resource *const resource{header->resource};
+    resource->deallocate(header, header->size, alignof(AllocationHeader));
+  }
+}
+
+}  // namespace memory
+}  // namespace utility
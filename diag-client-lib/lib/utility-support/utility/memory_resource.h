@@ -0,0 +1,342 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_MEMORY_RESOURCE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace utility {
+namespace memory {
+
+/**
+ * @brief       Memory resource handing out memory by bumping an offset into one pre-allocated buffer
+ * @details     Deallocation of memory from the buffer is a no-op, the whole buffer is reused by Reset() once all
+ *              allocations were returned. Requests not fitting into the remaining buffer are forwarded to the upstream
+ *              resource. All functions are thread safe, so that allocation and deallocation may happen from the
+ *              application and the reader thread of a connection.
+ */
+class MonotonicArenaResource final : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief       Construct an instance of MonotonicArenaResource
+   * @param[in]   capacity
+   *              The size of buffer in bytes, allocated once from upstream resource
+   * @param[in]   upstream
+   *              The resource providing the buffer and serving requests exceeding it
+   */
+  MonotonicArenaResource(std::size_t capacity, std::pmr::memory_resource *upstream);
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  MonotonicArenaResource(const MonotonicArenaResource &other) noexcept = delete;
+  MonotonicArenaResource &operator=(const MonotonicArenaResource &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  MonotonicArenaResource(MonotonicArenaResource &&other) noexcept = delete;
+  MonotonicArenaResource &operator=(MonotonicArenaResource &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of MonotonicArenaResource, returning the buffer to upstream resource
+   */
+  ~MonotonicArenaResource() noexcept override;
+
+  /**
+   * @brief       Make the whole buffer available again
+   * @details     The buffer is only reused when no allocation is outstanding, otherwise the call has no effect
+   * @return      True when the buffer was reset, false otherwise
+   */
+  auto Reset() noexcept -> bool;
+
+  /**
+   * @brief       Get the size of buffer
+   * @return      The size in bytes
+   */
+  auto GetCapacity() const noexcept -> std::size_t { return capacity_; }
+
+  /**
+   * @brief       Get the number of bytes of buffer in use since the last reset, including alignment padding
+   * @return      The size in bytes
+   */
+  auto GetUsedSize() const noexcept -> std::size_t;
+
+  /**
+   * @brief       Get the number of requests forwarded to upstream resource since construction
+   * @return      The number of requests
+   */
+  auto GetUpstreamAllocationCount() const noexcept -> std::size_t;
+
+  /**
+   * @brief       Get the upstream resource
+   * @return      The upstream resource
+   */
+  auto GetUpstreamResource() const noexcept -> std::pmr::memory_resource * { return upstream_; }
+
+ private:
+  /**
+   * @brief       Allocate memory, see std::pmr::memory_resource
+   */
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  /**
+   * @brief       Deallocate memory, see std::pmr::memory_resource
+   */
+  void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+  /**
+   * @brief       Compare for equality, memory may only be returned to the same arena
+   */
+  bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override { return this == &other; }
+
+  /**
+   * @brief       Store the upstream resource
+   */
+  std::pmr::memory_resource *upstream_;
+
+  /**
+   * @brief       Store the size of buffer
+   */
+  std::size_t capacity_;
+
+  /**
+   * @brief       Store the buffer
+   */
+  std::byte *buffer_;
+
+  /**
+   * @brief       Mutex to protect the bookkeeping below
+   */
+  mutable std::mutex mutex_;
+
+  /**
+   * @brief       Store the offset of the first free byte of buffer
+   */
+  std::size_t offset_;
+
+  /**
+   * @brief       Store the number of allocations not yet returned
+   */
+  std::size_t live_allocation_count_;
+
+  /**
+   * @brief       Store the number of requests forwarded to upstream resource
+   */
+  std::size_t upstream_allocation_count_;
+};
+
+/**
+ * @brief       Memory resource handing out blocks of one fixed size from a pre-allocated pool
+ * @details     Freed blocks are kept in a free list and handed out again. Requests larger than the block size or with
+ *              an alignment stricter than std::max_align_t, as well as requests while the pool is exhausted, are
+ *              forwarded to the upstream resource. All functions are thread safe.
+ */
+class FixedBlockPoolResource final : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief       Construct an instance of FixedBlockPoolResource
+   * @param[in]   block_size
+   *              The size of one block in bytes
+   * @param[in]   block_count
+   *              The number of blocks, allocated once from upstream resource
+   * @param[in]   upstream
+   *              The resource providing the pool and serving requests not fitting into a block
+   */
+  FixedBlockPoolResource(std::size_t block_size, std::size_t block_count, std::pmr::memory_resource *upstream);
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  FixedBlockPoolResource(const FixedBlockPoolResource &other) noexcept = delete;
+  FixedBlockPoolResource &operator=(const FixedBlockPoolResource &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  FixedBlockPoolResource(FixedBlockPoolResource &&other) noexcept = delete;
+  FixedBlockPoolResource &operator=(FixedBlockPoolResource &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of FixedBlockPoolResource, returning the pool to upstream resource
+   */
+  ~FixedBlockPoolResource() noexcept override;
+
+  /**
+   * @brief       Get the size of one block, rounded up to the alignment of std::max_align_t
+   * @return      The size in bytes
+   */
+  auto GetBlockSize() const noexcept -> std::size_t { return block_size_; }
+
+  /**
+   * @brief       Get the number of blocks
+   * @return      The number of blocks
+   */
+  auto GetBlockCount() const noexcept -> std::size_t { return block_count_; }
+
+  /**
+   * @brief       Get the number of blocks currently available
+   * @return      The number of blocks
+   */
+  auto GetFreeBlockCount() const noexcept -> std::size_t;
+
+  /**
+   * @brief       Get the number of requests forwarded to upstream resource since construction
+   * @return      The number of requests
+   */
+  auto GetUpstreamAllocationCount() const noexcept -> std::size_t;
+
+ private:
+  /**
+   * @brief       Free block, linking to the next free block
+   */
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  /**
+   * @brief       Allocate memory, see std::pmr::memory_resource
+   */
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  /**
+   * @brief       Deallocate memory, see std::pmr::memory_resource
+   */
+  void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+
+  /**
+   * @brief       Compare for equality, memory may only be returned to the same pool
+   */
+  bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override { return this == &other; }
+
+  /**
+   * @brief       Function to check whether the memory belongs to the pool
+   */
+  auto IsPoolBlock(void const *pointer) const noexcept -> bool;
+
+  /**
+   * @brief       Store the upstream resource
+   */
+  std::pmr::memory_resource *upstream_;
+
+  /**
+   * @brief       Store the size of one block
+   */
+  std::size_t block_size_;
+
+  /**
+   * @brief       Store the number of blocks
+   */
+  std::size_t block_count_;
+
+  /**
+   * @brief       Store the pool
+   */
+  std::byte *storage_;
+
+  /**
+   * @brief       Mutex to protect the bookkeeping below
+   */
+  mutable std::mutex mutex_;
+
+  /**
+   * @brief       Store the first free block
+   */
+  FreeBlock *free_list_;
+
+  /**
+   * @brief       Store the number of free blocks
+   */
+  std::size_t free_block_count_;
+
+  /**
+   * @brief       Store the number of requests forwarded to upstream resource
+   */
+  std::size_t upstream_allocation_count_;
+};
+
+/**
+ * @brief       Base class for objects which remember the memory resource they were allocated from
+ * @details     The resource is stored in front of the object, so that objects handed over as std::unique_ptr with the
+ *              default deleter are returned to their resource on deletion, also via a pointer to a base class with
+ *              virtual destructor. Objects allocated with plain new use std::pmr::new_delete_resource().
+ */
+class ResourceAllocated {
+ public:
+  /**
+   * @brief       Get the number of bytes requested from the resource for an object of given size
+   * @param[in]   object_size
+   *              The size of object
+   * @return      The size in bytes
+   */
+  static constexpr auto GetAllocationSize(std::size_t object_size) noexcept -> std::size_t {
+    return sizeof(AllocationHeader) + object_size;
+  }
+
+  /**
+   * @brief       Allocate an object from the given resource
+   */
+  static void *operator new(std::size_t size, std::pmr::memory_resource *resource);
+
+  /**
+   * @brief       Allocate an object from std::pmr::new_delete_resource()
+   */
+  static void *operator new(std::size_t size);
+
+  /**
+   * @brief       Return an object to its resource when its constructor failed
+   */
+  static void operator delete(void *object, std::pmr::memory_resource *resource) noexcept;
+
+  /**
+   * @brief       Return an object to its resource
+   */
+  static void operator delete(void *object) noexcept;
+
+ protected:
+  /**
+   * @brief       Default constructor and destructor, only for use as base class
+   */
+  ResourceAllocated() noexcept = default;
+  ~ResourceAllocated() noexcept = default;
+
+ private:
+  /**
+   * @brief       Bookkeeping stored in front of every object
+   */
+  struct alignas(std::max_align_t) AllocationHeader {
+    std::pmr::memory_resource *resource;
+    std::size_t size;
+  };
+};
+
+/**
+ * @brief       Function to create an object from the given memory resource
+ * @tparam      T
+ *              The type of object, must derive from ResourceAllocated
+ * @param[in]   resource
+ *              The resource to allocate from, must outlive the object
+ * @param[in]   args
+ *              The arguments forwarded to the constructor
+ * @return      The object, deleting it returns the memory to the resource
+ */
+template<typename T, typename... Args>
+auto MakeUniqueFromResource(std::pmr::memory_resource *resource, Args &&...args) -> std::unique_ptr<T> {
+  static_assert(std::is_base_of_v<ResourceAllocated, T>, "Type must derive from ResourceAllocated");
+  return std::unique_ptr<T>{new (resource) T(std::forward<Args>(args)...)};
+}
+
+}  // namespace memory
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_MEMORY_RESOURCE_H
@@ -0,0 +1,291 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_OBJECT_POOL_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_OBJECT_POOL_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace utility {
+namespace memory {
+
+/**
+ * @brief       Lock-free pool of storage for objects of one type
+ * @details     The storage of kCapacity objects is part of the pool, free slots are kept in a lock-free stack. The head
+ *              of stack carries a tag incremented on every change to rule out the ABA problem. Requests while the pool
+ *              is exhausted are served from the heap. The pool is trivially destructible, so that a static pool stays
+ *              usable until the very end of the program.
+ * @tparam      T
+ *              The type of objects
+ * @tparam      kCapacity
+ *              The number of objects the pool holds
+ */
+template<typename T, std::size_t kCapacity>
+class ObjectPool final {
+  static_assert(kCapacity > 0U, "Capacity must not be zero");
+  static_assert(kCapacity < 0xFFFFFFFFU, "Capacity must fit into 32 bits");
+
+ public:
+  /**
+   * @brief       Deleter destroying the object and returning its storage to the pool
+   */
+  class Deleter final {
+   public:
+    /**
+     * @brief       Construct an instance of Deleter
+     * @param[in]   pool
+     *              The pool the objects are returned to
+     */
+    explicit Deleter(ObjectPool *pool = nullptr) noexcept : pool_{pool} {}
+
+    /**
+     * @brief       Destroy the object and return its storage
+     * @param[in]   object
+     *              The object created by ObjectPool::Make
+     */
+    void operator()(T *object) const noexcept {
+      object->~T();
+      pool_->Deallocate(object);
+    }
+
+   private:
+    /**
+     * @brief       Store the pool
+     */
+    ObjectPool *pool_;
+  };
+
+  /**
+   * @brief       Type alias of unique pointer returning the object to the pool
+   */
+  using UniquePtr = std::unique_ptr<T, Deleter>;
+
+  /**
+   * @brief       Construct an empty pool
+   */
+  constexpr ObjectPool() noexcept : slots_{}, free_head_{0U}, unused_index_{0U}, heap_allocation_count_{0U} {}
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  ObjectPool(const ObjectPool &other) noexcept = delete;
+  ObjectPool &operator=(const ObjectPool &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  ObjectPool(ObjectPool &&other) noexcept = delete;
+  ObjectPool &operator=(ObjectPool &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct the pool, all objects must have been returned
+   */
+  ~ObjectPool() noexcept = default;
+
+  /**
+   * @brief       Create an object
+   * @param[in]   args
+   *              The arguments forwarded to the constructor
+   * @return      The object, returned to the pool on destruction
+   */
+  template<typename... Args>
+  auto Make(Args &&...args) -> UniquePtr {
+    void *const storage{Allocate()};
+    try {
+      return UniquePtr{::new (storage) T(std::forward<Args>(args)...), Deleter{this}};
+    } catch (...) {
+      Deallocate(storage);
+      throw;
+    }
+  }
+
+  /**
+   * @brief       Get storage for one object
+   * @return      The uninitialized storage
+   */
+  auto Allocate() -> void * {
+    std::uint64_t head{free_head_.load(std::memory_order_acquire)};
+    while (GetSlotNumber(head) != 0U) {
+      Slot &slot{slots_[GetSlotNumber(head) - 1U]};
+      std::uint64_t const new_head{MakeHead(slot.next.load(std::memory_order_relaxed), GetTag(head) + 1U)};
+      if (free_head_.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire)) {
+        return slot.storage;
+      }
+    }
+    // free stack is empty, take a slot never used before
+    std::uint32_t unused_index{unused_index_.load(std::memory_order_relaxed)};
+    while (unused_index < kCapacity) {
+      if (unused_index_.compare_exchange_weak(unused_index, unused_index + 1U, std::memory_order_relaxed)) {
+        return slots_[unused_index].storage;
+      }
+    }
+    heap_allocation_count_.fetch_add(1U, std::memory_order_relaxed);
+    return ::operator new(sizeof(T));
+  }
+
+  /**
+   * @brief       Return storage of one object
+   * @param[in]   storage
+   *              The storage returned by Allocate()
+   */
+  void Deallocate(void *storage) noexcept {
+    std::uint32_t const slot_number{FindSlotNumber(storage)};
+    if (slot_number != 0U) {
+      Slot &slot{slots_[slot_number - 1U]};
+      std::uint64_t head{free_head_.load(std::memory_order_relaxed)};
+      do {
+        slot.next.store(GetSlotNumber(head), std::memory_order_relaxed);
+      } while (!free_head_.compare_exchange_weak(head, MakeHead(slot_number, GetTag(head) + 1U),
+                                                 std::memory_order_release, std::memory_order_relaxed));
+    } else {
+      ::operator delete(storage);
+    }
+  }
+
+  /**
+   * @brief       Check whether the storage belongs to the pool
+   * @param[in]   storage
+   *              The storage to be checked
+   * @return      True when the storage is a slot of the pool, false when it was taken from the heap
+   */
+  auto Contains(void const *storage) const noexcept -> bool { return FindSlotNumber(storage) != 0U; }
+
+  /**
+   * @brief       Get the number of requests served from the heap since construction, because the pool was exhausted
+   * @return      The number of requests
+   */
+  auto GetHeapAllocationCount() const noexcept -> std::size_t {
+    return heap_allocation_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /**
+   * @brief       Storage of one object, linking to the next free slot while unused
+   */
+  struct Slot {
+    alignas(T) std::byte storage[sizeof(T)];
+    std::atomic<std::uint32_t> next;
+  };
+
+  /**
+   * @brief       Function to combine slot number and tag into the head of free stack
+   */
+  static constexpr auto MakeHead(std::uint32_t slot_number, std::uint32_t tag) noexcept -> std::uint64_t {
+    return (static_cast<std::uint64_t>(tag) << 32U) | slot_number;
+  }
+
+  /**
+   * @brief       Function to get the slot number out of the head of free stack, zero when empty
+   */
+  static constexpr auto GetSlotNumber(std::uint64_t head) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(head & 0xFFFFFFFFU);
+  }
+
+  /**
+   * @brief       Function to get the tag out of the head of free stack
+   */
+  static constexpr auto GetTag(std::uint64_t head) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(head >> 32U);
+  }
+
+  /**
+   * @brief       Function to get the one based slot number of storage, zero when not part of the pool
+   */
+  auto FindSlotNumber(void const *storage) const noexcept -> std::uint32_t {
+    std::less_equal<void const *> const less_equal{};
+    std::less<void const *> const less{};
+    std::uint32_t slot_number{0U};
+    if (less_equal(&slots_.front(), storage) && less(storage, slots_.data() + kCapacity)) {
+      slot_number = static_cast<std::uint32_t>(reinterpret_cast<Slot const *>(storage) - slots_.data()) + 1U;
+    }
+    return slot_number;
+  }
+
+  /**
+   * @brief       Store all slots
+   */
+  std::array<Slot, kCapacity> slots_;
+
+  /**
+   * @brief       Store the head of free stack
+   */
+  std::atomic<std::uint64_t> free_head_;
+
+  /**
+   * @brief       Store the index of first slot never used
+   */
+  std::atomic<std::uint32_t> unused_index_;
+
+  /**
+   * @brief       Store the number of requests served from the heap
+   */
+  std::atomic<std::size_t> heap_allocation_count_;
+};
+
+/**
+ * @brief       Base class routing plain new and delete of the derived class to a static object pool
+ * @details     Objects keep being created with std::make_unique and owned by std::unique_ptr with the default deleter,
+ *              their storage is recycled by the pool of the derived class.
+ * @tparam      T
+ *              The derived class, must be final
+ * @tparam      kCapacity
+ *              The number of objects the pool holds
+ */
+template<typename T, std::size_t kCapacity>
+class PoolAllocated {
+ public:
+  /**
+   * @brief       Type alias of the pool
+   */
+  using Pool = ObjectPool<T, kCapacity>;
+
+  /**
+   * @brief       Get the pool of derived class
+   * @return      The pool
+   */
+  static auto GetPool() noexcept -> Pool & {
+    static Pool pool{};
+    return pool;
+  }
+
+  /**
+   * @brief       Allocate an object from the pool
+   */
+  static void *operator new(std::size_t size) {
+    return (size <= sizeof(T)) ? GetPool().Allocate() : ::operator new(size);
+  }
+
+  /**
+   * @brief       Return an object to the pool
+   */
+  static void operator delete(void *object, std::size_t size) noexcept {
+    if (size <= sizeof(T)) {
+      GetPool().Deallocate(object);
+    } else {
+      ::operator delete(object);
+    }
+  }
+
+ protected:
+  /**
+   * @brief       Default constructor and destructor, only for use as base class
+   */
+  PoolAllocated() noexcept = default;
+  ~PoolAllocated() noexcept = default;
+};
+
+}  // namespace memory
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_OBJECT_POOL_H
@@ -0,0 +1,163 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_HANDOFF_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_HANDOFF_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "utility/spsc_ring_buffer.h"
+
+namespace utility {
+namespace ring_buffer {
+
+/**
+ * @brief       Handoff of elements from one producer thread to one consumer thread through a lock-free ring buffer
+ * @details     Elements are passed without locking. The consumer only blocks when the ring buffer went empty, and the
+ *              producer only takes the mutex to wake the consumer when it announced to be waiting. A full ring buffer
+ *              makes the producer yield until the consumer made room, elements are never dropped.
+ * @tparam      T
+ *              The element type, must be default constructible and move assignable
+ * @tparam      Capacity
+ *              The number of slots, must be a power of two
+ */
+template<typename T, std::size_t Capacity>
+class SpscHandoff final {
+ public:
+  /**
+   * @brief       Maximum number of elements dequeued at once by the consumer
+   */
+  static constexpr std::size_t kBatchSize{Capacity < 16U ? Capacity : 16U};
+
+  /**
+   * @brief       Construct an empty handoff
+   */
+  SpscHandoff() noexcept : ring_{}, consumer_waiting_{false}, stop_requested_{false}, mutex_{}, cond_var_{} {}
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  SpscHandoff(const SpscHandoff &other) noexcept = delete;
+  SpscHandoff &operator=(const SpscHandoff &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  SpscHandoff(SpscHandoff &&other) noexcept = delete;
+  SpscHandoff &operator=(SpscHandoff &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of SpscHandoff
+   */
+  ~SpscHandoff() noexcept = default;
+
+  /**
+   * @brief       Pass an element to the consumer, called by the producer thread only
+   * @param[in]   value
+   *              The element to be passed
+   * @return      True when passed, false when the handoff was stopped before the element found room
+   */
+  auto Push(T &&value) -> bool {
+    while (!ring_.TryPush(std::move(value))) {
+      if (stop_requested_.load(std::memory_order_relaxed)) { return false; }
+      std::this_thread::yield();
+    }
+    // pairs with the fence of consumer, either the consumer sees the element or the producer sees the waiting consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumer_waiting_.load(std::memory_order_relaxed)) {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      cond_var_.notify_one();
+    }
+    return true;
+  }
+
+  /**
+   * @brief       Take a batch of elements and pass them to the handler, called by the consumer thread only
+   * @details     Blocks while the ring buffer is empty, until an element arrives or the handoff is stopped
+   * @param[in]   handler
+   *              The handler invoked with every element in order
+   * @return      False when the handoff was stopped and all elements were handled, true otherwise
+   */
+  template<typename Handler>
+  auto ConsumeBatch(Handler &&handler) -> bool {
+    std::array<T, kBatchSize> batch{};
+    std::size_t batch_size{0U};
+    while ((batch_size < kBatchSize) && ring_.TryPop(batch[batch_size])) { ++batch_size; }
+    for (std::size_t index{0U}; index < batch_size; ++index) { handler(std::move(batch[index])); }
+    if (batch_size == 0U) {
+      if (stop_requested_.load(std::memory_order_acquire)) { return false; }
+      WaitUntilNotEmpty();
+    }
+    return true;
+  }
+
+  /**
+   * @brief       Stop the handoff, wakes up the consumer to handle the remaining elements
+   */
+  void Stop() noexcept {
+    {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      stop_requested_.store(true, std::memory_order_release);
+    }
+    cond_var_.notify_all();
+  }
+
+  /**
+   * @brief       Restart a stopped handoff, called while neither producer nor consumer thread is running
+   */
+  void Restart() noexcept { stop_requested_.store(false, std::memory_order_relaxed); }
+
+ private:
+  /**
+   * @brief       Function to block the consumer until an element arrives or the handoff is stopped
+   */
+  void WaitUntilNotEmpty() {
+    consumer_waiting_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      cond_var_.wait(lock, [this]() { return !ring_.Empty() || stop_requested_.load(std::memory_order_relaxed); });
+    }
+    consumer_waiting_.store(false, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief       Store the elements passed
+   */
+  SpscRingBuffer<T, Capacity> ring_;
+
+  /**
+   * @brief       Flag telling that the consumer is about to block
+   */
+  std::atomic<bool> consumer_waiting_;
+
+  /**
+   * @brief       Flag telling that the handoff was stopped
+   */
+  std::atomic<bool> stop_requested_;
+
+  /**
+   * @brief       Mutex protecting the wait of consumer
+   */
+  std::mutex mutex_;
+
+  /**
+   * @brief       Conditional variable to wake the consumer
+   */
+  std::condition_variable cond_var_;
+};
+
+}  // namespace ring_buffer
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_HANDOFF_H
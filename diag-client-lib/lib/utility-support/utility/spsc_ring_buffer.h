@@ -0,0 +1,179 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_RING_BUFFER_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace utility {
+namespace ring_buffer {
+
+/**
+ * @brief       Bounded lock-free ring buffer for exactly one producer thread and one consumer thread
+ * @details     The producer only writes the tail index and the consumer only writes the head index, so no
+ *              read-modify-write atomics are required. Both indices live on their own cache line to avoid false sharing.
+ * @tparam      T
+ *              The element type, must be default constructible and move assignable
+ * @tparam      Capacity
+ *              The number of slots, must be a power of two
+ */
+template<typename T, std::size_t Capacity>
+class SpscRingBuffer final {
+  static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U, "Capacity must be a power of two");
+  static_assert(std::is_default_constructible_v<T>, "Element type must be default constructible");
+
+ public:
+  /**
+   * @brief       Construct an empty ring buffer
+   */
+  SpscRingBuffer() noexcept = default;
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  SpscRingBuffer(const SpscRingBuffer &other) noexcept = delete;
+  SpscRingBuffer &operator=(const SpscRingBuffer &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  SpscRingBuffer(SpscRingBuffer &&other) noexcept = delete;
+  SpscRingBuffer &operator=(SpscRingBuffer &&other) noexcept = delete;
+
+  /**
+   * @brief       Destruct an instance of SpscRingBuffer
+   */
+  ~SpscRingBuffer() noexcept = default;
+
+  /**
+   * @brief       Reserve the next free slot for in-place writing by the producer
+   * @details     The slot becomes visible to the consumer only after Commit() is called
+   * @return      T *
+   *              Pointer to the free slot, nullptr when the buffer is full
+   */
+  auto Reserve() noexcept -> T * {
+    std::size_t const tail{tail_.load(std::memory_order_relaxed)};
+    if (tail - cached_head_ == Capacity) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == Capacity) { return nullptr; }
+    }
+    return &slots_[tail & kMask];
+  }
+
+  /**
+   * @brief       Publish the slot previously returned by Reserve() to the consumer
+   */
+  void Commit() noexcept { tail_.store(tail_.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+  /**
+   * @brief       Push an element into the buffer
+   * @param[in]   value
+   *              The element to be pushed
+   * @return      bool
+   *              True when pushed, false when the buffer is full
+   */
+  template<typename U>
+  auto TryPush(U &&value) noexcept(std::is_nothrow_assignable_v<T &, U &&>) -> bool {
+    T *const slot{Reserve()};
+    if (slot == nullptr) { return false; }
+    *slot = std::forward<U>(value);
+    Commit();
+    return true;
+  }
+
+  /**
+   * @brief       Get the oldest element without removing it
+   * @return      T *
+   *              Pointer to the oldest element, nullptr when the buffer is empty
+   */
+  auto Front() noexcept -> T * {
+    std::size_t const head{head_.load(std::memory_order_relaxed)};
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) { return nullptr; }
+    }
+    return &slots_[head & kMask];
+  }
+
+  /**
+   * @brief       Release the element previously returned by Front() back to the producer
+   */
+  void Pop() noexcept { head_.store(head_.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+  /**
+   * @brief       Pop an element from the buffer
+   * @param[out]  value
+   *              The popped element
+   * @return      bool
+   *              True when an element was popped, false when the buffer is empty
+   */
+  auto TryPop(T &value) noexcept(std::is_nothrow_move_assignable_v<T>) -> bool {
+    T *const slot{Front()};
+    if (slot == nullptr) { return false; }
+    value = std::move(*slot);
+    Pop();
+    return true;
+  }
+
+  /**
+   * @brief       Check whether the buffer is empty, only reliable from the consumer thread
+   */
+  auto Empty() const noexcept -> bool {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief       Get the number of slots
+   */
+  static constexpr auto GetCapacity() noexcept -> std::size_t { return Capacity; }
+
+ private:
+  /**
+   * @brief       Mask to convert the running index into a slot index
+   */
+  static constexpr std::size_t kMask{Capacity - 1U};
+
+  /**
+   * @brief       Assumed size of a cache line
+   */
+  static constexpr std::size_t kCacheLineSize{64U};
+
+  /**
+   * @brief       Store the running index of the next element to be consumed
+   */
+  alignas(kCacheLineSize) std::atomic<std::size_t> head_{0U};
+
+  /**
+   * @brief       Store the consumer's last seen value of tail
+   */
+  std::size_t cached_tail_{0U};
+
+  /**
+   * @brief       Store the running index of the next slot to be produced
+   */
+  alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0U};
+
+  /**
+   * @brief       Store the producer's last seen value of head
+   */
+  std::size_t cached_head_{0U};
+
+  /**
+   * @brief       Store the slots
+   */
+  alignas(kCacheLineSize) std::array<T, Capacity> slots_{};
+};
+
+}  // namespace ring_buffer
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SPSC_RING_BUFFER_H
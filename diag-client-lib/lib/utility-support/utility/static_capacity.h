@@ -0,0 +1,77 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATIC_CAPACITY_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATIC_CAPACITY_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Capacities are set by the build profile, the defaults apply to the default profile
+#ifndef DIAG_CLIENT_MAX_CONVERSATIONS
+#define DIAG_CLIENT_MAX_CONVERSATIONS 255U
+#endif
+#ifndef DIAG_CLIENT_MAX_RX_BUFFER_SIZE
+#define DIAG_CLIENT_MAX_RX_BUFFER_SIZE 65535U
+#endif
+#ifndef DIAG_CLIENT_MAX_VEHICLE_RESPONSES
+#define DIAG_CLIENT_MAX_VEHICLE_RESPONSES 65535U
+#endif
+#ifndef DIAG_CLIENT_TCP_MESSAGE_POOL_SIZE
+#define DIAG_CLIENT_TCP_MESSAGE_POOL_SIZE 64U
+#endif
+#ifndef DIAG_CLIENT_RESPONSE_POOL_SIZE
+#define DIAG_CLIENT_RESPONSE_POOL_SIZE 32U
+#endif
+
+namespace utility {
+namespace capacity {
+
+/**
+ * @brief  Flag telling whether the embedded profile is built, internal containers are fixed-capacity then
+ */
+#ifdef ENABLE_STATIC_CAPACITY
+constexpr bool kStaticCapacity{true};
+#else
+constexpr bool kStaticCapacity{false};
+#endif
+
+/**
+ * @brief  Maximum number of DM conversations, further conversations of the configuration are ignored
+ */
+constexpr std::size_t kMaxConversationCount{DIAG_CLIENT_MAX_CONVERSATIONS};
+
+/**
+ * @brief  Maximum reception buffer size of a conversation, larger configured sizes are clamped
+ */
+constexpr std::uint32_t kMaxRxBufferSize{DIAG_CLIENT_MAX_RX_BUFFER_SIZE};
+
+/**
+ * @brief  Maximum number of vehicle identification responses collected per request, further responses are dropped
+ */
+constexpr std::size_t kMaxVehicleResponseCount{DIAG_CLIENT_MAX_VEHICLE_RESPONSES};
+
+/**
+ * @brief  Number of tcp messages kept for reuse per socket
+ */
+constexpr std::size_t kTcpMessagePoolSize{DIAG_CLIENT_TCP_MESSAGE_POOL_SIZE};
+
+/**
+ * @brief  Number of response messages served from the pool shared by all conversations
+ */
+constexpr std::size_t kResponsePoolSize{DIAG_CLIENT_RESPONSE_POOL_SIZE};
+
+static_assert(kMaxConversationCount > 0U, "At least one conversation is required");
+static_assert(kMaxConversationCount <= 255U, "The number of conversations is configured as 8 bit value");
+static_assert(kMaxVehicleResponseCount > 0U, "At least one vehicle response is required");
+static_assert(kTcpMessagePoolSize > 0U, "Tcp message pool must not be empty");
+static_assert(kResponsePoolSize > 0U, "Response pool must not be empty");
+
+}  // namespace capacity
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATIC_CAPACITY_H
@@ -8,47 +8,73 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SYNC_TIMER_H
 #define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SYNC_TIMER_H
 
-namespace utility {
-namespace sync_timer {
-
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
+#include "core/include/clock.h"
+
+namespace utility {
+namespace sync_timer {
+
 /**
  * @brief       Timer class for timeout monitoring
- * @tparam      ClockType
- *              The type of clock to be used for time monitoring
+ * @details     The time is taken from the injected clock, so that timeouts can run on a virtual clock. A cancellation
+ *              requested while no wait is running is kept until the next wait, which then ends immediately. Once
+ *              shut down, the running and every further wait end immediately as timed out.
  */
-template<typename ClockType>
-class SyncTimer final {
+class SyncTimer final : public core_type::Clock::Waiter {
  public:
   /**
    * @brief  Type alias for the clock type
    */
-  using Clock = ClockType;
+  using Clock = core_type::Clock;
 
   /**
    * @brief  Type alias for the clock time point
    */
-  using TimePoint = std::chrono::time_point<Clock>;
+  using TimePoint = Clock::TimePoint;
 
   /**
    * @brief  Definition of different timer state during timeout monitoring
    */
-  enum class TimerState : std::uint8_t { kIdle = 0, kCancelRequested, kTimeout };
+  enum class TimerState : std::uint8_t { kIdle = 0, kCancelRequested, kTimeout, kShutdown };
 
   /**
    * @brief       Construct an instance of SyncTimer
+   * @param[in]   clock
+   *              The clock used for time monitoring, must outlive the timer
+   */
+  explicit SyncTimer(Clock &clock = Clock::GetSteadyClock())
+      : clock_{clock},
+        cond_var_{},
+        mutex_lock_{},
+        exit_request_{false},
+        start_running_{false},
+        cancel_requested_{false} {
+    clock_.AddWaiter(*this);
+  }
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
    */
-  SyncTimer() : cond_var_{}, mutex_lock_{}, exit_request_{false}, start_running_{false} {}
+  SyncTimer(const SyncTimer &other) noexcept = delete;
+  SyncTimer &operator=(const SyncTimer &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  SyncTimer(SyncTimer &&other) noexcept = delete;
+  SyncTimer &operator=(SyncTimer &&other) noexcept = delete;
 
   /**
    * @brief       Destruct an instance of SyncTimer
    */
   ~SyncTimer() {
+    clock_.RemoveWaiter(*this);
     std::lock_guard<std::mutex> const lck(mutex_lock_);
-    exit_request_ = false;
+    exit_request_ = true;
     start_running_ = false;
     cond_var_.notify_all();
   }
@@ -60,7 +86,7 @@ class SyncTimer final {
    * @tparam      CancelCallback
    *              The callback functor type for cancellation notification
    * @param[in]   timeout_func
-   *              The functor to be called when timeout occurs
+   *              The functor to be called when timeout occurs or the timer is shut down
    * @param[in]   cancel_func
    *              The functor to be called when expected event occurs within timeout
    * @param[in]   timeout
@@ -69,7 +95,8 @@ class SyncTimer final {
   template<typename TimeoutCallback, typename CancelCallback>
   void WaitForTimeout(TimeoutCallback &&timeout_func, CancelCallback &&cancellation_func,
                       std::chrono::milliseconds const timeout) {
-    if (Start(timeout) == TimerState::kTimeout) {
+    TimerState const timer_state{Start(timeout)};
+    if ((timer_state == TimerState::kTimeout) || (timer_state == TimerState::kShutdown)) {
       timeout_func();
     } else {
       cancellation_func();
@@ -84,46 +111,70 @@ class SyncTimer final {
     return start_running_;
   }
 
+  /**
+   * @brief       Function to arm the timer before triggering the event that is waited for
+   * @details     Discards a cancellation left over from before, so that only the event triggered afterwards ends the
+   *              next wait, even when it arrives before the wait started
+   */
+  void Arm() {
+    std::lock_guard<std::mutex> const lck(mutex_lock_);
+    cancel_requested_ = false;
+  }
+
   /**
    * @brief       Function to cancel the synchronous wait
    */
   void CancelWait() { Stop(); }
 
+  /**
+   * @brief       Function to shut down the timer, ending the running and every further wait without waiting
+   * @details     Used on shutdown, so that no caller stays blocked until its timeout
+   */
+  void Shutdown() {
+    std::lock_guard<std::mutex> const lck(mutex_lock_);
+    exit_request_ = true;
+    cond_var_.notify_all();
+  }
+
+  /**
+   * @brief       Function to wake up a wait to re-check its deadline, called by the clock when its time jumps
+   */
+  void WakeUp() noexcept override {
+    std::lock_guard<std::mutex> const lck(mutex_lock_);
+    cond_var_.notify_all();
+  }
+
  private:
   /**
    * @brief       Function to start the timeout monitoring
    * @param[in]   timeout
    *              The timeout value in milliseconds after which timeout happens
    * @return      TimerState
-   *              "kTimeout" in case of timeout or "kCancelRequested" when timeout monitoring was cancelled
+   *              "kTimeout" in case of timeout, "kCancelRequested" when timeout monitoring was cancelled or
+   *              "kShutdown" when the timer is shut down
    */
   auto Start(std::chrono::milliseconds const timeout) noexcept -> TimerState {
     TimerState timer_state{TimerState::kIdle};
     std::unique_lock<std::mutex> lck(mutex_lock_);
     start_running_ = true;
-    TimePoint const expiry_time_point{Clock::now() + timeout};
-    if (cond_var_.wait_until(lck, expiry_time_point, [this, &expiry_time_point, &timer_state]() {
-          bool do_exit_wait{false};
-          // check if exit was requested
-          if (!exit_request_) {
-            TimePoint const current_time{Clock::now()};
-            // check for expiry
-            if (current_time >= expiry_time_point) {
-              // timeout
-              timer_state = TimerState::kTimeout;
-              do_exit_wait = true;
-            } else {
-              // check for cancellation request
-              if (!start_running_) {
-                timer_state = TimerState::kCancelRequested;
-                do_exit_wait = true;
-              }  // else - spurious wake-up, do nothing
-            }
-          } else {
-            do_exit_wait = true;
-          }
-          return do_exit_wait;
-        })) {}
+    TimePoint const expiry_time_point{clock_.Now() + timeout};
+    while (timer_state == TimerState::kIdle) {
+      if (exit_request_) {
+        // shut down, the wait ends without the event
+        timer_state = TimerState::kShutdown;
+      } else if (cancel_requested_) {
+        // cancellation request, may have arrived before the wait started
+        cancel_requested_ = false;
+        timer_state = TimerState::kCancelRequested;
+      } else if (clock_.Now() >= expiry_time_point) {
+        // timeout
+        timer_state = TimerState::kTimeout;
+      } else {
+        // spurious wake-up returns here too
+        clock_.WaitUntil(lck, cond_var_, expiry_time_point);
+      }
+    }
+    start_running_ = false;
     return timer_state;
   }
 
@@ -132,11 +183,16 @@ class SyncTimer final {
    */
   void Stop() noexcept {
     std::lock_guard<std::mutex> const lck(mutex_lock_);
-    start_running_ = false;
+    cancel_requested_ = true;
     cond_var_.notify_all();
   }
 
  private:
+  /**
+   * @brief       The clock used for time monitoring
+   */
+  Clock &clock_;
+
   /**
    * @brief       The conditional variable needed for synchronizing between start and stop of running timer
    */
@@ -148,17 +204,22 @@ class SyncTimer final {
   std::mutex mutex_lock_;
 
   /**
-   * @brief       The flag to terminate the wait
+   * @brief       The flag to terminate the running and every further wait
    */
   bool exit_request_;
 
   /**
-   * @brief       The flag to stop the current running timer
+   * @brief       The flag telling that a wait is running
    */
   bool start_running_;
+
+  /**
+   * @brief       The flag to stop the current or next running timer
+   */
+  bool cancel_requested_;
 };
 
 }  // namespace sync_timer
 }  // namespace utility
 
-#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SYNC_TIMER_H
\ No newline at end of file
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_SYNC_TIMER_H
@@ -0,0 +1,143 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/trace.h"
+
+#include <array>
+#include <charconv>
+#include <string_view>
+
+namespace utility {
+namespace trace {
+namespace {
+
+static_assert((TraceBuffer::kCapacity & (TraceBuffer::kCapacity - 1U)) == 0U, "Capacity must be a power of two");
+
+/**
+ * @brief       Function to get the small sequential identifier of the calling thread
+ */
+auto GetThreadId() noexcept -> std::uint32_t {
+  static std::atomic<std::uint32_t> next_thread_id{1U};
+  thread_local std::uint32_t const thread_id{next_thread_id.fetch_add(1U, std::memory_order_relaxed)};
+  return thread_id;
+}
+
+/**
+ * @brief       Function to append an integer value to the document
+ */
+template<typename T>
+void AppendNumber(T value, std::string &document) {
+  std::array<char, 32U> buffer{};
+  auto const result{std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)};
+  document.append(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+}
+
+/**
+ * @brief       Function to append nanoseconds as microseconds with three fractional digits
+ */
+void AppendMicroseconds(std::int64_t nanoseconds, std::string &document) {
+  AppendNumber(nanoseconds / 1000, document);
+  std::int64_t const fraction{nanoseconds % 1000};
+  document.push_back('.');
+  if (fraction < 100) { document.push_back('0'); }
+  if (fraction < 10) { document.push_back('0'); }
+  AppendNumber(fraction, document);
+}
+
+/**
+ * @brief       Function to append a JSON string literal
+ */
+void AppendString(std::string_view text, std::string &document) {
+  document.push_back('"');
+  for (char const character: text) {
+    if ((character == '"') || (character == '\\')) { document.push_back('\\'); }
+    if (static_cast<unsigned char>(character) >= 0x20U) { document.push_back(character); }
+  }
+  document.push_back('"');
+}
+
+}  // namespace
+
+auto TraceBuffer::GetInstance() noexcept -> TraceBuffer & {
+  static TraceBuffer trace_buffer{};
+  return trace_buffer;
+}
+
+TraceBuffer::TraceBuffer() : slots_{std::make_unique<Slot[]>(kCapacity)}, write_index_{0U}, start_index_{0U} {}
+
+void TraceBuffer::Record(char const *category, char const *name, TracePhase phase, Clock::time_point start_time,
+                         Clock::duration duration, std::uint64_t value) noexcept {
+  std::uint64_t const index{write_index_.fetch_add(1U, std::memory_order_relaxed)};
+  Slot &slot{slots_[index & (kCapacity - 1U)]};
+  slot.sequence.store((2U * index) + 1U, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.category.store(category, std::memory_order_relaxed);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.timestamp_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(start_time.time_since_epoch()).count(),
+                          std::memory_order_relaxed);
+  slot.duration_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+                         std::memory_order_relaxed);
+  slot.value.store(value, std::memory_order_relaxed);
+  slot.thread_id.store(GetThreadId(), std::memory_order_relaxed);
+  slot.phase.store(static_cast<char>(phase), std::memory_order_relaxed);
+  slot.sequence.store((2U * index) + 2U, std::memory_order_release);
+}
+
+auto TraceBuffer::DumpChromeTrace() const -> std::string {
+  std::string document{"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["};
+  std::uint64_t const end_index{write_index_.load(std::memory_order_acquire)};
+  std::uint64_t begin_index{start_index_.load(std::memory_order_relaxed)};
+  if ((end_index - begin_index) > kCapacity) { begin_index = end_index - kCapacity; }
+  bool first_event{true};
+  for (std::uint64_t index{begin_index}; index < end_index; ++index) {
+    Slot const &slot{slots_[index & (kCapacity - 1U)]};
+    std::uint64_t const expected_sequence{(2U * index) + 2U};
+    if (slot.sequence.load(std::memory_order_acquire) != expected_sequence) { continue; }
+    char const *const category{slot.category.load(std::memory_order_relaxed)};
+    char const *const name{slot.name.load(std::memory_order_relaxed)};
+    std::int64_t const timestamp_ns{slot.timestamp_ns.load(std::memory_order_relaxed)};
+    std::int64_t const duration_ns{slot.duration_ns.load(std::memory_order_relaxed)};
+    std::uint64_t const value{slot.value.load(std::memory_order_relaxed)};
+    std::uint32_t const thread_id{slot.thread_id.load(std::memory_order_relaxed)};
+    char const phase{slot.phase.load(std::memory_order_relaxed)};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // skip the event when the slot was overwritten while reading
+    if (slot.sequence.load(std::memory_order_relaxed) != expected_sequence) { continue; }
+
+    if (!first_event) { document.push_back(','); }
+    first_event = false;
+    document.append("{\"name\":");
+    AppendString(name, document);
+    document.append(",\"cat\":");
+    AppendString(category, document);
+    document.append(",\"ph\":\"");
+    document.push_back(phase);
+    document.append("\",\"ts\":");
+    AppendMicroseconds(timestamp_ns, document);
+    if (phase == static_cast<char>(TracePhase::kComplete)) {
+      document.append(",\"dur\":");
+      AppendMicroseconds(duration_ns, document);
+    } else {
+      document.append(",\"s\":\"t\"");
+    }
+    document.append(",\"pid\":1,\"tid\":");
+    AppendNumber(thread_id, document);
+    document.append(",\"args\":{\"value\":");
+    AppendNumber(value, document);
+    document.append("}}");
+  }
+  document.append("]}");
+  return document;
+}
+
+void TraceBuffer::Clear() noexcept {
+  start_index_.store(write_index_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+}  // namespace trace
+}  // namespace utility
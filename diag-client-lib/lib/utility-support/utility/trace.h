@@ -0,0 +1,263 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TRACE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace utility {
+namespace trace {
+
+/**
+ * @brief  Flag telling whether trace points are compiled in, trace points compile to nothing otherwise
+ */
+#ifdef ENABLE_TRACE
+constexpr bool kTraceCompiled{true};
+#else
+constexpr bool kTraceCompiled{false};
+#endif
+
+/**
+ * @brief  Definition of the supported trace event phases, values match the Chrome trace event format
+ */
+enum class TracePhase : char {
+  kComplete = 'X', /**< Event with start time and duration */
+  kInstant = 'i',  /**< Event without duration */
+};
+
+/**
+ * @brief       Fixed size in-memory buffer of trace events, exported in Chrome trace event format
+ * @details     Recording is lock-free, every event claims a slot with a single atomic increment. The buffer keeps the
+ *              latest kCapacity events, older events are overwritten. Every slot is protected by a sequence number, so
+ *              that the export skips slots being overwritten concurrently.
+ */
+class TraceBuffer final {
+ public:
+  /**
+   * @brief  Number of events kept in the buffer, must be a power of two
+   */
+  static constexpr std::size_t kCapacity{8192U};
+
+  /**
+   * @brief  Type alias of the clock used for time stamps
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief       Get the trace buffer instance
+   * @return      TraceBuffer
+   *              The singleton instance
+   */
+  static auto GetInstance() noexcept -> TraceBuffer &;
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  TraceBuffer(const TraceBuffer &other) noexcept = delete;
+  TraceBuffer &operator=(const TraceBuffer &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  TraceBuffer(TraceBuffer &&other) noexcept = delete;
+  TraceBuffer &operator=(TraceBuffer &&other) noexcept = delete;
+
+  /**
+   * @brief       Record one event
+   * @param[in]   category
+   *              The category of event, must have static storage duration
+   * @param[in]   name
+   *              The name of event, must have static storage duration
+   * @param[in]   phase
+   *              The phase of event
+   * @param[in]   start_time
+   *              The time the event started
+   * @param[in]   duration
+   *              The duration of event, ignored for instant events
+   * @param[in]   value
+   *              The value shown as argument of event
+   */
+  void Record(char const *category, char const *name, TracePhase phase, Clock::time_point start_time,
+              Clock::duration duration, std::uint64_t value) noexcept;
+
+  /**
+   * @brief       Export all buffered events as Chrome trace event JSON, loadable in Perfetto or chrome://tracing
+   * @return      std::string
+   *              The JSON document
+   */
+  auto DumpChromeTrace() const -> std::string;
+
+  /**
+   * @brief       Discard all buffered events
+   */
+  void Clear() noexcept;
+
+ private:
+  /**
+   * @brief       One buffered event
+   * @details     All fields are atomics accessed with relaxed ordering, the sequence number orders them
+   */
+  struct Slot {
+    /**
+     * @brief  Odd while being written, 2 * (index + 1) once the event with the given index is complete
+     */
+    std::atomic<std::uint64_t> sequence{0U};
+
+    /**
+     * @brief  The category of event
+     */
+    std::atomic<char const *> category{nullptr};
+
+    /**
+     * @brief  The name of event
+     */
+    std::atomic<char const *> name{nullptr};
+
+    /**
+     * @brief  The start time in nanoseconds since epoch of clock
+     */
+    std::atomic<std::int64_t> timestamp_ns{0};
+
+    /**
+     * @brief  The duration in nanoseconds
+     */
+    std::atomic<std::int64_t> duration_ns{0};
+
+    /**
+     * @brief  The argument value
+     */
+    std::atomic<std::uint64_t> value{0U};
+
+    /**
+     * @brief  The recording thread
+     */
+    std::atomic<std::uint32_t> thread_id{0U};
+
+    /**
+     * @brief  The phase of event
+     */
+    std::atomic<char> phase{'i'};
+  };
+
+  /**
+   * @brief       Construct an instance of TraceBuffer
+   */
+  TraceBuffer();
+
+  /**
+   * @brief       Destruct an instance of TraceBuffer
+   */
+  ~TraceBuffer() = default;
+
+  /**
+   * @brief       Store all slots
+   */
+  std::unique_ptr<Slot[]> slots_;
+
+  /**
+   * @brief       Store the index of the next event
+   */
+  std::atomic<std::uint64_t> write_index_;
+
+  /**
+   * @brief       Store the index of the first event not discarded by Clear()
+   */
+  std::atomic<std::uint64_t> start_index_;
+};
+
+/**
+ * @brief       Trace point measuring the time until the end of the enclosing scope
+ */
+class TraceScope final {
+ public:
+  /**
+   * @brief       Start the measurement
+   * @param[in]   category
+   *              The category of event, must have static storage duration
+   * @param[in]   name
+   *              The name of event, must have static storage duration
+   * @param[in]   value
+   *              The value shown as argument of event
+   */
+  TraceScope(char const *category, char const *name, std::uint64_t value = 0U) noexcept
+      : category_{category},
+        name_{name},
+        value_{value},
+        start_time_{} {
+    if constexpr (kTraceCompiled) { start_time_ = TraceBuffer::Clock::now(); }
+  }
+
+  /**
+   * @brief       Deleted copy assignment and copy constructor
+   */
+  TraceScope(const TraceScope &other) noexcept = delete;
+  TraceScope &operator=(const TraceScope &other) noexcept = delete;
+
+  /**
+   * @brief       Deleted move assignment and move constructor
+   */
+  TraceScope(TraceScope &&other) noexcept = delete;
+  TraceScope &operator=(TraceScope &&other) noexcept = delete;
+
+  /**
+   * @brief       Stop the measurement and record the event
+   */
+  ~TraceScope() noexcept {
+    if constexpr (kTraceCompiled) {
+      TraceBuffer::GetInstance().Record(category_, name_, TracePhase::kComplete, start_time_,
+                                        TraceBuffer::Clock::now() - start_time_, value_);
+    }
+  }
+
+ private:
+  /**
+   * @brief       Store the category of event
+   */
+  char const *category_;
+
+  /**
+   * @brief       Store the name of event
+   */
+  char const *name_;
+
+  /**
+   * @brief       Store the argument value
+   */
+  std::uint64_t value_;
+
+  /**
+   * @brief       Store the start time
+   */
+  TraceBuffer::Clock::time_point start_time_;
+};
+
+/**
+ * @brief       Function to record an event without duration
+ * @param[in]   category
+ *              The category of event, must have static storage duration
+ * @param[in]   name
+ *              The name of event, must have static storage duration
+ * @param[in]   value
+ *              The value shown as argument of event
+ */
+inline void TraceInstant(char const *category, char const *name, std::uint64_t value = 0U) noexcept {
+  if constexpr (kTraceCompiled) {
+    TraceBuffer::GetInstance().Record(category, name, TracePhase::kInstant, TraceBuffer::Clock::now(),
+                                      TraceBuffer::Clock::duration::zero(), value);
+  }
+}
+
+}  // namespace trace
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TRACE_H
@@ -8,6 +8,8 @@
 #ifndef DIAG_CLIENT_COMMON_DOIP_TYPES_H_
 #define DIAG_CLIENT_COMMON_DOIP_TYPES_H_
 
+#include <cstdint>
+
 /* DoIP Port Number - Unsecured */
 constexpr uint16_t kDoipPort = 13400U;
 /* Udp Channel Length */
@@ -8,6 +8,7 @@
 
 #include "doip_handler/doip_tcp_handler.h"
 
+#include "core/include/endian_codec.h"
 #include "core/include/span.h"
 #include "doip_handler/common_doip_types.h"
 #include "doip_handler/logger.h"
@@ -35,7 +36,8 @@ DoipTcpHandler::DoipChannel::DoipChannel(std::uint16_t logical_address,
       running_{false},
       routing_activation_res_code_{kDoip_RoutingActivation_ResCode_RoutingSuccessful},
       diag_msg_ack_code_{kDoip_DiagnosticMessage_PosAckCode_Confirm},
-      num_of_pending_response_{0u} {
+      num_of_pending_response_{0u},
+      response_delay_{std::chrono::milliseconds(25)} {
   // Start thread to receive messages
   thread_ = std::thread([this]() {
     std::unique_lock<std::mutex> lck(mutex_);
@@ -117,26 +119,19 @@ void DoipTcpHandler::DoipChannel::HandleMessage(TcpMessagePtr tcp_rx_message) {
 }
 
 auto DoipTcpHandler::DoipChannel::GetDoIPPayloadType(core_type::Span<uint8_t> payload) noexcept -> std::uint16_t {
-  return ((uint16_t) (((payload[BYTE_POS_TWO] & 0xFF) << 8) | (payload[BYTE_POS_THREE] & 0xFF)));
+  return core_type::ReadBigEndian<std::uint16_t>(payload, BYTE_POS_TWO).value_or(0U);
 }
 
 auto DoipTcpHandler::DoipChannel::GetDoIPPayloadLength(core_type::Span<uint8_t> payload) noexcept -> std::uint32_t {
-  return ((uint32_t) ((payload[BYTE_POS_FOUR] << 24U) & 0xFF000000) |
-          (uint32_t) ((payload[BYTE_POS_FIVE] << 16U) & 0x00FF0000) |
-          (uint32_t) ((payload[BYTE_POS_SIX] << 8U) & 0x0000FF00) |
-          (uint32_t) ((payload[BYTE_POS_SEVEN] & 0x000000FF)));
+  return core_type::ReadBigEndian<std::uint32_t>(payload, BYTE_POS_FOUR).value_or(0U);
 }
 
-void DoipTcpHandler::DoipChannel::CreateDoipGenericHeader(std::vector<uint8_t> &doipHeader, std::uint16_t payload_type,
-                                                          std::uint32_t payload_len) {
+void DoipTcpHandler::DoipChannel::CreateDoipGenericHeader(TcpMessage::BufferType &doipHeader,
+                                                          std::uint16_t payload_type, std::uint32_t payload_len) {
   doipHeader.push_back(kDoip_ProtocolVersion);
-  doipHeader.push_back(~((uint8_t) kDoip_ProtocolVersion));
-  doipHeader.push_back((uint8_t) ((payload_type & 0xFF00) >> 8));
-  doipHeader.push_back((uint8_t) (payload_type & 0x00FF));
-  doipHeader.push_back((uint8_t) ((payload_len & 0xFF000000) >> 24));
-  doipHeader.push_back((uint8_t) ((payload_len & 0x00FF0000) >> 16));
-  doipHeader.push_back((uint8_t) ((payload_len & 0x0000FF00) >> 8));
-  doipHeader.push_back((uint8_t) (payload_len & 0x000000FF));
+  doipHeader.push_back(static_cast<std::uint8_t>(~kDoip_ProtocolVersion));
+  core_type::AppendBigEndian(doipHeader, payload_type);
+  core_type::AppendBigEndian(doipHeader, payload_len);
 }
 
 void DoipTcpHandler::DoipChannel::SendRoutingActivationResponse() {
@@ -150,8 +145,8 @@ void DoipTcpHandler::DoipChannel::SendRoutingActivationResponse() {
   routing_activation_response->GetTxBuffer().emplace_back(received_doip_message_.payload[0]);
   routing_activation_response->GetTxBuffer().emplace_back(received_doip_message_.payload[1]);
   // logical address of server
-  routing_activation_response->GetTxBuffer().emplace_back(logical_address_ >> 8U);
-  routing_activation_response->GetTxBuffer().emplace_back(logical_address_ & 0xFFU);
+  routing_activation_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ >> 8U));
+  routing_activation_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ & 0xFFU));
   // activation response code
   routing_activation_response->GetTxBuffer().emplace_back(routing_activation_res_code_);
   routing_activation_response->GetTxBuffer().emplace_back(0x00);
@@ -174,8 +169,8 @@ void DoipTcpHandler::DoipChannel::SendDiagnosticMessageAckResponse() {
                             kDoip_DiagMessageAck_ResMinLen);
   }
   // logical address of client
-  diag_msg_ack_response->GetTxBuffer().emplace_back(logical_address_ >> 8U);
-  diag_msg_ack_response->GetTxBuffer().emplace_back(logical_address_ & 0xFFU);
+  diag_msg_ack_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ >> 8U));
+  diag_msg_ack_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ & 0xFFU));
 
   // logical address of target
   diag_msg_ack_response->GetTxBuffer().emplace_back(received_doip_message_.payload[0]);
@@ -197,7 +192,7 @@ void DoipTcpHandler::DoipChannel::SendDiagnosticMessageAckResponse() {
         for (std::uint8_t pending_count{0}; pending_count < num_of_pending_response_; pending_count++) {
           job_queue_.emplace([this]() {
             // wait so that diag positive ack is processed first before sending diag response
-            std::this_thread::sleep_for(std::chrono::milliseconds(25));
+            std::this_thread::sleep_for(response_delay_);
             this->SendDiagnosticPendingMessageResponse();
           });
         }
@@ -205,7 +200,7 @@ void DoipTcpHandler::DoipChannel::SendDiagnosticMessageAckResponse() {
       // emplace a positive response
       job_queue_.emplace([this]() {
         // wait so that diag positive ack is processed first before sending diag response
-        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        std::this_thread::sleep_for(response_delay_);
         this->SendDiagnosticMessageResponse();
       });
       running_ = true;
@@ -224,11 +219,11 @@ void DoipTcpHandler::DoipChannel::SendDiagnosticMessageResponse() {
   diag_uds_message_response->GetTxBuffer().reserve(kDoipheadrSize + kDoip_DiagMessage_ReqResMinLen +
                                                    uds_response_payload_.size());
   CreateDoipGenericHeader(diag_uds_message_response->GetTxBuffer(), kDoip_DiagMessage_Type,
-                          kDoip_DiagMessage_ReqResMinLen + uds_response_payload_.size());
+                          static_cast<std::uint32_t>(kDoip_DiagMessage_ReqResMinLen + uds_response_payload_.size()));
 
   // logical address of client
-  diag_uds_message_response->GetTxBuffer().emplace_back(logical_address_ >> 8U);
-  diag_uds_message_response->GetTxBuffer().emplace_back(logical_address_ & 0xFFU);
+  diag_uds_message_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ >> 8U));
+  diag_uds_message_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ & 0xFFU));
 
   // logical address of target
   diag_uds_message_response->GetTxBuffer().emplace_back(received_doip_message_.payload[0]);
@@ -253,11 +248,12 @@ void DoipTcpHandler::DoipChannel::SendDiagnosticPendingMessageResponse() {
   diag_uds_message_response->GetTxBuffer().reserve(kDoipheadrSize + kDoip_DiagMessage_ReqResMinLen +
                                                    uds_pending_response_payload_.size());
   CreateDoipGenericHeader(diag_uds_message_response->GetTxBuffer(), kDoip_DiagMessage_Type,
-                          kDoip_DiagMessage_ReqResMinLen + uds_pending_response_payload_.size());
+                          static_cast<std::uint32_t>(kDoip_DiagMessage_ReqResMinLen +
+                                                     uds_pending_response_payload_.size()));
 
   // logical address of client
-  diag_uds_message_response->GetTxBuffer().emplace_back(logical_address_ >> 8U);
-  diag_uds_message_response->GetTxBuffer().emplace_back(logical_address_ & 0xFFU);
+  diag_uds_message_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ >> 8U));
+  diag_uds_message_response->GetTxBuffer().emplace_back(static_cast<std::uint8_t>(logical_address_ & 0xFFU));
 
   // logical address of target
   diag_uds_message_response->GetTxBuffer().emplace_back(received_doip_message_.payload[0]);
@@ -290,6 +286,10 @@ void DoipTcpHandler::DoipChannel::SetExpectedDiagnosticMessageUdsMessageToBeSend
   uds_response_payload_ = std::move(payload);
 }
 
+void DoipTcpHandler::DoipChannel::SetResponseDelay(std::chrono::milliseconds response_delay) {
+  response_delay_ = response_delay;
+}
+
 void DoipTcpHandler::DoipChannel::SetExpectedDiagnosticMessageWithPendingUdsMessageToBeSend(
     std::vector<std::uint8_t> payload, std::uint8_t num_of_pending_response) {
   uds_pending_response_payload_.clear();
@@ -9,6 +9,7 @@
 #ifndef DIAG_CLIENT_DOIP_TCP_HANDLER_H
 #define DIAG_CLIENT_DOIP_TCP_HANDLER_H
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -55,6 +56,9 @@ class DoipTcpHandler {
     void SetExpectedDiagnosticMessageWithPendingUdsMessageToBeSend(std::vector<std::uint8_t> payload,
                                                                    std::uint8_t num_of_pending_response);
 
+    // Set the delay before every diagnostic response, so that the positive ack is processed first
+    void SetResponseDelay(std::chrono::milliseconds response_delay);
+
    private:
     // Store the logical address
     std::uint16_t logical_address_;
@@ -95,6 +99,9 @@ class DoipTcpHandler {
     // Total number of pending response
     std::uint8_t num_of_pending_response_;
 
+    // Delay before every diagnostic response
+    std::chrono::milliseconds response_delay_;
+
     // Diag message uds payload
     std::vector<std::uint8_t> uds_response_payload_;
 
@@ -115,7 +122,7 @@ class DoipTcpHandler {
     static auto GetDoIPPayloadLength(core_type::Span<uint8_t> payload) noexcept -> std::uint32_t;
 
     // Function to create the generic header
-    static void CreateDoipGenericHeader(std::vector<uint8_t> &doipHeader, std::uint16_t payload_type,
+    static void CreateDoipGenericHeader(TcpMessage::BufferType &doipHeader, std::uint16_t payload_type,
                                         std::uint32_t payload_len);
 
     // Function to trigger transmission routing activation response
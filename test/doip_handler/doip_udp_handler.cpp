@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "core/include/endian_codec.h"
 #include "doip_handler/common_doip_types.h"
 
 namespace doip_handler {
@@ -129,14 +130,11 @@ void DoipUdpHandler::ProcessUdpUnicastMessage(UdpMessagePtr udp_rx_message) {
 }
 
 auto DoipUdpHandler::GetDoIPPayloadType(core_type::Span<uint8_t> payload) noexcept -> uint16_t {
-  return ((uint16_t) (((payload[BYTE_POS_TWO] & 0xFF) << 8) | (payload[BYTE_POS_THREE] & 0xFF)));
+  return core_type::ReadBigEndian<std::uint16_t>(payload, BYTE_POS_TWO).value_or(0U);
 }
 
 auto DoipUdpHandler::GetDoIPPayloadLength(core_type::Span<uint8_t> payload) noexcept -> uint32_t {
-  return ((uint32_t) ((payload[BYTE_POS_FOUR] << 24U) & 0xFF000000) |
-          (uint32_t) ((payload[BYTE_POS_FIVE] << 16U) & 0x00FF0000) |
-          (uint32_t) ((payload[BYTE_POS_SIX] << 8U) & 0x0000FF00) |
-          (uint32_t) ((payload[BYTE_POS_SEVEN] & 0x000000FF)));
+  return core_type::ReadBigEndian<std::uint32_t>(payload, BYTE_POS_FOUR).value_or(0U);
 }
 
 void DoipUdpHandler::SetExpectedVehicleIdentificationResponseToBeSent(DoipUdpHandler::VehicleAddrInfo& vehicle_info) {
@@ -189,12 +187,8 @@ void DoipUdpHandler::CreateDoipGenericHeader(std::vector<uint8_t>& doipHeader, s
                                              std::uint32_t payload_len) {
   doipHeader.push_back(kDoip_ProtocolVersion);
   doipHeader.push_back(~((uint8_t) kDoip_ProtocolVersion));
-  doipHeader.push_back((uint8_t) ((payload_type & 0xFF00) >> 8));
-  doipHeader.push_back((uint8_t) (payload_type & 0x00FF));
-  doipHeader.push_back((uint8_t) ((payload_len & 0xFF000000) >> 24));
-  doipHeader.push_back((uint8_t) ((payload_len & 0x00FF0000) >> 16));
-  doipHeader.push_back((uint8_t) ((payload_len & 0x0000FF00) >> 8));
-  doipHeader.push_back((uint8_t) (payload_len & 0x000000FF));
+  core_type::AppendBigEndian(doipHeader, payload_type);
+  core_type::AppendBigEndian(doipHeader, payload_len);
 }
 
 }  // namespace doip_handler
\ No newline at end of file
@@ -15,26 +15,24 @@ DoipUdpSocketHandler::DoipUdpSocketHandler(kDoip_String &local_ip_address, uint1
                                            UdpMessageFunctor udp_handler)
     : local_ip_address_{local_ip_address},
       port_num_{port_num},
-      port_type_{port_type} {
+      port_type_{port_type},
+      io_context_{},
+      thread_{} {
   // create sockets and start receiving
-  if (port_type == UdpSocket::PortType::kUdp_Broadcast) {
-    udp_socket_ =
-        std::make_unique<UdpSocket>(local_ip_address_, port_num_, port_type_,
-                                    [this, udp_handler_ = std::move(udp_handler)](UdpMessagePtr udp_rx_message) {
-                                      udp_handler_(std::move(udp_rx_message));
-                                    });
-  } else {
-    udp_socket_ =
-        std::make_unique<UdpSocket>(local_ip_address_, port_num_, port_type_,
-                                    [this, udp_handler_ = std::move(udp_handler)](UdpMessagePtr udp_rx_message) {
-                                      udp_handler_(std::move(udp_rx_message));
-                                    });
-  }
+  udp_socket_ =
+      std::make_unique<UdpSocket>(local_ip_address_, port_num_, port_type_, std::move(udp_handler), io_context_);
 }
 
-void DoipUdpSocketHandler::Start() { udp_socket_->Open(); }
+void DoipUdpSocketHandler::Start() {
+  thread_ = std::thread([this]() { io_context_.Run(); });
+  udp_socket_->Open();
+}
 
-void DoipUdpSocketHandler::Stop() { udp_socket_->Destroy(); }
+void DoipUdpSocketHandler::Stop() {
+  udp_socket_->Destroy();
+  io_context_.Stop();
+  if (thread_.joinable()) { thread_.join(); }
+}
 
 bool DoipUdpSocketHandler::Transmit(UdpMessageConstPtr udpTxMessage) {
   return (udp_socket_->Transmit(std::move(udpTxMessage)).HasValue());
@@ -12,7 +12,9 @@
 //includes
 #include <functional>
 #include <string>
+#include <thread>
 
+#include "socket/io_context.h"
 #include "socket/udp/udp_client.h"
 
 namespace doip_handler {
@@ -66,6 +68,12 @@ class DoipUdpSocketHandler {
   // Port type
   UdpSocket::PortType port_type_;
 
+  // event loop receiving the messages of socket
+  boost_support::socket::IoContext io_context_;
+
+  // thread running the event loop
+  std::thread thread_;
+
   // udp socket
   std::unique_ptr<UdpSocket> udp_socket_;
 };
@@ -8,13 +8,15 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <string>
-#include <thread>
 
+#include "core/include/clock.h"
 #include "doip_handler/doip_udp_handler.h"
 #include "doip_handler/logger.h"
 #include "include/create_diagnostic_client.h"
 #include "include/diagnostic_client.h"
+#include "test_helper.h"
 
 namespace doip_client {
 
@@ -30,7 +32,9 @@ const std::string DiagClientJsonPath{"../../../diag-client-lib/appl/etc/diag_cli
 class DoipClientFixture : public ::testing::Test {
  protected:
   DoipClientFixture()
-      : diag_client_{diag::client::CreateDiagnosticClient(DiagClientJsonPath)},
+      : clock_{},
+        diag_client_{
+            diag::client::CreateDiagnosticClient(DiagClientJsonPath, std::pmr::get_default_resource(), clock_)},
         doip_udp_handler_{DiagUdpIpAddress, DiagUdpPortNum} {
     // Initialize logger
     doip_handler::logger::LibGtestLogger::GetLibGtestLogger();
@@ -38,7 +42,6 @@ class DoipClientFixture : public ::testing::Test {
     doip_udp_handler_.Initialize();
     // Initialize diag client library
     diag_client_->Initialize();
-    std::this_thread::sleep_for(std::chrono::seconds(1));
   }
 
   ~DoipClientFixture() override {
@@ -58,7 +61,17 @@ class DoipClientFixture : public ::testing::Test {
   // Function to get Doip Test Handler reference
   auto GetDoipTestUdpHandlerRef() noexcept -> doip_handler::DoipUdpHandler& { return doip_udp_handler_; }
 
+  // Function to send vehicle identification request on the manual clock of diag client library
+  auto SendVehicleIdentificationRequest(diag::client::vehicle_info::VehicleInfoListRequestType const& request)
+      -> diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                              diag::client::DiagClient::VehicleInfoResponseError> {
+    return doip_client::SendVehicleIdentificationRequest(*diag_client_, clock_, request);
+  }
+
  private:
+  // manual clock driving all timeouts of diag client library
+  core_type::ManualClock clock_;
+
   // diag client library
   std::unique_ptr<diag::client::DiagClient> diag_client_;
 
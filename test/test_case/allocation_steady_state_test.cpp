@@ -0,0 +1,152 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "doip_handler/doip_tcp_handler.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "test_helper.h"
+#include "utility/allocation_counter.h"
+#include "utility/static_capacity.h"
+
+namespace doip_client {
+namespace {
+
+using doip_handler::DoipTcpHandler;
+using utility::allocation::AllocationCount;
+using utility::allocation::Layer;
+
+// Path to json file
+const std::string DiagClientJsonPath{"../../../diag-client-lib/appl/etc/diag_client_config.json"};
+
+// Number of cycles run before the counters are sampled, buffers and pools are sized during these
+constexpr std::size_t kWarmUpCycles{100U};
+
+// Number of cycles that must not allocate
+constexpr std::size_t kSteadyStateCycles{5000U};
+
+// Layers of the library
+constexpr std::array<Layer, 4U> kLibraryLayers{Layer::kDiagClient, Layer::kDoipClient, Layer::kBoostSupport,
+                                               Layer::kUtility};
+
+// Sample the counters of all library layers
+auto SampleLibraryLayers() noexcept -> std::array<AllocationCount, kLibraryLayers.size()> {
+  std::array<AllocationCount, kLibraryLayers.size()> counts{};
+  for (std::size_t index{0U}; index < kLibraryLayers.size(); ++index) {
+    counts[index] = utility::allocation::GetLayerCount(kLibraryLayers[index]);
+  }
+  return counts;
+}
+
+class AllocationSteadyStateFixture : public DoipHandlerFixture {
+ protected:
+  AllocationSteadyStateFixture() : diag_client_{diag::client::CreateDiagnosticClient(DiagClientJsonPath)} {}
+
+  // Function to get Diag client library reference
+  auto GetDiagClientRef() noexcept -> diag::client::DiagClient& { return *diag_client_; }
+
+ private:
+  // diag client library
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+// Sum the allocations of all library layers made by the given thread, the dcm thread may still be initializing
+auto CountThreadLibraryAllocations(std::uint32_t thread_id) noexcept -> std::uint64_t {
+  std::uint64_t allocations{0U};
+  for (std::size_t index{0U}; index < utility::allocation::GetThreadCount(); ++index) {
+    std::optional<utility::allocation::ThreadAllocationCount> const thread_count{
+        utility::allocation::GetThreadAllocationCount(index)};
+    if (thread_count && (thread_count->thread_id == thread_id)) {
+      for (Layer const layer: kLibraryLayers) {
+        allocations += thread_count->layers[static_cast<std::size_t>(layer)].allocations;
+      }
+    }
+  }
+  return allocations;
+}
+
+}  // namespace
+
+TEST_F(AllocationSteadyStateFixture, RequestPathDoesNotAllocateAfterWarmUp) {
+  if constexpr (!utility::allocation::kAllocationCounterCompiled) {
+    GTEST_SKIP() << "Allocation counting requires BUILD_WITH_ALLOCATION_COUNTER";
+  }
+  ASSERT_TRUE(GetDiagClientRef().Initialize().HasValue());
+
+  // Get the doip channel and Initialize it
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+  doip_channel.SetResponseDelay(std::chrono::milliseconds(0));
+
+  // Get conversation for tester one, start up the conversation and connect
+  diag::client::conversation::DiagClientConversation diag_client_conversation{
+      GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+  ASSERT_EQ(diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  // The request is created by the application, allocations of the test thread are attributed to the application
+  auto run_cycles = [&diag_client_conversation](std::size_t cycle_count) {
+    std::size_t failed_cycle_count{0U};
+    for (std::size_t cycle{0U}; cycle < cycle_count; ++cycle) {
+      auto response{diag_client_conversation.SendDiagnosticRequest(
+          std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+      if (!response.HasValue() || (response.Value()->GetPayload()[0U] != 0x50U)) { ++failed_cycle_count; }
+    }
+    return failed_cycle_count;
+  };
+
+  EXPECT_EQ(run_cycles(kWarmUpCycles), 0U);
+  std::array<AllocationCount, kLibraryLayers.size()> const warm_counts{SampleLibraryLayers()};
+  EXPECT_EQ(run_cycles(kSteadyStateCycles), 0U);
+  std::array<AllocationCount, kLibraryLayers.size()> const steady_counts{SampleLibraryLayers()};
+
+  for (std::size_t index{0U}; index < kLibraryLayers.size(); ++index) {
+    EXPECT_EQ(steady_counts[index].allocations - warm_counts[index].allocations, 0U)
+        << "Layer '" << utility::allocation::GetLayerName(kLibraryLayers[index]) << "' allocated "
+        << (steady_counts[index].bytes - warm_counts[index].bytes) << " bytes in " << kSteadyStateCycles
+        << " cycles after warm-up";
+  }
+
+  EXPECT_EQ(diag_client_conversation.DisconnectFromDiagServer(),
+            diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  diag_client_conversation.Shutdown();
+  doip_channel.DeInitialize();
+  GetDiagClientRef().DeInitialize();
+}
+
+TEST_F(AllocationSteadyStateFixture, ConversationIsPreallocatedInEmbeddedProfile) {
+  if constexpr (!utility::allocation::kAllocationCounterCompiled || !utility::capacity::kStaticCapacity) {
+    GTEST_SKIP() << "Requires BUILD_WITH_ALLOCATION_COUNTER and BUILD_PROFILE=EMBEDDED";
+  }
+  ASSERT_TRUE(GetDiagClientRef().Initialize().HasValue());
+
+  // the conversations are created on the test thread
+  std::uint32_t const test_thread_id{utility::allocation::GetCurrentThreadId()};
+  std::uint64_t const initialized_allocations{CountThreadLibraryAllocations(test_thread_id)};
+  {
+    diag::client::conversation::DiagClientConversation diag_client_conversation_one{
+        GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+    diag::client::conversation::DiagClientConversation diag_client_conversation_two{
+        GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  }
+  EXPECT_EQ(CountThreadLibraryAllocations(test_thread_id) - initialized_allocations, 0U);
+
+  GetDiagClientRef().DeInitialize();
+}
+
+}  // namespace doip_client
@@ -0,0 +1,176 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utility/async_log_backend.h"
+#include "utility/log_format.h"
+#include "utility/log_rate_limiter.h"
+#include "utility/logger.h"
+
+namespace utility {
+namespace logger {
+
+/**
+ * @brief    Log sink collecting all lines in memory
+ */
+class MemoryLogSink final : public LogSink {
+ public:
+  explicit MemoryLogSink(std::vector<std::string> &lines) noexcept : lines_{lines} {}
+
+  void Write(std::string_view line) noexcept override {
+    std::lock_guard<std::mutex> const lck{mutex_};
+    lines_.emplace_back(line);
+  }
+
+  void Flush() noexcept override {}
+
+ private:
+  std::vector<std::string> &lines_;
+
+  std::mutex mutex_;
+};
+
+// Fixture to test the asynchronous logging backend
+class AsyncLoggerFixture : public ::testing::Test {
+ protected:
+  void SetUp() override { AsyncLogBackend::GetInstance().SetSink(std::make_unique<MemoryLogSink>(lines_)); }
+
+  void TearDown() override { AsyncLogBackend::GetInstance().SetSink(std::make_unique<StreamLogSink>(stdout)); }
+
+  static void Log(std::string_view format, std::uint16_t value, std::string_view text) {
+    AsyncLogBackend &backend{AsyncLogBackend::GetInstance()};
+    LogRecord *const record{backend.AcquireRecord()};
+    ASSERT_NE(record, nullptr);
+    record->timestamp_ns = 0;
+    record->file_name = __FILE__;
+    record->func_name = __func__;
+    record->format = format;
+    record->line_no = 42;
+    record->level = LogLevel::kInfo;
+    record->context = {'t', 'e', 's', 't'};
+    record->context_size = 4U;
+    LogArgumentEncoder encoder{*record};
+    encoder.Encode(value);
+    encoder.Encode(text);
+    backend.CommitRecord();
+  }
+
+  std::vector<std::string> lines_{};
+};
+
+TEST_F(AsyncLoggerFixture, FormatRecordWithArguments) {
+  Log("Sent {} bytes to {}", 8U, "172.16.25.128");
+  AsyncLogBackend::GetInstance().Flush();
+
+  ASSERT_EQ(lines_.size(), 1U);
+  EXPECT_NE(lines_[0].find("test info    Sent 8 bytes to 172.16.25.128 ["), std::string::npos);
+  EXPECT_NE(lines_[0].find(":42]\n"), std::string::npos);
+}
+
+TEST_F(AsyncLoggerFixture, RecordsFromMultipleThreadsAreFormatted) {
+  constexpr std::uint16_t kRecordsPerThread{100U};
+  std::vector<std::thread> producers{};
+  for (std::uint8_t thread_index{0U}; thread_index < 4U; ++thread_index) {
+    producers.emplace_back([]() {
+      for (std::uint16_t count{0U}; count < kRecordsPerThread; ++count) { Log("Record {} {}", count, "thread"); }
+    });
+  }
+  for (std::thread &producer: producers) { producer.join(); }
+  AsyncLogBackend::GetInstance().Flush();
+
+  EXPECT_EQ(lines_.size(), 4U * kRecordsPerThread);
+}
+
+TEST(LogArgumentStreamTest, FunctorTextIsWrittenIntoRecord) {
+  LogRecord record{};
+  record.format = "{}";
+  std::string line{};
+
+  LogArgumentEncoder first_encoder{record};
+  LogArgumentStream::GetThreadInstance().Encode(
+      first_encoder, [](std::stringstream &msg) { msg << "LA= 0x" << std::hex << 0xFA1U; });
+  AsyncLogBackend::FormatRecord(record, line);
+  EXPECT_NE(line.find(" LA= 0xfa1 ["), std::string::npos);
+
+  // the next message starts in default format state
+  line.clear();
+  LogArgumentEncoder second_encoder{record};
+  LogArgumentStream::GetThreadInstance().Encode(second_encoder, [](std::stringstream &msg) { msg << 255; });
+  AsyncLogBackend::FormatRecord(record, line);
+  EXPECT_NE(line.find(" 255 ["), std::string::npos);
+
+  // text not fitting into the argument area is dropped
+  line.clear();
+  LogArgumentEncoder third_encoder{record};
+  LogArgumentStream::GetThreadInstance().Encode(
+      third_encoder, [](std::stringstream &msg) { msg << std::string(LogRecord::kMaxArgumentSize, 'x') << "end"; });
+  AsyncLogBackend::FormatRecord(record, line);
+  EXPECT_EQ(record.arguments_size, LogRecord::kMaxArgumentSize);
+  EXPECT_EQ(line.find("end"), std::string::npos);
+}
+
+TEST(LogFormatTest, FormatToReplacesPlaceholders) {
+  std::string line{};
+  format::FormatTo(line, "Udp message sent : <{},{}> -> <{}> {}", std::string{"172.16.25.127"}, std::uint16_t{13400U},
+                   "172.16.25.255", std::uint8_t{7U});
+  EXPECT_EQ(line, "Udp message sent : <172.16.25.127,13400> -> <172.16.25.255> 7");
+
+  line.clear();
+  format::FormatTo(line, "missing {} argument {}", true);
+  EXPECT_EQ(line, "missing true argument ");
+
+  line.clear();
+  format::FormatTo(line, "latency {} ms, load {}", 1.5, 0.25F);
+  EXPECT_EQ(line, "latency 1.5 ms, load 0.25");
+}
+
+TEST(LogRateLimiterTest, SuppressesMessagesAfterBurst) {
+  LogRateLimiter rate_limiter{3U, std::chrono::hours{1U}};
+
+  EXPECT_TRUE(rate_limiter.TryAcquire());
+  EXPECT_TRUE(rate_limiter.TryAcquire());
+  EXPECT_TRUE(rate_limiter.TryAcquire());
+  EXPECT_FALSE(rate_limiter.TryAcquire());
+  EXPECT_FALSE(rate_limiter.TryAcquire());
+  EXPECT_EQ(rate_limiter.TakeSuppressedCount(), 2U);
+  EXPECT_EQ(rate_limiter.TakeSuppressedCount(), 0U);
+}
+
+TEST(LoggerTest, SetLogLevelByContextId) {
+  Logger logger{"tst1"};
+  EXPECT_EQ(logger.GetLogLevel(), LogLevel::kVerbose);
+
+  EXPECT_TRUE(Logger::SetLogLevel("tst1", LogLevel::kError));
+  EXPECT_EQ(logger.GetLogLevel(), LogLevel::kError);
+  // levels above the runtime level are filtered, the others are logged when compiled into the configured build
+  EXPECT_FALSE(logger.IsLogLevelEnabled(LogLevel::kWarn));
+  EXPECT_EQ(logger.IsLogLevelEnabled(LogLevel::kError), IsLogLevelCompiled(LogLevel::kError));
+  EXPECT_EQ(logger.IsLogLevelEnabled(LogLevel::kFatal), IsLogLevelCompiled(LogLevel::kFatal));
+
+  EXPECT_FALSE(Logger::SetLogLevel("none", LogLevel::kError));
+}
+
+TEST(LoggerTest, SetLogLevelAppliesToLoggerCreatedLater) {
+  EXPECT_FALSE(Logger::SetLogLevel("tst2", LogLevel::kDebug));
+
+  Logger logger{"tst2"};
+  EXPECT_EQ(logger.GetLogLevel(), LogLevel::kDebug);
+
+  Logger other_logger{"tst3"};
+  EXPECT_EQ(other_logger.GetLogLevel(), LogLevel::kVerbose);
+}
+
+}  // namespace logger
+}  // namespace utility
@@ -0,0 +1,211 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "doip_handler/doip_tcp_handler.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "test_helper.h"
+
+namespace doip_client {
+namespace {
+
+using doip_handler::DoipTcpHandler;
+using diag::client::config::ConversationConfig;
+using diag::client::config::DiagClientConfig;
+using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+
+// Conversations with the running timing and with shortened P2 client time
+constexpr ConversationConfig kTesterOne{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0001U, "172.16.25.127"};
+constexpr ConversationConfig kTesterOneShortP2{"DiagTesterOne", 100U, 5000U, 4095U, 0x0001U, "172.16.25.127"};
+constexpr ConversationConfig kTesterOneNewSource{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0003U, "172.16.25.127"};
+constexpr ConversationConfig kTesterTwo{"DiagTesterTwo", 2000U, 5000U, 4095U, 0x0002U, "172.16.25.127"};
+
+constexpr std::array<ConversationConfig, 1U> kTesterOneOnly{kTesterOne};
+constexpr std::array<ConversationConfig, 1U> kTesterOneShortP2Only{kTesterOneShortP2};
+constexpr std::array<ConversationConfig, 1U> kTesterOneNewSourceOnly{kTesterOneNewSource};
+constexpr std::array<ConversationConfig, 2U> kTesterOneAndTwo{kTesterOne, kTesterTwo};
+constexpr std::array<ConversationConfig, 1U> kTesterTwoOnly{kTesterTwo};
+
+// Function to get the config of the given conversations
+template<std::size_t N>
+constexpr DiagClientConfig MakeConfig(std::array<ConversationConfig, N> const &conversations,
+                                      std::string_view udp_ip_address = "172.16.25.127") {
+  return DiagClientConfig{udp_ip_address, "172.16.255.255", core_type::Span<ConversationConfig const>{conversations}};
+}
+
+// Function to get the names of conversations in metrics snapshot
+std::vector<std::string> GetConversationNames(diag::client::DiagClient const &diag_client) {
+  std::vector<std::string> names{};
+  for (auto const &metrics: diag_client.GetMetricsSnapshot()) { names.emplace_back(metrics.conversation_name); }
+  return names;
+}
+
+class ConfigReloadFixture : public DoipHandlerFixture {
+ protected:
+  ConfigReloadFixture() : diag_client_{diag::client::CreateDiagnosticClient(MakeConfig(kTesterOneOnly))} {}
+
+  void SetUp() override { ASSERT_TRUE(diag_client_->Initialize().HasValue()); }
+
+  void TearDown() override { EXPECT_TRUE(diag_client_->DeInitialize().HasValue()); }
+
+  // Function to get diag client reference
+  auto GetDiagClientRef() noexcept -> diag::client::DiagClient& { return *diag_client_; }
+
+  // Function to send 10 01 on the conversation, returns whether the positive response is received
+  static auto SendDefaultSessionRequest(DiagClientConversation& diag_client_conversation) -> bool {
+    auto response{diag_client_conversation.SendDiagnosticRequest(
+        std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+    return response.HasValue() && response.Value()->GetPayload()[0U] == 0x50U;
+  }
+
+ private:
+  // diag client under test
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+}  // namespace
+
+TEST(ConfigReloadTest, ReloadBeforeInitializeFails) {
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(MakeConfig(kTesterOneOnly))};
+  EXPECT_FALSE(diag_client->Reload(MakeConfig(kTesterOneAndTwo)).HasValue());
+}
+
+TEST_F(ConfigReloadFixture, ReloadUpdatesTimingOfConnectedConversation) {
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+  doip_channel.SetResponseDelay(std::chrono::milliseconds{300});
+
+  DiagClientConversation diag_client_conversation{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+  ASSERT_EQ(diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            DiagClientConversation::ConnectResult::kConnectSuccess);
+  EXPECT_TRUE(SendDefaultSessionRequest(diag_client_conversation));
+
+  // the response delay exceeds the shortened P2 client time of the same connection
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneShortP2Only)).HasValue());
+  EXPECT_FALSE(SendDefaultSessionRequest(diag_client_conversation));
+  // let the late response pass
+  std::this_thread::sleep_for(std::chrono::milliseconds{400});
+
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneOnly)).HasValue());
+  EXPECT_TRUE(SendDefaultSessionRequest(diag_client_conversation));
+
+  EXPECT_EQ(diag_client_conversation.DisconnectFromDiagServer(),
+            DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  diag_client_conversation.Shutdown();
+  doip_channel.DeInitialize();
+}
+
+TEST_F(ConfigReloadFixture, ReloadAddsAndDrainsConversations) {
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  DiagClientConversation tester_one{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  tester_one.Startup();
+  ASSERT_EQ(tester_one.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneAndTwo)).HasValue());
+  EXPECT_EQ(GetConversationNames(GetDiagClientRef()), (std::vector<std::string>{"DiagTesterOne", "DiagTesterTwo"}));
+
+  // the removed conversation is no longer listed, but keeps working for its holder until shut down
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterTwoOnly)).HasValue());
+  EXPECT_EQ(GetConversationNames(GetDiagClientRef()), (std::vector<std::string>{"DiagTesterTwo"}));
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_one));
+  EXPECT_EQ(tester_one.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester_one.Shutdown();
+
+  // the added conversation is usable, the test channel accepts one connection at a time
+  doip_channel.DeInitialize();
+  doip_channel.Initialize();
+  DiagClientConversation tester_two{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterTwo")};
+  tester_two.Startup();
+  ASSERT_EQ(tester_two.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            DiagClientConversation::ConnectResult::kConnectSuccess);
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_two));
+  EXPECT_EQ(tester_two.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester_two.Shutdown();
+  doip_channel.DeInitialize();
+}
+
+TEST_F(ConfigReloadFixture, ReplacedConversationKeepsWorkingAfterRemoval) {
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  DiagClientConversation tester_one{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  tester_one.Startup();
+  ASSERT_EQ(tester_one.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  // the changed source address drains the running object, the next reload removes the conversation
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneNewSourceOnly)).HasValue());
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterTwoOnly)).HasValue());
+  EXPECT_EQ(GetConversationNames(GetDiagClientRef()), (std::vector<std::string>{"DiagTesterTwo"}));
+
+  // the drained object still records its metrics on the next request
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_one));
+  EXPECT_EQ(tester_one.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester_one.Shutdown();
+  doip_channel.DeInitialize();
+}
+
+TEST_F(ConfigReloadFixture, ReloadRejectsChangedVehicleDiscoveryAddress) {
+  EXPECT_FALSE(GetDiagClientRef().Reload(MakeConfig(kTesterOneAndTwo, "172.16.25.126")).HasValue());
+  EXPECT_EQ(GetConversationNames(GetDiagClientRef()), (std::vector<std::string>{"DiagTesterOne"}));
+}
+
+TEST_F(ConfigReloadFixture, ReloadedConfigIsKeptOverReInitialization) {
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneAndTwo)).HasValue());
+
+  ASSERT_TRUE(GetDiagClientRef().DeInitialize().HasValue());
+  ASSERT_TRUE(GetDiagClientRef().Initialize().HasValue());
+  EXPECT_EQ(GetConversationNames(GetDiagClientRef()), (std::vector<std::string>{"DiagTesterOne", "DiagTesterTwo"}));
+}
+
+TEST_F(ConfigReloadFixture, ReloadReleasesDrainedConversationDroppedWithoutShutdown) {
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  {  // the application drops the connected conversation after it is drained, without disconnecting
+    DiagClientConversation tester_one{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+    tester_one.Startup();
+    ASSERT_EQ(tester_one.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+              DiagClientConversation::ConnectResult::kConnectSuccess);
+    ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterTwoOnly)).HasValue());
+  }
+
+  // the next reload shuts down and releases the drained object, the conversation added again is usable
+  ASSERT_TRUE(GetDiagClientRef().Reload(MakeConfig(kTesterOneAndTwo)).HasValue());
+  doip_channel.DeInitialize();
+  doip_channel.Initialize();
+  DiagClientConversation tester_one{GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  tester_one.Startup();
+  ASSERT_EQ(tester_one.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            DiagClientConversation::ConnectResult::kConnectSuccess);
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_one));
+  EXPECT_EQ(tester_one.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester_one.Shutdown();
+  doip_channel.DeInitialize();
+}
+
+}  // namespace doip_client
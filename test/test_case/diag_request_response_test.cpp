@@ -8,93 +8,50 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <memory_resource>
 #include <string>
-#include <string_view>
 #include <thread>
 #include <utility>
 
+#include "core/include/clock.h"
 #include "doip_handler/common_doip_types.h"
 #include "doip_handler/doip_tcp_handler.h"
-#include "doip_handler/doip_udp_handler.h"
-#include "doip_handler/logger.h"
 #include "include/create_diagnostic_client.h"
 #include "include/diagnostic_client.h"
-#include "include/diagnostic_client_uds_message_type.h"
+#include "test_helper.h"
 
 namespace doip_client {
 namespace {
 
 using doip_handler::DoipTcpHandler;
-using doip_handler::DoipUdpHandler;
-
-// Diag Test Server Udp Ip Address
-const std::string DiagUdpIpAddress{"172.16.25.128"};
-
-// Diag Test Server Tcp Ip Address
-const std::string DiagTcpIpAddress{"172.16.25.128"};
-
-// Diag Test Server logical address
-const std::uint16_t DiagServerLogicalAddress{0xFA25U};
 
 // Diag Second Test Server logical address
 const std::uint16_t DiagSecondServerLogicalAddress{0xFA26U};
 
-// Port number
-constexpr std::uint16_t DiagUdpPortNum{13400u};
-constexpr std::uint16_t DiagTcpPortNum{13400u};
-
 // Path to json file
 const std::string DiagClientJsonPath{"../../../diag-client-lib/appl/etc/diag_client_config.json"};
 
-class UdsMessage : public diag::client::uds_message::UdsMessage {
- public:
-  // alias of ByteVector
-  using ByteVector = diag::client::uds_message::UdsMessage::ByteVector;
-
- public:
-  // ctor
-  UdsMessage(std::string_view host_ip_address, ByteVector payload)
-      : host_ip_address(host_ip_address),
-        uds_payload{std::move(payload)} {}
-
-  // dtor
-  ~UdsMessage() override = default;
+// Time the conversation DiagTesterOne waits for the first response
+constexpr std::chrono::milliseconds P2ClientMax{1000u};
 
- private:
-  // host ip address
-  IpAddress host_ip_address;
-  // store only UDS payload to be sent
-  ByteVector uds_payload;
-
-  const ByteVector& GetPayload() const override { return uds_payload; }
-
-  // return the underlying buffer for write access
-  ByteVector& GetPayload() override { return uds_payload; }
+// Real time the test handler delays its responses to let a request time out
+constexpr std::chrono::milliseconds DelayedResponse{200u};
 
-  // Get Host Ip address
-  IpAddress GetHostIpAddress() const noexcept override { return host_ip_address; };
-};
-
-class DiagReqResFixture : public ::testing::Test {
+class DiagReqResFixture : public DoipHandlerFixture {
  protected:
   DiagReqResFixture()
-      : diag_client_{diag::client::CreateDiagnosticClient(DiagClientJsonPath)},
-        doip_udp_handler_{DiagUdpIpAddress, DiagUdpPortNum},
-        doip_tcp_handler_{DiagTcpIpAddress, DiagTcpPortNum} {
-    // Initialize logger
-    doip_handler::logger::LibGtestLogger::GetLibGtestLogger();
-    // Initialize doip test handler
-    doip_udp_handler_.Initialize();
+      : clock_{},
+        diag_client_{
+            diag::client::CreateDiagnosticClient(DiagClientJsonPath, std::pmr::get_default_resource(), clock_)} {
     // Initialize diag client library
     assert(diag_client_->Initialize() && "Initialization of DiagClient failed");
-    std::this_thread::sleep_for(std::chrono::seconds(1));
   }
 
   ~DiagReqResFixture() override {
     // De-initialize diag client library
     diag_client_->DeInitialize();
-    // De-initialize doip test handler
-    doip_udp_handler_.DeInitialize();
   }
 
   void SetUp() override {}
@@ -104,21 +61,22 @@ class DiagReqResFixture : public ::testing::Test {
   // Function to get Diag client library reference
   auto GetDiagClientRef() noexcept -> diag::client::DiagClient& { return *diag_client_; }
 
-  // Function to get Doip Test Handler reference
-  auto GetDoipTestUdpHandlerRef() noexcept -> DoipUdpHandler& { return doip_udp_handler_; }
+  // Function to get the manual clock reference
+  auto GetClockRef() noexcept -> core_type::ManualClock& { return clock_; }
 
-  // Function to get Doip Tcp Test Handler reference
-  auto GetDoipTestTcpHandlerRef() noexcept -> DoipTcpHandler& { return doip_tcp_handler_; }
+  // Function to send vehicle identification request on the manual clock of diag client library
+  auto SendVehicleIdentificationRequest(diag::client::vehicle_info::VehicleInfoListRequestType const& request)
+      -> diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                              diag::client::DiagClient::VehicleInfoResponseError> {
+    return doip_client::SendVehicleIdentificationRequest(*diag_client_, clock_, request);
+  }
 
  private:
+  // manual clock driving all timeouts of diag client library
+  core_type::ManualClock clock_;
+
   // diag client library
   std::unique_ptr<diag::client::DiagClient> diag_client_;
-
-  // doip udp test handler
-  DoipUdpHandler doip_udp_handler_;
-
-  // doip tcp test handler
-  DoipTcpHandler doip_tcp_handler_;
 };
 
 }  // namespace
@@ -135,7 +93,7 @@ TEST_F(DiagReqResFixture, VerifyRoutingActivationSuccessful) {
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
-      diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagTcpIpAddress)};
+      diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress)};
 
   EXPECT_EQ(connect_result, diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
 
@@ -164,7 +122,7 @@ TEST_F(DiagReqResFixture, VerifyRoutingActivationFailure) {
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
-      diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagTcpIpAddress)};
+      diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress)};
 
   EXPECT_EQ(connect_result, diag::client::conversation::DiagClientConversation::ConnectResult::kConnectFailed);
 
@@ -185,7 +143,7 @@ TEST_F(DiagReqResFixture, VerifyDiagPositiveResponseDiagSession) {
 
   // Create uds message
   diag::client::uds_message::UdsRequestMessagePtr uds_message{
-      std::make_unique<UdsMessage>(DiagTcpIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
   // Create expected uds response
   doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
 
@@ -234,7 +192,7 @@ TEST_F(DiagReqResFixture, VerifyDiagNegativeResponseDiagSession) {
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::uds_message::UdsRequestMessagePtr uds_message{
-      std::make_unique<UdsMessage>(DiagTcpIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
       diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, uds_message->GetHostIpAddress())};
 
@@ -273,7 +231,7 @@ TEST_F(DiagReqResFixture, VerifyDiagPositiveResponseReadDID) {
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::uds_message::UdsRequestMessagePtr uds_message{
-      std::make_unique<UdsMessage>(DiagTcpIpAddress, UdsMessage::ByteVector{0x22, 0xF1, 0x90})};
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x22, 0xF1, 0x90})};
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
       diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, uds_message->GetHostIpAddress())};
 
@@ -314,7 +272,7 @@ TEST_F(DiagReqResFixture, VerifyDiagPendingResponse) {
 
   // Create uds message
   diag::client::uds_message::UdsRequestMessagePtr uds_message{
-      std::make_unique<UdsMessage>(DiagTcpIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
@@ -340,6 +298,72 @@ TEST_F(DiagReqResFixture, VerifyDiagPendingResponse) {
   doip_channel.DeInitialize();
 }
 
+TEST_F(DiagReqResFixture, VerifyPendingResponseCountIsOnlyRecordedForReceivedResponses) {
+  // Get the doip channel and Initialize it
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(0xFA25U)};
+  doip_channel.Initialize();
+
+  // Create expected uds pending response and positive response
+  doip_channel.SetExpectedDiagnosticMessageWithPendingUdsMessageToBeSend(UdsMessage::ByteVector{0x7F, 0x10, 0x78}, 1u);
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  // Get conversation for tester one and start up the conversation
+  diag::client::conversation::DiagClientConversation diag_client_conversation{
+      GetDiagClientRef().GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+
+  auto get_metrics = [this]() -> diag::client::metrics::ConversationMetricsSnapshot {
+    for (auto& metrics: GetDiagClientRef().GetMetricsSnapshot()) {
+      if (metrics.conversation_name == "DiagTesterOne") { return metrics; }
+    }
+    return {};
+  };
+
+  // Connect Tester One to remote ip address 172.16.25.128
+  diag::client::conversation::DiagClientConversation::ConnectResult connect_result{
+      diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress)};
+
+  EXPECT_EQ(connect_result, diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  // Send Diagnostic message and verify positive response after the pending response
+  auto const diag_result_with_pending{diag_client_conversation.SendDiagnosticRequest(
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+  EXPECT_TRUE(diag_result_with_pending.HasValue());
+
+  // Send Diagnostic message whose responses arrive after P2 client max
+  doip_channel.SetResponseDelay(DelayedResponse);
+  auto diag_result{std::async(std::launch::async, [&diag_client_conversation]() {
+    return diag_client_conversation.SendDiagnosticRequest(
+        std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}));
+  })};
+  // the response is waited for once the acknowledgement was received
+  while ((get_metrics().ack_latency.count != 2u) || (GetClockRef().GetWaitingCount() == 0u)) {
+    std::this_thread::sleep_for(PollInterval);
+  }
+  GetClockRef().Advance(P2ClientMax);
+
+  // Verify response timeout
+  auto const timed_out_result{diag_result.get()};
+  EXPECT_FALSE(timed_out_result.HasValue());
+  EXPECT_EQ(timed_out_result.Error(),
+            diag::client::conversation::DiagClientConversation::DiagError::kDiagResponseTimeout);
+
+  // Verify that only the received response counted its pending responses
+  diag::client::metrics::ConversationMetricsSnapshot const metrics{get_metrics()};
+  EXPECT_EQ(metrics.ack_latency.count, 2u);
+  EXPECT_EQ(metrics.pending_response_count.count, 1u);
+  EXPECT_EQ(metrics.pending_response_count.max, 1u);
+
+  diag::client::conversation::DiagClientConversation::DisconnectResult disconnect_result{
+      diag_client_conversation.DisconnectFromDiagServer()};
+
+  EXPECT_EQ(disconnect_result,
+            diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+
+  diag_client_conversation.Shutdown();
+  doip_channel.DeInitialize();
+}
+
 TEST_F(DiagReqResFixture, VerifyDiagNegAcknowledgement) {
   // Get the doip channel and Initialize it
   DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(0xFA25U)};
@@ -347,7 +371,7 @@ TEST_F(DiagReqResFixture, VerifyDiagNegAcknowledgement) {
 
   // Create uds message
   diag::client::uds_message::UdsRequestMessagePtr uds_message{
-      std::make_unique<UdsMessage>(DiagTcpIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01})};
   // Create expected Diag NACK
   doip_channel.SetExpectedDiagnosticMessageAckResponseToBeSend(kDoip_DiagnosticMessage_NegAckCode_InvalidSA);
 
@@ -399,7 +423,7 @@ TEST_F(DiagReqResFixture, VerifyDiagReqResponseWithVehicleDiscovery) {
   diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{1U, "ABCDEFGH123456789"};
   diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                        diag::client::DiagClient::VehicleInfoResponseError>
-      response_result{GetDiagClientRef().SendVehicleIdentificationRequest(vehicle_info_request)};
+      response_result{SendVehicleIdentificationRequest(vehicle_info_request)};
 
   // Verify Vehicle identification responses
   EXPECT_TRUE(response_result.HasValue());
@@ -462,10 +486,10 @@ TEST_F(DiagReqResFixture, VerifyTwoDiagClientConnection) {
 
   // Connect Tester One to remote ip address 172.16.25.128
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result_1{
-      diag_client_conversation_1.ConnectToDiagServer(DiagServerLogicalAddress, DiagTcpIpAddress)};
+      diag_client_conversation_1.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress)};
 
   diag::client::conversation::DiagClientConversation::ConnectResult connect_result_2{
-      diag_client_conversation_2.ConnectToDiagServer(DiagSecondServerLogicalAddress, DiagTcpIpAddress)};
+      diag_client_conversation_2.ConnectToDiagServer(DiagSecondServerLogicalAddress, DiagIpAddress)};
 
   EXPECT_EQ(connect_result_1, diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
 
@@ -0,0 +1,200 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "simulator/doip_simulator.h"
+#include "simulator/simulator_config.h"
+#include "simulator/uds_responder.h"
+#include "test_helper.h"
+
+namespace doip_simulator {
+namespace {
+
+using diag::client::config::ConversationConfig;
+using diag::client::config::DiagClientConfig;
+using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+using doip_client::UdsMessage;
+using ByteVector = std::vector<std::uint8_t>;
+
+// Vin of the simulated gateway
+constexpr std::string_view kGatewayVin{"SIMGATEWAY0000001"};
+
+// Function to get the config of an ecu answering after the latency with the given pending responses
+EcuConfig MakeEcuConfig(std::uint16_t logical_address, std::uint8_t pending_response_count) {
+  return EcuConfig{logical_address,
+                   std::chrono::milliseconds{5},
+                   pending_response_count,
+                   std::chrono::milliseconds{20},
+                   {{0xF187U, ByteVector{0x53U, 0x49U, 0x4DU}}},
+                   {{0x012345U, 0x2FU}, {0xC12300U, 0x08U}}};
+}
+
+// Function to call the responder with the request
+std::vector<ScheduledResponse> Respond(UdsResponder const& responder, ByteVector const& request) {
+  return responder.Respond(core_type::Span<std::uint8_t const>{request.data(), request.size()});
+}
+
+// Function to read the configuration out of json text
+core_type::Result<SimulatorConfig, std::string> ReadConfig(std::string const& json) {
+  std::stringstream stream{json};
+  boost_support::parser::boost_tree config_tree{};
+  boost::property_tree::read_json(stream, config_tree);
+  return ReadSimulatorConfig(config_tree);
+}
+
+// Conversation talking to the simulated entities on loopback
+constexpr std::array<ConversationConfig, 1U> kConversations{
+    {{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0E80U, "127.0.0.1"}}};
+
+class DoipSimulatorFixture : public ::testing::Test {
+ protected:
+  DoipSimulatorFixture()
+      : simulator_{ReadConfig(R"({"BroadcastListener": false, "Announcement": {"Count": 0}, "Entities": [
+            {"IpAddress": "127.0.3.1", "LogicalAddress": "0x3000", "Vin": "SIMGATEWAY0000001",
+             "Ecus": [{"LogicalAddress": "0x3001", "ResponseLatencyMs": 5, "PendingResponses": 2,
+                       "PendingIntervalMs": 20, "Dids": {"F187": "53 49 4D"}}]},
+            {"IpAddress": "127.0.4.1", "Count": 3, "LogicalAddress": "0x4000", "Vin": "SIMFLEETVEHICLE00"}]})")
+                       .Value()},
+        diag_client_{diag::client::CreateDiagnosticClient(DiagClientConfig{
+            "127.0.0.1", "127.255.255.255", core_type::Span<ConversationConfig const>{kConversations}})} {}
+
+  void SetUp() override {
+    ASSERT_TRUE(simulator_.Start(1U).HasValue());
+    ASSERT_TRUE(diag_client_->Initialize().HasValue());
+  }
+
+  void TearDown() override {
+    EXPECT_TRUE(diag_client_->DeInitialize().HasValue());
+    simulator_.Stop();
+  }
+
+  // Function to get the simulator
+  auto GetSimulator() noexcept -> DoipSimulator& { return simulator_; }
+
+  // Function to get the diag client
+  auto GetDiagClient() noexcept -> diag::client::DiagClient& { return *diag_client_; }
+
+ private:
+  // simulated entities
+  DoipSimulator simulator_;
+
+  // diag client under test
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+}  // namespace
+
+TEST(UdsResponderTest, ReadDataByIdentifierReturnsScriptedDataAndVin) {
+  EcuConfig const ecu{MakeEcuConfig(0x1001U, 0U)};
+  UdsResponder const responder{ecu, kGatewayVin};
+  std::vector<ScheduledResponse> const responses{Respond(responder, ByteVector{0x22U, 0xF1U, 0x87U, 0xF1U, 0x90U})};
+  ASSERT_EQ(responses.size(), 1U);
+  EXPECT_EQ(responses[0U].delay, std::chrono::milliseconds{5});
+  ByteVector expected{0x62U, 0xF1U, 0x87U, 0x53U, 0x49U, 0x4DU, 0xF1U, 0x90U};
+  expected.insert(expected.end(), kGatewayVin.begin(), kGatewayVin.end());
+  EXPECT_EQ(responses[0U].payload, expected);
+
+  EXPECT_EQ(Respond(responder, ByteVector{0x22U, 0x12U, 0x34U})[0U].payload, (ByteVector{0x7FU, 0x22U, 0x31U}));
+  EXPECT_EQ(Respond(responder, ByteVector{0x22U, 0xF1U})[0U].payload, (ByteVector{0x7FU, 0x22U, 0x13U}));
+}
+
+TEST(UdsResponderTest, ReadDtcInformationFiltersByStatusMask) {
+  EcuConfig const ecu{MakeEcuConfig(0x1001U, 0U)};
+  UdsResponder const responder{ecu, kGatewayVin};
+  EXPECT_EQ(Respond(responder, ByteVector{0x19U, 0x02U, 0x01U})[0U].payload,
+            (ByteVector{0x59U, 0x02U, 0xFFU, 0x01U, 0x23U, 0x45U, 0x2FU}));
+  EXPECT_EQ(Respond(responder, ByteVector{0x19U, 0x01U, 0x08U})[0U].payload,
+            (ByteVector{0x59U, 0x01U, 0xFFU, 0x01U, 0x00U, 0x02U}));
+  EXPECT_EQ(Respond(responder, ByteVector{0x19U, 0x0AU, 0x08U})[0U].payload, (ByteVector{0x7FU, 0x19U, 0x12U}));
+}
+
+TEST(UdsResponderTest, PendingResponsesPrecedeFinalResponse) {
+  EcuConfig const ecu{MakeEcuConfig(0x1001U, 2U)};
+  UdsResponder const responder{ecu, kGatewayVin};
+  std::vector<ScheduledResponse> const responses{Respond(responder, ByteVector{0x10U, 0x03U})};
+  ASSERT_EQ(responses.size(), 3U);
+  EXPECT_EQ(responses[0U].payload, (ByteVector{0x7FU, 0x10U, 0x78U}));
+  EXPECT_EQ(responses[0U].delay, std::chrono::milliseconds{5});
+  EXPECT_EQ(responses[1U].payload, (ByteVector{0x7FU, 0x10U, 0x78U}));
+  EXPECT_EQ(responses[1U].delay, std::chrono::milliseconds{20});
+  EXPECT_EQ(responses[2U].payload, (ByteVector{0x50U, 0x03U, 0x00U, 0x32U, 0x01U, 0xF4U}));
+  EXPECT_EQ(responses[2U].delay, std::chrono::milliseconds{20});
+
+  // suppressed positive response and tester present are never delayed by pending responses
+  EXPECT_TRUE(Respond(responder, ByteVector{0x3EU, 0x80U}).empty());
+  EXPECT_EQ(Respond(responder, ByteVector{0x3EU, 0x00U}).size(), 1U);
+  EXPECT_EQ(Respond(responder, ByteVector{0x31U, 0x01U}).back().payload, (ByteVector{0x7FU, 0x31U, 0x11U}));
+}
+
+TEST(SimulatorConfigTest, RepeatedEntitiesGetConsecutiveIdentities) {
+  auto config{ReadConfig(R"({"Entities": [{"IpAddress": "127.0.1.254", "Count": 3, "LogicalAddress": "0x2000",
+      "Vin": "SIMFLEETVEHICLE00", "Eid": "00:02:36:32:00:ff", "ResponseLatencyMs": 7,
+      "Ecus": [{"LogicalAddress": "0x2001", "PendingResponses": 1}]}]})")};
+  ASSERT_TRUE(config.HasValue());
+  ASSERT_EQ(config.Value().entities.size(), 3U);
+  EntityConfig const& last{config.Value().entities[2U]};
+  EXPECT_EQ(last.ip_address, "127.0.2.0");
+  EXPECT_EQ(last.logical_address, 0x2002U);
+  EXPECT_EQ(last.vin, "SIMFLEETVEH000003");
+  EXPECT_EQ(last.eid, (std::array<std::uint8_t, 6U>{0x00U, 0x02U, 0x36U, 0x32U, 0x01U, 0x01U}));
+  // the entity answers itself, the routed ecu takes the timing of entity as default
+  ASSERT_EQ(last.ecus.size(), 2U);
+  EXPECT_EQ(last.ecus[0U].logical_address, 0x2002U);
+  EXPECT_EQ(last.ecus[1U].logical_address, 0x2001U);
+  EXPECT_EQ(last.ecus[1U].response_latency, std::chrono::milliseconds{7});
+  EXPECT_EQ(last.ecus[1U].pending_response_count, 1U);
+
+  EXPECT_FALSE(ReadConfig(R"({"Entities": [{"Vin": "TOOSHORT"}]})").HasValue());
+  EXPECT_FALSE(ReadConfig(R"({"Entities": [{"LogicalAddress": "0x1FFFF"}]})").HasValue());
+}
+
+TEST_F(DoipSimulatorFixture, ClientReadsDataOfRoutedEcuAfterPendingResponses) {
+  DiagClientConversation tester{GetDiagClient().GetDiagnosticClientConversation("DiagTesterOne")};
+  tester.Startup();
+  ASSERT_EQ(tester.ConnectToDiagServer(0x3001U, "127.0.3.1"), DiagClientConversation::ConnectResult::kConnectSuccess);
+  auto response{
+      tester.SendDiagnosticRequest(std::make_unique<UdsMessage>("127.0.3.1", ByteVector{0x22U, 0xF1U, 0x87U}))};
+  ASSERT_TRUE(response.HasValue());
+  EXPECT_EQ(response.Value()->GetPayload(), (ByteVector{0x62U, 0xF1U, 0x87U, 0x53U, 0x49U, 0x4DU}));
+  EXPECT_EQ(GetSimulator().GetStatistics().pending_responses.load(), 2U);
+
+  // the gateway does not route to unknown ecus
+  EXPECT_EQ(tester.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  ASSERT_EQ(tester.ConnectToDiagServer(0x3009U, "127.0.3.1"), DiagClientConversation::ConnectResult::kConnectSuccess);
+  auto rejected{tester.SendDiagnosticRequest(std::make_unique<UdsMessage>("127.0.3.1", ByteVector{0x10U, 0x01U}))};
+  ASSERT_FALSE(rejected.HasValue());
+  EXPECT_EQ(rejected.Error(), DiagClientConversation::DiagError::kDiagNegAckReceived);
+  EXPECT_EQ(tester.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester.Shutdown();
+}
+
+TEST_F(DoipSimulatorFixture, ClientReadsVinOfRepeatedEntity) {
+  DiagClientConversation tester{GetDiagClient().GetDiagnosticClientConversation("DiagTesterOne")};
+  tester.Startup();
+  ASSERT_EQ(tester.ConnectToDiagServer(0x4002U, "127.0.4.3"), DiagClientConversation::ConnectResult::kConnectSuccess);
+  auto response{
+      tester.SendDiagnosticRequest(std::make_unique<UdsMessage>("127.0.4.3", ByteVector{0x22U, 0xF1U, 0x90U}))};
+  ASSERT_TRUE(response.HasValue());
+  std::string const vin{response.Value()->GetPayload().begin() + 3, response.Value()->GetPayload().end()};
+  EXPECT_EQ(vin, "SIMFLEETVEH000003");
+  EXPECT_EQ(tester.DisconnectFromDiagServer(), DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  tester.Shutdown();
+}
+
+}  // namespace doip_simulator
@@ -0,0 +1,78 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "core/include/endian_codec.h"
+#include "core/include/span.h"
+
+namespace core_type {
+namespace {
+
+constexpr std::array<std::uint8_t, 8U> kDoipHeader{0x02, 0xFD, 0x80, 0x01, 0x00, 0x00, 0x00, 0x06};
+
+/**
+ * @brief    Encode a field at compile time to prove the writer is usable in constant expressions
+ */
+constexpr auto EncodeAtCompileTime(std::uint32_t value) noexcept -> std::array<std::uint8_t, 4U> {
+  std::array<std::uint8_t, 4U> buffer{};
+  StoreBigEndian(buffer.data(), value);
+  return buffer;
+}
+
+static_assert(LoadBigEndian<std::uint16_t>(kDoipHeader.data() + 2U) == 0x8001U);
+static_assert(LoadBigEndian<std::uint32_t>(kDoipHeader.data() + 4U) == 0x06U);
+static_assert(ReadBigEndian<std::uint32_t>(Span<std::uint8_t const>{kDoipHeader}, 4U).value() == 0x06U);
+static_assert(!ReadBigEndian<std::uint32_t>(Span<std::uint8_t const>{kDoipHeader}, 5U).has_value());
+static_assert(EncodeAtCompileTime(0x12345678U)[0U] == 0x12U);
+static_assert(EncodeAtCompileTime(0x12345678U)[3U] == 0x78U);
+
+}  // namespace
+
+TEST(EndianCodecTest, ReadsFieldsOfDoipHeader) {
+  std::vector<std::uint8_t> header{kDoipHeader.begin(), kDoipHeader.end()};
+  Span<std::uint8_t> const buffer{header};
+  EXPECT_EQ(ReadBigEndian<std::uint8_t>(buffer, 0U), 0x02U);
+  EXPECT_EQ(ReadBigEndian<std::uint16_t>(buffer, 2U), 0x8001U);
+  EXPECT_EQ(ReadBigEndian<std::uint32_t>(buffer, 4U), 0x06U);
+  EXPECT_EQ(ReadBigEndian<std::uint64_t>(buffer, 0U), 0x02FD800100000006U);
+}
+
+TEST(EndianCodecTest, RejectsFieldsOutsideBuffer) {
+  std::array<std::uint8_t, 4U> bytes{0x11, 0x22, 0x33, 0x44};
+  Span<std::uint8_t> const buffer{bytes};
+  EXPECT_FALSE(ReadBigEndian<std::uint16_t>(buffer, 3U).has_value());
+  EXPECT_FALSE(ReadBigEndian<std::uint32_t>(buffer, 1U).has_value());
+  // offset far beyond the buffer must not wrap around
+  EXPECT_FALSE(ReadBigEndian<std::uint16_t>(buffer, static_cast<std::size_t>(-1)).has_value());
+  EXPECT_FALSE(WriteBigEndian(buffer, 3U, std::uint16_t{0xABCDU}));
+  EXPECT_THAT(bytes, ::testing::ElementsAre(0x11, 0x22, 0x33, 0x44));
+}
+
+TEST(EndianCodecTest, WritesAndReadsBack) {
+  std::array<std::uint8_t, 6U> bytes{};
+  Span<std::uint8_t> const buffer{bytes};
+  EXPECT_TRUE(WriteBigEndian(buffer, 0U, std::uint16_t{0x0E80U}));
+  EXPECT_TRUE(WriteBigEndian(buffer, 2U, std::uint32_t{0xDEADBEEFU}));
+  EXPECT_THAT(bytes, ::testing::ElementsAre(0x0E, 0x80, 0xDE, 0xAD, 0xBE, 0xEF));
+  EXPECT_EQ(ReadBigEndian<std::uint32_t>(buffer, 2U), 0xDEADBEEFU);
+}
+
+TEST(EndianCodecTest, AppendsFieldsToContainer) {
+  std::vector<std::uint8_t> header{0x02, 0xFD};
+  AppendBigEndian(header, std::uint16_t{0x8001U});
+  AppendBigEndian(header, std::uint32_t{0x06U});
+  EXPECT_THAT(header, ::testing::ElementsAreArray(kDoipHeader));
+}
+
+}  // namespace core_type
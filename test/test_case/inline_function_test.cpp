@@ -0,0 +1,90 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "utility/inline_function.h"
+
+namespace utility {
+namespace function {
+
+// Inline function used by the tests
+using TestFunction = InlineFunction<std::uint32_t(std::uint32_t), kDefaultInlineCapacity>;
+
+// Capture counting its destructions
+class DestructionCounter final {
+ public:
+  explicit DestructionCounter(std::uint32_t &count) noexcept : count_{&count} {}
+
+  DestructionCounter(DestructionCounter &&other) noexcept : count_{std::exchange(other.count_, nullptr)} {}
+
+  ~DestructionCounter() {
+    if (count_ != nullptr) { ++(*count_); }
+  }
+
+ private:
+  std::uint32_t *count_;
+};
+
+TEST(InlineFunctionTest, CallReturnsResultOfCallable) {
+  std::uint32_t const offset{5U};
+  TestFunction function{[offset](std::uint32_t value) { return value + offset; }};
+  ASSERT_TRUE(function);
+  EXPECT_EQ(function(2U), 7U);
+}
+
+TEST(InlineFunctionTest, MoveLeavesSourceEmpty) {
+  TestFunction source{[](std::uint32_t value) { return value * 2U; }};
+  TestFunction destination{std::move(source)};
+  EXPECT_FALSE(source);
+  ASSERT_TRUE(destination);
+  EXPECT_EQ(destination(4U), 8U);
+
+  TestFunction assigned{};
+  assigned = std::move(destination);
+  EXPECT_FALSE(destination);
+  EXPECT_EQ(assigned(5U), 10U);
+}
+
+TEST(InlineFunctionTest, HoldsMoveOnlyCapture) {
+  TestFunction function{
+      [value = std::make_unique<std::uint32_t>(3U)](std::uint32_t factor) { return *value * factor; }};
+  TestFunction moved{std::move(function)};
+  EXPECT_EQ(moved(3U), 9U);
+}
+
+TEST(InlineFunctionTest, CaptureIsDestroyedOnce) {
+  std::uint32_t destruction_count{0U};
+  {
+    TestFunction function{[counter = DestructionCounter{destruction_count}](std::uint32_t value) { return value; }};
+    TestFunction moved{std::move(function)};
+    TestFunction assigned{};
+    assigned = std::move(moved);
+    EXPECT_EQ(destruction_count, 0U);
+  }
+  EXPECT_EQ(destruction_count, 1U);
+
+  TestFunction function{[counter = DestructionCounter{destruction_count}](std::uint32_t value) { return value; }};
+  function = nullptr;
+  EXPECT_FALSE(function);
+  EXPECT_EQ(destruction_count, 2U);
+}
+
+TEST(InlineFunctionTest, DefaultConstructedIsEmpty) {
+  TestFunction function{};
+  TestFunction null_function{nullptr};
+  EXPECT_FALSE(function);
+  EXPECT_FALSE(null_function);
+}
+
+}  // namespace function
+}  // namespace utility
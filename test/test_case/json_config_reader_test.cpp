@@ -0,0 +1,158 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "parser/json_parser.h"
+#include "src/dcm/config_parser/config_parser_type.h"
+#include "src/dcm/config_parser/json_config_reader.h"
+
+namespace doip_client {
+namespace {
+
+// Path to json file
+const std::string DiagClientJsonPath{"../../../diag-client-lib/appl/etc/diag_client_config.json"};
+
+// Valid configuration, the line and column of errors below refer to it
+constexpr std::string_view kValidConfig{R"({
+  "UdpIpAddress": "172.16.25.127",
+  "UdpBroadcastAddress": "172.16.255.255",
+  "Conversation": {
+    "NumberOfConversation": 1,
+    "ConversationProperty": [
+      {
+        "ConversationName": "DiagTesterOne",
+        "P2ClientMax": 1000,
+        "P2StarClientMax": 5000,
+        "RxBufferSize": 4095,
+        "SourceAddress": 1,
+        "Network": {"TcpIpAddress": "172.16.25.127"}
+      }
+    ]
+  }
+})"};
+
+// Function to replace the first occurrence of a text in the valid configuration
+std::string ReplaceInValidConfig(std::string_view from, std::string_view to) {
+  std::string config{kValidConfig};
+  std::size_t const position{config.find(from)};
+  EXPECT_NE(position, std::string::npos);
+  return config.replace(position, from.size(), to);
+}
+
+// Function to get the error of an invalid configuration
+diag::client::config::ConfigError GetConfigError(std::string_view content) {
+  auto const result{diag::client::config::ValidateJsonConfig(diag::client::config::JsonConfig{content})};
+  EXPECT_FALSE(result.HasValue());
+  return result.HasValue() ? diag::client::config::ConfigError{} : result.Error();
+}
+
+}  // namespace
+
+TEST(JsonConfigReaderTest, ReadJsonFileContentSameAsPropertyTree) {
+  std::ifstream file{DiagClientJsonPath};
+  ASSERT_TRUE(file.is_open());
+  std::string const content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+  boost_support::parser::boost_tree config_tree{};
+  ASSERT_TRUE(boost_support::parser::Read(DiagClientJsonPath, config_tree).HasValue());
+  diag::client::config_parser::DcmClientConfig const tree_config{
+      diag::client::config_parser::ReadDcmClientConfig(config_tree)};
+  auto const streamed_config{
+      diag::client::config_parser::ReadDcmClientConfig(diag::client::config::JsonConfig{content})};
+  ASSERT_TRUE(streamed_config.HasValue());
+
+  EXPECT_EQ(streamed_config.Value().udp_ip_address, tree_config.udp_ip_address);
+  EXPECT_EQ(streamed_config.Value().udp_broadcast_address, tree_config.udp_broadcast_address);
+  EXPECT_EQ(streamed_config.Value().num_of_conversation, tree_config.num_of_conversation);
+  ASSERT_EQ(streamed_config.Value().conversations.size(), tree_config.conversations.size());
+  for (std::size_t index{0U}; index < tree_config.conversations.size(); ++index) {
+    auto const &streamed{streamed_config.Value().conversations[index]};
+    auto const &tree{tree_config.conversations[index]};
+    EXPECT_EQ(streamed.conversation_name, tree.conversation_name);
+    EXPECT_EQ(streamed.p2_client_max, tree.p2_client_max);
+    EXPECT_EQ(streamed.p2_star_client_max, tree.p2_star_client_max);
+    EXPECT_EQ(streamed.rx_buffer_size, tree.rx_buffer_size);
+    EXPECT_EQ(streamed.source_address, tree.source_address);
+    EXPECT_EQ(streamed.network.tcp_ip_address, tree.network.tcp_ip_address);
+  }
+}
+
+TEST(JsonConfigReaderTest, SkipUnusedMembersAndDecodeEscapes) {
+  auto const config{diag::client::config_parser::ReadDcmClientConfig(diag::client::config::JsonConfig{
+      ReplaceInValidConfig(R"("ConversationName": "DiagTesterOne",)",
+                           R"("Unused": [1.5e3, -0, true, null, {"a": "\""}], "ConversationName": "Tester\u00e9",)")})};
+  ASSERT_TRUE(config.HasValue());
+  ASSERT_EQ(config.Value().conversations.size(), 1U);
+  EXPECT_EQ(config.Value().conversations[0U].conversation_name, "Tester\xC3\xA9");
+  EXPECT_EQ(config.Value().conversations[0U].p2_star_client_max, 5000U);
+}
+
+TEST(JsonConfigReaderTest, ReportValueOutOfRangeWithPosition) {
+  diag::client::config::ConfigError const error{
+      GetConfigError(ReplaceInValidConfig("\"P2ClientMax\": 1000", "\"P2ClientMax\": 70000"))};
+  EXPECT_EQ(error.line, 9U);
+  EXPECT_EQ(error.column, 24U);
+  EXPECT_EQ(error.message, "Conversation.ConversationProperty[0].P2ClientMax: value 70000 exceeds 65535");
+}
+
+TEST(JsonConfigReaderTest, ReportWrongTypeWithPosition) {
+  diag::client::config::ConfigError const error{
+      GetConfigError(ReplaceInValidConfig("\"SourceAddress\": 1", "\"SourceAddress\": \"1\""))};
+  EXPECT_EQ(error.line, 12U);
+  EXPECT_EQ(error.column, 26U);
+  EXPECT_EQ(error.message, "Conversation.ConversationProperty[0].SourceAddress: expected unsigned integer");
+}
+
+TEST(JsonConfigReaderTest, ReportMissingMemberAtObject) {
+  diag::client::config::ConfigError const error{
+      GetConfigError(ReplaceInValidConfig("{\"TcpIpAddress\": \"172.16.25.127\"}", "{}"))};
+  EXPECT_EQ(error.line, 13U);
+  EXPECT_EQ(error.column, 20U);
+  EXPECT_EQ(error.message, "Conversation.ConversationProperty[0].Network: missing member 'TcpIpAddress'");
+}
+
+TEST(JsonConfigReaderTest, ReportDuplicateConversationName) {
+  std::string const conversation{kValidConfig.substr(kValidConfig.find("      {"),
+                                                     kValidConfig.find("    ]") - kValidConfig.find("      {") - 1U)};
+  diag::client::config::ConfigError const error{
+      GetConfigError(ReplaceInValidConfig(conversation, conversation + ",\n" + conversation))};
+  EXPECT_EQ(error.line, 16U);
+  EXPECT_EQ(error.column, 29U);
+  EXPECT_EQ(error.message, "Conversation.ConversationProperty[1].ConversationName: duplicate name 'DiagTesterOne'");
+}
+
+TEST(JsonConfigReaderTest, ReportSyntaxErrors) {
+  EXPECT_EQ(GetConfigError("").message, "unexpected end of input");
+  EXPECT_EQ(GetConfigError(kValidConfig.substr(0U, kValidConfig.find("\"NumberOfConversation\""))).message,
+            "Conversation: unexpected end of input");
+  EXPECT_EQ(GetConfigError(std::string{kValidConfig} + "}").message, "unexpected content after configuration");
+
+  diag::client::config::ConfigError const error{
+      GetConfigError(ReplaceInValidConfig("\"RxBufferSize\": 4095,", "\"RxBufferSize\": 4095"))};
+  EXPECT_EQ(error.line, 12U);
+  EXPECT_EQ(error.column, 9U);
+  EXPECT_EQ(error.message, "Conversation.ConversationProperty[0]: expected ',' or '}'");
+}
+
+TEST(JsonConfigReaderTest, InitializeFailsOnInvalidConfiguration) {
+  std::string const config{ReplaceInValidConfig("\"NumberOfConversation\": 1", "\"NumberOfConversation\": -1")};
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(diag::client::config::JsonConfig{config})};
+  EXPECT_FALSE(diag_client->Initialize().HasValue());
+}
+
+}  // namespace doip_client
@@ -0,0 +1,164 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "utility/memory_resource.h"
+
+namespace utility {
+namespace memory {
+
+// Memory resource counting the outstanding allocations forwarded to new/delete
+class CountingResource final : public std::pmr::memory_resource {
+ public:
+  std::size_t allocation_count{0U};
+  std::size_t outstanding_bytes{0U};
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocation_count;
+    outstanding_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override {
+    outstanding_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override { return this == &other; }
+};
+
+// Base and derived class to check deletion via base class pointer
+class Message {
+ public:
+  virtual ~Message() = default;
+};
+
+class PooledMessage final : public Message, public ResourceAllocated {
+ public:
+  explicit PooledMessage(std::uint32_t value) : value_{value} {}
+
+  std::uint32_t value_;
+};
+
+TEST(MonotonicArenaResourceTest, AllocationsAreAlignedAndServedFromBuffer) {
+  CountingResource upstream{};
+  MonotonicArenaResource arena{256U, &upstream};
+  EXPECT_EQ(upstream.allocation_count, 1U);
+
+  void *const first{arena.allocate(3U, 1U)};
+  void *const second{arena.allocate(8U, 8U)};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8U, 0U);
+  EXPECT_GE(arena.GetUsedSize(), 11U);
+  EXPECT_EQ(upstream.allocation_count, 1U);
+  EXPECT_EQ(arena.GetUpstreamAllocationCount(), 0U);
+  arena.deallocate(first, 3U, 1U);
+  arena.deallocate(second, 8U, 8U);
+}
+
+TEST(MonotonicArenaResourceTest, ResetOnlyWhenAllAllocationsReturned) {
+  CountingResource upstream{};
+  MonotonicArenaResource arena{64U, &upstream};
+
+  void *const first{arena.allocate(16U, 8U)};
+  EXPECT_FALSE(arena.Reset());
+  EXPECT_EQ(arena.GetUsedSize(), 16U);
+  arena.deallocate(first, 16U, 8U);
+  EXPECT_TRUE(arena.Reset());
+  EXPECT_EQ(arena.GetUsedSize(), 0U);
+  // the buffer is reused after reset
+  void *const second{arena.allocate(16U, 8U)};
+  EXPECT_EQ(first, second);
+  arena.deallocate(second, 16U, 8U);
+}
+
+TEST(MonotonicArenaResourceTest, OverflowIsForwardedToUpstream) {
+  CountingResource upstream{};
+  MonotonicArenaResource arena{32U, &upstream};
+
+  void *const inside{arena.allocate(32U, 8U)};
+  void *const outside{arena.allocate(16U, 8U)};
+  EXPECT_EQ(arena.GetUpstreamAllocationCount(), 1U);
+  EXPECT_EQ(upstream.allocation_count, 2U);
+  arena.deallocate(outside, 16U, 8U);
+  EXPECT_EQ(upstream.outstanding_bytes, 32U);
+  arena.deallocate(inside, 32U, 8U);
+  EXPECT_TRUE(arena.Reset());
+}
+
+TEST(MonotonicArenaResourceTest, ServesPolymorphicAllocatorContainers) {
+  CountingResource upstream{};
+  {
+    MonotonicArenaResource arena{1024U, &upstream};
+    std::pmr::vector<std::uint8_t> payload{&arena};
+    payload.assign({0x22U, 0xF1U, 0x90U});
+    EXPECT_EQ(payload.size(), 3U);
+    EXPECT_EQ(upstream.allocation_count, 1U);
+  }
+  EXPECT_EQ(upstream.outstanding_bytes, 0U);
+}
+
+TEST(FixedBlockPoolResourceTest, BlocksAreReused) {
+  CountingResource upstream{};
+  FixedBlockPoolResource pool{24U, 2U, &upstream};
+  EXPECT_EQ(pool.GetBlockSize() % alignof(std::max_align_t), 0U);
+  EXPECT_EQ(pool.GetFreeBlockCount(), 2U);
+
+  void *const first{pool.allocate(24U)};
+  void *const second{pool.allocate(8U)};
+  EXPECT_NE(first, second);
+  EXPECT_EQ(pool.GetFreeBlockCount(), 0U);
+  pool.deallocate(first, 24U);
+  EXPECT_EQ(pool.GetFreeBlockCount(), 1U);
+  void *const third{pool.allocate(24U)};
+  EXPECT_EQ(first, third);
+  pool.deallocate(second, 8U);
+  pool.deallocate(third, 24U);
+  EXPECT_EQ(pool.GetFreeBlockCount(), 2U);
+  EXPECT_EQ(upstream.allocation_count, 1U);
+}
+
+TEST(FixedBlockPoolResourceTest, OversizedAndExhaustedRequestsAreForwardedToUpstream) {
+  CountingResource upstream{};
+  FixedBlockPoolResource pool{16U, 1U, &upstream};
+
+  void *const oversized{pool.allocate(pool.GetBlockSize() + 1U)};
+  void *const block{pool.allocate(16U)};
+  void *const exhausted{pool.allocate(16U)};
+  EXPECT_EQ(pool.GetUpstreamAllocationCount(), 2U);
+  pool.deallocate(oversized, pool.GetBlockSize() + 1U);
+  pool.deallocate(exhausted, 16U);
+  pool.deallocate(block, 16U);
+  EXPECT_EQ(pool.GetFreeBlockCount(), 1U);
+  EXPECT_EQ(upstream.outstanding_bytes, pool.GetBlockSize());
+}
+
+TEST(ResourceAllocatedTest, DeleteViaBaseClassReturnsMemoryToResource) {
+  CountingResource upstream{};
+  FixedBlockPoolResource pool{ResourceAllocated::GetAllocationSize(sizeof(PooledMessage)), 1U, &upstream};
+  {
+    std::unique_ptr<Message> message{MakeUniqueFromResource<PooledMessage>(&pool, 42U)};
+    EXPECT_EQ(static_cast<PooledMessage &>(*message).value_, 42U);
+    EXPECT_EQ(pool.GetFreeBlockCount(), 0U);
+    EXPECT_EQ(pool.GetUpstreamAllocationCount(), 0U);
+  }
+  EXPECT_EQ(pool.GetFreeBlockCount(), 1U);
+}
+
+TEST(ResourceAllocatedTest, PlainNewUsesNewDeleteResource) {
+  std::unique_ptr<Message> message{std::make_unique<PooledMessage>(7U)};
+  EXPECT_EQ(static_cast<PooledMessage &>(*message).value_, 7U);
+}
+
+}  // namespace memory
+}  // namespace utility
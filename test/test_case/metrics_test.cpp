@@ -0,0 +1,126 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "src/dcm/conversation/conversation_metrics.h"
+#include "utility/latency_histogram.h"
+
+namespace utility {
+namespace metrics {
+
+TEST(LatencyHistogramTest, EmptySnapshot) {
+  LatencyHistogram histogram{};
+  LatencyHistogram::Snapshot const snapshot{histogram.TakeSnapshot()};
+
+  EXPECT_EQ(snapshot.count, 0U);
+  EXPECT_EQ(snapshot.min, 0U);
+  EXPECT_EQ(snapshot.max, 0U);
+  EXPECT_EQ(snapshot.GetValueAtPercentile(99.0), 0U);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+  LatencyHistogram histogram{};
+  for (std::uint64_t value{1U}; value <= 10U; ++value) { histogram.Record(value); }
+  LatencyHistogram::Snapshot const snapshot{histogram.TakeSnapshot()};
+
+  EXPECT_EQ(snapshot.count, 10U);
+  EXPECT_EQ(snapshot.min, 1U);
+  EXPECT_EQ(snapshot.max, 10U);
+  EXPECT_DOUBLE_EQ(snapshot.GetMean(), 5.5);
+  EXPECT_EQ(snapshot.GetValueAtPercentile(50.0), 5U);
+  EXPECT_EQ(snapshot.GetValueAtPercentile(100.0), 10U);
+}
+
+TEST(LatencyHistogramTest, LargeValuesWithinRelativeError) {
+  LatencyHistogram histogram{};
+  for (std::uint64_t value{1U}; value <= 100000U; ++value) { histogram.Record(value); }
+  LatencyHistogram::Snapshot const snapshot{histogram.TakeSnapshot()};
+
+  std::uint64_t const p99{snapshot.GetValueAtPercentile(99.0)};
+  EXPECT_GE(p99, 99000U);
+  EXPECT_LE(p99, 99000U + 99000U / LatencyHistogram::kSubBucketHalfCount);
+  EXPECT_EQ(snapshot.GetValueAtPercentile(100.0), 100000U);
+}
+
+TEST(LatencyHistogramTest, BucketIndexIsContiguous) {
+  for (std::size_t index{0U}; index + 1U < LatencyHistogram::kBucketCount; ++index) {
+    std::uint64_t const highest_value{LatencyHistogram::GetHighestEquivalentValue(index)};
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(highest_value), index);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(highest_value + 1U), index + 1U);
+  }
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecording) {
+  constexpr std::uint64_t kValuesPerThread{10000U};
+  LatencyHistogram histogram{};
+  std::vector<std::thread> recorders{};
+  for (std::uint8_t thread_index{0U}; thread_index < 4U; ++thread_index) {
+    recorders.emplace_back([&histogram]() {
+      for (std::uint64_t value{0U}; value < kValuesPerThread; ++value) { histogram.Record(value); }
+    });
+  }
+  for (std::thread &recorder: recorders) { recorder.join(); }
+  LatencyHistogram::Snapshot const snapshot{histogram.TakeSnapshot()};
+
+  EXPECT_EQ(snapshot.count, 4U * kValuesPerThread);
+  EXPECT_EQ(snapshot.min, 0U);
+  EXPECT_EQ(snapshot.max, kValuesPerThread - 1U);
+}
+
+}  // namespace metrics
+}  // namespace utility
+
+namespace diag {
+namespace client {
+namespace conversation {
+
+TEST(ConversationMetricsTest, SnapshotPerServiceIdentifier) {
+  ConversationMetrics conversation_metrics{};
+  conversation_metrics.RecordRoutingActivation(std::chrono::milliseconds{2});
+  conversation_metrics.RecordAckLatency(0x22U, std::chrono::microseconds{300});
+  conversation_metrics.RecordTimeToFirstByte(0x22U, std::chrono::milliseconds{5});
+  conversation_metrics.RecordTotalResponseTime(0x22U, std::chrono::milliseconds{5});
+  conversation_metrics.RecordPendingResponseCount(0x22U, 0U);
+  conversation_metrics.RecordAckLatency(0x10U, std::chrono::microseconds{200});
+  conversation_metrics.RecordTimeToFirstByte(0x10U, std::chrono::milliseconds{20});
+  conversation_metrics.RecordTotalResponseTime(0x10U, std::chrono::milliseconds{900});
+  conversation_metrics.RecordPendingResponseCount(0x10U, 3U);
+
+  metrics::ConversationMetricsSnapshot const snapshot{conversation_metrics.GetSnapshot("DiagTesterOne")};
+  EXPECT_EQ(snapshot.conversation_name, "DiagTesterOne");
+  EXPECT_EQ(snapshot.routing_activation.count, 1U);
+  EXPECT_EQ(snapshot.routing_activation.max, 2000U);
+  EXPECT_EQ(snapshot.ack_latency.count, 2U);
+  EXPECT_EQ(snapshot.total_response_time.min, 5000U);
+  EXPECT_EQ(snapshot.total_response_time.max, 900000U);
+  EXPECT_EQ(snapshot.pending_response_count.max, 3U);
+
+  ASSERT_EQ(snapshot.services.size(), 2U);
+  EXPECT_EQ(snapshot.services[0].service_id, 0x10U);
+  EXPECT_EQ(snapshot.services[0].total_response_time.count, 1U);
+  EXPECT_EQ(snapshot.services[0].pending_response_count.p50, 3U);
+  EXPECT_EQ(snapshot.services[1].service_id, 0x22U);
+  EXPECT_EQ(snapshot.services[1].time_to_first_byte.max, 5000U);
+}
+
+TEST(ConversationMetricsTest, NegativeDurationIsClampedToZero) {
+  ConversationMetrics conversation_metrics{};
+  conversation_metrics.RecordAckLatency(0x3EU, std::chrono::microseconds{-10});
+
+  metrics::ConversationMetricsSnapshot const snapshot{conversation_metrics.GetSnapshot("DiagTesterOne")};
+  EXPECT_EQ(snapshot.ack_latency.count, 1U);
+  EXPECT_EQ(snapshot.ack_latency.max, 0U);
+}
+
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
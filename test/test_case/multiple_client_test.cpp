@@ -0,0 +1,127 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "doip_handler/doip_tcp_handler.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "test_helper.h"
+
+namespace doip_client {
+namespace {
+
+using doip_handler::DoipTcpHandler;
+using diag::client::config::ConversationConfig;
+using diag::client::config::DiagClientConfig;
+using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+
+// Each diag client knows only its own conversation
+constexpr std::array<ConversationConfig, 1U> kTesterOneOnly{
+    {{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0001U, "172.16.25.127"}}};
+constexpr std::array<ConversationConfig, 1U> kTesterTwoOnly{
+    {{"DiagTesterTwo", 2000U, 5000U, 4095U, 0x0002U, "172.16.25.127"}}};
+
+// Function to get the config of the given conversations
+template<std::size_t N>
+constexpr DiagClientConfig MakeConfig(std::array<ConversationConfig, N> const &conversations) {
+  return DiagClientConfig{"172.16.25.127", "172.16.255.255", core_type::Span<ConversationConfig const>{conversations}};
+}
+
+// Function to get the names of conversations in metrics snapshot
+std::vector<std::string> GetConversationNames(diag::client::DiagClient const &diag_client) {
+  std::vector<std::string> names{};
+  for (auto const &metrics: diag_client.GetMetricsSnapshot()) { names.emplace_back(metrics.conversation_name); }
+  return names;
+}
+
+class MultipleClientFixture : public DoipHandlerFixture {
+ protected:
+  // Function to connect, send 10 01 and disconnect, returns whether the positive response is received
+  static auto SendDefaultSessionRequest(DiagClientConversation& diag_client_conversation) -> bool {
+    if (diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress) !=
+        DiagClientConversation::ConnectResult::kConnectSuccess) {
+      return false;
+    }
+    auto response{diag_client_conversation.SendDiagnosticRequest(
+        std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+    static_cast<void>(diag_client_conversation.DisconnectFromDiagServer());
+    return response.HasValue() && response.Value()->GetPayload()[0U] == 0x50U;
+  }
+};
+
+}  // namespace
+
+TEST_F(MultipleClientFixture, ClientsKeepTheirConversationsIsolated) {
+  std::unique_ptr<diag::client::DiagClient> client_one{
+      diag::client::CreateDiagnosticClient(MakeConfig(kTesterOneOnly))};
+  std::unique_ptr<diag::client::DiagClient> client_two{
+      diag::client::CreateDiagnosticClient(MakeConfig(kTesterTwoOnly))};
+  ASSERT_TRUE(client_one->Initialize().HasValue());
+  ASSERT_TRUE(client_two->Initialize().HasValue());
+  EXPECT_EQ(GetConversationNames(*client_one), (std::vector<std::string>{"DiagTesterOne"}));
+  EXPECT_EQ(GetConversationNames(*client_two), (std::vector<std::string>{"DiagTesterTwo"}));
+
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  // the conversation is taken from the diag client created first
+  DiagClientConversation tester_one{client_one->GetDiagnosticClientConversation("DiagTesterOne")};
+  DiagClientConversation tester_two{client_two->GetDiagnosticClientConversation("DiagTesterTwo")};
+  tester_one.Startup();
+  tester_two.Startup();
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_one));
+  tester_one.Shutdown();
+
+  // the other diag client keeps working once the first one is de-initialized
+  EXPECT_TRUE(client_one->DeInitialize().HasValue());
+  doip_channel.DeInitialize();
+  doip_channel.Initialize();
+  EXPECT_TRUE(SendDefaultSessionRequest(tester_two));
+  tester_two.Shutdown();
+  EXPECT_TRUE(client_two->DeInitialize().HasValue());
+  doip_channel.DeInitialize();
+}
+
+TEST_F(MultipleClientFixture, ResponseOutlivesDiagClient) {
+  std::unique_ptr<diag::client::DiagClient> client{diag::client::CreateDiagnosticClient(MakeConfig(kTesterOneOnly))};
+  ASSERT_TRUE(client->Initialize().HasValue());
+  DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  diag::client::uds_message::UdsResponseMessagePtr response{};
+  {
+    DiagClientConversation tester_one{client->GetDiagnosticClientConversation("DiagTesterOne")};
+    tester_one.Startup();
+    ASSERT_EQ(tester_one.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+              DiagClientConversation::ConnectResult::kConnectSuccess);
+    auto result{tester_one.SendDiagnosticRequest(
+        std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+    ASSERT_TRUE(result.HasValue());
+    response = std::move(result).Value();
+    EXPECT_EQ(response->GetPayload(), (UdsMessage::ByteVector{0x50, 0x01}));
+    static_cast<void>(tester_one.DisconnectFromDiagServer());
+    tester_one.Shutdown();
+  }
+  EXPECT_TRUE(client->DeInitialize().HasValue());
+  client.reset();
+  doip_channel.DeInitialize();
+
+  // the response is released after the diag client is gone
+  response.reset();
+}
+
+}  // namespace doip_client
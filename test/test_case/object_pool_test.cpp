@@ -0,0 +1,106 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "socket/tcp/tcp_message.h"
+#include "utility/object_pool.h"
+
+namespace utility {
+namespace memory {
+
+// Object counting its live instances
+class CountedObject final {
+ public:
+  explicit CountedObject(std::uint32_t value) : value_{value} { live_count.fetch_add(1U); }
+
+  ~CountedObject() { live_count.fetch_sub(1U); }
+
+  std::uint32_t value_;
+
+  static std::atomic<std::int32_t> live_count;
+};
+
+std::atomic<std::int32_t> CountedObject::live_count{0};
+
+TEST(ObjectPoolTest, MakeRecyclesStorage) {
+  ObjectPool<CountedObject, 2U> pool{};
+  void const *storage{nullptr};
+  {
+    ObjectPool<CountedObject, 2U>::UniquePtr object{pool.Make(7U)};
+    EXPECT_EQ(object->value_, 7U);
+    EXPECT_EQ(CountedObject::live_count.load(), 1);
+    EXPECT_TRUE(pool.Contains(object.get()));
+    storage = object.get();
+  }
+  EXPECT_EQ(CountedObject::live_count.load(), 0);
+  ObjectPool<CountedObject, 2U>::UniquePtr object{pool.Make(8U)};
+  EXPECT_EQ(storage, object.get());
+  EXPECT_EQ(pool.GetHeapAllocationCount(), 0U);
+}
+
+TEST(ObjectPoolTest, ExhaustedPoolFallsBackToHeap) {
+  ObjectPool<CountedObject, 2U> pool{};
+  std::vector<ObjectPool<CountedObject, 2U>::UniquePtr> objects{};
+  for (std::uint32_t value{0U}; value < 3U; ++value) { objects.emplace_back(pool.Make(value)); }
+  EXPECT_TRUE(pool.Contains(objects[0U].get()));
+  EXPECT_TRUE(pool.Contains(objects[1U].get()));
+  EXPECT_FALSE(pool.Contains(objects[2U].get()));
+  EXPECT_EQ(pool.GetHeapAllocationCount(), 1U);
+  objects.clear();
+  EXPECT_EQ(CountedObject::live_count.load(), 0);
+}
+
+TEST(ObjectPoolTest, ConcurrentMakeAndRelease) {
+  constexpr std::uint32_t kIterations{10000U};
+  static ObjectPool<CountedObject, 8U> pool{};
+  std::atomic<bool> corrupted{false};
+  std::vector<std::thread> workers{};
+  for (std::uint32_t thread_index{0U}; thread_index < 4U; ++thread_index) {
+    workers.emplace_back([thread_index, &corrupted]() {
+      for (std::uint32_t iteration{0U}; iteration < kIterations; ++iteration) {
+        std::uint32_t const value{(thread_index << 16U) | (iteration & 0xFFFFU)};
+        ObjectPool<CountedObject, 8U>::UniquePtr first{pool.Make(value)};
+        ObjectPool<CountedObject, 8U>::UniquePtr second{pool.Make(value + 1U)};
+        std::this_thread::yield();
+        // no other thread may have been given the same storage meanwhile
+        if ((first->value_ != value) || (second->value_ != (value + 1U))) { corrupted = true; }
+      }
+    });
+  }
+  for (std::thread &worker: workers) { worker.join(); }
+  EXPECT_FALSE(corrupted.load());
+  EXPECT_EQ(CountedObject::live_count.load(), 0);
+  EXPECT_EQ(pool.GetHeapAllocationCount(), 0U);
+}
+
+TEST(ObjectPoolTest, PoolAllocatedMessagesKeepDefaultDeleter) {
+  using boost_support::socket::tcp::TcpMessage;
+  using boost_support::socket::tcp::TcpMessagePtr;
+  TcpMessage::Pool &pool{TcpMessage::GetPool()};
+  std::size_t const heap_allocation_count{pool.GetHeapAllocationCount()};
+  void const *storage{nullptr};
+  {
+    TcpMessagePtr message{std::make_unique<TcpMessage>("172.16.25.128", 13400U, TcpMessage::BufferType{0x02U, 0xFDU})};
+    EXPECT_TRUE(pool.Contains(message.get()));
+    EXPECT_EQ(message->GetHostPortNumber(), 13400U);
+    storage = message.get();
+  }
+  TcpMessagePtr message{std::make_unique<TcpMessage>()};
+  EXPECT_EQ(storage, message.get());
+  EXPECT_EQ(pool.GetHeapAllocationCount(), heap_allocation_count);
+}
+
+}  // namespace memory
+}  // namespace utility
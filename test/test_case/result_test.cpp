@@ -0,0 +1,179 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "core/include/error_code.h"
+#include "core/include/result.h"
+
+namespace core_type {
+namespace {
+
+/**
+ * @brief    Error values of the test domain
+ */
+enum class TestErrc : ErrorDomain::CodeType { kOpenFailed = 1, kConnectFailed = 2 };
+
+/**
+ * @brief    Error domain only used by these tests
+ */
+class TestErrorDomain final : public ErrorDomain {
+ public:
+  constexpr TestErrorDomain() noexcept : ErrorDomain{0x5000000000000FFFU} {}
+
+  const char *Name() const noexcept override { return "TestErrorDomain"; }
+
+  const char *Message(CodeType error_code) noexcept override {
+    return error_code == static_cast<CodeType>(TestErrc::kOpenFailed) ? "open failed" : "connect failed";
+  }
+};
+
+TestErrorDomain test_error_domain{};
+
+ErrorCode MakeErrorCode(TestErrc code, ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType{}) noexcept {
+  return ErrorCode{static_cast<ErrorDomain::CodeType>(code), test_error_domain, data};
+}
+
+/**
+ * @brief    Plain error enum as used by the socket layer
+ */
+enum class SocketErrc : std::uint8_t { kSendFailed };
+
+// Results of trivially copyable payloads must be trivially copyable themselves
+static_assert(std::is_trivially_copyable_v<ErrorCode>);
+static_assert(sizeof(Result<void>) == 24U);
+static_assert(std::is_trivially_copyable_v<Result<void>>);
+static_assert(std::is_trivially_copyable_v<Result<void, SocketErrc>>);
+static_assert(std::is_trivially_copyable_v<Result<std::uint32_t>>);
+static_assert(std::is_trivially_copyable_v<Result<std::uint32_t, SocketErrc>>);
+static_assert(std::is_trivially_destructible_v<Result<void>>);
+static_assert(!std::is_trivially_copyable_v<Result<std::unique_ptr<int>, SocketErrc>>);
+
+// and constexpr constructible, including the monadic operations
+static_assert(Result<void, SocketErrc>{}.HasValue());
+static_assert(Result<void, SocketErrc>{SocketErrc::kSendFailed}.Error() == SocketErrc::kSendFailed);
+static_assert(Result<std::uint32_t, SocketErrc>::FromValue(7U).Value() == 7U);
+static_assert(Result<std::uint32_t, SocketErrc>::FromValue(7U)
+                  .AndThen([](std::uint32_t value) { return value * 2U; })
+                  .ValueOr(0U) == 14U);
+static_assert(Result<std::uint32_t, SocketErrc>::FromError(SocketErrc::kSendFailed)
+                  .AndThen([](std::uint32_t value) { return value * 2U; })
+                  .ErrorOr(SocketErrc{}) == SocketErrc::kSendFailed);
+
+constexpr ErrorCode kOpenFailed{static_cast<ErrorDomain::CodeType>(TestErrc::kOpenFailed), test_error_domain};
+static_assert(kOpenFailed.Value() == 1);
+static_assert(Result<void>{kOpenFailed}.Error().Value() == 1);
+
+}  // namespace
+
+TEST(ResultTest, ErrorCodeKeepsValueAndDomain) {
+  ErrorCode const error{TestErrc::kConnectFailed, 0x10U};
+  EXPECT_EQ(error.Value(), 2);
+  EXPECT_EQ(error.SupportData(), 0x10U);
+  EXPECT_EQ(&error.Domain(), &test_error_domain);
+  EXPECT_EQ(error.Message(), "connect failed");
+  EXPECT_EQ(error, MakeErrorCode(TestErrc::kConnectFailed));
+  EXPECT_NE(error, MakeErrorCode(TestErrc::kOpenFailed));
+}
+
+TEST(ResultTest, ErrorCodeIsAssignable) {
+  Result<void> result{MakeErrorCode(TestErrc::kOpenFailed)};
+  result = Result<void>{MakeErrorCode(TestErrc::kConnectFailed)};
+  ASSERT_FALSE(result.HasValue());
+  EXPECT_EQ(result.Error().Value(), 2);
+  result.EmplaceValue();
+  EXPECT_TRUE(result.HasValue());
+}
+
+TEST(ResultTest, NonTrivialPayloadIsCopiedMovedAndDestroyed) {
+  auto const payload{std::make_shared<std::uint32_t>(5U)};
+  {
+    Result<std::shared_ptr<std::uint32_t>, SocketErrc> result{payload};
+    Result<std::shared_ptr<std::uint32_t>, SocketErrc> copy{result};
+    EXPECT_EQ(payload.use_count(), 3);
+    Result<std::shared_ptr<std::uint32_t>, SocketErrc> moved{std::move(copy)};
+    EXPECT_EQ(payload.use_count(), 3);
+    result.EmplaceError(SocketErrc::kSendFailed);
+    EXPECT_EQ(payload.use_count(), 2);
+    result = moved;
+    ASSERT_TRUE(result.HasValue());
+    EXPECT_EQ(*result.Value(), 5U);
+    EXPECT_EQ(payload.use_count(), 3);
+  }
+  EXPECT_EQ(payload.use_count(), 1);
+
+  Result<std::unique_ptr<std::uint32_t>, SocketErrc> owner{std::make_unique<std::uint32_t>(7U)};
+  std::unique_ptr<std::uint32_t> const taken{std::move(owner).Value()};
+  EXPECT_EQ(*taken, 7U);
+}
+
+TEST(ResultTest, AndThenChainStopsAtFirstError) {
+  std::uint32_t calls{0U};
+  Result<std::uint32_t> const result{Result<std::uint32_t>::FromValue(1U)
+                                         .AndThen([&calls](std::uint32_t value) {
+                                           ++calls;
+                                           return value + 1U;
+                                         })
+                                         .AndThen([&calls](std::uint32_t value) {
+                                           ++calls;
+                                           return value + 1U;
+                                         })};
+  ASSERT_TRUE(result.HasValue());
+  EXPECT_EQ(result.Value(), 3U);
+
+  Result<std::uint32_t> const failed{Result<std::uint32_t>::FromError(MakeErrorCode(TestErrc::kOpenFailed))
+                                         .AndThen([&calls](std::uint32_t value) {
+                                           ++calls;
+                                           return value + 1U;
+                                         })};
+  ASSERT_FALSE(failed.HasValue());
+  EXPECT_EQ(failed.Error(), MakeErrorCode(TestErrc::kOpenFailed));
+  EXPECT_EQ(calls, 2U);
+}
+
+TEST(ResultTest, AndThenDoesNotNestReturnedResult) {
+  auto connect = [](std::uint32_t handle) -> Result<std::uint32_t> {
+    return handle == 0U ? Result<std::uint32_t>{MakeErrorCode(TestErrc::kConnectFailed)}
+                        : Result<std::uint32_t>{handle};
+  };
+  auto chained{Result<std::uint32_t>::FromValue(0U).AndThen(connect)};
+  static_assert(std::is_same_v<decltype(chained), Result<std::uint32_t>>);
+  ASSERT_FALSE(chained.HasValue());
+  EXPECT_EQ(chained.Error().Value(), 2);
+
+  bool opened{false};
+  Result<void> const result{Result<void>{}.AndThen([]() { return Result<void>{MakeErrorCode(TestErrc::kOpenFailed)}; })
+                                .AndThen([&opened]() { opened = true; })};
+  ASSERT_FALSE(result.HasValue());
+  EXPECT_EQ(result.Error().Value(), 1);
+  EXPECT_FALSE(opened);
+}
+
+TEST(ResultTest, MapErrorAndOrElseTranslateErrors) {
+  Result<void> const mapped{Result<void, SocketErrc>{SocketErrc::kSendFailed}.MapError(
+      [](SocketErrc) { return MakeErrorCode(TestErrc::kConnectFailed); })};
+  ASSERT_FALSE(mapped.HasValue());
+  EXPECT_EQ(mapped.Error().Value(), 2);
+
+  Result<void> const recovered{Result<void>{MakeErrorCode(TestErrc::kOpenFailed)}.OrElse(
+      [](ErrorCode const &) { return MakeErrorCode(TestErrc::kConnectFailed); })};
+  EXPECT_EQ(recovered.Error().Value(), 2);
+
+  bool resolved{false};
+  Result<void>{}.Resolve([&resolved](ErrorCode const &) { resolved = true; });
+  EXPECT_FALSE(resolved);
+  EXPECT_EQ(Result<std::uint32_t>{MakeErrorCode(TestErrc::kOpenFailed)}.Resolve(
+                [](ErrorCode const &error) { return static_cast<std::uint32_t>(error.Value()); }),
+            1U);
+}
+
+}  // namespace core_type
@@ -0,0 +1,114 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "doip_handler/doip_tcp_handler.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "test_helper.h"
+
+// Time for which running requests are waited for on shutdown, set by the build
+#ifndef DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS
+#define DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS 100U
+#endif
+
+namespace doip_client {
+namespace {
+
+using doip_handler::DoipTcpHandler;
+using diag::client::config::ConversationConfig;
+using diag::client::config::DiagClientConfig;
+using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+
+// Time DeInitialize() may take at most
+constexpr std::chrono::milliseconds kShutdownTimeout{DIAG_CLIENT_SHUTDOWN_TIMEOUT_MS};
+
+// Delay of the server response, all requests are still waiting for it on shutdown
+constexpr std::chrono::milliseconds kResponseDelay{1000};
+
+// Conversations waiting with P2 longer than the response delay
+constexpr std::array<ConversationConfig, 4U> kConversations{
+    {{"DiagTesterOne", 5000U, 5000U, 4095U, 0x0001U, "172.16.25.127"},
+     {"DiagTesterTwo", 5000U, 5000U, 4095U, 0x0002U, "172.16.25.127"},
+     {"DiagTesterThree", 5000U, 5000U, 4095U, 0x0003U, "172.16.25.127"},
+     {"DiagTesterFour", 5000U, 5000U, 4095U, 0x0004U, "172.16.25.127"}}};
+
+using ShutdownFixture = DoipHandlerFixture;
+
+}  // namespace
+
+TEST_F(ShutdownFixture, DeInitializeEndsWaitingRequestsWithinTimeout) {
+  std::unique_ptr<diag::client::DiagClient> diag_client{diag::client::CreateDiagnosticClient(
+      DiagClientConfig{"172.16.25.127", "172.16.255.255", core_type::Span<ConversationConfig const>{kConversations}})};
+  ASSERT_TRUE(diag_client->Initialize().HasValue());
+
+  std::array<DiagClientConversation, kConversations.size()> testers{
+      {diag_client->GetDiagnosticClientConversation(kConversations[0U].conversation_name),
+       diag_client->GetDiagnosticClientConversation(kConversations[1U].conversation_name),
+       diag_client->GetDiagnosticClientConversation(kConversations[2U].conversation_name),
+       diag_client->GetDiagnosticClientConversation(kConversations[3U].conversation_name)}};
+  // connect one after the other, so that every doip channel accepts the connection of its conversation
+  std::vector<DoipTcpHandler::DoipChannel*> doip_channels{};
+  for (std::size_t index{0U}; index < kConversations.size(); ++index) {
+    std::uint16_t const server_address{static_cast<std::uint16_t>(DiagServerLogicalAddress + index)};
+    DoipTcpHandler::DoipChannel& doip_channel{GetDoipTestTcpHandlerRef().CreateDoipChannel(server_address)};
+    doip_channel.Initialize();
+    doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+    doip_channel.SetResponseDelay(kResponseDelay);
+    doip_channels.push_back(&doip_channel);
+
+    testers[index].Startup();
+    ASSERT_EQ(testers[index].ConnectToDiagServer(server_address, DiagIpAddress),
+              DiagClientConversation::ConnectResult::kConnectSuccess);
+  }
+
+  // every conversation waits for its response on its own thread
+  std::atomic<std::size_t> started_count{0U};
+  std::array<bool, kConversations.size()> timed_out{};
+  std::array<std::chrono::steady_clock::duration, kConversations.size()> request_durations{};
+  std::vector<std::thread> requesters{};
+  for (std::size_t index{0U}; index < testers.size(); ++index) {
+    requesters.emplace_back([&, index]() {
+      started_count.fetch_add(1U);
+      std::chrono::steady_clock::time_point const start_time{std::chrono::steady_clock::now()};
+      auto response{testers[index].SendDiagnosticRequest(
+          std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+      request_durations[index] = std::chrono::steady_clock::now() - start_time;
+      timed_out[index] =
+          !response.HasValue() && (response.Error() == DiagClientConversation::DiagError::kDiagResponseTimeout);
+    });
+  }
+  while (started_count.load() < testers.size()) { std::this_thread::yield(); }
+  // the requests are acknowledged by now and wait for the delayed response
+  std::this_thread::sleep_for(std::chrono::milliseconds{200});
+
+  std::chrono::steady_clock::time_point const shutdown_start_time{std::chrono::steady_clock::now()};
+  EXPECT_TRUE(diag_client->DeInitialize().HasValue());
+  std::chrono::steady_clock::duration const shutdown_duration{std::chrono::steady_clock::now() - shutdown_start_time};
+  RecordProperty("shutdown_us",
+                 static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(shutdown_duration).count()));
+  EXPECT_LT(shutdown_duration, kShutdownTimeout);
+
+  for (std::thread& requester: requesters) { requester.join(); }
+  for (std::size_t index{0U}; index < testers.size(); ++index) {
+    // the request ended on shutdown, not with the response or P2 timeout
+    EXPECT_TRUE(timed_out[index]);
+    EXPECT_LT(request_durations[index], kResponseDelay);
+  }
+  for (DoipTcpHandler::DoipChannel* doip_channel: doip_channels) { doip_channel->DeInitialize(); }
+}
+
+}  // namespace doip_client
@@ -0,0 +1,87 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "core/include/small_byte_vector.h"
+#include "include/diagnostic_client_uds_message_type.h"
+
+namespace core_type {
+
+using SmallByteVector8 = SmallByteVector<8U>;
+
+TEST(SmallByteVectorTest, ShortUdsRequestStaysInline) {
+  diag::client::uds_message::UdsMessage::ByteVector const request{0x22, 0xF1, 0x90};
+  EXPECT_TRUE(request.IsInline());
+  EXPECT_EQ(request.size(), 3U);
+  EXPECT_THAT(request, ::testing::ElementsAre(0x22, 0xF1, 0x90));
+}
+
+TEST(SmallByteVectorTest, GrowsToHeapAndShrinksBack) {
+  SmallByteVector8 bytes{};
+  for (std::uint8_t value{0U}; value < 20U; ++value) { bytes.push_back(value); }
+  EXPECT_FALSE(bytes.IsInline());
+  EXPECT_GE(bytes.capacity(), 20U);
+  for (std::uint8_t value{0U}; value < 20U; ++value) { EXPECT_EQ(bytes[value], value); }
+  bytes.resize(4U);
+  bytes.shrink_to_fit();
+  EXPECT_TRUE(bytes.IsInline());
+  EXPECT_THAT(bytes, ::testing::ElementsAre(0U, 1U, 2U, 3U));
+}
+
+TEST(SmallByteVectorTest, MoveTakesOverHeapBufferAndCopiesInlineBytes) {
+  SmallByteVector8 heap_bytes(16U, 0xAA);
+  std::uint8_t const *const heap_data{heap_bytes.data()};
+  SmallByteVector8 moved_heap_bytes{std::move(heap_bytes)};
+  EXPECT_EQ(moved_heap_bytes.data(), heap_data);
+  EXPECT_TRUE(heap_bytes.empty());
+  EXPECT_TRUE(heap_bytes.IsInline());
+
+  SmallByteVector8 inline_bytes{0x3E, 0x00};
+  SmallByteVector8 moved_inline_bytes{};
+  moved_inline_bytes = std::move(inline_bytes);
+  EXPECT_TRUE(moved_inline_bytes.IsInline());
+  EXPECT_EQ(moved_inline_bytes, (SmallByteVector8{0x3E, 0x00}));
+  EXPECT_TRUE(inline_bytes.empty());
+}
+
+TEST(SmallByteVectorTest, InsertAndEraseKeepOrder) {
+  SmallByteVector8 bytes{1U, 2U, 6U};
+  std::vector<std::uint8_t> const middle{3U, 4U, 5U};
+  (void) bytes.insert(bytes.begin() + 2, middle.begin(), middle.end());
+  (void) bytes.insert(bytes.begin(), 0U);
+  (void) bytes.insert(bytes.end(), 4U, 7U);
+  EXPECT_FALSE(bytes.IsInline());
+  EXPECT_THAT(bytes, ::testing::ElementsAre(0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 7U, 7U, 7U));
+  (void) bytes.erase(bytes.begin() + 7, bytes.end());
+  (void) bytes.erase(bytes.begin());
+  EXPECT_THAT(bytes, ::testing::ElementsAre(1U, 2U, 3U, 4U, 5U, 6U));
+}
+
+TEST(SmallByteVectorTest, InsertsFromSinglePassRange) {
+  std::istringstream input{"abc"};
+  SmallByteVector8 bytes{'x'};
+  (void) bytes.insert(bytes.begin(), std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{});
+  EXPECT_THAT(bytes, ::testing::ElementsAre('a', 'b', 'c', 'x'));
+}
+
+TEST(SmallByteVectorTest, ConvertsFromAndToStdVector) {
+  std::vector<std::uint8_t> const vector{0x50, 0x01, 0x00, 0x32, 0x01, 0xF4};
+  SmallByteVector8 const bytes{vector};
+  std::vector<std::uint8_t> const converted_back{bytes};
+  EXPECT_EQ(converted_back, vector);
+}
+
+}  // namespace core_type
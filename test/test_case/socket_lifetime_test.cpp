@@ -0,0 +1,125 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "socket/io_context.h"
+#include "socket/tcp/tcp_client.h"
+#include "socket/udp/udp_client.h"
+
+namespace doip_client {
+namespace {
+
+using boost_support::socket::tcp::TcpClientSocket;
+using boost_support::socket::udp::UdpClientSocket;
+
+// Diag client ip address
+constexpr std::string_view kClientIpAddress{"172.16.25.127"};
+
+// Function to get the number of entries of the directory
+std::size_t GetEntryCount(char const *path) {
+  return static_cast<std::size_t>(
+      std::distance(std::filesystem::directory_iterator{path}, std::filesystem::directory_iterator{}));
+}
+
+// Function to get the number of threads of this process
+std::size_t GetThreadCount() { return GetEntryCount("/proc/self/task"); }
+
+// Function to get the number of open file descriptors of this process
+std::size_t GetFileDescriptorCount() { return GetEntryCount("/proc/self/fd"); }
+
+// Function to wait until the open file descriptors of this process drop to the expected count, returns the last count
+std::size_t WaitForFileDescriptorCount(std::size_t expected_count) {
+  std::size_t fd_count{GetFileDescriptorCount()};
+  for (std::size_t retry{0U}; (retry < 100U) && (fd_count > expected_count); ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    fd_count = GetFileDescriptorCount();
+  }
+  return fd_count;
+}
+
+}  // namespace
+
+TEST(SocketLifetimeTest, TcpSocketNeedsNoThread) {
+  boost_support::socket::IoContext io_context{};
+  std::size_t const thread_count{GetThreadCount()};
+  TcpClientSocket tcp_socket{kClientIpAddress, 0U, [](boost_support::socket::tcp::TcpMessagePtr) {}, io_context};
+  EXPECT_EQ(GetThreadCount(), thread_count);
+
+  ASSERT_TRUE(tcp_socket.Open().HasValue());
+#ifndef ENABLE_RX_HANDOFF
+  // reception runs on the event loop
+  EXPECT_EQ(GetThreadCount(), thread_count);
+#endif
+  EXPECT_TRUE(tcp_socket.Destroy().HasValue());
+  EXPECT_EQ(GetThreadCount(), thread_count);
+
+  // the socket can be opened again after being destroyed
+  ASSERT_TRUE(tcp_socket.Open().HasValue());
+  EXPECT_TRUE(tcp_socket.Destroy().HasValue());
+  EXPECT_EQ(GetThreadCount(), thread_count);
+}
+
+TEST(SocketLifetimeTest, UdpSocketIsReleasedWhenIdle) {
+  boost_support::socket::IoContext io_context{};
+  std::thread io_thread{[&io_context]() { io_context.Run(); }};
+  UdpClientSocket udp_socket{kClientIpAddress, 0U, UdpClientSocket::PortType::kUdp_Unicast,
+                             [](boost_support::socket::udp::UdpMessagePtr) {}, io_context,
+                             std::chrono::milliseconds{50}};
+  std::size_t const fd_count{GetFileDescriptorCount()};
+
+  ASSERT_TRUE(udp_socket.Open().HasValue());
+  EXPECT_EQ(GetFileDescriptorCount(), fd_count + 1U);
+  EXPECT_EQ(WaitForFileDescriptorCount(fd_count), fd_count);
+
+  // a released socket is opened again on demand
+  ASSERT_TRUE(udp_socket.Open().HasValue());
+  EXPECT_EQ(GetFileDescriptorCount(), fd_count + 1U);
+  EXPECT_TRUE(udp_socket.Destroy().HasValue());
+  EXPECT_EQ(GetFileDescriptorCount(), fd_count);
+
+  io_context.Stop();
+  io_thread.join();
+}
+
+TEST(SocketLifetimeTest, StartupOfConversationsCreatesNoThreads) {
+  constexpr std::array<diag::client::config::ConversationConfig, 2U> kConversations{
+      {{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0001U, kClientIpAddress},
+       {"DiagTesterTwo", 2000U, 5000U, 4095U, 0x0002U, kClientIpAddress}}};
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(diag::client::config::DiagClientConfig{
+          kClientIpAddress, "172.16.255.255",
+          core_type::Span<diag::client::config::ConversationConfig const>{kConversations}})};
+  ASSERT_TRUE(diag_client->Initialize().HasValue());
+  // only the thread of the diag client itself is running
+  std::size_t const thread_count{GetThreadCount()};
+
+  diag::client::conversation::DiagClientConversation tester_one{
+      diag_client->GetDiagnosticClientConversation("DiagTesterOne")};
+  diag::client::conversation::DiagClientConversation tester_two{
+      diag_client->GetDiagnosticClientConversation("DiagTesterTwo")};
+  tester_one.Startup();
+  tester_two.Startup();
+  EXPECT_EQ(GetThreadCount(), thread_count);
+
+  tester_one.Shutdown();
+  tester_two.Shutdown();
+  EXPECT_TRUE(diag_client->DeInitialize().HasValue());
+}
+
+}  // namespace doip_client
@@ -0,0 +1,76 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "utility/spsc_handoff.h"
+
+namespace utility {
+namespace ring_buffer {
+
+TEST(SpscHandoffTest, ConsumeBatchHandlesElementsInOrder) {
+  SpscHandoff<std::unique_ptr<std::uint32_t>, 8U> handoff{};
+  for (std::uint32_t value{0U}; value < 5U; ++value) {
+    EXPECT_TRUE(handoff.Push(std::make_unique<std::uint32_t>(value)));
+  }
+  std::vector<std::uint32_t> received{};
+  EXPECT_TRUE(handoff.ConsumeBatch([&received](std::unique_ptr<std::uint32_t> value) { received.push_back(*value); }));
+  EXPECT_EQ(received, (std::vector<std::uint32_t>{0U, 1U, 2U, 3U, 4U}));
+}
+
+TEST(SpscHandoffTest, ConsumeBatchIsLimitedToBatchSize) {
+  SpscHandoff<std::uint32_t, 32U> handoff{};
+  for (std::uint32_t value{0U}; value < 20U; ++value) { EXPECT_TRUE(handoff.Push(std::uint32_t{value})); }
+  std::size_t handled_count{0U};
+  EXPECT_TRUE(handoff.ConsumeBatch([&handled_count](std::uint32_t) { ++handled_count; }));
+  EXPECT_EQ(handled_count, (SpscHandoff<std::uint32_t, 32U>::kBatchSize));
+  EXPECT_TRUE(handoff.ConsumeBatch([&handled_count](std::uint32_t) { ++handled_count; }));
+  EXPECT_EQ(handled_count, 20U);
+}
+
+TEST(SpscHandoffTest, StopWakesUpWaitingConsumer) {
+  SpscHandoff<std::uint32_t, 4U> handoff{};
+  std::thread consumer{[&handoff]() {
+    while (handoff.ConsumeBatch([](std::uint32_t) {})) {}
+  }};
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  handoff.Stop();
+  consumer.join();
+  EXPECT_FALSE(handoff.ConsumeBatch([](std::uint32_t) {}));
+}
+
+TEST(SpscHandoffTest, ConcurrentProducerAndConsumerKeepOrder) {
+  constexpr std::uint32_t kElementCount{100000U};
+  SpscHandoff<std::uint32_t, 8U> handoff{};
+  std::uint32_t expected{0U};
+  bool in_order{true};
+  std::thread consumer{[&handoff, &expected, &in_order]() {
+    while (handoff.ConsumeBatch([&expected, &in_order](std::uint32_t value) {
+      if (value != expected) { in_order = false; }
+      ++expected;
+    })) {}
+  }};
+  for (std::uint32_t value{0U}; value < kElementCount; ++value) {
+    EXPECT_TRUE(handoff.Push(std::uint32_t{value}));
+    // let the consumer run dry from time to time to exercise the wake up
+    if ((value % 1000U) == 0U) { std::this_thread::sleep_for(std::chrono::microseconds{100}); }
+  }
+  handoff.Stop();
+  consumer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(expected, kElementCount);
+}
+
+}  // namespace ring_buffer
+}  // namespace utility
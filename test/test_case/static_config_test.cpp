@@ -0,0 +1,141 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "diag_client_static_config.h"
+#include "doip_handler/doip_tcp_handler.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "parser/json_parser.h"
+#include "src/dcm/config_parser/config_parser_type.h"
+#include "test_helper.h"
+
+namespace doip_client {
+namespace {
+
+using doip_handler::DoipTcpHandler;
+
+// Path to json file the static config is generated from
+const std::string DiagClientJsonPath{"../../../diag-client-lib/appl/etc/diag_client_config.json"};
+
+// The generated config is usable in constant expressions
+static_assert(kDiagClientStaticConfig.conversations.size() == 2U);
+static_assert(kDiagClientStaticConfigConversations[0U].conversation_name == "DiagTesterOne");
+static_assert(kDiagClientStaticConfigConversations[1U].p2_client_max == 2000U);
+
+// Config written in code, with a single conversation
+constexpr std::array<diag::client::config::ConversationConfig, 1U> kSingleConversation{
+    {{"DiagTesterOne", 1000U, 5000U, 4095U, 0x0001U, "172.16.25.127"}}};
+constexpr diag::client::config::DiagClientConfig kSingleConversationConfig{
+    "172.16.25.127", "172.16.255.255",
+    core_type::Span<diag::client::config::ConversationConfig const>{kSingleConversation}};
+
+// Json config held in memory, with a single conversation
+constexpr std::string_view kSingleConversationJsonConfig{R"({
+  "UdpIpAddress": "172.16.25.127",
+  "UdpBroadcastAddress": "172.16.255.255",
+  "Conversation": {
+    "NumberOfConversation": 1,
+    "ConversationProperty": [{"ConversationName": "DiagTesterOne", "P2ClientMax": 1000, "P2StarClientMax": 5000,
+                              "RxBufferSize": 4095, "SourceAddress": 1, "Network": {"TcpIpAddress": "172.16.25.127"}}]
+  }
+})"};
+
+using StaticConfigFixture = DoipHandlerFixture;
+
+}  // namespace
+
+TEST(StaticConfigTest, GeneratedConfigMatchesJsonFile) {
+  boost_support::parser::boost_tree config_tree{};
+  ASSERT_TRUE(boost_support::parser::Read(DiagClientJsonPath, config_tree).HasValue());
+  diag::client::config_parser::DcmClientConfig const json_config{
+      diag::client::config_parser::ReadDcmClientConfig(config_tree)};
+  diag::client::config_parser::DcmClientConfig const static_config{
+      diag::client::config_parser::ReadDcmClientConfig(kDiagClientStaticConfig)};
+
+  EXPECT_EQ(static_config.udp_ip_address, json_config.udp_ip_address);
+  EXPECT_EQ(static_config.udp_broadcast_address, json_config.udp_broadcast_address);
+  EXPECT_EQ(static_config.num_of_conversation, json_config.num_of_conversation);
+  ASSERT_EQ(static_config.conversations.size(), json_config.conversations.size());
+  for (std::size_t index{0U}; index < json_config.conversations.size(); ++index) {
+    EXPECT_EQ(static_config.conversations[index].conversation_name, json_config.conversations[index].conversation_name);
+    EXPECT_EQ(static_config.conversations[index].p2_client_max, json_config.conversations[index].p2_client_max);
+    EXPECT_EQ(static_config.conversations[index].p2_star_client_max,
+              json_config.conversations[index].p2_star_client_max);
+    EXPECT_EQ(static_config.conversations[index].rx_buffer_size, json_config.conversations[index].rx_buffer_size);
+    EXPECT_EQ(static_config.conversations[index].source_address, json_config.conversations[index].source_address);
+    EXPECT_EQ(static_config.conversations[index].network.tcp_ip_address,
+              json_config.conversations[index].network.tcp_ip_address);
+  }
+}
+
+TEST(StaticConfigTest, ConfigBuiltInCodeWithTooManyConversationsFailsInitialization) {
+  // one more conversation than NumberOfConversation of a json configuration can hold
+  std::vector<std::string> names{};
+  std::vector<diag::client::config::ConversationConfig> conversations{};
+  for (std::size_t index{0U}; index <= 255U; ++index) { names.emplace_back("DiagTester" + std::to_string(index)); }
+  for (std::string const& name: names) {
+    conversations.emplace_back(diag::client::config::ConversationConfig{name, 1000U, 5000U, 4095U, 0x0001U,
+                                                                        "172.16.25.127"});
+  }
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(diag::client::config::DiagClientConfig{
+          "172.16.25.127", "172.16.255.255",
+          core_type::Span<diag::client::config::ConversationConfig const>{conversations}})};
+
+  EXPECT_FALSE(diag_client->Initialize().HasValue());
+}
+
+// Function to send a request on the single conversation of the given diag client and check the positive response
+void SendDiagRequest(diag::client::DiagClient &diag_client, DoipTcpHandler &doip_tcp_handler) {
+  ASSERT_TRUE(diag_client.Initialize().HasValue());
+
+  // Get the doip channel and Initialize it
+  DoipTcpHandler::DoipChannel& doip_channel{doip_tcp_handler.CreateDoipChannel(DiagServerLogicalAddress)};
+  doip_channel.Initialize();
+  doip_channel.SetExpectedDiagnosticMessageUdsMessageToBeSend(UdsMessage::ByteVector{0x50, 0x01});
+
+  // Get conversation for tester one, start up the conversation and connect
+  diag::client::conversation::DiagClientConversation diag_client_conversation{
+      diag_client.GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+  ASSERT_EQ(diag_client_conversation.ConnectToDiagServer(DiagServerLogicalAddress, DiagIpAddress),
+            diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  auto response{diag_client_conversation.SendDiagnosticRequest(
+      std::make_unique<UdsMessage>(DiagIpAddress, UdsMessage::ByteVector{0x10, 0x01}))};
+  ASSERT_TRUE(response.HasValue());
+  EXPECT_EQ(response.Value()->GetPayload()[0U], 0x50U);
+
+  EXPECT_EQ(diag_client_conversation.DisconnectFromDiagServer(),
+            diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  diag_client_conversation.Shutdown();
+  doip_channel.DeInitialize();
+  EXPECT_TRUE(diag_client.DeInitialize().HasValue());
+}
+
+TEST_F(StaticConfigFixture, SendDiagRequestWithConfigBuiltInCode) {
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(kSingleConversationConfig)};
+  SendDiagRequest(*diag_client, GetDoipTestTcpHandlerRef());
+}
+
+TEST_F(StaticConfigFixture, SendDiagRequestWithJsonConfigInMemory) {
+  std::unique_ptr<diag::client::DiagClient> diag_client{
+      diag::client::CreateDiagnosticClient(diag::client::config::JsonConfig{kSingleConversationJsonConfig})};
+  SendDiagRequest(*diag_client, GetDoipTestTcpHandlerRef());
+}
+
+}  // namespace doip_client
@@ -0,0 +1,64 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "core/include/static_vector.h"
+
+namespace core_type {
+
+TEST(StaticVectorTest, FillsUpToCapacity) {
+  StaticVector<std::uint16_t, 4U> values{};
+  EXPECT_TRUE(values.empty());
+  for (std::uint16_t value{0U}; values.size() < values.max_size(); ++value) { values.push_back(value); }
+  EXPECT_TRUE(values.full());
+  EXPECT_EQ(values.size(), 4U);
+  EXPECT_THAT(values, ::testing::ElementsAre(0U, 1U, 2U, 3U));
+  values.pop_back();
+  EXPECT_FALSE(values.full());
+  EXPECT_EQ(values.back(), 2U);
+}
+
+TEST(StaticVectorTest, InsertAndEraseKeepOrder) {
+  StaticVector<std::string, 8U> names{};
+  names.emplace_back("tester-b");
+  names.emplace_back("tester-d");
+  names.insert(std::lower_bound(names.begin(), names.end(), std::string{"tester-c"}), "tester-c");
+  names.insert(names.begin(), "tester-a");
+  EXPECT_THAT(names, ::testing::ElementsAre("tester-a", "tester-b", "tester-c", "tester-d"));
+  auto const next{names.erase(names.begin() + 1)};
+  EXPECT_EQ(*next, "tester-c");
+  EXPECT_THAT(names, ::testing::ElementsAre("tester-a", "tester-c", "tester-d"));
+}
+
+TEST(StaticVectorTest, ElementsAreDestroyedAndMoved) {
+  auto const payload{std::make_shared<std::uint32_t>(5U)};
+  {
+    StaticVector<std::shared_ptr<std::uint32_t>, 3U> owners{};
+    owners.push_back(payload);
+    owners.push_back(payload);
+    StaticVector<std::shared_ptr<std::uint32_t>, 3U> const copy{owners};
+    EXPECT_EQ(payload.use_count(), 5);
+    StaticVector<std::shared_ptr<std::uint32_t>, 3U> moved{std::move(owners)};
+    EXPECT_TRUE(owners.empty());
+    EXPECT_EQ(moved.size(), 2U);
+    EXPECT_EQ(payload.use_count(), 5);
+    moved.clear();
+    EXPECT_EQ(payload.use_count(), 3);
+  }
+  EXPECT_EQ(payload.use_count(), 1);
+}
+
+}  // namespace core_type
@@ -0,0 +1,112 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "core/include/clock.h"
+#include "utility/sync_timer.h"
+
+namespace utility {
+namespace sync_timer {
+
+TEST(ManualClockTest, NowOnlyMovesOnAdvance) {
+  core_type::ManualClock clock{};
+  core_type::Clock::TimePoint const start_time{clock.Now()};
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  EXPECT_EQ(clock.Now(), start_time);
+  clock.Advance(std::chrono::milliseconds{250});
+  EXPECT_EQ(clock.Now() - start_time, std::chrono::milliseconds{250});
+}
+
+TEST(SyncTimerTest, TimeoutHappensOnlyWhenClockPassesDeadline) {
+  core_type::ManualClock clock{};
+  SyncTimer sync_timer{clock};
+  bool timeout_happened{false};
+  std::thread waiter{[&sync_timer, &timeout_happened]() {
+    sync_timer.WaitForTimeout([&timeout_happened]() { timeout_happened = true; }, []() {},
+                              std::chrono::hours{1});
+  }};
+  clock.WaitForWaiting(1U);
+  EXPECT_TRUE(sync_timer.IsTimerActive());
+  // advancing short of the deadline wakes the timer up, it must go back to waiting
+  clock.Advance(std::chrono::minutes{59});
+  EXPECT_TRUE(sync_timer.IsTimerActive());
+  clock.WaitForWaiting(1U);
+  clock.Advance(std::chrono::minutes{1});
+  waiter.join();
+  EXPECT_TRUE(timeout_happened);
+  EXPECT_FALSE(sync_timer.IsTimerActive());
+}
+
+TEST(SyncTimerTest, CancelEndsRunningWait) {
+  core_type::ManualClock clock{};
+  SyncTimer sync_timer{clock};
+  bool cancelled{false};
+  std::thread waiter{[&sync_timer, &cancelled]() {
+    sync_timer.WaitForTimeout([]() {}, [&cancelled]() { cancelled = true; }, std::chrono::milliseconds{100});
+  }};
+  clock.WaitForWaiting(1U);
+  sync_timer.CancelWait();
+  waiter.join();
+  EXPECT_TRUE(cancelled);
+}
+
+TEST(SyncTimerTest, CancelBeforeWaitIsNotLost) {
+  core_type::ManualClock clock{};
+  SyncTimer sync_timer{clock};
+  bool cancelled{false};
+  sync_timer.Arm();
+  // the awaited event arrives before the wait started
+  sync_timer.CancelWait();
+  sync_timer.WaitForTimeout([]() {}, [&cancelled]() { cancelled = true; }, std::chrono::milliseconds{100});
+  EXPECT_TRUE(cancelled);
+  EXPECT_EQ(clock.GetWaitingCount(), 0U);
+}
+
+TEST(SyncTimerTest, ArmDiscardsStaleCancel) {
+  core_type::ManualClock clock{};
+  SyncTimer sync_timer{clock};
+  bool timeout_happened{false};
+  sync_timer.CancelWait();
+  sync_timer.Arm();
+  std::thread waiter{[&sync_timer, &timeout_happened]() {
+    sync_timer.WaitForTimeout([&timeout_happened]() { timeout_happened = true; }, []() {},
+                              std::chrono::milliseconds{100});
+  }};
+  clock.WaitForWaiting(1U);
+  clock.Advance(std::chrono::milliseconds{100});
+  waiter.join();
+  EXPECT_TRUE(timeout_happened);
+}
+
+TEST(SyncTimerTest, ShutdownEndsRunningAndFurtherWaitsAsTimeout) {
+  core_type::ManualClock clock{};
+  SyncTimer sync_timer{clock};
+  bool timeout_happened{false};
+  std::thread waiter{[&sync_timer, &timeout_happened]() {
+    sync_timer.WaitForTimeout([&timeout_happened]() { timeout_happened = true; }, []() {}, std::chrono::hours{1});
+  }};
+  clock.WaitForWaiting(1U);
+  // the clock is never advanced, only the shutdown ends the wait
+  sync_timer.Shutdown();
+  waiter.join();
+  EXPECT_TRUE(timeout_happened);
+
+  // a wait started after shutdown ends immediately, even when armed
+  timeout_happened = false;
+  sync_timer.Arm();
+  sync_timer.WaitForTimeout([&timeout_happened]() { timeout_happened = true; }, []() {}, std::chrono::hours{1});
+  EXPECT_TRUE(timeout_happened);
+  EXPECT_EQ(clock.GetWaitingCount(), 0U);
+}
+
+}  // namespace sync_timer
+}  // namespace utility
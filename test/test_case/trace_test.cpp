@@ -0,0 +1,93 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utility/trace.h"
+
+namespace utility {
+namespace trace {
+
+// Fixture to test the trace buffer, every test starts with an empty buffer
+class TraceBufferFixture : public ::testing::Test {
+ protected:
+  void SetUp() override { TraceBuffer::GetInstance().Clear(); }
+
+  void TearDown() override { TraceBuffer::GetInstance().Clear(); }
+
+  static void TraceInstantRecord(char const *name) {
+    TraceBuffer::GetInstance().Record("test", name, TracePhase::kInstant, TraceBuffer::Clock::now(),
+                                      TraceBuffer::Clock::duration::zero(), 0U);
+  }
+
+  static auto CountOccurrences(std::string const &document, std::string const &pattern) -> std::size_t {
+    std::size_t count{0U};
+    for (std::size_t position{document.find(pattern)}; position != std::string::npos;
+         position = document.find(pattern, position + pattern.size())) {
+      ++count;
+    }
+    return count;
+  }
+};
+
+TEST_F(TraceBufferFixture, EmptyTrace) {
+  EXPECT_EQ(TraceBuffer::GetInstance().DumpChromeTrace(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[]}");
+}
+
+TEST_F(TraceBufferFixture, CompleteAndInstantEvents) {
+  TraceBuffer::Clock::time_point const start_time{std::chrono::microseconds{1500}};
+  TraceBuffer::GetInstance().Record("dm", "SendDiagnosticRequest", TracePhase::kComplete, start_time,
+                                    std::chrono::nanoseconds{2250}, 0x22U);
+  TraceBuffer::GetInstance().Record("dm", "PendingResponse", TracePhase::kInstant, start_time,
+                                    TraceBuffer::Clock::duration::zero(), 0x10U);
+  std::string const document{TraceBuffer::GetInstance().DumpChromeTrace()};
+
+  EXPECT_NE(document.find("{\"name\":\"SendDiagnosticRequest\",\"cat\":\"dm\",\"ph\":\"X\",\"ts\":1500.000,"
+                          "\"dur\":2.250,\"pid\":1,\"tid\":"),
+            std::string::npos);
+  EXPECT_NE(document.find("\"args\":{\"value\":34}"), std::string::npos);
+  EXPECT_NE(document.find("{\"name\":\"PendingResponse\",\"cat\":\"dm\",\"ph\":\"i\",\"ts\":1500.000,\"s\":\"t\""),
+            std::string::npos);
+}
+
+TEST_F(TraceBufferFixture, KeepsLatestEvents) {
+  for (std::size_t count{0U}; count < TraceBuffer::kCapacity + 10U; ++count) { TraceInstantRecord("old"); }
+  TraceInstantRecord("new");
+  std::string const document{TraceBuffer::GetInstance().DumpChromeTrace()};
+
+  EXPECT_EQ(CountOccurrences(document, "\"name\":"), TraceBuffer::kCapacity);
+  EXPECT_EQ(CountOccurrences(document, "\"name\":\"new\""), 1U);
+}
+
+TEST_F(TraceBufferFixture, EventsFromMultipleThreads) {
+  constexpr std::size_t kEventsPerThread{100U};
+  std::vector<std::thread> producers{};
+  for (std::uint8_t thread_index{0U}; thread_index < 4U; ++thread_index) {
+    producers.emplace_back([]() {
+      for (std::size_t count{0U}; count < kEventsPerThread; ++count) { TraceInstantRecord("event"); }
+    });
+  }
+  for (std::thread &producer: producers) { producer.join(); }
+
+  EXPECT_EQ(CountOccurrences(TraceBuffer::GetInstance().DumpChromeTrace(), "\"name\":\"event\""),
+            4U * kEventsPerThread);
+}
+
+TEST_F(TraceBufferFixture, TraceScopeRecordsOnlyWhenCompiled) {
+  { TraceScope const trace_scope{"socket", "TcpWrite", 8U}; }
+  std::string const document{TraceBuffer::GetInstance().DumpChromeTrace()};
+
+  EXPECT_EQ(CountOccurrences(document, "\"name\":\"TcpWrite\""), kTraceCompiled ? 1U : 0U);
+}
+
+}  // namespace trace
+}  // namespace utility
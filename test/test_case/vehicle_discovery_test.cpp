@@ -22,7 +22,7 @@ TEST_F(DoipClientFixture, VerifyPreselectionModeEmpty) {
 
   // Send Vehicle Identification request and expect response
   diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{0u, ""};
-  auto response_result{GetDiagClientRef().SendVehicleIdentificationRequest(vehicle_info_request)};
+  auto response_result{SendVehicleIdentificationRequest(vehicle_info_request)};
 
   // Verify Vehicle identification request with no payload
   EXPECT_TRUE(GetDoipTestUdpHandlerRef().VerifyVehicleIdentificationRequestWithExpectedVIN(""));
@@ -51,7 +51,7 @@ TEST_F(DoipClientFixture, VerifyPreselectionModeVin) {
 
   // Send Vehicle Identification request with VIN and expect response
   diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{1U, "ABCDEFGH123456789"};
-  auto response_result{GetDiagClientRef().SendVehicleIdentificationRequest(vehicle_info_request)};
+  auto response_result{SendVehicleIdentificationRequest(vehicle_info_request)};
 
   // Verify Vehicle identification request payload matches
   EXPECT_TRUE(GetDoipTestUdpHandlerRef().VerifyVehicleIdentificationRequestWithExpectedVIN("ABCDEFGH123456789"));
@@ -81,7 +81,7 @@ TEST_F(DoipClientFixture, VerifyPreselectionModeEID) {
 
   // Send Vehicle Identification request with EID and expect response
   diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{2U, "00:02:36:31:00:1c"};
-  auto response_result{GetDiagClientRef().SendVehicleIdentificationRequest(vehicle_info_request)};
+  auto response_result{SendVehicleIdentificationRequest(vehicle_info_request)};
 
   // Verify Vehicle identification request payload matches
   EXPECT_TRUE(GetDoipTestUdpHandlerRef().VerifyVehicleIdentificationRequestWithExpectedEID("00:02:36:31:00:1c"));
@@ -0,0 +1,124 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef DIAG_CLIENT_TEST_HELPER_H
+#define DIAG_CLIENT_TEST_HELPER_H
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "core/include/clock.h"
+#include "doip_handler/doip_tcp_handler.h"
+#include "doip_handler/doip_udp_handler.h"
+#include "doip_handler/logger.h"
+#include "include/diagnostic_client.h"
+#include "include/diagnostic_client_uds_message_type.h"
+
+namespace doip_client {
+
+// Diag Test Server Ip Address
+inline const std::string DiagIpAddress{"172.16.25.128"};
+
+// Diag Test Server logical address
+constexpr std::uint16_t DiagServerLogicalAddress{0xFA25U};
+
+// Port number
+constexpr std::uint16_t DiagPortNum{13400U};
+
+// Time the client collects vehicle identification responses
+constexpr std::chrono::milliseconds VehicleIdentificationTimeout{2000u};
+
+// Real time given to the test handler to deliver its responses before the manual clock is advanced
+constexpr std::chrono::milliseconds ResponseWindow{100u};
+
+// Real time between checks whether the client waits on the manual clock
+constexpr std::chrono::milliseconds PollInterval{1u};
+
+// Function to send vehicle identification request, its timeout expires on the manual clock once it is waited for
+inline auto SendVehicleIdentificationRequest(diag::client::DiagClient& diag_client, core_type::ManualClock& clock,
+                                             diag::client::vehicle_info::VehicleInfoListRequestType const& request)
+    -> diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                            diag::client::DiagClient::VehicleInfoResponseError> {
+  auto response{std::async(std::launch::async, [&diag_client, &request]() {
+    return diag_client.SendVehicleIdentificationRequest(request);
+  })};
+  while (response.wait_for(PollInterval) != std::future_status::ready) {
+    if (clock.GetWaitingCount() != 0u) {
+      std::this_thread::sleep_for(ResponseWindow);
+      clock.Advance(VehicleIdentificationTimeout);
+    }
+  }
+  return response.get();
+}
+
+class UdsMessage final : public diag::client::uds_message::UdsMessage {
+ public:
+  // alias of ByteVector
+  using ByteVector = diag::client::uds_message::UdsMessage::ByteVector;
+
+  // ctor
+  UdsMessage(std::string_view host_ip_address, ByteVector payload)
+      : host_ip_address_{host_ip_address},
+        uds_payload_{std::move(payload)} {}
+
+  // dtor
+  ~UdsMessage() override = default;
+
+ private:
+  // host ip address
+  IpAddress host_ip_address_;
+  // store only UDS payload to be sent
+  ByteVector uds_payload_;
+
+  const ByteVector& GetPayload() const override { return uds_payload_; }
+
+  ByteVector& GetPayload() override { return uds_payload_; }
+
+  IpAddress GetHostIpAddress() const noexcept override { return host_ip_address_; };
+};
+
+// Fixture running the doip test handlers on the diag test server address
+class DoipHandlerFixture : public ::testing::Test {
+ protected:
+  DoipHandlerFixture()
+      : doip_udp_handler_{DiagIpAddress, DiagPortNum},
+        doip_tcp_handler_{DiagIpAddress, DiagPortNum} {
+    // Initialize logger
+    doip_handler::logger::LibGtestLogger::GetLibGtestLogger();
+    // Initialize doip test handler
+    doip_udp_handler_.Initialize();
+  }
+
+  ~DoipHandlerFixture() override {
+    // De-initialize doip test handler
+    doip_udp_handler_.DeInitialize();
+  }
+
+  // Function to get Doip Udp Test Handler reference
+  auto GetDoipTestUdpHandlerRef() noexcept -> doip_handler::DoipUdpHandler& { return doip_udp_handler_; }
+
+  // Function to get Doip Tcp Test Handler reference
+  auto GetDoipTestTcpHandlerRef() noexcept -> doip_handler::DoipTcpHandler& { return doip_tcp_handler_; }
+
+ private:
+  // doip udp test handler
+  doip_handler::DoipUdpHandler doip_udp_handler_;
+
+  // doip tcp test handler
+  doip_handler::DoipTcpHandler doip_tcp_handler_;
+};
+
+}  // namespace doip_client
+
+#endif  // DIAG_CLIENT_TEST_HELPER_H
@@ -0,0 +1,467 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/include/endian_codec.h"
+#include "include/create_diagnostic_client.h"
+#include "include/diagnostic_client.h"
+#include "include/diagnostic_client_config.h"
+#include "include/diagnostic_client_uds_message_type.h"
+#include "simulator/doip_simulator.h"
+#include "simulator/simulator_config.h"
+
+namespace {
+
+using diag::client::config::ConversationConfig;
+using diag::client::config::DiagClientConfig;
+using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+using ByteVector = std::vector<std::uint8_t>;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief       Local ip address of all conversations
+ */
+constexpr std::string_view kLocalIpAddress{"127.0.0.1"};
+
+/**
+ * @brief       Ip address and logical address of the in-process simulated entity
+ */
+constexpr std::string_view kSimulatorIpAddress{"127.0.5.1"};
+constexpr std::uint16_t kSimulatorLogicalAddress{0x5000U};
+
+/**
+ * @brief       Data identifier read by every request, its data has the size of the payload
+ */
+constexpr std::uint16_t kDataIdentifier{0xF100U};
+
+/**
+ * @brief       Source address of the first conversation, the others follow
+ */
+constexpr std::uint16_t kFirstSourceAddress{0x0E80U};
+
+/**
+ * @brief       Size of the response message besides the data, service id and data identifier
+ */
+constexpr std::size_t kResponseOverhead{3U};
+
+/**
+ * @brief       Receive buffer size of the conversations
+ */
+constexpr std::uint16_t kRxBufferSize{4095U};
+
+/**
+ * @brief       Name of the threads sending the requests, each of them measures its own cpu time
+ */
+constexpr char kConversationThreadName[]{"bench_conv"};
+
+/**
+ * @brief       Command line options of the benchmark
+ */
+struct Options {
+  std::size_t conversations;
+  std::chrono::milliseconds duration;
+  std::size_t payload_size;
+  std::uint8_t pending_responses;
+  std::chrono::milliseconds pending_interval;
+  std::size_t simulator_threads;
+  std::string server_ip_address;
+  std::uint16_t target_address;
+  std::string output_path;
+};
+
+/**
+ * @brief       Results measured by one conversation
+ */
+struct ConversationResult {
+  std::vector<std::uint64_t> latencies_ns;
+  std::uint64_t errors;
+  std::chrono::microseconds cpu_time;
+};
+
+/**
+ * @brief       Guard de-initializing the diag client on every exit path, destructing an initialized client terminates
+ */
+class DeInitializeGuard final {
+ public:
+  explicit DeInitializeGuard(diag::client::DiagClient &diag_client) noexcept : diag_client_{&diag_client} {}
+
+  DeInitializeGuard(const DeInitializeGuard &other) noexcept = delete;
+  DeInitializeGuard &operator=(const DeInitializeGuard &other) noexcept = delete;
+  DeInitializeGuard(DeInitializeGuard &&other) noexcept = delete;
+  DeInitializeGuard &operator=(DeInitializeGuard &&other) noexcept = delete;
+
+  ~DeInitializeGuard() { DeInitialize(); }
+
+  /**
+   * @brief       Function to de-initialize the diag client, only the first call has an effect
+   */
+  void DeInitialize() noexcept {
+    if (diag_client_ != nullptr) {
+      static_cast<void>(diag_client_->DeInitialize());
+      diag_client_ = nullptr;
+    }
+  }
+
+ private:
+  diag::client::DiagClient *diag_client_;
+};
+
+class UdsMessage final : public diag::client::uds_message::UdsMessage {
+ public:
+  // ctor
+  UdsMessage(std::string_view host_ip_address, ByteVector payload)
+      : host_ip_address_{host_ip_address},
+        uds_payload_{std::move(payload)} {}
+
+  // dtor
+  ~UdsMessage() override = default;
+
+ private:
+  // host ip address
+  IpAddress host_ip_address_;
+  // store only UDS payload to be sent
+  ByteVector uds_payload_;
+
+  const ByteVector &GetPayload() const override { return uds_payload_; }
+
+  ByteVector &GetPayload() override { return uds_payload_; }
+
+  IpAddress GetHostIpAddress() const noexcept override { return host_ip_address_; };
+};
+
+/**
+ * @brief       Function to print the usage
+ */
+void PrintUsage(char const *program) {
+  std::cerr << "Usage: " << program << " [options]\n"
+            << "  --conversations <count>    Conversations sending requests in parallel, default 1\n"
+            << "  --duration-ms <time>       Time of measurement, default 1000\n"
+            << "  --payload-size <bytes>     Data size of the read data identifier 0xF100, default 32\n"
+            << "  --pending <count>          Response pending messages before every response, default 0\n"
+            << "  --pending-interval-ms <t>  Time between the response pending messages, default 0\n"
+            << "  --simulator-threads <n>    Threads of the in-process simulator, default 1\n"
+            << "  --server <ip>              Use the DoIP server at ip instead of the in-process simulator\n"
+            << "  --target-address <addr>    Logical address of the server, default 0x5000\n"
+            << "  --output <file>            Write the json report to file instead of stdout\n"
+            << "Payload size and pending responses only apply to the in-process simulator, an external server\n"
+            << "must answer 22 F1 00 itself.\n";
+}
+
+/**
+ * @brief       Function to parse a number, decimal or with 0x prefix
+ */
+auto ParseNumber(char const *text, unsigned long max_value) -> std::optional<unsigned long> {
+  char *end{nullptr};
+  unsigned long const value{std::strtoul(text, &end, 0)};
+  if ((end == text) || (*end != '\0') || (value > max_value)) { return std::nullopt; }
+  return value;
+}
+
+/**
+ * @brief       Function to parse the command line, returns false on invalid arguments
+ */
+auto ParseOptions(int argc, char *argv[], Options &options) -> bool {
+  for (int index{1}; index < argc; index += 2) {
+    std::string_view const option{argv[index]};
+    if ((index + 1) >= argc) { return false; }
+    char const *const argument{argv[index + 1]};
+    if (option == "--server") {
+      options.server_ip_address = argument;
+      continue;
+    }
+    if (option == "--output") {
+      options.output_path = argument;
+      continue;
+    }
+    std::optional<unsigned long> const value{ParseNumber(argument, 0xFFFFFFFFUL)};
+    if (!value.has_value()) { return false; }
+    if (option == "--conversations") {
+      options.conversations = *value;
+    } else if (option == "--duration-ms") {
+      options.duration = std::chrono::milliseconds{*value};
+    } else if (option == "--payload-size") {
+      options.payload_size = *value;
+    } else if ((option == "--pending") && (*value <= 0xFFU)) {
+      options.pending_responses = static_cast<std::uint8_t>(*value);
+    } else if (option == "--pending-interval-ms") {
+      options.pending_interval = std::chrono::milliseconds{*value};
+    } else if (option == "--simulator-threads") {
+      options.simulator_threads = *value;
+    } else if ((option == "--target-address") && (*value <= 0xFFFFU)) {
+      options.target_address = static_cast<std::uint16_t>(*value);
+    } else {
+      return false;
+    }
+  }
+  return (options.conversations > 0U) && (options.simulator_threads > 0U) &&
+         ((options.payload_size + kResponseOverhead) <= kRxBufferSize);
+}
+
+/**
+ * @brief       Function to call the functor with the name and the stat line of every thread of this process
+ */
+template<typename Func>
+void ForEachThread(Func &&func) {
+  for (std::filesystem::directory_entry const &task: std::filesystem::directory_iterator{"/proc/self/task"}) {
+    std::string name{};
+    std::string stat{};
+    std::getline(std::ifstream{task.path() / "comm"}, name);
+    std::getline(std::ifstream{task.path() / "stat"}, stat);
+    func(std::string_view{name}, std::string_view{stat});
+  }
+}
+
+/**
+ * @brief       Function to get the number of threads of this process, the in-process simulator is not counted
+ */
+auto GetClientThreadCount() -> std::size_t {
+  std::size_t thread_count{0U};
+  ForEachThread([&thread_count](std::string_view name, std::string_view) {
+    if (name != doip_simulator::DoipSimulator::kThreadName) { ++thread_count; }
+  });
+  return thread_count;
+}
+
+/**
+ * @brief       Function to get the user and system cpu time consumed by the threads of the diag client and the main
+ *              thread, the in-process simulator and the conversation threads are not counted
+ */
+auto GetLibraryCpuTime() -> std::chrono::microseconds {
+  std::uint64_t ticks{0U};
+  ForEachThread([&ticks](std::string_view name, std::string_view stat) {
+    std::size_t const name_end{stat.rfind(')')};
+    if ((name == doip_simulator::DoipSimulator::kThreadName) || (name == kConversationThreadName) ||
+        (name_end == std::string_view::npos)) {
+      return;
+    }
+    // utime and stime are the 12th and 13th field after the thread name
+    std::istringstream fields{std::string{stat.substr(name_end + 1U)}};
+    std::string field{};
+    for (std::uint8_t index{0U}; index < 11U; ++index) { fields >> field; }
+    std::uint64_t user_ticks{0U};
+    std::uint64_t system_ticks{0U};
+    fields >> user_ticks >> system_ticks;
+    ticks += user_ticks + system_ticks;
+  });
+  return std::chrono::microseconds{ticks * 1000000U / static_cast<std::uint64_t>(sysconf(_SC_CLK_TCK))};
+}
+
+/**
+ * @brief       Function to get the user and system cpu time consumed by the calling thread
+ */
+auto GetThreadCpuTime() -> std::chrono::microseconds {
+  timespec time{};
+  static_cast<void>(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time));
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::seconds{time.tv_sec} +
+                                                               std::chrono::nanoseconds{time.tv_nsec});
+}
+
+/**
+ * @brief       Function to get the configuration of the in-process simulator
+ */
+auto CreateSimulatorConfig(Options const &options) -> doip_simulator::SimulatorConfig {
+  doip_simulator::EcuConfig const ecu{kSimulatorLogicalAddress,
+                                      std::chrono::milliseconds{0},
+                                      options.pending_responses,
+                                      options.pending_interval,
+                                      {{kDataIdentifier, ByteVector(options.payload_size, 0xA5U)}},
+                                      {}};
+  doip_simulator::EntityConfig const entity{std::string{kSimulatorIpAddress},
+                                            kSimulatorLogicalAddress,
+                                            "BENCHVEHICLE00001",
+                                            {0x00U, 0x02U, 0x36U, 0x31U, 0x00U, 0x01U},
+                                            {0x00U, 0x02U, 0x36U, 0x31U, 0x00U, 0x01U},
+                                            0x10U,
+                                            {ecu}};
+  return doip_simulator::SimulatorConfig{13400U, "127.255.255.255", 0U, std::chrono::milliseconds{0}, false, {entity}};
+}
+
+/**
+ * @brief       Function to send requests until the end time, every round-trip time is recorded
+ */
+auto RunConversation(DiagClientConversation &conversation, std::string_view server_ip_address,
+                     Clock::time_point start_time, Clock::time_point end_time) -> ConversationResult {
+  ConversationResult result{{}, 0U, std::chrono::microseconds{0}};
+  result.latencies_ns.reserve(1U << 16U);
+  std::this_thread::sleep_until(start_time);
+  std::chrono::microseconds const cpu_time_start{GetThreadCpuTime()};
+  while (Clock::now() < end_time) {
+    ByteVector request{0x22U};
+    core_type::AppendBigEndian(request, kDataIdentifier);
+    Clock::time_point const request_time{Clock::now()};
+    auto response{
+        conversation.SendDiagnosticRequest(std::make_unique<UdsMessage>(server_ip_address, std::move(request)))};
+    if (response.HasValue() && (response.Value()->GetPayload().size() > 0U) &&
+        (response.Value()->GetPayload()[0U] == 0x62U)) {
+      result.latencies_ns.push_back(static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - request_time).count()));
+    } else {
+      ++result.errors;
+    }
+  }
+  result.cpu_time = GetThreadCpuTime() - cpu_time_start;
+  return result;
+}
+
+/**
+ * @brief       Function to get the percentile of sorted latencies in microseconds
+ */
+auto GetPercentile(std::vector<std::uint64_t> const &sorted_latencies_ns, double percentile) -> double {
+  if (sorted_latencies_ns.empty()) { return 0.0; }
+  std::size_t const rank{static_cast<std::size_t>(
+      std::ceil(percentile * static_cast<double>(sorted_latencies_ns.size())))};
+  std::size_t const index{std::min(sorted_latencies_ns.size(), std::max<std::size_t>(rank, 1U)) - 1U};
+  return static_cast<double>(sorted_latencies_ns[index]) / 1000.0;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options{1U, std::chrono::milliseconds{1000}, 32U, 0U, std::chrono::milliseconds{0}, 1U, "",
+                  kSimulatorLogicalAddress, ""};
+  if (!ParseOptions(argc, argv, options)) {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  bool const is_simulator_in_process{options.server_ip_address.empty()};
+  if (is_simulator_in_process) { options.server_ip_address = std::string{kSimulatorIpAddress}; }
+
+  std::unique_ptr<doip_simulator::DoipSimulator> simulator{};
+  if (is_simulator_in_process) {
+    simulator = std::make_unique<doip_simulator::DoipSimulator>(CreateSimulatorConfig(options));
+    auto started{simulator->Start(options.simulator_threads)};
+    if (!started.HasValue()) {
+      std::cerr << "Simulator start failed: " << started.Error() << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::vector<std::string> names{};
+  std::vector<ConversationConfig> conversation_configs{};
+  names.reserve(options.conversations);
+  for (std::size_t index{0U}; index < options.conversations; ++index) {
+    names.emplace_back("DiagTester" + std::to_string(index));
+  }
+  for (std::size_t index{0U}; index < options.conversations; ++index) {
+    conversation_configs.push_back(ConversationConfig{names[index], 1000U, 5000U, kRxBufferSize,
+                                                      static_cast<std::uint16_t>(kFirstSourceAddress + index),
+                                                      kLocalIpAddress});
+  }
+  std::unique_ptr<diag::client::DiagClient> diag_client{diag::client::CreateDiagnosticClient(DiagClientConfig{
+      kLocalIpAddress, "127.255.255.255", core_type::Span<ConversationConfig const>{conversation_configs}})};
+  if (!diag_client->Initialize().HasValue()) {
+    std::cerr << "Initialize of diag client failed\n";
+    return EXIT_FAILURE;
+  }
+  DeInitializeGuard de_initialize_guard{*diag_client};
+
+  // conversations are neither copyable nor movable
+  std::vector<std::unique_ptr<DiagClientConversation>> conversations{};
+  conversations.reserve(options.conversations);
+  for (std::string const &name: names) {
+    conversations.emplace_back(new DiagClientConversation{diag_client->GetDiagnosticClientConversation(name)});
+    conversations.back()->Startup();
+    if (conversations.back()->ConnectToDiagServer(options.target_address, options.server_ip_address) !=
+        DiagClientConversation::ConnectResult::kConnectSuccess) {
+      std::cerr << "Connect of " << name << " to " << options.server_ip_address << " failed\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // all conversations start at the same time after their threads are created
+  Clock::time_point const start_time{Clock::now() + std::chrono::milliseconds{10}};
+  Clock::time_point const end_time{start_time + options.duration};
+  std::vector<ConversationResult> results(options.conversations);
+  std::vector<std::thread> threads{};
+  threads.reserve(options.conversations);
+  for (std::size_t index{0U}; index < options.conversations; ++index) {
+    threads.emplace_back([&conversations, &results, &options, index, start_time, end_time]() {
+      results[index] = RunConversation(*conversations[index], options.server_ip_address, start_time, end_time);
+    });
+    pthread_setname_np(threads.back().native_handle(), kConversationThreadName);
+  }
+  std::this_thread::sleep_until(start_time);
+  std::chrono::microseconds const library_cpu_time_start{GetLibraryCpuTime()};
+  // threads are counted in the middle of measurement, all conversations are running then
+  std::this_thread::sleep_until(start_time + (options.duration / 2));
+  std::size_t const thread_count{GetClientThreadCount()};
+  std::this_thread::sleep_until(end_time);
+  for (std::thread &thread: threads) { thread.join(); }
+  Clock::time_point const stop_time{Clock::now()};
+  // the conversation threads measured their own cpu time, they are gone now
+  std::chrono::microseconds cpu_time{GetLibraryCpuTime() - library_cpu_time_start};
+
+  for (std::unique_ptr<DiagClientConversation> &conversation: conversations) {
+    static_cast<void>(conversation->DisconnectFromDiagServer());
+    conversation->Shutdown();
+  }
+  conversations.clear();
+  de_initialize_guard.DeInitialize();
+  if (simulator) { simulator->Stop(); }
+
+  std::vector<std::uint64_t> latencies_ns{};
+  std::uint64_t errors{0U};
+  for (ConversationResult &result: results) {
+    latencies_ns.insert(latencies_ns.end(), result.latencies_ns.begin(), result.latencies_ns.end());
+    errors += result.errors;
+    cpu_time += result.cpu_time;
+  }
+  std::sort(latencies_ns.begin(), latencies_ns.end());
+  std::uint64_t const request_count{latencies_ns.size()};
+  double const elapsed_s{std::chrono::duration<double>(stop_time - start_time).count()};
+  std::uint64_t const latency_sum_ns{std::accumulate(latencies_ns.begin(), latencies_ns.end(), std::uint64_t{0U})};
+  double const mean_us{
+      request_count == 0U ? 0.0 : static_cast<double>(latency_sum_ns) / static_cast<double>(request_count) / 1000.0};
+  double const cpu_per_request_us{
+      request_count == 0U ? 0.0 : static_cast<double>(cpu_time.count()) / static_cast<double>(request_count)};
+
+  std::ofstream output_file{};
+  if (!options.output_path.empty()) {
+    output_file.open(options.output_path);
+    if (!output_file) {
+      std::cerr << "Opening " << options.output_path << " failed\n";
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream &report{options.output_path.empty() ? std::cout : output_file};
+  report << "{\"conversations\": " << options.conversations << ", \"duration_ms\": " << options.duration.count()
+         << ", \"payload_size\": " << options.payload_size
+         << ", \"pending_responses\": " << static_cast<unsigned>(options.pending_responses)
+         << ", \"pending_interval_ms\": " << options.pending_interval.count()
+         << ", \"simulator_in_process\": " << (is_simulator_in_process ? "true" : "false")
+         << ", \"requests\": " << request_count << ", \"errors\": " << errors
+         << ", \"requests_per_second\": " << (static_cast<double>(request_count) / elapsed_s)
+         << ", \"latency_us\": {\"min\": " << GetPercentile(latencies_ns, 0.0) << ", \"mean\": " << mean_us
+         << ", \"p50\": " << GetPercentile(latencies_ns, 0.5) << ", \"p99\": " << GetPercentile(latencies_ns, 0.99)
+         << ", \"p999\": " << GetPercentile(latencies_ns, 0.999) << ", \"max\": " << GetPercentile(latencies_ns, 1.0)
+         << "}, \"cpu_us_per_request\": " << cpu_per_request_us << ", \"threads\": " << thread_count << "}"
+         << std::endl;
+  return (request_count > 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,121 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "parser/json_parser.h"
+#include "simulator/doip_simulator.h"
+#include "simulator/simulator_config.h"
+
+namespace {
+
+/**
+ * @brief       Command line options of the simulator
+ */
+struct Options {
+  std::string config_path;
+  std::size_t thread_count;
+  std::chrono::milliseconds duration;
+};
+
+/**
+ * @brief       Function to print the usage
+ */
+void PrintUsage(char const *program) {
+  std::cerr << "Usage: " << program << " <config.json> [--threads <count>] [--duration-ms <time>]\n"
+            << "  --threads      Threads running the event loop of all entities, default 1\n"
+            << "  --duration-ms  Time after which the simulator exits, default 0 runs until SIGINT/SIGTERM\n"
+            << "SIGUSR1 lets all entities send a burst of vehicle announcements.\n";
+}
+
+/**
+ * @brief       Function to parse the command line, returns false on invalid arguments
+ */
+auto ParseOptions(int argc, char *argv[], Options &options) -> bool {
+  if (argc < 2) { return false; }
+  options.config_path = argv[1];
+  for (int index{2}; index < argc; index += 2) {
+    std::string_view const option{argv[index]};
+    if ((index + 1) >= argc) { return false; }
+    char *end{nullptr};
+    unsigned long const value{std::strtoul(argv[index + 1], &end, 10)};
+    if (*end != '\0') { return false; }
+    if (option == "--threads") {
+      options.thread_count = value;
+    } else if (option == "--duration-ms") {
+      options.duration = std::chrono::milliseconds{value};
+    } else {
+      return false;
+    }
+  }
+  return options.thread_count > 0U;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options{"", 1U, std::chrono::milliseconds{0}};
+  if (!ParseOptions(argc, argv, options)) {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  boost_support::parser::boost_tree config_tree{};
+  if (!boost_support::parser::Read(options.config_path, config_tree).HasValue()) {
+    std::cerr << "Reading " << options.config_path << " failed\n";
+    return EXIT_FAILURE;
+  }
+  auto config{doip_simulator::ReadSimulatorConfig(config_tree)};
+  if (!config.HasValue()) {
+    std::cerr << "Invalid configuration: " << config.Error() << "\n";
+    return EXIT_FAILURE;
+  }
+  std::size_t const entity_count{config.Value().entities.size()};
+  doip_simulator::DoipSimulator simulator{std::move(config).Value()};
+  auto started{simulator.Start(options.thread_count)};
+  if (!started.HasValue()) {
+    std::cerr << "Start failed: " << started.Error() << "\n";
+    return EXIT_FAILURE;
+  }
+  std::cerr << "DoIP simulator running " << entity_count << " entities on " << options.thread_count << " threads\n";
+
+  // the main thread only waits for signals and the end of duration
+  boost::asio::io_context main_context{};
+  boost::asio::signal_set signals{main_context, SIGINT, SIGTERM, SIGUSR1};
+  boost::asio::steady_timer duration_timer{main_context};
+  std::function<void(boost::system::error_code const &, int)> handle_signal{};
+  handle_signal = [&](boost::system::error_code const &error, int signal_number) {
+    if (error) { return; }
+    if (signal_number == SIGUSR1) {
+      simulator.SendAnnouncements();
+      signals.async_wait(handle_signal);
+    } else {
+      main_context.stop();
+    }
+  };
+  signals.async_wait(handle_signal);
+  if (options.duration.count() > 0) {
+    duration_timer.expires_after(options.duration);
+    duration_timer.async_wait([&main_context](boost::system::error_code const &error) {
+      if (!error) { main_context.stop(); }
+    });
+  }
+  main_context.run();
+
+  simulator.Stop();
+  std::cout << simulator.GetStatistics() << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,468 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "simulator/doip_entity.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "core/include/endian_codec.h"
+#include "doip_handler/common_doip_types.h"
+
+namespace doip_simulator {
+namespace {
+
+/**
+ * @brief       Type alias of tcp and udp protocol
+ */
+using Tcp = boost::asio::ip::tcp;
+using Udp = boost::asio::ip::udp;
+
+/**
+ * @brief       Offsets within the DoIP generic header
+ */
+constexpr std::size_t kPayloadTypeOffset{2U};
+constexpr std::size_t kPayloadLengthOffset{4U};
+
+/**
+ * @brief       Function to check the protocol version and its inverse of the header
+ */
+auto IsValidHeader(core_type::Span<std::uint8_t const> header) noexcept -> bool {
+  return (header.size() >= kDoipheadrSize) && (header[0U] == static_cast<std::uint8_t>(~header[1U]));
+}
+
+}  // namespace
+
+auto CreateDoipHeader(std::uint16_t payload_type, std::uint32_t payload_length) -> std::vector<std::uint8_t> {
+  std::vector<std::uint8_t> message{};
+  message.reserve(kDoipheadrSize + payload_length);
+  message.push_back(kDoip_ProtocolVersion);
+  message.push_back(static_cast<std::uint8_t>(~kDoip_ProtocolVersion));
+  core_type::AppendBigEndian(message, payload_type);
+  core_type::AppendBigEndian(message, payload_length);
+  return message;
+}
+
+/**
+ * @brief       Class handling a tcp connection of the tester, one strand serializes all its handlers
+ */
+class DoipEntity::Connection final : public std::enable_shared_from_this<Connection> {
+ public:
+  /**
+   * @brief         Construct an instance of Connection
+   * @param[in]     socket
+   *                The accepted socket
+   * @param[in]     entity
+   *                The entity accepting the connection
+   */
+  Connection(Tcp::socket socket, DoipEntity &entity)
+      : socket_{std::move(socket)},
+        response_timer_{socket_.get_executor()},
+        entity_{entity},
+        header_{},
+        payload_{},
+        tx_queue_{},
+        scheduled_responses_{},
+        tester_address_{},
+        close_after_write_{false} {}
+
+  /**
+   * @brief         Function to start reading messages
+   */
+  void Start() {
+    // no delay, as responses are small and their timing is simulated
+    boost::system::error_code ec{};
+    socket_.set_option(Tcp::no_delay{true}, ec);
+    ReadHeader();
+  }
+
+ private:
+  /**
+   * @brief         Diagnostic message scheduled to be sent
+   */
+  struct ScheduledMessage {
+    std::chrono::milliseconds delay;
+    std::uint16_t source_address;
+    std::uint16_t target_address;
+    std::vector<std::uint8_t> payload;
+    bool is_pending;
+  };
+
+  /**
+   * @brief         Function to read the next generic header
+   */
+  void ReadHeader() {
+    boost::asio::async_read(socket_, boost::asio::buffer(header_),
+                            [self = shared_from_this()](boost::system::error_code const &error, std::size_t) {
+                              if (!error) { self->HandleHeader(); }
+                            });
+  }
+
+  /**
+   * @brief         Function to validate the header and read the payload
+   */
+  void HandleHeader() {
+    if (!IsValidHeader(core_type::Span<std::uint8_t const>{header_.data(), header_.size()})) {
+      SendGenericNegativeAcknowledgement(kDoip_GenericHeader_IncorrectPattern);
+      return;
+    }
+    std::uint32_t const payload_length{core_type::LoadBigEndian<std::uint32_t>(&header_[kPayloadLengthOffset])};
+    if (payload_length > kTcpChannelLength) {
+      SendGenericNegativeAcknowledgement(kDoip_GenericHeader_MessageTooLarge);
+      return;
+    }
+    payload_.resize(payload_length);
+    boost::asio::async_read(socket_, boost::asio::buffer(payload_),
+                            [self = shared_from_this()](boost::system::error_code const &error, std::size_t) {
+                              if (!error) {
+                                self->HandlePayload();
+                                self->ReadHeader();
+                              }
+                            });
+  }
+
+  /**
+   * @brief         Function to handle the received message
+   */
+  void HandlePayload() {
+    switch (core_type::LoadBigEndian<std::uint16_t>(&header_[kPayloadTypeOffset])) {
+      case kDoip_RoutingActivation_ReqType:
+        HandleRoutingActivation();
+        break;
+      case kDoip_DiagMessage_Type:
+        HandleDiagnosticMessage();
+        break;
+      case kDoip_AliveCheck_ReqType: {
+        std::vector<std::uint8_t> response{};
+        core_type::AppendBigEndian(response, tester_address_.value_or(0U));
+        Send(kDoip_AliveCheck_ResType, std::move(response));
+      } break;
+      default:
+        SendGenericNegativeAcknowledgement(kDoip_GenericHeader_UnknownPayload);
+        break;
+    }
+  }
+
+  /**
+   * @brief         Function to answer the routing activation request with the configured response code
+   */
+  void HandleRoutingActivation() {
+    if (payload_.size() < kDoip_RoutingActivation_ReqMinLen) {
+      SendGenericNegativeAcknowledgement(kDoip_GenericHeader_InvalidPayloadLen);
+      return;
+    }
+    std::uint16_t const tester_address{core_type::LoadBigEndian<std::uint16_t>(payload_.data())};
+    std::uint8_t const response_code{entity_.GetConfig().routing_activation_code};
+    if (response_code == kDoip_RoutingActivation_ResCode_RoutingSuccessful) { tester_address_ = tester_address; }
+    std::vector<std::uint8_t> response{};
+    core_type::AppendBigEndian(response, tester_address);
+    core_type::AppendBigEndian(response, entity_.GetConfig().logical_address);
+    response.insert(response.end(), {response_code, 0x00U, 0x00U, 0x00U, 0x00U});
+    Send(kDoip_RoutingActivation_ResType, std::move(response));
+    // the connection is closed when routing is denied
+    close_after_write_ = (response_code != kDoip_RoutingActivation_ResCode_RoutingSuccessful);
+    entity_.GetStatistics().routing_activations.fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief         Function to acknowledge the diagnostic message and to schedule the responses of the ecu
+   */
+  void HandleDiagnosticMessage() {
+    if (payload_.size() <= kDoip_DiagMessage_ReqResMinLen) {
+      SendGenericNegativeAcknowledgement(kDoip_GenericHeader_InvalidPayloadLen);
+      return;
+    }
+    entity_.GetStatistics().diagnostic_requests.fetch_add(1U, std::memory_order_relaxed);
+    std::uint16_t const source_address{core_type::LoadBigEndian<std::uint16_t>(&payload_[0U])};
+    std::uint16_t const target_address{core_type::LoadBigEndian<std::uint16_t>(&payload_[2U])};
+    UdsResponder const *const responder{entity_.FindResponder(target_address)};
+    std::uint8_t ack_code{kDoip_DiagnosticMessage_PosAckCode_Confirm};
+    if (!tester_address_.has_value() || (*tester_address_ != source_address)) {
+      ack_code = kDoip_DiagnosticMessage_NegAckCode_InvalidSA;
+    } else if (responder == nullptr) {
+      ack_code = kDoip_DiagnosticMessage_NegAckCode_UnknownTA;
+    }
+    std::vector<std::uint8_t> acknowledgement{};
+    core_type::AppendBigEndian(acknowledgement, target_address);
+    core_type::AppendBigEndian(acknowledgement, source_address);
+    acknowledgement.push_back(ack_code);
+    if (ack_code != kDoip_DiagnosticMessage_PosAckCode_Confirm) {
+      entity_.GetStatistics().negative_acknowledgements.fetch_add(1U, std::memory_order_relaxed);
+      Send(kDoip_DiagMessageNegAck_Type, std::move(acknowledgement));
+      return;
+    }
+    Send(kDoip_DiagMessagePosAck_Type, std::move(acknowledgement));
+
+    std::vector<ScheduledResponse> responses{responder->Respond(
+        core_type::Span<std::uint8_t const>{&payload_[kDoip_DiagMessage_ReqResMinLen],
+                                            payload_.size() - kDoip_DiagMessage_ReqResMinLen})};
+    bool const is_idle{scheduled_responses_.empty()};
+    for (std::size_t index{0U}; index < responses.size(); ++index) {
+      scheduled_responses_.push_back(ScheduledMessage{responses[index].delay, target_address, source_address,
+                                                      std::move(responses[index].payload),
+                                                      (index + 1U) < responses.size()});
+    }
+    if (is_idle && !scheduled_responses_.empty()) { ScheduleNextResponse(); }
+  }
+
+  /**
+   * @brief         Function to send the next scheduled response once its delay elapsed
+   */
+  void ScheduleNextResponse() {
+    response_timer_.expires_after(scheduled_responses_.front().delay);
+    response_timer_.async_wait([self = shared_from_this()](boost::system::error_code const &error) {
+      if (error) { return; }
+      ScheduledMessage message{std::move(self->scheduled_responses_.front())};
+      self->scheduled_responses_.pop_front();
+      std::vector<std::uint8_t> payload{};
+      payload.reserve(kDoip_DiagMessage_ReqResMinLen + message.payload.size());
+      core_type::AppendBigEndian(payload, message.source_address);
+      core_type::AppendBigEndian(payload, message.target_address);
+      payload.insert(payload.end(), message.payload.begin(), message.payload.end());
+      self->Send(kDoip_DiagMessage_Type, std::move(payload));
+      (message.is_pending ? self->entity_.GetStatistics().pending_responses
+                          : self->entity_.GetStatistics().diagnostic_responses)
+          .fetch_add(1U, std::memory_order_relaxed);
+      if (!self->scheduled_responses_.empty()) { self->ScheduleNextResponse(); }
+    });
+  }
+
+  /**
+   * @brief         Function to send the generic header negative acknowledgement and to close the connection
+   */
+  void SendGenericNegativeAcknowledgement(std::uint8_t nack_code) {
+    Send(kDoip_GenericHeadr_NackType, std::vector<std::uint8_t>{nack_code});
+    close_after_write_ = true;
+  }
+
+  /**
+   * @brief         Function to queue the message for transmission
+   */
+  void Send(std::uint16_t payload_type, std::vector<std::uint8_t> payload) {
+    std::vector<std::uint8_t> message{CreateDoipHeader(payload_type, static_cast<std::uint32_t>(payload.size()))};
+    message.insert(message.end(), payload.begin(), payload.end());
+    tx_queue_.push_back(std::move(message));
+    if (tx_queue_.size() == 1U) { Write(); }
+  }
+
+  /**
+   * @brief         Function to write the first queued message
+   */
+  void Write() {
+    boost::asio::async_write(socket_, boost::asio::buffer(tx_queue_.front()),
+                             [self = shared_from_this()](boost::system::error_code const &error, std::size_t) {
+                               self->tx_queue_.pop_front();
+                               if (error) {
+                                 self->Close();
+                               } else if (!self->tx_queue_.empty()) {
+                                 self->Write();
+                               } else if (self->close_after_write_) {
+                                 self->Close();
+                               }
+                             });
+  }
+
+  /**
+   * @brief         Function to close the connection, pending handlers complete with an error
+   */
+  void Close() {
+    boost::system::error_code ec{};
+    response_timer_.cancel();
+    socket_.shutdown(Tcp::socket::shutdown_both, ec);
+    socket_.close(ec);
+  }
+
+  /**
+   * @brief         The socket of connection
+   */
+  Tcp::socket socket_;
+
+  /**
+   * @brief         The timer delaying the responses
+   */
+  boost::asio::steady_timer response_timer_;
+
+  /**
+   * @brief         The entity accepting the connection
+   */
+  DoipEntity &entity_;
+
+  /**
+   * @brief         The generic header of received message
+   */
+  std::array<std::uint8_t, kDoipheadrSize> header_;
+
+  /**
+   * @brief         The payload of received message
+   */
+  std::vector<std::uint8_t> payload_;
+
+  /**
+   * @brief         The messages waiting for transmission
+   */
+  std::deque<std::vector<std::uint8_t>> tx_queue_;
+
+  /**
+   * @brief         The responses waiting for their delay
+   */
+  std::deque<ScheduledMessage> scheduled_responses_;
+
+  /**
+   * @brief         The logical address of tester, set by a successful routing activation
+   */
+  std::optional<std::uint16_t> tester_address_;
+
+  /**
+   * @brief         Whether the connection is closed once all messages are sent
+   */
+  bool close_after_write_;
+};
+
+DoipEntity::DoipEntity(boost::asio::io_context &io_context, EntityConfig const &entity, SimulatorConfig const &config,
+                       SimulatorStatistics &statistics)
+    : entity_{entity},
+      config_{config},
+      statistics_{statistics},
+      responders_{},
+      io_context_{io_context},
+      strand_{boost::asio::make_strand(io_context)},
+      acceptor_{strand_},
+      udp_socket_{strand_},
+      announcement_timer_{strand_},
+      rx_buffer_{},
+      remote_endpoint_{} {
+  responders_.reserve(entity_.ecus.size());
+  for (EcuConfig const &ecu: entity_.ecus) { responders_.emplace_back(ecu, entity_.vin); }
+}
+
+auto DoipEntity::Start() noexcept -> core_type::Result<void, std::string> {
+  boost::system::error_code ec{};
+  boost::asio::ip::address const address{boost::asio::ip::make_address(entity_.ip_address, ec)};
+  if (!ec) {
+    Tcp::endpoint const endpoint{address, config_.port};
+    acceptor_.open(endpoint.protocol(), ec);
+    if (!ec) { acceptor_.set_option(Tcp::acceptor::reuse_address{true}, ec); }
+    if (!ec) { acceptor_.bind(endpoint, ec); }
+    if (!ec) { acceptor_.listen(Tcp::acceptor::max_listen_connections, ec); }
+  }
+  if (!ec) {
+    Udp::endpoint const endpoint{address, config_.port};
+    udp_socket_.open(endpoint.protocol(), ec);
+    if (!ec) { udp_socket_.set_option(Udp::socket::reuse_address{true}, ec); }
+    if (!ec) { udp_socket_.set_option(Udp::socket::broadcast{true}, ec); }
+    if (!ec) { udp_socket_.bind(endpoint, ec); }
+  }
+  if (ec) {
+    return core_type::Result<void, std::string>::FromError("entity <" + entity_.ip_address + "," +
+                                                           std::to_string(config_.port) + "> failed: " + ec.message());
+  }
+  boost::asio::post(strand_, [this]() {
+    Accept();
+    Receive();
+  });
+  return core_type::Result<void, std::string>::FromValue();
+}
+
+void DoipEntity::SendAnnouncements() {
+  boost::asio::post(strand_, [this]() { SendNextAnnouncement(config_.announcement_count); });
+}
+
+void DoipEntity::HandleVehicleIdentificationRequest(std::vector<std::uint8_t> const &request,
+                                                    UdpEndpoint const &requester) {
+  boost::asio::post(strand_, [this, request, requester]() {
+    RespondToVehicleIdentification(core_type::Span<std::uint8_t const>{request.data(), request.size()}, requester);
+  });
+}
+
+auto DoipEntity::FindResponder(std::uint16_t logical_address) const noexcept -> UdsResponder const * {
+  for (UdsResponder const &responder: responders_) {
+    if (responder.GetLogicalAddress() == logical_address) { return &responder; }
+  }
+  return nullptr;
+}
+
+void DoipEntity::Accept() {
+  acceptor_.async_accept(boost::asio::make_strand(io_context_),
+                         [this](boost::system::error_code const &error, Tcp::socket socket) {
+                           if (error == boost::asio::error::operation_aborted) { return; }
+                           if (!error) {
+                             statistics_.connections.fetch_add(1U, std::memory_order_relaxed);
+                             std::make_shared<Connection>(std::move(socket), *this)->Start();
+                           }
+                           Accept();
+                         });
+}
+
+void DoipEntity::Receive() {
+  udp_socket_.async_receive_from(boost::asio::buffer(rx_buffer_), remote_endpoint_,
+                                 [this](boost::system::error_code const &error, std::size_t length) {
+                                   if (error == boost::asio::error::operation_aborted) { return; }
+                                   if (!error) {
+                                     RespondToVehicleIdentification(
+                                         core_type::Span<std::uint8_t const>{rx_buffer_.data(), length},
+                                         remote_endpoint_);
+                                   }
+                                   Receive();
+                                 });
+}
+
+void DoipEntity::SendNextAnnouncement(std::uint8_t remaining_count) {
+  if (remaining_count == 0U) { return; }
+  boost::system::error_code ec{};
+  boost::asio::ip::address const address{boost::asio::ip::make_address(config_.announcement_address, ec)};
+  if (ec) { return; }
+  SendVehicleAnnouncement(UdpEndpoint{address, config_.port});
+  statistics_.announcements.fetch_add(1U, std::memory_order_relaxed);
+  announcement_timer_.expires_after(config_.announcement_interval);
+  announcement_timer_.async_wait([this, remaining_count](boost::system::error_code const &error) {
+    if (!error) { SendNextAnnouncement(static_cast<std::uint8_t>(remaining_count - 1U)); }
+  });
+}
+
+void DoipEntity::RespondToVehicleIdentification(core_type::Span<std::uint8_t const> request,
+                                                UdpEndpoint const &requester) {
+  if (!IsValidHeader(request)) { return; }
+  core_type::Span<std::uint8_t const> const payload{request.subspan(kDoipheadrSize)};
+  bool is_requested{false};
+  switch (core_type::LoadBigEndian<std::uint16_t>(&request[kPayloadTypeOffset])) {
+    case kDoip_VehicleIdentification_ReqType:
+      is_requested = true;
+      break;
+    case kDoip_VehicleIdentificationEID_ReqType:
+      is_requested = (payload.size() == entity_.eid.size()) &&
+                     std::equal(payload.begin(), payload.end(), entity_.eid.begin());
+      break;
+    case kDoip_VehicleIdentificationVIN_ReqType:
+      is_requested = (payload.size() == entity_.vin.size()) &&
+                     std::equal(payload.begin(), payload.end(), entity_.vin.begin());
+      break;
+    default:
+      break;
+  }
+  if (is_requested) {
+    SendVehicleAnnouncement(requester);
+    statistics_.vehicle_identification_responses.fetch_add(1U, std::memory_order_relaxed);
+  }
+}
+
+void DoipEntity::SendVehicleAnnouncement(UdpEndpoint const &endpoint) {
+  std::shared_ptr<std::vector<std::uint8_t>> message{std::make_shared<std::vector<std::uint8_t>>(
+      CreateDoipHeader(kDoip_VehicleAnnouncement_ResType, kDoip_VehicleAnnouncement_ResMaxLen))};
+  message->insert(message->end(), entity_.vin.begin(), entity_.vin.end());
+  core_type::AppendBigEndian(*message, entity_.logical_address);
+  message->insert(message->end(), entity_.eid.begin(), entity_.eid.end());
+  message->insert(message->end(), entity_.gid.begin(), entity_.gid.end());
+  // no further action required, VIN and GID are synchronized
+  message->insert(message->end(), {0x00U, 0x00U});
+  udp_socket_.async_send_to(boost::asio::buffer(*message), endpoint,
+                            [message](boost::system::error_code const &, std::size_t) {});
+}
+
+}  // namespace doip_simulator
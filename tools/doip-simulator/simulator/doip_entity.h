@@ -0,0 +1,207 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_ENTITY_H
+#define DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_ENTITY_H
+
+#include <array>
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/include/result.h"
+#include "core/include/span.h"
+#include "simulator/simulator_config.h"
+#include "simulator/simulator_statistics.h"
+#include "simulator/uds_responder.h"
+
+namespace doip_simulator {
+
+/**
+ * @brief       Class simulating a DoIP entity with its tcp connections, vehicle identification and announcements
+ * @details     All handlers of entity run on its strand, every tcp connection has a strand of its own.
+ *              The entity must outlive the io context running its handlers.
+ */
+class DoipEntity final {
+ public:
+  /**
+   * @brief         Type alias of the udp endpoint
+   */
+  using UdpEndpoint = boost::asio::ip::udp::endpoint;
+
+  /**
+   * @brief         Construct an instance of DoipEntity
+   * @param[in]     io_context
+   *                The io context running the handlers
+   * @param[in]     entity
+   *                The entity configuration, it must outlive the entity
+   * @param[in]     config
+   *                The simulator configuration, it must outlive the entity
+   * @param[in]     statistics
+   *                The counters updated by the entity
+   */
+  DoipEntity(boost::asio::io_context &io_context, EntityConfig const &entity, SimulatorConfig const &config,
+             SimulatorStatistics &statistics);
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  DoipEntity(const DoipEntity &other) noexcept = delete;
+  DoipEntity &operator=(const DoipEntity &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  DoipEntity(DoipEntity &&other) noexcept = delete;
+  DoipEntity &operator=(DoipEntity &&other) noexcept = delete;
+
+  /**
+   * @brief         Destruct an instance of DoipEntity
+   */
+  ~DoipEntity() = default;
+
+  /**
+   * @brief         Function to bind the tcp and udp sockets and to start accepting connections
+   * @return        Empty result on success, otherwise the description of the failure
+   */
+  auto Start() noexcept -> core_type::Result<void, std::string>;
+
+  /**
+   * @brief         Function to send a burst of vehicle announcements
+   */
+  void SendAnnouncements();
+
+  /**
+   * @brief         Function to answer a vehicle identification request received on the broadcast listener
+   * @param[in]     request
+   *                The DoIP message including the generic header
+   * @param[in]     requester
+   *                The endpoint the request is received from
+   */
+  void HandleVehicleIdentificationRequest(std::vector<std::uint8_t> const &request, UdpEndpoint const &requester);
+
+  /**
+   * @brief         Function to get the responder of the ecu with the logical address
+   * @param[in]     logical_address
+   *                The logical address of ecu
+   * @return        The responder, nullptr when no ecu has the logical address
+   */
+  auto FindResponder(std::uint16_t logical_address) const noexcept -> UdsResponder const *;
+
+  /**
+   * @brief         Function to get the entity configuration
+   * @return        The entity configuration
+   */
+  auto GetConfig() const noexcept -> EntityConfig const & { return entity_; }
+
+  /**
+   * @brief         Function to get the counters
+   * @return        The counters
+   */
+  auto GetStatistics() noexcept -> SimulatorStatistics & { return statistics_; }
+
+ private:
+  /**
+   * @brief         Forward declaration of tcp connection
+   */
+  class Connection;
+
+  /**
+   * @brief         Function to accept the next tcp connection
+   */
+  void Accept();
+
+  /**
+   * @brief         Function to receive the next udp message
+   */
+  void Receive();
+
+  /**
+   * @brief         Function to send the next vehicle announcement of a burst
+   */
+  void SendNextAnnouncement(std::uint8_t remaining_count);
+
+  /**
+   * @brief         Function to answer a vehicle identification request, must run on the strand
+   */
+  void RespondToVehicleIdentification(core_type::Span<std::uint8_t const> request, UdpEndpoint const &requester);
+
+  /**
+   * @brief         Function to send the vehicle announcement message to the endpoint
+   */
+  void SendVehicleAnnouncement(UdpEndpoint const &endpoint);
+
+  /**
+   * @brief         The entity configuration
+   */
+  EntityConfig const &entity_;
+
+  /**
+   * @brief         The simulator configuration
+   */
+  SimulatorConfig const &config_;
+
+  /**
+   * @brief         The counters
+   */
+  SimulatorStatistics &statistics_;
+
+  /**
+   * @brief         The responders of all ecus of entity
+   */
+  std::vector<UdsResponder> responders_;
+
+  /**
+   * @brief         The io context running the handlers
+   */
+  boost::asio::io_context &io_context_;
+
+  /**
+   * @brief         The strand serializing the handlers of entity
+   */
+  boost::asio::strand<boost::asio::io_context::executor_type> strand_;
+
+  /**
+   * @brief         The tcp acceptor
+   */
+  boost::asio::ip::tcp::acceptor acceptor_;
+
+  /**
+   * @brief         The udp socket for vehicle identification and announcements
+   */
+  boost::asio::ip::udp::socket udp_socket_;
+
+  /**
+   * @brief         The timer between the vehicle announcements
+   */
+  boost::asio::steady_timer announcement_timer_;
+
+  /**
+   * @brief         The buffer of udp reception
+   */
+  std::array<std::uint8_t, 64U> rx_buffer_;
+
+  /**
+   * @brief         The endpoint of the last udp reception
+   */
+  UdpEndpoint remote_endpoint_;
+};
+
+/**
+ * @brief       Function to create the DoIP generic header
+ * @param[in]   payload_type
+ *              The payload type
+ * @param[in]   payload_length
+ *              The length of payload following the header
+ * @return      The header bytes, the payload is appended to them
+ */
+auto CreateDoipHeader(std::uint16_t payload_type, std::uint32_t payload_length) -> std::vector<std::uint8_t>;
+
+}  // namespace doip_simulator
+
+#endif  // DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_ENTITY_H
@@ -0,0 +1,86 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "simulator/doip_simulator.h"
+
+#include <pthread.h>
+
+#include <utility>
+
+namespace doip_simulator {
+
+DoipSimulator::DoipSimulator(SimulatorConfig config)
+    : config_{std::move(config)},
+      statistics_{},
+      io_context_{},
+      work_guard_{boost::asio::make_work_guard(io_context_)},
+      entities_{},
+      broadcast_socket_{io_context_},
+      broadcast_buffer_{},
+      broadcast_endpoint_{},
+      threads_{} {
+  entities_.reserve(config_.entities.size());
+  for (EntityConfig const &entity: config_.entities) {
+    entities_.push_back(std::make_unique<DoipEntity>(io_context_, entity, config_, statistics_));
+  }
+}
+
+DoipSimulator::~DoipSimulator() { Stop(); }
+
+auto DoipSimulator::Start(std::size_t thread_count) noexcept -> core_type::Result<void, std::string> {
+  for (std::unique_ptr<DoipEntity> &entity: entities_) {
+    auto result{entity->Start()};
+    if (!result.HasValue()) { return result; }
+  }
+  if (config_.broadcast_listener) {
+    boost::system::error_code ec{};
+    boost::asio::ip::udp::endpoint const endpoint{boost::asio::ip::address_v4::any(), config_.port};
+    broadcast_socket_.open(endpoint.protocol(), ec);
+    if (!ec) { broadcast_socket_.set_option(boost::asio::ip::udp::socket::reuse_address{true}, ec); }
+    if (!ec) { broadcast_socket_.bind(endpoint, ec); }
+    if (ec) {
+      return core_type::Result<void, std::string>::FromError("broadcast listener failed: " + ec.message());
+    }
+    ReceiveBroadcast();
+  }
+  for (std::size_t index{0U}; index < thread_count; ++index) {
+    threads_.emplace_back([this]() { io_context_.run(); });
+    pthread_setname_np(threads_.back().native_handle(), kThreadName);
+  }
+  SendAnnouncements();
+  return core_type::Result<void, std::string>::FromValue();
+}
+
+void DoipSimulator::Stop() noexcept {
+  work_guard_.reset();
+  io_context_.stop();
+  for (std::thread &thread: threads_) {
+    if (thread.joinable()) { thread.join(); }
+  }
+  threads_.clear();
+}
+
+void DoipSimulator::SendAnnouncements() {
+  for (std::unique_ptr<DoipEntity> &entity: entities_) { entity->SendAnnouncements(); }
+}
+
+void DoipSimulator::ReceiveBroadcast() {
+  broadcast_socket_.async_receive_from(
+      boost::asio::buffer(broadcast_buffer_), broadcast_endpoint_,
+      [this](boost::system::error_code const &error, std::size_t length) {
+        if (error == boost::asio::error::operation_aborted) { return; }
+        if (!error) {
+          std::vector<std::uint8_t> const request{broadcast_buffer_.begin(), broadcast_buffer_.begin() + length};
+          for (std::unique_ptr<DoipEntity> &entity: entities_) {
+            entity->HandleVehicleIdentificationRequest(request, broadcast_endpoint_);
+          }
+        }
+        ReceiveBroadcast();
+      });
+}
+
+}  // namespace doip_simulator
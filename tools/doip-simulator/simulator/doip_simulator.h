@@ -0,0 +1,139 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_SIMULATOR_H
+#define DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_SIMULATOR_H
+
+#include <array>
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/include/result.h"
+#include "simulator/doip_entity.h"
+#include "simulator/simulator_config.h"
+#include "simulator/simulator_statistics.h"
+
+namespace doip_simulator {
+
+/**
+ * @brief       Class simulating all configured DoIP entities on a pool of threads
+ * @details     The entities share one event loop, so hundreds of them are simulated with a few threads.
+ */
+class DoipSimulator final {
+ public:
+  /**
+   * @brief         Name of the threads running the event loop
+   */
+  static constexpr char kThreadName[]{"doip_sim"};
+
+  /**
+   * @brief         Construct an instance of DoipSimulator
+   * @param[in]     config
+   *                The simulator configuration
+   */
+  explicit DoipSimulator(SimulatorConfig config);
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  DoipSimulator(const DoipSimulator &other) noexcept = delete;
+  DoipSimulator &operator=(const DoipSimulator &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  DoipSimulator(DoipSimulator &&other) noexcept = delete;
+  DoipSimulator &operator=(DoipSimulator &&other) noexcept = delete;
+
+  /**
+   * @brief         Destruct an instance of DoipSimulator, the threads are stopped
+   */
+  ~DoipSimulator();
+
+  /**
+   * @brief         Function to bind the sockets of all entities, to start the threads and the first announcements
+   * @param[in]     thread_count
+   *                The number of threads running the event loop
+   * @return        Empty result on success, otherwise the description of the failure
+   */
+  auto Start(std::size_t thread_count) noexcept -> core_type::Result<void, std::string>;
+
+  /**
+   * @brief         Function to stop the threads, open connections are closed on destruction
+   */
+  void Stop() noexcept;
+
+  /**
+   * @brief         Function to let all entities send a burst of vehicle announcements at the same time
+   */
+  void SendAnnouncements();
+
+  /**
+   * @brief         Function to get the counters of all entities
+   * @return        The counters
+   */
+  auto GetStatistics() const noexcept -> SimulatorStatistics const & { return statistics_; }
+
+ private:
+  /**
+   * @brief         Function to receive the next broadcast message and to pass it to all entities
+   */
+  void ReceiveBroadcast();
+
+  /**
+   * @brief         The simulator configuration
+   */
+  SimulatorConfig config_;
+
+  /**
+   * @brief         The counters of all entities
+   */
+  SimulatorStatistics statistics_;
+
+  /**
+   * @brief         The event loop of all entities
+   */
+  boost::asio::io_context io_context_;
+
+  /**
+   * @brief         The guard keeping the event loop running without pending work
+   */
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
+
+  /**
+   * @brief         The simulated entities
+   */
+  std::vector<std::unique_ptr<DoipEntity>> entities_;
+
+  /**
+   * @brief         The udp socket receiving broadcast vehicle identification requests
+   */
+  boost::asio::ip::udp::socket broadcast_socket_;
+
+  /**
+   * @brief         The buffer of broadcast reception
+   */
+  std::array<std::uint8_t, 64U> broadcast_buffer_;
+
+  /**
+   * @brief         The endpoint of the last broadcast reception
+   */
+  boost::asio::ip::udp::endpoint broadcast_endpoint_;
+
+  /**
+   * @brief         The threads running the event loop
+   */
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace doip_simulator
+
+#endif  // DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_DOIP_SIMULATOR_H
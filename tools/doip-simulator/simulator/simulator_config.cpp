@@ -0,0 +1,250 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "simulator/simulator_config.h"
+
+#include <algorithm>
+#include <boost/asio/ip/address_v4.hpp>
+#include <cstdio>
+#include <limits>
+#include <utility>
+
+#include "core/include/endian_codec.h"
+#include "doip_handler/common_doip_types.h"
+
+namespace doip_simulator {
+namespace {
+
+/**
+ * @brief       Type alias of the property tree
+ */
+using boost_tree = boost_support::parser::boost_tree;
+
+/**
+ * @brief       Type alias of the result of reading an element
+ */
+template<typename T>
+using ReadResult = core_type::Result<T, std::string>;
+
+/**
+ * @brief       Number of characters of VIN
+ */
+constexpr std::size_t kVinLength{17U};
+
+/**
+ * @brief       Number of VIN characters replaced by the index of repeated entities
+ */
+constexpr std::size_t kVinIndexLength{6U};
+
+/**
+ * @brief       Function to get the value of a decimal digit
+ */
+auto GetDecimalDigit(char digit) noexcept -> int { return ((digit >= '0') && (digit <= '9')) ? digit - '0' : -1; }
+
+/**
+ * @brief       Function to get the value of a hex digit
+ */
+auto GetHexDigit(char digit) noexcept -> int {
+  if ((digit >= '0') && (digit <= '9')) { return digit - '0'; }
+  if ((digit >= 'a') && (digit <= 'f')) { return digit - 'a' + 10; }
+  if ((digit >= 'A') && (digit <= 'F')) { return digit - 'A' + 10; }
+  return -1;
+}
+
+/**
+ * @brief       Function to read an unsigned number given in decimal or as hex with "0x" prefix
+ */
+auto ReadNumber(boost_tree const &tree, std::string const &key, std::uint32_t default_value,
+                std::uint32_t max_value) noexcept -> ReadResult<std::uint32_t> {
+  boost::optional<std::string> const text{tree.get_optional<std::string>(key)};
+  if (!text) { return ReadResult<std::uint32_t>::FromValue(default_value); }
+  std::uint64_t value{0U};
+  bool const is_hex{(text->size() > 2U) && ((*text)[0U] == '0') && (((*text)[1U] == 'x') || ((*text)[1U] == 'X'))};
+  std::size_t const start{is_hex ? 2U : 0U};
+  bool is_valid{text->size() > start};
+  for (std::size_t index{start}; is_valid && (index < text->size()); ++index) {
+    int const digit{is_hex ? GetHexDigit((*text)[index]) : GetDecimalDigit((*text)[index])};
+    is_valid = (digit >= 0);
+    value = (value * (is_hex ? 16U : 10U)) + static_cast<std::uint64_t>(digit);
+    is_valid = is_valid && (value <= max_value);
+  }
+  if (!is_valid) { return ReadResult<std::uint32_t>::FromError("invalid value '" + *text + "' of " + key); }
+  return ReadResult<std::uint32_t>::FromValue(static_cast<std::uint32_t>(value));
+}
+
+/**
+ * @brief       Function to read the 6 byte EID or GID given as "00:02:36:31:00:1c"
+ */
+auto ReadIdentification(boost_tree const &tree, std::string const &key) noexcept
+    -> ReadResult<std::array<std::uint8_t, 6U>> {
+  std::array<std::uint8_t, 6U> identification{};
+  std::string text{tree.get<std::string>(key, "00:00:00:00:00:00")};
+  text.erase(std::remove(text.begin(), text.end(), ':'), text.end());
+  auto bytes{ParseHexBytes(text)};
+  if (!bytes.HasValue() || (bytes.Value().size() != identification.size())) {
+    return ReadResult<std::array<std::uint8_t, 6U>>::FromError("invalid " + key + " '" + text + "'");
+  }
+  std::copy(bytes.Value().begin(), bytes.Value().end(), identification.begin());
+  return ReadResult<std::array<std::uint8_t, 6U>>::FromValue(identification);
+}
+
+/**
+ * @brief       Function to read the ecu, elements not given are taken from the defaults
+ */
+auto ReadEcu(boost_tree const &tree, EcuConfig const &defaults) noexcept -> ReadResult<EcuConfig> {
+  EcuConfig ecu{defaults};
+  auto logical_address{ReadNumber(tree, "LogicalAddress", defaults.logical_address, 0xFFFFU)};
+  auto response_latency{ReadNumber(tree, "ResponseLatencyMs",
+                                   static_cast<std::uint32_t>(defaults.response_latency.count()),
+                                   std::numeric_limits<std::uint32_t>::max())};
+  auto pending_response_count{ReadNumber(tree, "PendingResponses", defaults.pending_response_count, 0xFFU)};
+  auto pending_response_interval{ReadNumber(tree, "PendingIntervalMs",
+                                            static_cast<std::uint32_t>(defaults.pending_response_interval.count()),
+                                            std::numeric_limits<std::uint32_t>::max())};
+  for (auto const *result: {&logical_address, &response_latency, &pending_response_count, &pending_response_interval}) {
+    if (!result->HasValue()) { return ReadResult<EcuConfig>::FromError(result->Error()); }
+  }
+  ecu.logical_address = static_cast<std::uint16_t>(logical_address.Value());
+  ecu.response_latency = std::chrono::milliseconds{response_latency.Value()};
+  ecu.pending_response_count = static_cast<std::uint8_t>(pending_response_count.Value());
+  ecu.pending_response_interval = std::chrono::milliseconds{pending_response_interval.Value()};
+
+  if (boost::optional<boost_tree const &> const dids{tree.get_child_optional("Dids")}) {
+    ecu.dids.clear();
+    for (auto const &did: *dids) {
+      auto identifier{ParseHexBytes(did.first)};
+      auto data{ParseHexBytes(did.second.data())};
+      if (!identifier.HasValue() || (identifier.Value().size() != 2U) || !data.HasValue()) {
+        return ReadResult<EcuConfig>::FromError("invalid did '" + did.first + "'");
+      }
+      ecu.dids[core_type::LoadBigEndian<std::uint16_t>(identifier.Value().data())] = std::move(data).Value();
+    }
+  }
+  if (boost::optional<boost_tree const &> const dtcs{tree.get_child_optional("Dtcs")}) {
+    ecu.dtcs.clear();
+    for (auto const &dtc: *dtcs) {
+      auto code{ReadNumber(dtc.second, "Code", 0U, 0xFFFFFFU)};
+      auto status{ReadNumber(dtc.second, "Status", 0x08U, 0xFFU)};
+      if (!code.HasValue()) { return ReadResult<EcuConfig>::FromError(code.Error()); }
+      if (!status.HasValue()) { return ReadResult<EcuConfig>::FromError(status.Error()); }
+      ecu.dtcs.push_back(DtcConfig{code.Value(), static_cast<std::uint8_t>(status.Value())});
+    }
+  }
+  return ReadResult<EcuConfig>::FromValue(std::move(ecu));
+}
+
+/**
+ * @brief       Function to read the entity and append it, repeated when "Count" is given
+ */
+auto ReadEntities(boost_tree const &tree, std::vector<EntityConfig> &entities) noexcept -> ReadResult<void> {
+  EntityConfig entity{};
+  entity.ip_address = tree.get<std::string>("IpAddress", "127.0.0.1");
+  entity.vin = tree.get<std::string>("Vin", "SIMULATEDVEHICLE0");
+  if (entity.vin.size() != kVinLength) { return ReadResult<void>::FromError("invalid vin '" + entity.vin + "'"); }
+  auto logical_address{ReadNumber(tree, "LogicalAddress", 0x1000U, 0xFFFFU)};
+  auto routing_activation_code{
+      ReadNumber(tree, "RoutingActivationCode", kDoip_RoutingActivation_ResCode_RoutingSuccessful, 0xFFU)};
+  auto count{ReadNumber(tree, "Count", 1U, 0xFFFFU)};
+  auto eid{ReadIdentification(tree, "Eid")};
+  auto gid{ReadIdentification(tree, "Gid")};
+  if (!logical_address.HasValue()) { return ReadResult<void>::FromError(logical_address.Error()); }
+  if (!routing_activation_code.HasValue()) { return ReadResult<void>::FromError(routing_activation_code.Error()); }
+  if (!count.HasValue()) { return ReadResult<void>::FromError(count.Error()); }
+  if (!eid.HasValue()) { return ReadResult<void>::FromError(eid.Error()); }
+  if (!gid.HasValue()) { return ReadResult<void>::FromError(gid.Error()); }
+  entity.logical_address = static_cast<std::uint16_t>(logical_address.Value());
+  entity.routing_activation_code = static_cast<std::uint8_t>(routing_activation_code.Value());
+  entity.eid = eid.Value();
+  entity.gid = gid.Value();
+
+  // the entity answers itself with the timing and data given at the entity, routed ecus take them as defaults
+  auto entity_ecu{ReadEcu(tree, EcuConfig{entity.logical_address, std::chrono::milliseconds{0}, 0U,
+                                          std::chrono::milliseconds{0}, {}, {}})};
+  if (!entity_ecu.HasValue()) { return ReadResult<void>::FromError(entity_ecu.Error()); }
+  entity.ecus.push_back(entity_ecu.Value());
+  if (boost::optional<boost_tree const &> const ecus{tree.get_child_optional("Ecus")}) {
+    for (auto const &ecu_tree: *ecus) {
+      auto ecu{ReadEcu(ecu_tree.second, entity_ecu.Value())};
+      if (!ecu.HasValue()) { return ReadResult<void>::FromError(ecu.Error()); }
+      entity.ecus.push_back(std::move(ecu).Value());
+    }
+  }
+
+  boost::system::error_code ec{};
+  boost::asio::ip::address_v4 const ip_address{boost::asio::ip::make_address_v4(entity.ip_address, ec)};
+  if (ec) { return ReadResult<void>::FromError("invalid ip address '" + entity.ip_address + "'"); }
+  for (std::uint32_t index{0U}; index < count.Value(); ++index) {
+    EntityConfig repeated{entity};
+    if (count.Value() > 1U) {
+      repeated.ip_address = boost::asio::ip::make_address_v4(ip_address.to_uint() + index).to_string();
+      repeated.logical_address = static_cast<std::uint16_t>(entity.logical_address + index);
+      repeated.ecus.front().logical_address = repeated.logical_address;
+      std::array<char, kVinIndexLength + 1U> vin_index{};
+      std::snprintf(vin_index.data(), vin_index.size(), "%06u", static_cast<unsigned>(index + 1U));
+      repeated.vin.replace(kVinLength - kVinIndexLength, kVinIndexLength, vin_index.data());
+      // the last two bytes of the EID count up
+      core_type::StoreBigEndian(
+          &repeated.eid[4U],
+          static_cast<std::uint16_t>(core_type::LoadBigEndian<std::uint16_t>(&entity.eid[4U]) + index));
+    }
+    entities.push_back(std::move(repeated));
+  }
+  return ReadResult<void>::FromValue();
+}
+
+}  // namespace
+
+auto ReadSimulatorConfig(boost_support::parser::boost_tree const &config_tree) noexcept
+    -> core_type::Result<SimulatorConfig, std::string> {
+  using Result = core_type::Result<SimulatorConfig, std::string>;
+  try {
+    SimulatorConfig config{};
+    auto port{ReadNumber(config_tree, "Port", kDoipPort, 0xFFFFU)};
+    auto announcement_count{ReadNumber(config_tree, "Announcement.Count", 3U, 0xFFU)};
+    auto announcement_interval{
+        ReadNumber(config_tree, "Announcement.IntervalMs", 500U, std::numeric_limits<std::uint32_t>::max())};
+    if (!port.HasValue()) { return Result::FromError(port.Error()); }
+    if (!announcement_count.HasValue()) { return Result::FromError(announcement_count.Error()); }
+    if (!announcement_interval.HasValue()) { return Result::FromError(announcement_interval.Error()); }
+    config.port = static_cast<std::uint16_t>(port.Value());
+    config.announcement_address = config_tree.get<std::string>("Announcement.Address", "255.255.255.255");
+    config.announcement_count = static_cast<std::uint8_t>(announcement_count.Value());
+    config.announcement_interval = std::chrono::milliseconds{announcement_interval.Value()};
+    config.broadcast_listener = config_tree.get<bool>("BroadcastListener", true);
+    if (boost::optional<boost_tree const &> const entities{config_tree.get_child_optional("Entities")}) {
+      for (auto const &entity: *entities) {
+        auto result{ReadEntities(entity.second, config.entities)};
+        if (!result.HasValue()) { return Result::FromError(result.Error()); }
+      }
+    }
+    if (config.entities.empty()) { return Result::FromError("no entity configured"); }
+    return Result::FromValue(std::move(config));
+  } catch (boost::property_tree::ptree_error const &error) {
+    return Result::FromError(error.what());
+  }
+}
+
+auto ParseHexBytes(std::string_view hex_string) noexcept -> core_type::Result<std::vector<std::uint8_t>, std::string> {
+  using Result = core_type::Result<std::vector<std::uint8_t>, std::string>;
+  std::vector<std::uint8_t> bytes{};
+  int high_digit{-1};
+  for (char const character: hex_string) {
+    if (character == ' ') { continue; }
+    int const digit{GetHexDigit(character)};
+    if (digit < 0) { return Result::FromError("invalid hex digit in '" + std::string{hex_string} + "'"); }
+    if (high_digit < 0) {
+      high_digit = digit;
+    } else {
+      bytes.push_back(static_cast<std::uint8_t>((high_digit << 4U) | digit));
+      high_digit = -1;
+    }
+  }
+  if (high_digit >= 0) { return Result::FromError("odd number of hex digits in '" + std::string{hex_string} + "'"); }
+  return Result::FromValue(std::move(bytes));
+}
+
+}  // namespace doip_simulator
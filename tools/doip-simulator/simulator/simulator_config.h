@@ -0,0 +1,170 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_CONFIG_H
+#define DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_CONFIG_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/include/result.h"
+#include "parser/json_parser.h"
+
+namespace doip_simulator {
+
+/**
+ * @brief       Diagnostic trouble code reported by an ecu
+ */
+struct DtcConfig {
+  /**
+   * @brief     The 3 byte dtc number
+   */
+  std::uint32_t code;
+
+  /**
+   * @brief     The dtc status byte
+   */
+  std::uint8_t status;
+};
+
+/**
+ * @brief       Ecu reachable through a DoIP entity, the entity itself or an ecu routed by a gateway
+ */
+struct EcuConfig {
+  /**
+   * @brief     The logical address diagnostic requests are sent to
+   */
+  std::uint16_t logical_address;
+
+  /**
+   * @brief     The delay of the first response after the diagnostic message acknowledgement
+   */
+  std::chrono::milliseconds response_latency;
+
+  /**
+   * @brief     The number of pending responses (NRC 0x78) sent before the final response
+   */
+  std::uint8_t pending_response_count;
+
+  /**
+   * @brief     The delay between the pending responses and before the final response
+   */
+  std::chrono::milliseconds pending_response_interval;
+
+  /**
+   * @brief     The data returned by ReadDataByIdentifier, by data identifier
+   */
+  std::map<std::uint16_t, std::vector<std::uint8_t>> dids;
+
+  /**
+   * @brief     The dtcs returned by ReadDTCInformation
+   */
+  std::vector<DtcConfig> dtcs;
+};
+
+/**
+ * @brief       DoIP entity, a DoIP node or a gateway routing to further ecus
+ */
+struct EntityConfig {
+  /**
+   * @brief     The ip address the entity listens on
+   */
+  std::string ip_address;
+
+  /**
+   * @brief     The logical address of entity
+   */
+  std::uint16_t logical_address;
+
+  /**
+   * @brief     The vehicle identification number of 17 characters
+   */
+  std::string vin;
+
+  /**
+   * @brief     The entity identification
+   */
+  std::array<std::uint8_t, 6U> eid;
+
+  /**
+   * @brief     The group identification
+   */
+  std::array<std::uint8_t, 6U> gid;
+
+  /**
+   * @brief     The response code sent to every routing activation request
+   */
+  std::uint8_t routing_activation_code;
+
+  /**
+   * @brief     The ecus answering diagnostic requests, the first one has the logical address of entity
+   */
+  std::vector<EcuConfig> ecus;
+};
+
+/**
+ * @brief       Configuration of the simulator
+ */
+struct SimulatorConfig {
+  /**
+   * @brief     The tcp and udp port of all entities
+   */
+  std::uint16_t port;
+
+  /**
+   * @brief     The address vehicle announcements are sent to
+   */
+  std::string announcement_address;
+
+  /**
+   * @brief     The number of vehicle announcements every entity sends in a burst
+   */
+  std::uint8_t announcement_count;
+
+  /**
+   * @brief     The delay between the vehicle announcements of a burst
+   */
+  std::chrono::milliseconds announcement_interval;
+
+  /**
+   * @brief     Whether broadcast vehicle identification requests are received on the wildcard address
+   */
+  bool broadcast_listener;
+
+  /**
+   * @brief     The simulated entities
+   */
+  std::vector<EntityConfig> entities;
+};
+
+/**
+ * @brief       Function to read the simulator configuration from the property tree
+ * @details     An entity with "Count" is repeated with consecutive ip addresses, logical addresses, VIN and EID.
+ *              Entities without "Ecus" answer diagnostic requests themselves.
+ * @param[in]   config_tree
+ *              The tree read from the json configuration file
+ * @return      The configuration on success, otherwise the description of the invalid element
+ */
+auto ReadSimulatorConfig(boost_support::parser::boost_tree const &config_tree) noexcept
+    -> core_type::Result<SimulatorConfig, std::string>;
+
+/**
+ * @brief       Function to convert hex digits into bytes, spaces between the bytes are ignored
+ * @param[in]   hex_string
+ *              The hex digits, e.g. "F1 90" or "F190"
+ * @return      The bytes on success, otherwise an error when a digit is invalid or the digit count is odd
+ */
+auto ParseHexBytes(std::string_view hex_string) noexcept -> core_type::Result<std::vector<std::uint8_t>, std::string>;
+
+}  // namespace doip_simulator
+
+#endif  // DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_CONFIG_H
@@ -0,0 +1,83 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_STATISTICS_H
+#define DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_STATISTICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace doip_simulator {
+
+/**
+ * @brief       Counters of all entities, updated from any thread of the simulator
+ */
+struct SimulatorStatistics {
+  /**
+   * @brief     The accepted tcp connections
+   */
+  std::atomic<std::uint64_t> connections{0U};
+
+  /**
+   * @brief     The routing activation responses sent
+   */
+  std::atomic<std::uint64_t> routing_activations{0U};
+
+  /**
+   * @brief     The diagnostic requests received
+   */
+  std::atomic<std::uint64_t> diagnostic_requests{0U};
+
+  /**
+   * @brief     The diagnostic messages negatively acknowledged
+   */
+  std::atomic<std::uint64_t> negative_acknowledgements{0U};
+
+  /**
+   * @brief     The pending responses (NRC 0x78) sent
+   */
+  std::atomic<std::uint64_t> pending_responses{0U};
+
+  /**
+   * @brief     The final diagnostic responses sent
+   */
+  std::atomic<std::uint64_t> diagnostic_responses{0U};
+
+  /**
+   * @brief     The vehicle identification responses sent
+   */
+  std::atomic<std::uint64_t> vehicle_identification_responses{0U};
+
+  /**
+   * @brief     The vehicle announcements sent
+   */
+  std::atomic<std::uint64_t> announcements{0U};
+};
+
+/**
+ * @brief       Function to write the counters as json object
+ * @param[in]   stream
+ *              The stream written to
+ * @param[in]   statistics
+ *              The counters
+ * @return      The stream
+ */
+inline auto operator<<(std::ostream &stream, SimulatorStatistics const &statistics) -> std::ostream & {
+  return stream << "{\"connections\": " << statistics.connections.load()
+                << ", \"routing_activations\": " << statistics.routing_activations.load()
+                << ", \"diagnostic_requests\": " << statistics.diagnostic_requests.load()
+                << ", \"negative_acknowledgements\": " << statistics.negative_acknowledgements.load()
+                << ", \"pending_responses\": " << statistics.pending_responses.load()
+                << ", \"diagnostic_responses\": " << statistics.diagnostic_responses.load()
+                << ", \"vehicle_identification_responses\": " << statistics.vehicle_identification_responses.load()
+                << ", \"announcements\": " << statistics.announcements.load() << "}";
+}
+
+}  // namespace doip_simulator
+
+#endif  // DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_SIMULATOR_STATISTICS_H
@@ -0,0 +1,168 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "simulator/uds_responder.h"
+
+#include <utility>
+
+#include "core/include/endian_codec.h"
+
+namespace doip_simulator {
+namespace {
+
+/**
+ * @brief       Uds service identifiers
+ */
+constexpr std::uint8_t kDiagnosticSessionControl{0x10U};
+constexpr std::uint8_t kEcuReset{0x11U};
+constexpr std::uint8_t kReadDtcInformation{0x19U};
+constexpr std::uint8_t kReadDataByIdentifier{0x22U};
+constexpr std::uint8_t kTesterPresent{0x3EU};
+constexpr std::uint8_t kNegativeResponse{0x7FU};
+
+/**
+ * @brief       Offset of the positive response service identifier
+ */
+constexpr std::uint8_t kPositiveResponseOffset{0x40U};
+
+/**
+ * @brief       Bit of the sub-function suppressing the positive response
+ */
+constexpr std::uint8_t kSuppressPositiveResponse{0x80U};
+
+/**
+ * @brief       Negative response codes
+ */
+constexpr std::uint8_t kServiceNotSupported{0x11U};
+constexpr std::uint8_t kSubFunctionNotSupported{0x12U};
+constexpr std::uint8_t kIncorrectMessageLength{0x13U};
+constexpr std::uint8_t kRequestOutOfRange{0x31U};
+constexpr std::uint8_t kResponsePending{0x78U};
+
+/**
+ * @brief       ReadDTCInformation sub-functions
+ */
+constexpr std::uint8_t kReportNumberOfDtcByStatusMask{0x01U};
+constexpr std::uint8_t kReportDtcByStatusMask{0x02U};
+
+/**
+ * @brief       Status bits supported by the simulated ecus
+ */
+constexpr std::uint8_t kDtcStatusAvailabilityMask{0xFFU};
+
+/**
+ * @brief       Format identifier of the dtc count, ISO 14229-1 dtc format
+ */
+constexpr std::uint8_t kDtcFormatIdentifier{0x01U};
+
+/**
+ * @brief       Data identifier of VIN
+ */
+constexpr std::uint16_t kVinDataIdentifier{0xF190U};
+
+/**
+ * @brief       Function to create a negative response
+ */
+auto CreateNegativeResponse(std::uint8_t service_id, std::uint8_t response_code) -> std::vector<std::uint8_t> {
+  return std::vector<std::uint8_t>{kNegativeResponse, service_id, response_code};
+}
+
+}  // namespace
+
+UdsResponder::UdsResponder(EcuConfig const &ecu, std::string_view vin) noexcept : ecu_{ecu}, vin_{vin} {}
+
+auto UdsResponder::Respond(core_type::Span<std::uint8_t const> request) const -> std::vector<ScheduledResponse> {
+  std::vector<ScheduledResponse> responses{};
+  std::vector<std::uint8_t> final_response{CreateFinalResponse(request)};
+  if (final_response.empty()) { return responses; }
+  std::chrono::milliseconds delay{ecu_.response_latency};
+  // tester present keeps the session alive, it is always answered at once
+  if (request[0U] != kTesterPresent) {
+    for (std::uint8_t count{0U}; count < ecu_.pending_response_count; ++count) {
+      responses.push_back(ScheduledResponse{delay, CreateNegativeResponse(request[0U], kResponsePending)});
+      delay = ecu_.pending_response_interval;
+    }
+  }
+  responses.push_back(ScheduledResponse{delay, std::move(final_response)});
+  return responses;
+}
+
+auto UdsResponder::CreateFinalResponse(core_type::Span<std::uint8_t const> request) const
+    -> std::vector<std::uint8_t> {
+  if (request.empty()) { return {}; }
+  std::uint8_t const service_id{request[0U]};
+  std::uint8_t const positive_service_id{static_cast<std::uint8_t>(service_id + kPositiveResponseOffset)};
+  switch (service_id) {
+    case kDiagnosticSessionControl:
+    case kEcuReset:
+    case kTesterPresent: {
+      if (request.size() != 2U) { return CreateNegativeResponse(service_id, kIncorrectMessageLength); }
+      if ((request[1U] & kSuppressPositiveResponse) != 0U) { return {}; }
+      std::vector<std::uint8_t> response{positive_service_id, request[1U]};
+      // session parameter record with P2 50 ms and P2* 5000 ms
+      if (service_id == kDiagnosticSessionControl) { response.insert(response.end(), {0x00U, 0x32U, 0x01U, 0xF4U}); }
+      return response;
+    }
+    case kReadDataByIdentifier:
+      return ReadDataByIdentifier(request);
+    case kReadDtcInformation:
+      return ReadDtcInformation(request);
+    default:
+      return CreateNegativeResponse(service_id, kServiceNotSupported);
+  }
+}
+
+auto UdsResponder::ReadDataByIdentifier(core_type::Span<std::uint8_t const> request) const
+    -> std::vector<std::uint8_t> {
+  if ((request.size() < 3U) || ((request.size() % 2U) == 0U)) {
+    return CreateNegativeResponse(kReadDataByIdentifier, kIncorrectMessageLength);
+  }
+  std::vector<std::uint8_t> response{static_cast<std::uint8_t>(kReadDataByIdentifier + kPositiveResponseOffset)};
+  for (std::size_t offset{1U}; offset < request.size(); offset += 2U) {
+    std::uint16_t const identifier{core_type::LoadBigEndian<std::uint16_t>(&request[offset])};
+    core_type::AppendBigEndian(response, identifier);
+    auto const did{ecu_.dids.find(identifier)};
+    if (did != ecu_.dids.end()) {
+      response.insert(response.end(), did->second.begin(), did->second.end());
+    } else if (identifier == kVinDataIdentifier) {
+      response.insert(response.end(), vin_.begin(), vin_.end());
+    } else {
+      return CreateNegativeResponse(kReadDataByIdentifier, kRequestOutOfRange);
+    }
+  }
+  return response;
+}
+
+auto UdsResponder::ReadDtcInformation(core_type::Span<std::uint8_t const> request) const
+    -> std::vector<std::uint8_t> {
+  if (request.size() < 2U) { return CreateNegativeResponse(kReadDtcInformation, kIncorrectMessageLength); }
+  std::uint8_t const sub_function{static_cast<std::uint8_t>(request[1U] & ~kSuppressPositiveResponse)};
+  if ((sub_function != kReportNumberOfDtcByStatusMask) && (sub_function != kReportDtcByStatusMask)) {
+    return CreateNegativeResponse(kReadDtcInformation, kSubFunctionNotSupported);
+  }
+  if (request.size() != 3U) { return CreateNegativeResponse(kReadDtcInformation, kIncorrectMessageLength); }
+  if ((request[1U] & kSuppressPositiveResponse) != 0U) { return {}; }
+  std::uint8_t const status_mask{request[2U]};
+  std::vector<std::uint8_t> response{static_cast<std::uint8_t>(kReadDtcInformation + kPositiveResponseOffset),
+                                     sub_function, kDtcStatusAvailabilityMask};
+  std::uint16_t dtc_count{0U};
+  for (DtcConfig const &dtc: ecu_.dtcs) {
+    if ((dtc.status & status_mask) == 0U) { continue; }
+    ++dtc_count;
+    if (sub_function == kReportDtcByStatusMask) {
+      // the 3 byte DTC followed by its status byte is appended as one 32 bit field
+      core_type::AppendBigEndian(response, static_cast<std::uint32_t>((dtc.code << 8U) | dtc.status));
+    }
+  }
+  if (sub_function == kReportNumberOfDtcByStatusMask) {
+    response.push_back(kDtcFormatIdentifier);
+    core_type::AppendBigEndian(response, dtc_count);
+  }
+  return response;
+}
+
+}  // namespace doip_simulator
@@ -0,0 +1,96 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_UDS_RESPONDER_H
+#define DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_UDS_RESPONDER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "core/include/span.h"
+#include "simulator/simulator_config.h"
+
+namespace doip_simulator {
+
+/**
+ * @brief       Uds response sent after a delay
+ */
+struct ScheduledResponse {
+  /**
+   * @brief     The delay after the previous response or the acknowledgement of request
+   */
+  std::chrono::milliseconds delay;
+
+  /**
+   * @brief     The uds payload
+   */
+  std::vector<std::uint8_t> payload;
+};
+
+/**
+ * @brief       Class answering uds requests of an ecu with the scripted data and timing
+ * @details     Supported are DiagnosticSessionControl, EcuReset, TesterPresent, ReadDataByIdentifier and
+ *              ReadDTCInformation with the sub-functions 0x01 and 0x02, other services are answered with NRC 0x11.
+ *              DID 0xF190 returns the VIN of entity unless it is scripted.
+ */
+class UdsResponder final {
+ public:
+  /**
+   * @brief         Construct an instance of UdsResponder
+   * @param[in]     ecu
+   *                The ecu configuration, it must outlive the responder
+   * @param[in]     vin
+   *                The VIN of entity the ecu belongs to, it must outlive the responder
+   */
+  UdsResponder(EcuConfig const &ecu, std::string_view vin) noexcept;
+
+  /**
+   * @brief         Function to get the responses to the request
+   * @param[in]     request
+   *                The uds request
+   * @return        The pending responses followed by the final response, empty when the response is suppressed
+   */
+  auto Respond(core_type::Span<std::uint8_t const> request) const -> std::vector<ScheduledResponse>;
+
+  /**
+   * @brief         Function to get the logical address of ecu
+   * @return        The logical address
+   */
+  auto GetLogicalAddress() const noexcept -> std::uint16_t { return ecu_.logical_address; }
+
+ private:
+  /**
+   * @brief         Function to get the final response to the request, empty when the response is suppressed
+   */
+  auto CreateFinalResponse(core_type::Span<std::uint8_t const> request) const -> std::vector<std::uint8_t>;
+
+  /**
+   * @brief         Function to get the response to ReadDataByIdentifier
+   */
+  auto ReadDataByIdentifier(core_type::Span<std::uint8_t const> request) const -> std::vector<std::uint8_t>;
+
+  /**
+   * @brief         Function to get the response to ReadDTCInformation
+   */
+  auto ReadDtcInformation(core_type::Span<std::uint8_t const> request) const -> std::vector<std::uint8_t>;
+
+  /**
+   * @brief         The ecu configuration
+   */
+  EcuConfig const &ecu_;
+
+  /**
+   * @brief         The VIN of entity
+   */
+  std::string_view vin_;
+};
+
+}  // namespace doip_simulator
+
+#endif  // DIAG_CLIENT_TOOLS_DOIP_SIMULATOR_SIMULATOR_UDS_RESPONDER_H